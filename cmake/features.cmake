@@ -22,6 +22,9 @@ Supported values:\
  FIRST_INFERENCE - enable only first inference time counters" ALL
                ALLOWED_VALUES ALL FIRST_INFERENCE)
 
+ie_option (ENABLE_PROFILING_CHROME_TRACE "Build with the built-in Chrome trace collector for ITT annotations.\
+The collector is enabled at runtime through OPENVINO_CHROME_TRACE environment variable or TRACE_FILE core config key" OFF)
+
 ie_option (ENABLE_PROFILING_FIRST_INFERENCE "Build with ITT tracing of first inference time." ON)
 
 ie_option(ENABLE_TEMPLATE_PLUGIN "Register template plugin into plugins.xml" OFF)
@@ -0,0 +1,273 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header for advanced hardware related properties for CPU plugin
+ *        To use in SetConfig(), LoadNetwork() and GetMetric() methods of plugins
+ *
+ * @file cpu_config.hpp
+ */
+#pragma once
+
+#include "ie_plugin_config.hpp"
+
+namespace InferenceEngine {
+
+namespace Metrics {
+
+/**
+ * @def CPU_METRIC_KEY(name)
+ * @brief shortcut for defining CPU plugin metrics
+ */
+#define CPU_METRIC_KEY(name) METRIC_KEY(CPU_##name)
+#define DECLARE_CPU_METRIC_KEY(name, ...) DECLARE_METRIC_KEY(CPU_##name, __VA_ARGS__)
+
+/**
+ * @brief Executable network metric which returns the number of inferences that found a compiled graph for their input shapes
+ */
+DECLARE_CPU_METRIC_KEY(SHAPE_CACHE_HITS, uint64_t);
+
+/**
+ * @brief Executable network metric which returns the number of inferences that required a graph compilation for their input shapes
+ */
+DECLARE_CPU_METRIC_KEY(SHAPE_CACHE_MISSES, uint64_t);
+
+/**
+ * @brief Executable network metric which returns the number of reorders executed on each inference if each node
+ *        selects its memory layout on its own, i.e. the CPU_REORDER_COUNT of the network compiled with
+ *        CPU_LAYOUT_GREEDY. If CPU_LAYOUT_GLOBAL is used, the network is compiled with the greedy layouts once more
+ *        on the first query of the metric.
+ */
+DECLARE_CPU_METRIC_KEY(GREEDY_REORDER_COUNT, uint64_t);
+
+/**
+ * @brief Executable network metric which returns the number of bytes reordered per inference if each node selects
+ *        its memory layout on its own
+ */
+DECLARE_CPU_METRIC_KEY(GREEDY_REORDER_BYTES, uint64_t);
+
+/**
+ * @brief Executable network metric which returns the number of reorders executed on each inference, i.e. the reorder
+ *        nodes of the compiled graph except the constant ones
+ */
+DECLARE_CPU_METRIC_KEY(REORDER_COUNT, uint64_t);
+
+/**
+ * @brief Executable network metric which returns the number of bytes reordered per inference by the reorders counted
+ *        in CPU_REORDER_COUNT
+ */
+DECLARE_CPU_METRIC_KEY(REORDER_BYTES, uint64_t);
+
+/**
+ * @brief Executable network metric which returns the configuration selected by CPU_THROUGHPUT_AUTO_TUNE as
+ *        std::map<std::string, std::string> with CPU_THROUGHPUT_STREAMS and CPU_THREADS_NUM keys. The map can be
+ *        passed to LoadNetwork() to load the network with the same configuration without tuning.
+ */
+DECLARE_CPU_METRIC_KEY(THROUGHPUT_AUTO_TUNE_RESULT, std::map<std::string, std::string>);
+
+/**
+ * @brief Executable network metric which returns the average number of requests inferred together with
+ *        CPU_BATCHING_MAX_BATCH, including the requests inferred alone
+ */
+DECLARE_CPU_METRIC_KEY(BATCHING_AVERAGE_BATCH_SIZE, float);
+
+/**
+ * @brief Executable network metric which returns the average time in milliseconds the asynchronous requests wait
+ *        from the start to the inference of their batch with CPU_BATCHING_MAX_BATCH
+ */
+DECLARE_CPU_METRIC_KEY(BATCHING_AVERAGE_QUEUE_TIME, float);
+
+/**
+ * @brief Executable network metric which returns the maximal time in milliseconds an asynchronous request waited
+ *        from the start to the inference of its batch with CPU_BATCHING_MAX_BATCH
+ */
+DECLARE_CPU_METRIC_KEY(BATCHING_MAX_QUEUE_TIME, float);
+
+/**
+ * @brief Executable network metric which returns the average time in milliseconds from the start of the inference
+ *        to its completion of the CPU_PRIORITY_NORMAL requests run by the streams executor of the network
+ */
+DECLARE_CPU_METRIC_KEY(NORMAL_PRIORITY_AVERAGE_LATENCY, float);
+
+/**
+ * @brief Executable network metric which returns the maximal time in milliseconds from the start of the inference
+ *        to its completion of the CPU_PRIORITY_NORMAL requests run by the streams executor of the network
+ */
+DECLARE_CPU_METRIC_KEY(NORMAL_PRIORITY_MAX_LATENCY, float);
+
+/**
+ * @brief Executable network metric which returns the average time in milliseconds from the start of the inference
+ *        to its completion of the CPU_PRIORITY_HIGH requests run by the streams executor of the network
+ */
+DECLARE_CPU_METRIC_KEY(HIGH_PRIORITY_AVERAGE_LATENCY, float);
+
+/**
+ * @brief Executable network metric which returns the maximal time in milliseconds from the start of the inference
+ *        to its completion of the CPU_PRIORITY_HIGH requests run by the streams executor of the network
+ */
+DECLARE_CPU_METRIC_KEY(HIGH_PRIORITY_MAX_LATENCY, float);
+
+}  // namespace Metrics
+
+/**
+ * @brief CPU plugin configuration
+ */
+namespace CPUConfigParams {
+
+/**
+ * @brief shortcut for defining configuration keys
+ */
+#define CPU_CONFIG_KEY(name) InferenceEngine::CPUConfigParams::_CONFIG_KEY(CPU_##name)
+#define DECLARE_CPU_CONFIG_KEY(name) DECLARE_CONFIG_KEY(CPU_##name)
+#define DECLARE_CPU_CONFIG_VALUE(name) DECLARE_CONFIG_VALUE(CPU_##name)
+
+/**
+ * @brief The number of graphs compiled for non-default input shapes which are kept per stream.
+ *
+ * If the value is positive, the input blobs of an infer request may have shapes other than the network ones (the rank
+ * and the precision must stay the same). The network is reshaped and compiled for such shapes on the first request
+ * and the result is kept in the least recently used cache, so the following requests with the same shapes reuse it.
+ * The weights and the constants of the same values are shared between the compiled graphs, so their values are hashed
+ * while the network is loaded. Output blobs are reallocated to the actual output shapes.
+ * 0 (default) disables the cache, input blobs must match the network shapes.
+ */
+DECLARE_CPU_CONFIG_KEY(SHAPE_CACHE_SIZE);
+
+/**
+ * @brief The list of input shapes to compile graphs for during the network loading.
+ *
+ * Shape sets are separated with ';', inputs in a set are separated with ',' and each of them is written as
+ * "input_name:1x3x224x224". The input name may be omitted if the network has only one input, e.g. "1x128;1x256".
+ * Requests are dispatched to the graph compiled for exactly the same shapes, no padding is applied.
+ * If CPU_SHAPE_CACHE_SIZE is less than the number of shape sets, the cache size is extended to hold all of them.
+ */
+DECLARE_CPU_CONFIG_KEY(SHAPE_BUCKETS);
+
+/**
+ * @brief The way memory layouts of the nodes are chosen.
+ *
+ * CPU_LAYOUT_GREEDY (default): each node selects its layout following the layouts of its parents.
+ * CPU_LAYOUT_GLOBAL: the layouts selected by the nodes are refined for the whole graph to minimize the amount of data
+ * reordered between the nodes. The kernel implementation selected by each node is kept.
+ */
+DECLARE_CPU_CONFIG_KEY(LAYOUT_ASSIGNMENT);
+DECLARE_CPU_CONFIG_VALUE(LAYOUT_GREEDY);
+DECLARE_CPU_CONFIG_VALUE(LAYOUT_GLOBAL);
+
+/**
+ * @brief The way the memory of the graph activations and the shared weights is allocated.
+ *
+ * CPU_ARENA_DEFAULT (default): the memory is allocated by the primitives library.
+ * CPU_ARENA_NUMA: the memory is reserved from the system bound to the NUMA node of the stream
+ * which creates the graph and is initialized by the stream thread.
+ * CPU_ARENA_NUMA_THP: the same as CPU_ARENA_NUMA, the memory is advised to be backed by transparent huge pages.
+ * CPU_ARENA_NUMA_HUGETLB: the same as CPU_ARENA_NUMA, the memory is reserved from the explicit huge pages pool.
+ * Falls back to the transparent huge pages if the pool is exhausted.
+ */
+DECLARE_CPU_CONFIG_KEY(MEMORY_ARENA);
+DECLARE_CPU_CONFIG_VALUE(ARENA_DEFAULT);
+DECLARE_CPU_CONFIG_VALUE(ARENA_NUMA);
+DECLARE_CPU_CONFIG_VALUE(ARENA_NUMA_THP);
+DECLARE_CPU_CONFIG_VALUE(ARENA_NUMA_HUGETLB);
+
+/**
+ * @brief Enables code generation for elementwise subgraphs.
+ *
+ * NO (default): elementwise operations are executed by the nodes they are fused into.
+ * YES: chains of elementwise operations, including the ones with several outputs, are collapsed into subgraphs
+ * and a jit kernel processing all the operations in a single pass over the memory is generated for each subgraph.
+ * Requires AVX2, the subgraphs which can't be generated are executed by the reference implementation.
+ */
+DECLARE_CPU_CONFIG_KEY(SNIPPETS);
+
+/**
+ * @brief The minimal ratio of zero blocks in the constant weights of a FullyConnected layer to execute it with
+ * the sparse weights kernel, a floating point number in the [0, 1] range.
+ *
+ * A block is formed by 16 output channels at one input channel, the kernel skips the blocks consisting of zeros.
+ * The layers executed with the sparse weights have "sparse" in the implementation type of the execution graph.
+ * 0 (default) disables the sparse weights execution. Requires AVX2, FP32, BF16 and INT8 layers are supported.
+ */
+DECLARE_CPU_CONFIG_KEY(SPARSE_WEIGHTS_THRESHOLD);
+
+/**
+ * @brief Keeps the FP16 and BF16 constant weights of FullyConnected layers compressed in memory.
+ *
+ * NO (default): the weights are converted to FP32 at the network loading.
+ * YES: the weights of the MatMul operations which are converted to FullyConnected layers stay in the original
+ * precision and are widened to FP32 inside the kernel, the accumulation is done in FP32. It halves the memory
+ * taken by the weights at the cost of the conversion. Requires AVX2, the layers with the compressed weights
+ * report the memory taken by the weights in the "weightsBytes" field of the execution graph.
+ * The U4 and I4 weights decompressed by Convert, optional Subtract and Multiply by the scales of the output channels
+ * or of the groups of input channels are kept packed as well, the number of the input channels in a group must
+ * be a multiple of 32.
+ */
+DECLARE_CPU_CONFIG_KEY(COMPRESSED_WEIGHTS);
+
+/**
+ * @brief Selects the number of streams and threads by running the network on the machine during the loading.
+ *
+ * NO (default): CPU_THROUGHPUT_STREAMS and CPU_THREADS_NUM are used as they are set.
+ * YES: the network is loaded with the numbers of streams which are powers of two up to the number of cores, the number
+ * of cores and the number of NUMA nodes, with and without the hyper-threading. Each configuration runs as many
+ * requests as OPTIMAL_NUMBER_OF_INFER_REQUESTS reports for half a second with zero inputs, and the one with the highest
+ * throughput under CPU_THROUGHPUT_AUTO_TUNE_LATENCY_LIMIT is kept. The selection is reported by the
+ * CPU_THROUGHPUT_AUTO_TUNE_RESULT metric. Not applied with KEY_EXCLUSIVE_ASYNC_REQUESTS and CPU_REQUEST_PRIORITY.
+ */
+DECLARE_CPU_CONFIG_KEY(THROUGHPUT_AUTO_TUNE);
+
+/**
+ * @brief The limit of the average inference latency in milliseconds for CPU_THROUGHPUT_AUTO_TUNE, a non-negative
+ * floating point number. If no configuration fits the limit, the one with the lowest latency is selected.
+ * 0 (default) means no limit.
+ */
+DECLARE_CPU_CONFIG_KEY(THROUGHPUT_AUTO_TUNE_LATENCY_LIMIT);
+
+/**
+ * @brief The maximal number of asynchronous requests which are inferred together as one batch, a non-negative integer.
+ *
+ * The requests started concurrently are collected until their number reaches the limit or the first of them waits
+ * for CPU_BATCHING_TIMEOUT. Their inputs are copied into one batch along the first dimension, padded with zeros up to
+ * the nearest power of two or the limit, the network compiled for that batch is inferred and the outputs are copied
+ * back to the requests, which are completed and call their callbacks individually. The batched networks are compiled
+ * at the loading and kept in the CPU_SHAPE_CACHE_SIZE cache. The requests with blobs other than the network ones or
+ * with preprocessing, as well as the synchronous ones, are inferred alone. The queueing is reported by
+ * the CPU_BATCHING_* metrics. Networks with memory states and dynamic batch are not supported.
+ * 0 (default) and 1 disable the batching.
+ */
+DECLARE_CPU_CONFIG_KEY(BATCHING_MAX_BATCH);
+
+/**
+ * @brief The time in microseconds the first collected request waits for others with CPU_BATCHING_MAX_BATCH,
+ * a non-negative integer. 1000 by default.
+ */
+DECLARE_CPU_CONFIG_KEY(BATCHING_TIMEOUT);
+
+/**
+ * @brief The priority of the asynchronous requests of the network.
+ *
+ * CPU_PRIORITY_NONE (default): the network has its own streams executor.
+ * CPU_PRIORITY_NORMAL, CPU_PRIORITY_HIGH: the networks with the same streams configuration which set the priority
+ * share one streams executor. The requests of the CPU_PRIORITY_HIGH networks are taken by the streams before the
+ * CPU_PRIORITY_NORMAL ones. With CPU_HIGH_PRIORITY_STREAMS the CPU_PRIORITY_NORMAL requests running on the cores of
+ * the high priority streams are paused between the nodes while high priority requests are queued or inferred.
+ * The latencies of both priorities are reported by the CPU_*_PRIORITY_*_LATENCY metrics.
+ */
+DECLARE_CPU_CONFIG_KEY(REQUEST_PRIORITY);
+DECLARE_CPU_CONFIG_VALUE(PRIORITY_NONE);
+DECLARE_CPU_CONFIG_VALUE(PRIORITY_NORMAL);
+DECLARE_CPU_CONFIG_VALUE(PRIORITY_HIGH);
+
+/**
+ * @brief The number of additional streams which infer only the CPU_PRIORITY_HIGH requests, a non-negative integer.
+ *
+ * The streams are bound to the cores of the first CPU_THROUGHPUT_STREAMS streams. Used with CPU_REQUEST_PRIORITY
+ * only, the networks sharing the streams executor must set the same value. 0 (default): no streams are reserved,
+ * the high priority requests are only inferred before the normal ones.
+ */
+DECLARE_CPU_CONFIG_KEY(HIGH_PRIORITY_STREAMS);
+
+}  // namespace CPUConfigParams
+
+}  // namespace InferenceEngine
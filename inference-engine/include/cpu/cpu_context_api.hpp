@@ -0,0 +1,205 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header that defines wrappers for the CPU plugin remote context and the blobs
+ *        backed by shared memory (POSIX shared memory objects or memfd file descriptors).
+ *
+ * Such blobs can be filled by another process mapping the same memory and are used by the CPU infer requests
+ * in place, without copying, if their precision and layout match the network ones.
+ *
+ * @file cpu_context_api.hpp
+ */
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "ie_remote_context.hpp"
+#include "ie_core.hpp"
+
+namespace InferenceEngine {
+
+namespace CPUContextParams {
+
+/**
+ * @def CPU_PARAM_KEY(name)
+ * @brief Shortcut for defining CPU plugin context and blob parameter keys
+ */
+#define CPU_PARAM_KEY(name) CPUContextParams::PARAM_##name
+
+/**
+ * @def CPU_PARAM_VALUE(name)
+ * @brief Shortcut for defining CPU plugin context and blob parameter values
+ */
+#define CPU_PARAM_VALUE(name) CPUContextParams::name
+
+/**
+ * @def DECLARE_CPU_PARAM_VALUE(name)
+ * @brief Shortcut for defining possible values for object parameter keys
+ */
+#define DECLARE_CPU_PARAM_VALUE(name) static constexpr auto name = #name
+
+/**
+ * @def DECLARE_CPU_PARAM_KEY(name, ...)
+ * @brief Shortcut for defining object parameter keys
+ */
+#define DECLARE_CPU_PARAM_KEY(name, ...) static constexpr auto PARAM_##name = #name
+
+/**
+ * @brief Context type: the only supported one is SHARED_MEMORY
+ */
+DECLARE_CPU_PARAM_KEY(CONTEXT_TYPE, std::string);
+DECLARE_CPU_PARAM_VALUE(SHARED_MEMORY);
+
+/**
+ * @brief Type of the memory backing a blob.
+ * SHM: POSIX shared memory object opened (or created if absent) by the name given with SHM_NAME.
+ * The object is not unlinked by the plugin.
+ * MEMFD: a file descriptor given with MEM_FD, e.g. created with memfd_create() and received from another process.
+ * If the blob parameters are empty, a new anonymous memfd is created and can be obtained with SharedMemoryBlob::getFd().
+ */
+DECLARE_CPU_PARAM_KEY(SHARED_MEM_TYPE, std::string);
+DECLARE_CPU_PARAM_VALUE(SHM);
+DECLARE_CPU_PARAM_VALUE(MEMFD);
+
+/**
+ * @brief Name of the POSIX shared memory object
+ */
+DECLARE_CPU_PARAM_KEY(SHM_NAME, std::string);
+
+/**
+ * @brief File descriptor of the shared memory. The blob duplicates the descriptor, so the caller may close its one.
+ */
+DECLARE_CPU_PARAM_KEY(MEM_FD, int);
+
+/**
+ * @brief Offset of the blob data in the shared memory in bytes, 0 by default.
+ * The memory is grown to fit the blob if it is smaller.
+ */
+DECLARE_CPU_PARAM_KEY(MEM_OFFSET, size_t);
+
+}  // namespace CPUContextParams
+
+namespace cpu {
+
+/**
+ * @brief This class represents an abstraction for the CPU plugin remote context creating shared memory blobs.
+ * The plugin object derived from this class can be obtained either with GetContext() method of Executable network
+ * or using CreateContext() Core call.
+ */
+class SharedMemoryContext : public RemoteContext {
+public:
+    /**
+     * @brief A smart pointer to the SharedMemoryContext object
+     */
+    using Ptr = std::shared_ptr<SharedMemoryContext>;
+};
+
+/**
+ * @brief This class represents an abstraction for the CPU plugin blob backed by shared memory.
+ * The plugin object derived from this class can be obtained with CreateBlob() call.
+ */
+class SharedMemoryBlob : public RemoteBlob {
+public:
+    /**
+     * @brief A smart pointer to the SharedMemoryBlob object
+     */
+    using Ptr = std::shared_ptr<SharedMemoryBlob>;
+
+    /**
+     * @brief Creates a SharedMemoryBlob object with the specified dimensions and layout.
+     * @param tensorDesc Tensor description
+     */
+    explicit SharedMemoryBlob(const TensorDesc& tensorDesc) : RemoteBlob(tensorDesc) {}
+
+    /**
+     * @brief Returns the file descriptor of the shared memory owned by the blob.
+     * It is valid while the blob exists and can be passed to another process, e.g. over a UNIX socket.
+     */
+    int getFd() const {
+        return getParams().at(CPU_PARAM_KEY(MEM_FD)).as<int>();
+    }
+
+    /**
+     * @brief Returns the offset of the blob data in the shared memory in bytes
+     */
+    size_t getOffset() const {
+        return getParams().at(CPU_PARAM_KEY(MEM_OFFSET)).as<size_t>();
+    }
+};
+
+/**
+ * @brief Creates the CPU remote context
+ * @param core Inference Engine Core object
+ * @return A shared remote context instance
+ */
+static inline RemoteContext::Ptr make_shared_context(Core& core) {
+    ParamMap contextParams = {
+        { CPU_PARAM_KEY(CONTEXT_TYPE), CPU_PARAM_VALUE(SHARED_MEMORY) }
+    };
+    return core.CreateContext("CPU", contextParams);
+}
+
+/**
+ * @brief Creates a blob backed by a new anonymous memfd
+ * @param desc Tensor description
+ * @param ctx The CPU remote context
+ * @return A blob owning the memfd
+ */
+static inline Blob::Ptr make_shared_blob(const TensorDesc& desc, RemoteContext::Ptr ctx) {
+    auto casted = std::dynamic_pointer_cast<SharedMemoryContext>(ctx);
+    if (nullptr == casted) {
+        IE_THROW() << "Invalid remote context passed";
+    }
+    return std::dynamic_pointer_cast<Blob>(casted->CreateBlob(desc));
+}
+
+/**
+ * @brief Creates a blob over the shared memory file descriptor
+ * @param desc Tensor description
+ * @param ctx The CPU remote context
+ * @param fd The shared memory file descriptor
+ * @param offset Offset of the blob data in the shared memory in bytes
+ * @return A blob mapping the shared memory
+ */
+static inline Blob::Ptr make_shared_blob(const TensorDesc& desc, RemoteContext::Ptr ctx, int fd, size_t offset = 0) {
+    auto casted = std::dynamic_pointer_cast<SharedMemoryContext>(ctx);
+    if (nullptr == casted) {
+        IE_THROW() << "Invalid remote context passed";
+    }
+
+    ParamMap params = {
+        { CPU_PARAM_KEY(SHARED_MEM_TYPE), CPU_PARAM_VALUE(MEMFD) },
+        { CPU_PARAM_KEY(MEM_FD), fd },
+        { CPU_PARAM_KEY(MEM_OFFSET), offset }
+    };
+    return std::dynamic_pointer_cast<Blob>(casted->CreateBlob(desc, params));
+}
+
+/**
+ * @brief Creates a blob over the named POSIX shared memory object
+ * @param desc Tensor description
+ * @param ctx The CPU remote context
+ * @param shmName Name of the shared memory object, e.g. "/frames"
+ * @param offset Offset of the blob data in the shared memory in bytes
+ * @return A blob mapping the shared memory
+ */
+static inline Blob::Ptr make_shared_blob(const TensorDesc& desc, RemoteContext::Ptr ctx, const std::string& shmName, size_t offset = 0) {
+    auto casted = std::dynamic_pointer_cast<SharedMemoryContext>(ctx);
+    if (nullptr == casted) {
+        IE_THROW() << "Invalid remote context passed";
+    }
+
+    ParamMap params = {
+        { CPU_PARAM_KEY(SHARED_MEM_TYPE), CPU_PARAM_VALUE(SHM) },
+        { CPU_PARAM_KEY(SHM_NAME), shmName },
+        { CPU_PARAM_KEY(MEM_OFFSET), offset }
+    };
+    return std::dynamic_pointer_cast<Blob>(casted->CreateBlob(desc, params));
+}
+
+}  // namespace cpu
+
+}  // namespace InferenceEngine
@@ -34,5 +34,23 @@ namespace HeteroConfigParams {
  */
 DECLARE_HETERO_CONFIG_KEY(DUMP_GRAPH_DOT);
 
+/**
+ * @brief The key for enabling of pipelined execution of subgraphs.
+ * If enabled, each subgraph is executed as an independent stage with its own pool of device infer requests,
+ * and the blobs passed between subgraphs are taken from a ring of preallocated buffers. So while one infer request
+ * runs the second subgraph, the first subgraph can already be executed for another infer request.
+ * Set CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS) to CONFIG_VALUE(NO) to let the subgraphs on the same device run in parallel.
+ * This option should be used with values: CONFIG_VALUE(NO) (default) or CONFIG_VALUE(YES)
+ */
+DECLARE_HETERO_CONFIG_KEY(PIPELINE);
+
+/**
+ * @brief The number of preallocated sets of intermediate buffers, i.e. the number of infer requests which can be
+ * processed by the pipeline simultaneously. Requests started above this limit wait for a free set.
+ * This option should be used with a non-negative integer value, 0 (default) means the sum of the stage pool sizes.
+ * The pool size of each stage is the optimal number of infer requests reported by the subgraph device.
+ */
+DECLARE_HETERO_CONFIG_KEY(PIPELINE_DEPTH);
+
 }  // namespace HeteroConfigParams
 }  // namespace InferenceEngine
@@ -381,6 +381,36 @@ DECLARE_CONFIG_KEY(ENFORCE_BF16);
  */
 DECLARE_CONFIG_KEY(CACHE_DIR);
 
+/**
+ * @brief This key enables the built-in Chrome trace collector of OpenVINO profiling annotations.
+ *
+ * The value is a path to the JSON file which is written on application exit and can be opened
+ * in chrome://tracing or Perfetto UI. Empty value stops the collection.
+ * The key is supported only by the Core itself (without a device name) and only if OpenVINO
+ * is built with ENABLE_PROFILING_CHROME_TRACE option; otherwise the key is ignored.
+ *
+ * @code
+ * ie.SetConfig({{CONFIG_KEY(TRACE_FILE), "trace.json"}});
+ * @endcode
+ */
+DECLARE_CONFIG_KEY(TRACE_FILE);
+
+/**
+ * @brief This key enables mapping of the IR weights file into memory at ReadNetwork instead of reading it.
+ *
+ * The bytes of the constants are read from the file only when they are accessed, so the constants removed
+ * by transformations never take memory. The constants of the network point into the mapping, thus the weights
+ * file must not be modified, truncated or replaced in place while the network or the executable networks loaded
+ * from it are alive: the changes may become visible in the weights or terminate the process (SIGBUS on Linux
+ * if the file is truncated).
+ * The key is supported only by the Core itself (without a device name), the values are YES and NO (default).
+ *
+ * @code
+ * ie.SetConfig({{CONFIG_KEY(MMAP_WEIGHTS), CONFIG_VALUE(YES)}});
+ * @endcode
+ */
+DECLARE_CONFIG_KEY(MMAP_WEIGHTS);
+
 }  // namespace PluginConfigParams
 
 /**
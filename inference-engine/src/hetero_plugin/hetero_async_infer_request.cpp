@@ -4,6 +4,7 @@
 
 #include <utility>
 #include <memory>
+#include <threading/ie_immediate_executor.hpp>
 #include "hetero_async_infer_request.hpp"
 
 using namespace HeteroPlugin;
@@ -15,6 +16,10 @@ HeteroAsyncInferRequest::HeteroAsyncInferRequest(const IInferRequestInternal::Pt
     AsyncInferRequestThreadSafeDefault(request, taskExecutor, callbackExecutor),
     _heteroInferRequest(std::static_pointer_cast<HeteroInferRequest>(request)) {
     _pipeline.clear();
+    if (_heteroInferRequest->_pipeline) {
+        CreatePipelinedStages();
+        return;
+    }
     for (std::size_t requestId = 0; requestId < _heteroInferRequest->_inferRequests.size(); ++requestId) {
         struct RequestExecutor : ITaskExecutor {
             explicit RequestExecutor(SoIInferRequestInternal & inferRequest) : _inferRequest(inferRequest) {
@@ -43,8 +48,86 @@ HeteroAsyncInferRequest::HeteroAsyncInferRequest(const IInferRequestInternal::Pt
     }
 }
 
+void HeteroAsyncInferRequest::CreatePipelinedStages() {
+    auto pipeline = _heteroInferRequest->_pipeline;
+    _stageExceptions.resize(pipeline->_stages.size());
+    _stageRequests.resize(pipeline->_stages.size());
+
+    // Waits for a free set of intermediate buffers, so the number of requests in flight is limited by the ring size
+    struct FrameExecutor : ITaskExecutor {
+        FrameExecutor(const HeteroPipeline::Ptr& pipeline, HeteroPipeline::Frame& frame) :
+            _pipeline(pipeline), _frame(frame) {}
+        void run(Task task) override {
+            _pipeline->_frames.acquire([this, task] (HeteroPipeline::Frame frame) {
+                _frame = std::move(frame);
+                task();
+            });
+        }
+        HeteroPipeline::Ptr     _pipeline;
+        HeteroPipeline::Frame&  _frame;
+    };
+    _pipeline.emplace_back(std::make_shared<FrameExecutor>(pipeline, _frame), [] {});
+
+    // Runs the subgraph on a device request taken from the stage pool and returns the request to the pool
+    // as soon as the subgraph is executed, so the next heterogeneous request can use it for the same stage
+    for (std::size_t stageId = 0; stageId < pipeline->_stages.size(); ++stageId) {
+        struct StageExecutor : ITaskExecutor {
+            StageExecutor(HeteroAsyncInferRequest* request, std::size_t stageId) :
+                _request(request), _stageId(stageId), _pool(request->_heteroInferRequest->_pipeline->_stages[stageId].get()) {}
+            void run(Task task) override {
+                _pool->acquire([this, task] (SoIInferRequestInternal inferRequest) {
+                    _request->_stageExceptions[_stageId] = nullptr;
+                    try {
+                        _request->_heteroInferRequest->bindSubRequest(_stageId, inferRequest, *_request->_frame);
+                        // the device request is kept by the stage rather than captured by its own callback
+                        _request->_stageRequests[_stageId] = inferRequest;
+                        inferRequest->SetCallback([this, task] (std::exception_ptr exceptionPtr) {
+                            auto finishedRequest = std::move(_request->_stageRequests[_stageId]);
+                            _request->_stageExceptions[_stageId] = exceptionPtr;
+                            _request->_heteroInferRequest->storePerformanceCounts(_stageId, finishedRequest);
+                            _pool->release(std::move(finishedRequest));
+                            task();
+                        });
+                        inferRequest->StartAsync();
+                    } catch (...) {
+                        _request->_stageExceptions[_stageId] = std::current_exception();
+                        _request->_stageRequests[_stageId] = {};
+                        _pool->release(std::move(inferRequest));
+                        task();
+                    }
+                });
+            }
+            HeteroAsyncInferRequest*                _request;
+            std::size_t                             _stageId;
+            AsyncPool<SoIInferRequestInternal>*     _pool;
+        };
+
+        _pipeline.emplace_back(std::make_shared<StageExecutor>(this, stageId), [this, stageId] {
+            if (nullptr != _stageExceptions[stageId]) {
+                ReleaseFrame();
+                std::rethrow_exception(_stageExceptions[stageId]);
+            }
+        });
+    }
+    _pipeline.emplace_back(std::make_shared<ImmediateExecutor>(), [this] {
+        ReleaseFrame();
+    });
+
+    // Synchronous inference goes through the same stages
+    _syncPipeline = _pipeline;
+}
+
+void HeteroAsyncInferRequest::ReleaseFrame() {
+    if (_frame) {
+        _heteroInferRequest->_pipeline->_frames.release(std::move(_frame));
+        _frame = nullptr;
+    }
+}
+
 void HeteroAsyncInferRequest::StartAsync_ThreadUnsafe() {
-    _heteroInferRequest->updateInOutIfNeeded();
+    if (!_heteroInferRequest->_pipeline) {
+        _heteroInferRequest->updateInOutIfNeeded();
+    }
     RunFirstStage(_pipeline.begin(), _pipeline.end());
 }
 
@@ -53,8 +136,11 @@ StatusCode HeteroAsyncInferRequest::Wait(int64_t millis_timeout) {
     try {
         waitStatus = AsyncInferRequestThreadSafeDefault::Wait(millis_timeout);
     } catch(...) {
-        for (auto&& requestDesc : _heteroInferRequest->_inferRequests) {
-            requestDesc._request->Wait(InferRequest::RESULT_READY);
+        // pooled device requests are returned to the pool only after they are finished
+        if (!_heteroInferRequest->_pipeline) {
+            for (auto&& requestDesc : _heteroInferRequest->_inferRequests) {
+                requestDesc._request->Wait(InferRequest::RESULT_READY);
+            }
         }
         throw;
     }
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <exception>
 #include <vector>
 #include <memory>
 #include "cpp_interfaces/impl/ie_infer_async_request_thread_safe_default.hpp"
@@ -22,7 +23,13 @@ public:
     InferenceEngine::StatusCode Wait(int64_t millis_timeout) override;
 
 private:
+    void CreatePipelinedStages();
+    void ReleaseFrame();
+
     HeteroInferRequest::Ptr                     _heteroInferRequest;
+    HeteroPipeline::Frame                       _frame;
+    std::vector<std::exception_ptr>             _stageExceptions;
+    std::vector<InferenceEngine::SoIInferRequestInternal>   _stageRequests;
 };
 
 }  // namespace HeteroPlugin
@@ -28,6 +28,7 @@
 #include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
 #include "hetero_plugin.hpp"
 #include <ie_algorithm.hpp>
+#include <blob_factory.hpp>
 
 #include <ngraph/function.hpp>
 #include <ngraph/variant.hpp>
@@ -57,7 +58,7 @@ HeteroExecutableNetwork::HeteroExecutableNetwork(const InferenceEngine::CNNNetwo
     _config{config} {
     auto function = network.getFunction();
     IE_ASSERT(function != nullptr);
-    auto clonedFunction = ngraph::clone_function(*function);
+    auto clonedFunction = ngraph::clone_function_trusted(*function);
     auto itDumpDotFile = _config.find(HETERO_CONFIG_KEY(DUMP_GRAPH_DOT));
     bool dumpDotFile = itDumpDotFile != _config.end() ? (itDumpDotFile->second == YES) : false;
 #ifndef NDEBUG
@@ -173,7 +174,7 @@ HeteroExecutableNetwork::HeteroExecutableNetwork(const InferenceEngine::CNNNetwo
                     }
                     colorIndex++;
                 }
-            }}.run_on_function(ngraph::clone_function(*function));
+            }}.run_on_function(ngraph::clone_function_trusted(*function));
     }
 
 
@@ -419,7 +420,7 @@ HeteroExecutableNetwork::HeteroExecutableNetwork(const InferenceEngine::CNNNetwo
                         }
                     }
                 }
-            }}.run_on_function(ngraph::clone_function(*function));
+            }}.run_on_function(ngraph::clone_function_trusted(*function));
     }
     for (auto&& network : _networks) {
         auto metaDevices = _heteroPlugin->GetDevicePlugins(network._device, _config);
@@ -427,6 +428,8 @@ HeteroExecutableNetwork::HeteroExecutableNetwork(const InferenceEngine::CNNNetwo
         network._network = _heteroPlugin->GetCore()->LoadNetwork(network._clonedNetwork,
             network._device, metaDevices[network._device]);
     }
+
+    InitPipeline();
 }
 
 HeteroExecutableNetwork::HeteroExecutableNetwork(std::istream&                               heteroModel,
@@ -552,6 +555,64 @@ HeteroExecutableNetwork::HeteroExecutableNetwork(std::istream&
     this->_config = importedConfigs;
     this->_networks = std::move(descs);
     this->SetPointerToPlugin(_heteroPlugin->shared_from_this());
+
+    InitPipeline();
+}
+
+void HeteroExecutableNetwork::InitPipeline() {
+    auto itPipeline = _config.find(HETERO_CONFIG_KEY(PIPELINE));
+    if (itPipeline == _config.end() || itPipeline->second != YES) {
+        return;
+    }
+
+    int depth = 0;
+    auto itDepth = _config.find(HETERO_CONFIG_KEY(PIPELINE_DEPTH));
+    if (itDepth != _config.end()) {
+        try {
+            depth = std::stoi(itDepth->second);
+        } catch (...) {
+            depth = -1;
+        }
+        if (depth < 0) {
+            IE_THROW() << "Wrong value for property key " << HETERO_CONFIG_KEY(PIPELINE_DEPTH)
+                       << ". Expected non-negative integer value, got: " << itDepth->second;
+        }
+    }
+
+    _pipeline = std::make_shared<HeteroPipeline>();
+    auto itPerfCount = _config.find(CONFIG_KEY(PERF_COUNT));
+    _pipeline->_perfCount = itPerfCount != _config.end() && itPerfCount->second == YES;
+
+    // each subgraph gets as many device requests as its device needs to be fully loaded
+    unsigned int poolSizes = 0;
+    for (auto&& network : _networks) {
+        auto poolSize = std::max(1u,
+            network._network->GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>());
+        _pipeline->_stages.emplace_back(new AsyncPool<SoIInferRequestInternal>{});
+        for (unsigned int i = 0; i < poolSize; ++i) {
+            _pipeline->_stages.back()->release({network._network, network._network->CreateInferRequest()});
+        }
+        poolSizes += poolSize;
+    }
+
+    // the blobs passed between subgraphs, one set per request in flight
+    std::unordered_set<std::string> intermediateNames;
+    for (auto&& blobName : _blobNameMap) {
+        intermediateNames.emplace(blobName.second);
+    }
+    for (int i = 0; i < (depth == 0 ? static_cast<int>(poolSizes) : depth); ++i) {
+        auto frame = std::make_shared<BlobMap>();
+        for (auto&& network : _networks) {
+            for (auto&& outputInfo : network._network->GetOutputsInfo()) {
+                if (contains(intermediateNames, outputInfo.first)) {
+                    auto blob = make_blob_with_precision(outputInfo.second->getTensorDesc());
+                    blob->allocate();
+                    (*frame)[outputInfo.first] = blob;
+                }
+            }
+        }
+        _pipeline->_frames.release(frame);
+    }
 }
 
 void HeteroExecutableNetwork::Export(std::ostream& heteroModel) {
@@ -657,7 +718,8 @@ IInferRequestInternal::Ptr HeteroExecutableNetwork::CreateInferRequestImpl(
     return std::make_shared<HeteroInferRequest>(networkInputs,
                                                 networkOutputs,
                                                 inferRequests,
-                                                _blobNameMap);
+                                                _blobNameMap,
+                                                _pipeline);
 }
 
 IInferRequestInternal::Ptr HeteroExecutableNetwork::CreateInferRequest() {
@@ -678,6 +740,11 @@ InferenceEngine::Parameter HeteroExecutableNetwork::GetConfig(const std::string
         auto it = _config.find(name);
         IE_ASSERT(it != _config.end());
         result = it->second == YES ? true : false;
+    } else if (name == HETERO_CONFIG_KEY(PIPELINE)) {
+        result = static_cast<bool>(_pipeline);
+    } else if (name == HETERO_CONFIG_KEY(PIPELINE_DEPTH)) {
+        auto it = _config.find(name);
+        result = it != _config.end() ? it->second : std::string{"0"};
     } else {
         // find config key among plugin config keys
         for (auto&& desc : _networks) {
@@ -762,6 +829,8 @@ InferenceEngine::Parameter HeteroExecutableNetwork::GetMetric(const std::string
         std::vector<std::string> heteroConfigKeys = {
             "TARGET_FALLBACK",
             HETERO_CONFIG_KEY(DUMP_GRAPH_DOT),
+            HETERO_CONFIG_KEY(PIPELINE),
+            HETERO_CONFIG_KEY(PIPELINE_DEPTH),
             CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS)
         };
 
@@ -21,6 +21,7 @@
 #include "hetero_infer_request.hpp"
 #include "ie_icore.hpp"
 #include "hetero_async_infer_request.hpp"
+#include "hetero_pipeline.hpp"
 
 namespace HeteroPlugin {
 
@@ -61,6 +62,7 @@ public:
 private:
     void InitCNNImpl(const InferenceEngine::CNNNetwork&    network);
     void InitNgraph(const InferenceEngine::CNNNetwork&     network);
+    void InitPipeline();
 
     struct NetworkDesc {
         std::string                                   _device;
@@ -73,6 +75,7 @@ private:
     std::string                                  _name;
     std::map<std::string, std::string>           _config;
     std::unordered_map<std::string, std::string> _blobNameMap;
+    HeteroPipeline::Ptr                          _pipeline;
 };
 
 }  // namespace HeteroPlugin
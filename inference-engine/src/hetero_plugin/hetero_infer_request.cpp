@@ -8,6 +8,7 @@
 #include <description_buffer.hpp>
 #include <ie_layouts.h>
 #include <ie_algorithm.hpp>
+#include <blob_factory.hpp>
 #include <cassert>
 #include <map>
 #include <string>
@@ -19,13 +20,32 @@ using namespace InferenceEngine::details;
 HeteroInferRequest::HeteroInferRequest(InferenceEngine::InputsDataMap networkInputs,
                                        InferenceEngine::OutputsDataMap networkOutputs,
                                        const SubRequestsList& inferRequests,
-                                       const std::unordered_map<std::string, std::string>& subgraphInputToOutputBlobNames) :
+                                       const std::unordered_map<std::string, std::string>& subgraphInputToOutputBlobNames,
+                                       const HeteroPipeline::Ptr& pipeline) :
     IInferRequestInternal(networkInputs, networkOutputs),
-    _inferRequests(inferRequests) {
+    _inferRequests(inferRequests),
+    _pipeline(pipeline),
+    _blobNameMap(subgraphInputToOutputBlobNames) {
     if (_networkOutputs.empty() || _networkInputs.empty()) {
         IE_THROW() << "Internal error: no information about network's output/input";
     }
 
+    if (_pipeline) {
+        // device requests are taken from the stage pools for each run, so the request owns its inputs and outputs
+        for (auto&& input : _networkInputs) {
+            auto blob = make_blob_with_precision(input.second->getTensorDesc());
+            blob->allocate();
+            _inputs[input.first] = blob;
+        }
+        for (auto&& output : _networkOutputs) {
+            auto blob = make_blob_with_precision(output.second->getTensorDesc());
+            blob->allocate();
+            _outputs[output.first] = blob;
+        }
+        _perfCounts.resize(_inferRequests.size());
+        return;
+    }
+
     auto requestBlob([&](const std::string& blobName, InferenceEngine::SoIInferRequestInternal& r) {
         std::string intermediateBlobName = blobName;
         auto itName = subgraphInputToOutputBlobNames.find(blobName);
@@ -66,6 +86,10 @@ HeteroInferRequest::HeteroInferRequest(InferenceEngine::InputsDataMap networkInp
 
 void HeteroInferRequest::SetBlob(const std::string& name, const InferenceEngine::Blob::Ptr& data) {
     InferenceEngine::IInferRequestInternal::SetBlob(name, data);
+    if (_pipeline) {
+        // blobs are set to the pooled device requests by bindSubRequest()
+        return;
+    }
     assert(!_inferRequests.empty());
     for (auto &&desc : _inferRequests) {
         auto &r = desc._request;
@@ -82,6 +106,9 @@ void HeteroInferRequest::SetBlob(const std::string& name, const InferenceEngine:
 }
 
 void HeteroInferRequest::InferImpl() {
+    if (_pipeline) {
+        IE_THROW(NotImplemented) << "Pipelined heterogeneous request is executed by the asynchronous request stages";
+    }
     updateInOutIfNeeded();
     for (auto &&desc : _inferRequests) {
         OV_ITT_SCOPED_TASK(itt::domains::HeteroPlugin, desc._profilingTask);
@@ -94,7 +121,7 @@ void HeteroInferRequest::InferImpl() {
 std::map<std::string, InferenceEngineProfileInfo> HeteroInferRequest::GetPerformanceCounts() const {
     std::map<std::string, InferenceEngineProfileInfo> perfMap;
     for (size_t i = 0; i < _inferRequests.size(); i++) {
-        auto perfMapRequest = _inferRequests[i]._request->GetPerformanceCounts();
+        auto perfMapRequest = _pipeline ? _perfCounts[i] : _inferRequests[i]._request->GetPerformanceCounts();
         for (auto &&r : perfMapRequest) {
             perfMap[std::string("subgraph") + std::to_string(i) + ": " + r.first] = r.second;
         }
@@ -138,3 +165,36 @@ void HeteroInferRequest::updateInOutIfNeeded() {
         }
     }
 }
+
+void HeteroInferRequest::bindSubRequest(std::size_t index, SoIInferRequestInternal& request, const BlobMap& frame) {
+    OV_ITT_SCOPED_TASK(itt::domains::HeteroPlugin, "bindSubRequest");
+    auto& desc = _inferRequests.at(index);
+    for (auto&& inputInfo : desc._network->GetInputsInfo()) {
+        auto& ioname = inputInfo.first;
+        if (InferenceEngine::details::contains(_networkInputs, ioname)) {
+            auto it = _preProcData.find(ioname);
+            auto blob = (it != _preProcData.end()) ? it->second->getRoiBlob() : _inputs[ioname];
+            request->SetBlob(ioname, blob, GetPreProcess(ioname));
+            continue;
+        }
+        auto intermediateName = ioname;
+        auto itName = _blobNameMap.find(ioname);
+        if (itName != _blobNameMap.end()) {
+            intermediateName = itName->second;
+        }
+        // a subgraph output can be both a network output and an input of the next subgraph
+        auto ito = _outputs.find(intermediateName);
+        request->SetBlob(ioname, ito != _outputs.end() ? ito->second : frame.at(intermediateName));
+    }
+    for (auto&& outputInfo : desc._network->GetOutputsInfo()) {
+        auto& ioname = outputInfo.first;
+        auto ito = _outputs.find(ioname);
+        request->SetBlob(ioname, ito != _outputs.end() ? ito->second : frame.at(ioname));
+    }
+}
+
+void HeteroInferRequest::storePerformanceCounts(std::size_t index, SoIInferRequestInternal& request) {
+    if (_pipeline && _pipeline->_perfCount) {
+        _perfCounts.at(index) = request->GetPerformanceCounts();
+    }
+}
@@ -13,6 +13,7 @@
 #include <cpp_interfaces/interface/ie_iinfer_request_internal.hpp>
 #include <cpp_interfaces/interface/ie_iexecutable_network_internal.hpp>
 #include <openvino/itt.hpp>
+#include "hetero_pipeline.hpp"
 
 namespace HeteroPlugin {
 
@@ -30,7 +31,8 @@ public:
     explicit HeteroInferRequest(InferenceEngine::InputsDataMap networkInputs,
                                 InferenceEngine::OutputsDataMap networkOutputs,
                                 const SubRequestsList &inferRequests,
-                                const std::unordered_map<std::string, std::string>& blobNameMap);
+                                const std::unordered_map<std::string, std::string>& blobNameMap,
+                                const HeteroPipeline::Ptr& pipeline = {});
 
     void InferImpl() override;
 
@@ -40,8 +42,26 @@ public:
 
     void updateInOutIfNeeded();
 
+    /**
+     * @brief Sets the request inputs and outputs and the intermediate blobs of the pipeline frame
+     *        to the pooled device request which executes the subgraph with the given index
+     */
+    void bindSubRequest(std::size_t index,
+                        InferenceEngine::SoIInferRequestInternal& request,
+                        const InferenceEngine::BlobMap& frame);
+
+    /**
+     * @brief Keeps performance counters of the pooled device request before it is returned to the pool
+     */
+    void storePerformanceCounts(std::size_t index, InferenceEngine::SoIInferRequestInternal& request);
+
     SubRequestsList _inferRequests;
     std::map<std::string, InferenceEngine::Blob::Ptr>   _blobs;
+    HeteroPipeline::Ptr                                 _pipeline;
+
+private:
+    std::unordered_map<std::string, std::string>        _blobNameMap;
+    std::vector<std::map<std::string, InferenceEngine::InferenceEngineProfileInfo>> _perfCounts;
 };
 
 }  // namespace HeteroPlugin
@@ -0,0 +1,80 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief Resources shared by infer requests of the pipelined heterogeneous network
+ * @file hetero_pipeline.hpp
+ */
+#pragma once
+
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include <ie_common.h>
+#include <cpp_interfaces/interface/ie_iinfer_request_internal.hpp>
+
+namespace HeteroPlugin {
+
+/**
+ * @brief Thread-safe pool of reusable objects. Acquisition never blocks the calling thread:
+ *        if the pool is empty the continuation is queued and called when an object is released.
+ * @note  Continuations are called without the pool lock held and must not throw.
+ */
+template <typename T>
+class AsyncPool {
+public:
+    using Continuation = std::function<void(T)>;
+
+    void acquire(Continuation continuation) {
+        T item;
+        {
+            std::lock_guard<std::mutex> lock{_mutex};
+            if (_items.empty()) {
+                _waiting.push_back(std::move(continuation));
+                return;
+            }
+            item = std::move(_items.back());
+            _items.pop_back();
+        }
+        continuation(std::move(item));
+    }
+
+    void release(T item) {
+        Continuation continuation;
+        {
+            std::lock_guard<std::mutex> lock{_mutex};
+            if (_waiting.empty()) {
+                _items.push_back(std::move(item));
+                return;
+            }
+            continuation = std::move(_waiting.front());
+            _waiting.pop_front();
+        }
+        continuation(std::move(item));
+    }
+
+private:
+    std::mutex                  _mutex;
+    std::vector<T>              _items;
+    std::deque<Continuation>    _waiting;
+};
+
+/**
+ * @brief Per network state of the pipelined execution: a pool of device infer requests for each subgraph
+ *        and a ring of preallocated buffers for the blobs passed between subgraphs
+ */
+struct HeteroPipeline {
+    using Ptr = std::shared_ptr<HeteroPipeline>;
+    using Frame = std::shared_ptr<InferenceEngine::BlobMap>;
+
+    std::vector<std::unique_ptr<AsyncPool<InferenceEngine::SoIInferRequestInternal>>>  _stages;
+    AsyncPool<Frame>                                                                    _frames;
+    bool                                                                                _perfCount = false;
+};
+
+}  // namespace HeteroPlugin
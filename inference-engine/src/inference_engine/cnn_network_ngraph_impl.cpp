@@ -160,7 +160,7 @@ CNNNetworkNGraphImpl::CNNNetworkNGraphImpl(const CNNNetwork& network) {
         IE_THROW() << "Cannot create CNNNetwork with nGraph from legacy network format!";
     }
 
-    _ngraph_function = ngraph::clone_function(*network.getFunction());
+    _ngraph_function = ngraph::clone_function_trusted(*network.getFunction());
     validateFunctionNames();
     InputsDataMap inputs = network.getInputsInfo();
     OutputsDataMap outputs = network.getOutputsInfo();
@@ -382,7 +382,7 @@ CNNNetworkNGraphImpl::reshape(const std::map<std::string, ngraph::PartialShape>&
         if (outputs_are_static) {
             specialized_ngraph_function = _ngraph_function;
         } else {
-            specialized_ngraph_function = ngraph::clone_function(*_ngraph_function);
+            specialized_ngraph_function = ngraph::clone_function_trusted(*_ngraph_function);
             {
                 OV_ITT_SCOPED_TASK(itt::domains::IE, "CNNNetworkNGraphImpl::ConvertToLegacy");
                 ::ngraph::pass::Manager manager;
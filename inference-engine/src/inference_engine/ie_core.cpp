@@ -7,6 +7,7 @@
 #include <string>
 #include <vector>
 #include <mutex>
+#include <atomic>
 #include <sys/stat.h>
 
 #include <ie_core.hpp>
@@ -14,6 +15,7 @@
 #include <ngraph/opsets/opset.hpp>
 #include <ngraph/ngraph.hpp>
 #include <ngraph/graph_util.hpp>
+#include <ngraph/parallel_for.hpp>
 #include <ngraph/pass/constant_folding.hpp>
 
 #include "compilation_context.hpp"
@@ -22,6 +24,7 @@
 #include "ie_cache_manager.hpp"
 #include "ie_cache_guard.hpp"
 #include "ie_itt.hpp"
+#include "ie_parallel.hpp"
 #include "file_utils.h"
 #include "ie_network_reader.hpp"
 #include "xml_parse_utils.h"
@@ -196,6 +199,30 @@ class Core::Impl : public ICore {
 
                 config.erase(it);
             }
+
+            it = config.find(CONFIG_KEY(MMAP_WEIGHTS));
+            if (it != config.end()) {
+                if (it->second == CONFIG_VALUE(YES)) {
+                    _mmapWeights = true;
+                } else if (it->second == CONFIG_VALUE(NO)) {
+                    _mmapWeights = false;
+                } else {
+                    IE_THROW() << "Wrong value " << it->second << " for " << CONFIG_KEY(MMAP_WEIGHTS) << " config key";
+                }
+
+                config.erase(it);
+            }
+
+            it = config.find(CONFIG_KEY(TRACE_FILE));
+            if (it != config.end()) {
+                if (it->second.empty()) {
+                    openvino::itt::traceStop();
+                } else {
+                    openvino::itt::traceStart(it->second);
+                }
+
+                config.erase(it);
+            }
         }
 
         // Creating thread-safe copy of config including shared_ptr to ICacheManager
@@ -204,9 +231,14 @@ class Core::Impl : public ICore {
             return _cacheConfig;
         }
 
+        bool isWeightsMappingEnabled() const {
+            return _mmapWeights;
+        }
+
     private:
         mutable std::mutex _cacheConfigMutex;
         CacheConfig _cacheConfig;
+        std::atomic<bool> _mmapWeights{false};
     };
 
     // Core settings (cache config, etc)
@@ -396,6 +428,12 @@ public:
         opsetNames.insert("opset5");
         opsetNames.insert("opset6");
         opsetNames.insert("opset7");
+#if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
+        // used by nGraph validation, constant folding and reference kernels to run independent work concurrently
+        ngraph::set_parallel_for([] (size_t size, const std::function<void(size_t)>& body) {
+            tbb::parallel_for(static_cast<size_t>(0), size, body);
+        });
+#endif
     }
 
     ~Impl() override = default;
@@ -477,7 +515,7 @@ public:
 
     CNNNetwork ReadNetwork(const std::string& modelPath, const std::string& binPath) const override {
         OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::IE_RT, "Core::Impl::ReadNetwork from file");
-        return details::ReadNetwork(modelPath, binPath, extensions);
+        return details::ReadNetwork(modelPath, binPath, extensions, coreConfig.isWeightsMappingEnabled());
     }
 
     CNNNetwork ReadNetwork(const std::string& model, const Blob::CPtr& weights) const override {
@@ -579,7 +617,7 @@ public:
             return res;
 
         const auto& func = network.getFunction();
-        auto specialized_function = ngraph::clone_function(*func);
+        auto specialized_function = ngraph::clone_function_trusted(*func);
 
         std::string defDevice = res.supportedLayersMap.begin()->second;
         ngraph::pass::ConstantFolding().run_on_function(specialized_function);
@@ -0,0 +1,46 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ie_mmap_object.hpp"
+
+#include <memory>
+
+namespace InferenceEngine {
+
+namespace {
+
+/**
+ * @brief Allocator which returns the file mapping it holds, the mapping lives as long as the blob does
+ */
+class MappedMemoryAllocator final : public IAllocator {
+    std::shared_ptr<MappedMemory> _memory;
+
+public:
+    explicit MappedMemoryAllocator(const std::shared_ptr<MappedMemory>& memory) : _memory(memory) {}
+
+    void* lock(void* handle, LockOp = LOCK_FOR_WRITE) noexcept override {
+        return handle == _memory->data() ? handle : nullptr;
+    }
+
+    void unlock(void*) noexcept override {}  // NOLINT
+
+    void* alloc(size_t size) noexcept override {
+        return size <= _memory->size() ? _memory->data() : nullptr;
+    }
+
+    bool free(void*) noexcept override {  // NOLINT
+        return false;
+    }
+};
+
+}  // namespace
+
+Blob::Ptr makeMappedBlob(const std::shared_ptr<MappedMemory>& memory) {
+    auto blob = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {memory->size()}, Layout::C),
+                                          std::make_shared<MappedMemoryAllocator>(memory));
+    blob->allocate();
+    return blob;
+}
+
+}  // namespace InferenceEngine
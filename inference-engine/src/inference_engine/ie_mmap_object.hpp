@@ -0,0 +1,53 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief This is a header file for the read-only file mapping used to load the model weights lazily
+ *
+ * @file ie_mmap_object.hpp
+ */
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "ie_blob.h"
+
+namespace InferenceEngine {
+
+/**
+ * @brief Private (copy-on-write) mapping of a whole file into the process memory. The pages are read from the
+ * file on the first access, so the parts of the file which are never accessed don't take memory.
+ */
+class MappedMemory {
+public:
+    virtual ~MappedMemory() = default;
+
+    /**
+     * @brief Returns a pointer to the beginning of the mapped file
+     */
+    virtual char* data() noexcept = 0;
+
+    /**
+     * @brief Returns the size of the mapped file in bytes
+     */
+    virtual size_t size() const noexcept = 0;
+};
+
+/**
+ * @brief Maps the file into memory
+ * @param path Path to the file
+ * @return The mapping or nullptr if the file is empty or cannot be mapped
+ */
+std::shared_ptr<MappedMemory> loadMmapObject(const std::string& path);
+
+/**
+ * @brief Creates U8 blob on top of the file mapping, the blob keeps the mapping alive
+ * @param memory The file mapping
+ * @return A new blob
+ */
+Blob::Ptr makeMappedBlob(const std::shared_ptr<MappedMemory>& memory);
+
+}  // namespace InferenceEngine
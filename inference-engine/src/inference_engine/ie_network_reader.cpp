@@ -4,6 +4,7 @@
 
 #include "ie_network_reader.hpp"
 #include "ie_itt.hpp"
+#include "ie_mmap_object.hpp"
 
 #include <details/ie_so_pointer.hpp>
 #include <file_utils.h>
@@ -148,9 +149,41 @@ void assertIfIRv7LikeModel(std::istream & modelStream) {
                                                          "version of the OpenVINO to generate supported IR version.";
 }
 
+Blob::Ptr readWeights(const std::string& binPath, bool mapWeights) {
+    // Map the weights file, so the bytes of the constants are read only when they are accessed and the constants
+    // removed by transformations never take memory. The constants point into the mapping, so it's done only if the
+    // application guarantees the file isn't modified while the network is alive.
+    if (mapWeights) {
+        if (auto mappedWeights = loadMmapObject(binPath))
+            return makeMappedBlob(mappedWeights);
+    }
+
+    // Open weights file
+#if defined(ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
+    std::wstring weights_path = FileUtils::multiByteCharToWString(binPath.c_str());
+#else
+    std::string weights_path = binPath;
+#endif
+    std::ifstream binStream;
+    binStream.open(weights_path, std::ios::binary);
+    if (!binStream.is_open())
+        IE_THROW() << "Weights file " << binPath << " cannot be opened!";
+
+    binStream.seekg(0, std::ios::end);
+    size_t fileSize = binStream.tellg();
+    binStream.seekg(0, std::ios::beg);
+
+    Blob::Ptr weights = make_shared_blob<uint8_t>({Precision::U8, { fileSize }, C });
+    weights->allocate();
+    binStream.read(weights->buffer(), fileSize);
+    binStream.close();
+    return weights;
+}
+
 }  // namespace
 
-CNNNetwork details::ReadNetwork(const std::string& modelPath, const std::string& binPath, const std::vector<IExtensionPtr>& exts) {
+CNNNetwork details::ReadNetwork(const std::string& modelPath, const std::string& binPath, const std::vector<IExtensionPtr>& exts,
+                                bool mapWeights) {
     // Register readers if it is needed
     registerReaders();
 
@@ -193,28 +226,10 @@ CNNNetwork details::ReadNetwork(const std::string& modelPath, const std::string&
                 }
             }
             if (!bPath.empty()) {
-                // Open weights file
-#if defined(ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
-                std::wstring weights_path = FileUtils::multiByteCharToWString(bPath.c_str());
-#else
-                std::string weights_path = bPath;
-#endif
-                std::ifstream binStream;
-                binStream.open(weights_path, std::ios::binary);
-                if (!binStream.is_open())
-                    IE_THROW() << "Weights file " << bPath << " cannot be opened!";
-
-                binStream.seekg(0, std::ios::end);
-                size_t fileSize = binStream.tellg();
-                binStream.seekg(0, std::ios::beg);
-
-                Blob::Ptr weights = make_shared_blob<uint8_t>({Precision::U8, { fileSize }, C });
-
+                Blob::Ptr weights;
                 {
                     OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::IE_RT, "ReadNetworkWeights");
-                    weights->allocate();
-                    binStream.read(weights->buffer(), fileSize);
-                    binStream.close();
+                    weights = readWeights(bPath, mapWeights);
                 }
 
                 // read model with weights
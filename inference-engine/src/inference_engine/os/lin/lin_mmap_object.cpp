@@ -0,0 +1,58 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <memory>
+#include <string>
+
+#include "ie_mmap_object.hpp"
+
+namespace InferenceEngine {
+
+class MapHolder : public MappedMemory {
+public:
+    MapHolder(void* data, size_t size) : _data(data), _size(size) {}
+
+    ~MapHolder() override {
+        munmap(_data, _size);
+    }
+
+    char* data() noexcept override {
+        return static_cast<char*>(_data);
+    }
+
+    size_t size() const noexcept override {
+        return _size;
+    }
+
+private:
+    void* _data;
+    size_t _size;
+};
+
+std::shared_ptr<MappedMemory> loadMmapObject(const std::string& path) {
+    const int fd = open(path.c_str(), O_RDONLY);
+    if (fd == -1)
+        return nullptr;
+
+    struct stat sb = {};
+    void* data = MAP_FAILED;
+    if (fstat(fd, &sb) != -1 && sb.st_size > 0) {
+        // The private mapping keeps the file intact if somebody writes to the weights. It doesn't protect the weights
+        // from the changes of the file: the pages which aren't copied yet reflect them, and the pages beyond the end
+        // of the truncated file raise SIGBUS on access.
+        data = mmap(nullptr, sb.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    }
+    // the mapping stays valid after the descriptor is closed
+    close(fd);
+    if (data == MAP_FAILED)
+        return nullptr;
+    return std::make_shared<MapHolder>(data, static_cast<size_t>(sb.st_size));
+}
+
+}  // namespace InferenceEngine
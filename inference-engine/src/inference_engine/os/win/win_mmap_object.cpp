@@ -0,0 +1,74 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#ifndef NOMINMAX
+# define NOMINMAX
+#endif
+
+#include <windows.h>
+
+#include <memory>
+#include <string>
+
+#include "file_utils.h"
+#include "ie_mmap_object.hpp"
+
+namespace InferenceEngine {
+
+class MapHolder : public MappedMemory {
+public:
+    MapHolder(HANDLE mapping, void* data, size_t size) : _mapping(mapping), _data(data), _size(size) {}
+
+    ~MapHolder() override {
+        UnmapViewOfFile(_data);
+        CloseHandle(_mapping);
+    }
+
+    char* data() noexcept override {
+        return static_cast<char*>(_data);
+    }
+
+    size_t size() const noexcept override {
+        return _size;
+    }
+
+private:
+    HANDLE _mapping;
+    void* _data;
+    size_t _size;
+};
+
+std::shared_ptr<MappedMemory> loadMmapObject(const std::string& path) {
+#if defined(ENABLE_UNICODE_PATH_SUPPORT)
+    const std::wstring filePath = FileUtils::multiByteCharToWString(path.c_str());
+    HANDLE file = CreateFileW(filePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL, nullptr);
+#else
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL, nullptr);
+#endif
+    if (file == INVALID_HANDLE_VALUE)
+        return nullptr;
+
+    LARGE_INTEGER fileSize = {};
+    HANDLE mapping = nullptr;
+    if (GetFileSizeEx(file, &fileSize) && fileSize.QuadPart > 0) {
+        // Copy-on-write pages keep the file intact if somebody writes to the weights. The writes to the file are
+        // still visible in the pages which aren't copied yet, while the file can't be truncated until it's unmapped.
+        mapping = CreateFileMapping(file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+    }
+    // the mapping object keeps the file open
+    CloseHandle(file);
+    if (mapping == nullptr)
+        return nullptr;
+
+    void* data = MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, 0);
+    if (data == nullptr) {
+        CloseHandle(mapping);
+        return nullptr;
+    }
+    return std::make_shared<MapHolder>(mapping, data, static_cast<size_t>(fileSize.QuadPart));
+}
+
+}  // namespace InferenceEngine
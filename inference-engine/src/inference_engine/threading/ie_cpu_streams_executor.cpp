@@ -13,6 +13,9 @@
 #include <climits>
 #include <cassert>
 #include <utility>
+#include <chrono>
+#include <map>
+#include <algorithm>
 
 #include "threading/ie_thread_local.hpp"
 #include "ie_parallel_custom_arena.hpp"
@@ -25,6 +28,11 @@ using namespace openvino;
 
 namespace InferenceEngine {
 struct CPUStreamsExecutor::Impl {
+    struct QueuedTask {
+        Task                                    _task;
+        std::chrono::steady_clock::time_point   _queued;
+        bool                                    _measured;
+    };
     struct Stream {
 #if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
         struct Observer: public custom::task_scheduler_observer {
@@ -35,15 +43,13 @@ struct CPUStreamsExecutor::Impl {
             Observer(custom::task_arena&    arena,
                      CpuSet              mask,
                      int                 ncpus,
-                     const int           streamId,
-                     const int           threadsPerStream,
-                     const int           threadBindingStep,
-                     const int           threadBindingOffset) :
+                     const int           offset,
+                     const int           threadBindingStep) :
                 custom::task_scheduler_observer(arena),
                 _mask{std::move(mask)},
                 _ncpus(ncpus),
                 _threadBindingStep(threadBindingStep),
-                _offset{streamId * threadsPerStream  + threadBindingOffset} {
+                _offset{offset} {
             }
             void on_scheduler_entry(bool) override {
                 PinThreadToVacantCore(_offset + tbb::this_task_arena::current_thread_index(), _threadBindingStep, _ncpus, _mask);
@@ -58,13 +64,24 @@ struct CPUStreamsExecutor::Impl {
             _impl(impl) {
             {
                 std::lock_guard<std::mutex> lock{_impl->_streamIdMutex};
-                if (_impl->_streamIdQueue.empty()) {
+                auto highPriorityStreamId = _impl->_highPriorityStreamIds.find(std::this_thread::get_id());
+                if (highPriorityStreamId != _impl->_highPriorityStreamIds.end()) {
+                    _streamId = highPriorityStreamId->second;
+                    _highPriorityOnly = true;
+                } else if (_impl->_streamIdQueue.empty()) {
                     _streamId = _impl->_streamId++;
+                    // the ids following the normal streams are taken by the high priority streams
+                    if (_streamId == _impl->_config._streams && 0 != _impl->_config._highPriorityStreams) {
+                        _streamId += _impl->_config._highPriorityStreams;
+                        _impl->_streamId = _streamId + 1;
+                    }
                 } else {
                     _streamId = _impl->_streamIdQueue.front();
                     _impl->_streamIdQueue.pop();
                 }
             }
+            // the high priority streams share the cores of the first normal streams
+            const int bindingStreamId = _highPriorityOnly ? _streamId - _impl->_config._streams : _streamId;
             _numaNodeId = _impl->_config._streams
                 ? _impl->_usedNumaNodes.at(
                     (_streamId % _impl->_config._streams)/
@@ -87,7 +104,7 @@ struct CPUStreamsExecutor::Impl {
                     // assigning the stream to the core type in the round-robin fashion
                     // wrapping around total_streams (i.e. how many streams all different core types can handle together)
                     const auto total_streams = _impl->total_streams_on_core_types.back().second;
-                    const auto streamId_wrapped = _streamId % total_streams;
+                    const auto streamId_wrapped = bindingStreamId % total_streams;
                     const auto& selected_core_type = std::find_if(_impl->total_streams_on_core_types.cbegin(), _impl->total_streams_on_core_types.cend(),
                         [streamId_wrapped](const decltype(_impl->total_streams_on_core_types)::value_type & p) { return p.second > streamId_wrapped; })->first;
                     _taskArena.reset(new custom::task_arena{
@@ -105,10 +122,8 @@ struct CPUStreamsExecutor::Impl {
                         _observer.reset(new Observer{*_taskArena,
                                                      std::move(processMask),
                                                      ncpus,
-                                                     _streamId,
-                                                     _impl->_config._threadsPerStream,
-                                                     _impl->_config._threadBindingStep,
-                                                     _impl->_config._threadBindingOffset});
+                                                     bindingStreamId * _impl->_config._threadsPerStream + _impl->_config._threadBindingOffset,
+                                                     _impl->_config._threadBindingStep});
                         _observer->observe(true);
                     }
                 }
@@ -121,7 +136,7 @@ struct CPUStreamsExecutor::Impl {
                 std::tie(processMask, ncpus) = GetProcessMask();
                 if (nullptr != processMask) {
                     parallel_nt(_impl->_config._threadsPerStream, [&] (int threadIndex, int threadsPerStream) {
-                        int thrIdx = _streamId * _impl->_config._threadsPerStream + threadIndex + _impl->_config._threadBindingOffset;
+                        int thrIdx = bindingStreamId * _impl->_config._threadsPerStream + threadIndex + _impl->_config._threadBindingOffset;
                         PinThreadToVacantCore(thrIdx, _impl->_config._threadBindingStep, ncpus, processMask);
                     });
                 }
@@ -134,13 +149,13 @@ struct CPUStreamsExecutor::Impl {
                 int    ncpus = 0;
                 std::tie(processMask, ncpus) = GetProcessMask();
                 if (nullptr != processMask) {
-                    PinThreadToVacantCore(_streamId + _impl->_config._threadBindingOffset, _impl->_config._threadBindingStep, ncpus, processMask);
+                    PinThreadToVacantCore(bindingStreamId + _impl->_config._threadBindingOffset, _impl->_config._threadBindingStep, ncpus, processMask);
                 }
             }
 #endif
         }
         ~Stream() {
-            {
+            if (!_highPriorityOnly) {
                 std::lock_guard<std::mutex> lock{_impl->_streamIdMutex};
                 _impl->_streamIdQueue.push(_streamId);
             }
@@ -155,6 +170,8 @@ struct CPUStreamsExecutor::Impl {
         int _streamId   = 0;
         int _numaNodeId = 0;
         bool _execute = false;
+        bool _highPriorityOnly = false;
+        TaskPriority _priority = TaskPriority::NORMAL;
         std::queue<Task> _taskQueue;
 #if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
         std::unique_ptr<custom::task_arena> _taskArena;
@@ -194,33 +211,102 @@ struct CPUStreamsExecutor::Impl {
             }
         }
         #endif
-        for (auto streamId = 0; streamId < _config._streams; ++streamId) {
-            _threads.emplace_back([this, streamId] {
+        const auto highPriorityStreams = _config._streams != 0 ? _config._highPriorityStreams : 0;
+        for (auto streamId = 0; streamId < _config._streams + highPriorityStreams; ++streamId) {
+            const bool highPriorityOnly = streamId >= _config._streams;
+            _threads.emplace_back([this, streamId, highPriorityOnly] {
                 openvino::itt::threadName(_config._name + "_" + std::to_string(streamId));
+                if (highPriorityOnly) {
+                    std::lock_guard<std::mutex> lock{_streamIdMutex};
+                    _highPriorityStreamIds[std::this_thread::get_id()] = streamId;
+                }
+                auto& condVar = highPriorityOnly ? _highPriorityQueueCondVar : _queueCondVar;
                 for (bool stopped = false; !stopped;) {
-                    Task task;
+                    QueuedTask task{};
+                    auto priority = TaskPriority::NORMAL;
+                    bool tasksLeft = false;
                     {
                         std::unique_lock<std::mutex> lock(_mutex);
-                        _queueCondVar.wait(lock, [&] { return !_taskQueue.empty() || (stopped = _isStopped); });
-                        if (!_taskQueue.empty()) {
+                        condVar.wait(lock, [&] {
+                            return !_highPriorityTaskQueue.empty() || (!highPriorityOnly && !_taskQueue.empty()) || (stopped = _isStopped);
+                        });
+                        if (!_highPriorityTaskQueue.empty()) {
+                            task = std::move(_highPriorityTaskQueue.front());
+                            _highPriorityTaskQueue.pop();
+                            priority = TaskPriority::HIGH;
+                        } else if (!highPriorityOnly && !_taskQueue.empty()) {
                             task = std::move(_taskQueue.front());
                             _taskQueue.pop();
                         }
+                        tasksLeft = !_highPriorityTaskQueue.empty() || !_taskQueue.empty();
                     }
-                    if (task) {
-                        Execute(task, *(_streams.local()));
+                    // the notification may have been taken by a thread which picked a task of the other queue
+                    if (tasksLeft) {
+                        _queueCondVar.notify_one();
+                    }
+                    if (task._task) {
+                        auto& stream = *(_streams.local());
+                        stream._priority = priority;
+                        Execute(task._task, stream);
+                        stream._priority = TaskPriority::NORMAL;
+                        Complete(task, priority);
                     }
                 }
             });
         }
     }
 
-    void Enqueue(Task task) {
+    void Enqueue(Task task, TaskPriority priority, bool measured) {
+        QueuedTask queuedTask{std::move(task), std::chrono::steady_clock::now(), measured};
         {
             std::lock_guard<std::mutex> lock(_mutex);
-            _taskQueue.emplace(std::move(task));
+            if (TaskPriority::HIGH == priority) {
+                _highPriorityTaskQueue.push(std::move(queuedTask));
+                ++_highPriorityTasks;
+            } else {
+                _taskQueue.push(std::move(queuedTask));
+            }
         }
         _queueCondVar.notify_one();
+        if (TaskPriority::HIGH == priority) {
+            _highPriorityQueueCondVar.notify_one();
+        }
+    }
+
+    void Complete(const QueuedTask& task, TaskPriority priority) {
+        if (!task._measured && TaskPriority::NORMAL == priority) {
+            return;
+        }
+        const auto latency = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - task._queued).count();
+        bool resume = false;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (task._measured) {
+                auto& statistics = _latencyStatistics[priority];
+                statistics.tasks++;
+                statistics.latencySum += latency;
+                statistics.maxLatency = std::max(statistics.maxLatency, latency);
+            }
+            if (TaskPriority::HIGH == priority) {
+                resume = (0 == --_highPriorityTasks);
+            }
+        }
+        if (resume) {
+            _highPriorityDoneCondVar.notify_all();
+        }
+    }
+
+    void YieldToHighPriority() {
+        if (0 == _highPriorityTasks.load(std::memory_order_relaxed)) {
+            return;
+        }
+        // only the normal priority tasks on the streams sharing the cores with the high priority streams are paused
+        auto& stream = *(_streams.local());
+        if (TaskPriority::HIGH == stream._priority || stream._highPriorityOnly || stream._streamId >= _config._highPriorityStreams) {
+            return;
+        }
+        std::unique_lock<std::mutex> lock(_mutex);
+        _highPriorityDoneCondVar.wait(lock, [&] { return 0 == _highPriorityTasks || _isStopped; });
     }
 
     void Execute(const Task& task, Stream& stream) {
@@ -258,7 +344,14 @@ struct CPUStreamsExecutor::Impl {
     std::vector<std::thread>                _threads;
     std::mutex                              _mutex;
     std::condition_variable                 _queueCondVar;
-    std::queue<Task>                        _taskQueue;
+    std::condition_variable                 _highPriorityQueueCondVar;
+    std::condition_variable                 _highPriorityDoneCondVar;
+    std::queue<QueuedTask>                  _taskQueue;
+    std::queue<QueuedTask>                  _highPriorityTaskQueue;
+    // queued and running high priority tasks, modified under _mutex
+    std::atomic<int>                        _highPriorityTasks{0};
+    std::map<std::thread::id, int>          _highPriorityStreamIds;
+    std::map<TaskPriority, LatencyStatistics> _latencyStatistics;
     bool                                    _isStopped = false;
     std::vector<int>                        _usedNumaNodes;
     ThreadLocal<std::shared_ptr<Stream>>    _streams;
@@ -293,6 +386,8 @@ CPUStreamsExecutor::~CPUStreamsExecutor() {
         _impl->_isStopped = true;
     }
     _impl->_queueCondVar.notify_all();
+    _impl->_highPriorityQueueCondVar.notify_all();
+    _impl->_highPriorityDoneCondVar.notify_all();
     for (auto& thread : _impl->_threads) {
         if (thread.joinable()) {
             thread.join();
@@ -308,8 +403,28 @@ void CPUStreamsExecutor::run(Task task) {
     if (0 == _impl->_config._streams) {
         _impl->Defer(std::move(task));
     } else {
-        _impl->Enqueue(std::move(task));
+        _impl->Enqueue(std::move(task), TaskPriority::NORMAL, false);
+    }
+}
+
+void CPUStreamsExecutor::RunWithPriority(Task task, TaskPriority priority) {
+    if (0 == _impl->_config._streams) {
+        _impl->Defer(std::move(task));
+    } else {
+        _impl->Enqueue(std::move(task), priority, true);
+    }
+}
+
+void CPUStreamsExecutor::YieldToHighPriority() {
+    if (0 != _impl->_config._highPriorityStreams) {
+        _impl->YieldToHighPriority();
     }
 }
 
+CPUStreamsExecutor::LatencyStatistics CPUStreamsExecutor::GetLatencyStatistics(TaskPriority priority) const {
+    std::lock_guard<std::mutex> lock(_impl->_mutex);
+    auto statistics = _impl->_latencyStatistics.find(priority);
+    return statistics == _impl->_latencyStatistics.end() ? LatencyStatistics{} : statistics->second;
+}
+
 }  // namespace InferenceEngine
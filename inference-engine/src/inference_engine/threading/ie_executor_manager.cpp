@@ -22,6 +22,24 @@ ITaskExecutor::Ptr ExecutorManagerImpl::getExecutor(std::string id) {
     return foundEntry->second;
 }
 
+namespace {
+
+bool isSameConfig(const IStreamsExecutor::Config& executorConfig, const IStreamsExecutor::Config& config) {
+    if (executorConfig._name == config._name &&
+        executorConfig._streams == config._streams &&
+        executorConfig._threadsPerStream == config._threadsPerStream &&
+        executorConfig._threadBindingType == config._threadBindingType &&
+        executorConfig._threadBindingStep == config._threadBindingStep &&
+        executorConfig._threadBindingOffset == config._threadBindingOffset &&
+        executorConfig._highPriorityStreams == config._highPriorityStreams)
+        if (executorConfig._threadBindingType != IStreamsExecutor::ThreadBindingType::HYBRID_AWARE
+             || executorConfig._threadPreferredCoreType == config._threadPreferredCoreType)
+        return true;
+    return false;
+}
+
+}  // namespace
+
 IStreamsExecutor::Ptr ExecutorManagerImpl::getIdleCPUStreamsExecutor(const IStreamsExecutor::Config& config) {
     std::lock_guard<std::mutex> guard(streamExecutorMutex);
     for (const auto& it : cpuStreamsExecutors) {
@@ -29,15 +47,7 @@ IStreamsExecutor::Ptr ExecutorManagerImpl::getIdleCPUStreamsExecutor(const IStre
         if (executor.use_count() != 1)
             continue;
 
-        const auto& executorConfig = it.first;
-        if (executorConfig._name == config._name &&
-            executorConfig._streams == config._streams &&
-            executorConfig._threadsPerStream == config._threadsPerStream &&
-            executorConfig._threadBindingType == config._threadBindingType &&
-            executorConfig._threadBindingStep == config._threadBindingStep &&
-            executorConfig._threadBindingOffset == config._threadBindingOffset)
-            if (executorConfig._threadBindingType != IStreamsExecutor::ThreadBindingType::HYBRID_AWARE
-                 || executorConfig._threadPreferredCoreType == config._threadPreferredCoreType)
+        if (isSameConfig(it.first, config))
             return executor;
     }
     auto newExec = std::make_shared<CPUStreamsExecutor>(config);
@@ -45,6 +55,17 @@ IStreamsExecutor::Ptr ExecutorManagerImpl::getIdleCPUStreamsExecutor(const IStre
     return newExec;
 }
 
+IStreamsExecutor::Ptr ExecutorManagerImpl::getSharedCPUStreamsExecutor(const IStreamsExecutor::Config& config) {
+    std::lock_guard<std::mutex> guard(streamExecutorMutex);
+    for (const auto& it : sharedCPUStreamsExecutors) {
+        if (isSameConfig(it.first, config))
+            return it.second;
+    }
+    auto newExec = std::make_shared<CPUStreamsExecutor>(config);
+    sharedCPUStreamsExecutors.emplace_back(std::make_pair(config, newExec));
+    return newExec;
+}
+
 // for tests purposes
 size_t ExecutorManagerImpl::getExecutorsNumber() {
     return executors.size();
@@ -61,6 +82,7 @@ void ExecutorManagerImpl::clear(const std::string& id) {
     if (id.empty()) {
         executors.clear();
         cpuStreamsExecutors.clear();
+        sharedCPUStreamsExecutors.clear();
     } else {
         executors.erase(id);
         cpuStreamsExecutors.erase(
@@ -69,6 +91,12 @@ void ExecutorManagerImpl::clear(const std::string& id) {
                               return it.first._name == id;
                            }),
             cpuStreamsExecutors.end());
+        sharedCPUStreamsExecutors.erase(
+            std::remove_if(sharedCPUStreamsExecutors.begin(), sharedCPUStreamsExecutors.end(),
+                           [&](const std::pair<IStreamsExecutor::Config, IStreamsExecutor::Ptr>& it) {
+                              return it.first._name == id;
+                           }),
+            sharedCPUStreamsExecutors.end());
     }
 }
 
@@ -133,4 +161,8 @@ IStreamsExecutor::Ptr ExecutorManager::getIdleCPUStreamsExecutor(const IStreamsE
     return _impl.getIdleCPUStreamsExecutor(config);
 }
 
+IStreamsExecutor::Ptr ExecutorManager::getSharedCPUStreamsExecutor(const IStreamsExecutor::Config& config) {
+    return _impl.getSharedCPUStreamsExecutor(config);
+}
+
 }  // namespace InferenceEngine
@@ -13,11 +13,18 @@
 #include <algorithm>
 #include <vector>
 #include <thread>
+#include <utility>
 
 
 namespace InferenceEngine {
 IStreamsExecutor::~IStreamsExecutor() {}
 
+void IStreamsExecutor::RunWithPriority(Task task, TaskPriority) {
+    run(std::move(task));
+}
+
+void IStreamsExecutor::YieldToHighPriority() {}
+
 std::vector<std::string> IStreamsExecutor::Config::SupportedKeys() {
     return {
         CONFIG_KEY(CPU_THROUGHPUT_STREAMS),
@@ -95,7 +95,7 @@ CNNNetworkImpl::CNNNetworkImpl(const CNNNetwork & cnnnetwork) {
     auto ngraphImplPtr = dynamic_cast<const details::CNNNetworkNGraphImpl*>(&icnnnetwork);
     IE_ASSERT(ngraphImplPtr != nullptr);
     IE_ASSERT(ngraphImplPtr->getFunction() != nullptr);
-    auto graph = ngraph::clone_function(*ngraphImplPtr->getFunction());
+    auto graph = ngraph::clone_function_trusted(*ngraphImplPtr->getFunction());
 
     ::ngraph::pass::Manager manager;
     manager.register_pass<::ngraph::pass::InitNodeInfo>();
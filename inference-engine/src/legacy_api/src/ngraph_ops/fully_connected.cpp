@@ -24,7 +24,10 @@ op::FullyConnected::FullyConnected(
 
 shared_ptr<Node> op::FullyConnected::clone_with_new_inputs(const OutputVector& new_args) const {
     check_new_args_count(this, new_args);
-    return make_shared<FullyConnected>(new_args.at(0), new_args.at(1), new_args.at(2), m_output_shape);
+    auto fc = make_shared<FullyConnected>(new_args.at(0), new_args.at(1), new_args.at(2), m_output_shape);
+    // set by validate_and_infer_types(), which a trusted copy doesn't run
+    fc->m_output_size = m_output_size;
+    return fc;
 }
 
 void op::FullyConnected::validate_and_infer_types() {
@@ -9,6 +9,7 @@
 #include <algorithm>
 
 #include "ie_plugin_config.hpp"
+#include "cpu/cpu_config.hpp"
 #include "ie_common.h"
 #include "ie_parallel.hpp"
 #include "ie_system_conf.h"
@@ -19,6 +20,50 @@ namespace MKLDNNPlugin {
 
 using namespace InferenceEngine;
 
+namespace {
+
+std::vector<std::string> split(const std::string& str, char delimiter) {
+    std::vector<std::string> tokens;
+    size_t begin = 0;
+    while (begin <= str.size()) {
+        auto end = str.find(delimiter, begin);
+        if (end == std::string::npos)
+            end = str.size();
+        if (end != begin)
+            tokens.push_back(str.substr(begin, end - begin));
+        begin = end + 1;
+    }
+    return tokens;
+}
+
+std::vector<std::map<std::string, SizeVector>> parseShapeBuckets(const std::string& value) {
+    std::vector<std::map<std::string, SizeVector>> buckets;
+    for (auto&& bucketStr : split(value, ';')) {
+        std::map<std::string, SizeVector> bucket;
+        for (auto&& inputStr : split(bucketStr, ',')) {
+            auto separator = inputStr.rfind(':');
+            auto name = separator == std::string::npos ? std::string{} : inputStr.substr(0, separator);
+            SizeVector dims;
+            for (auto&& dim : split(inputStr.substr(separator == std::string::npos ? 0 : separator + 1), 'x')) {
+                if (dim.find_first_not_of("0123456789") != std::string::npos)
+                    IE_THROW() << "Wrong value " << value << " for property key " << CPUConfigParams::KEY_CPU_SHAPE_BUCKETS
+                               << ". Expected shapes like input_name:1x3x224x224 separated with ',' and ';'";
+                dims.push_back(std::stoul(dim));
+            }
+            if (dims.empty() || !bucket.emplace(name, dims).second)
+                IE_THROW() << "Wrong value " << value << " for property key " << CPUConfigParams::KEY_CPU_SHAPE_BUCKETS
+                           << ". Each input of a shape set must be specified once with non-empty shape";
+        }
+        if (bucket.size() > 1 && bucket.count({}))
+            IE_THROW() << "Wrong value " << value << " for property key " << CPUConfigParams::KEY_CPU_SHAPE_BUCKETS
+                       << ". Input names can be omitted for networks with a single input only";
+        buckets.push_back(bucket);
+    }
+    return buckets;
+}
+
+}  // namespace
+
 Config::Config() {
     // this is default mode
     streamExecutorConfig._threadBindingType = InferenceEngine::IStreamsExecutor::CORES;
@@ -109,6 +154,137 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
                 IE_THROW() << "Wrong value for property key " << PluginConfigParams::KEY_ENFORCE_BF16
                     << ". Expected only YES/NO";
             }
+        } else if (key == CPUConfigParams::KEY_CPU_SHAPE_CACHE_SIZE) {
+            int val_i = -1;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                IE_THROW() << "Wrong value for property key " << CPUConfigParams::KEY_CPU_SHAPE_CACHE_SIZE
+                           << ". Expected only non-negative integer numbers";
+            }
+            if (val_i < 0)
+                IE_THROW() << "Wrong value for property key " << CPUConfigParams::KEY_CPU_SHAPE_CACHE_SIZE
+                           << ". Expected only non-negative integer numbers";
+            shapeCacheSize = static_cast<size_t>(val_i);
+        } else if (key == CPUConfigParams::KEY_CPU_SHAPE_BUCKETS) {
+            shapeBuckets = parseShapeBuckets(val);
+            shapeBucketsStr = val;
+        } else if (key == CPUConfigParams::KEY_CPU_LAYOUT_ASSIGNMENT) {
+            if (val == CPUConfigParams::CPU_LAYOUT_GREEDY)
+                layoutAssignment = LayoutAssignment::Greedy;
+            else if (val == CPUConfigParams::CPU_LAYOUT_GLOBAL)
+                layoutAssignment = LayoutAssignment::Global;
+            else
+                IE_THROW() << "Wrong value for property key " << CPUConfigParams::KEY_CPU_LAYOUT_ASSIGNMENT
+                           << ". Expected only " << CPUConfigParams::CPU_LAYOUT_GREEDY << "/" << CPUConfigParams::CPU_LAYOUT_GLOBAL;
+        } else if (key == CPUConfigParams::KEY_CPU_MEMORY_ARENA) {
+            if (val == CPUConfigParams::CPU_ARENA_DEFAULT)
+                memoryArena = MemoryArena::Default;
+            else if (val == CPUConfigParams::CPU_ARENA_NUMA)
+                memoryArena = MemoryArena::Numa;
+            else if (val == CPUConfigParams::CPU_ARENA_NUMA_THP)
+                memoryArena = MemoryArena::NumaTransparentHugePages;
+            else if (val == CPUConfigParams::CPU_ARENA_NUMA_HUGETLB)
+                memoryArena = MemoryArena::NumaExplicitHugePages;
+            else
+                IE_THROW() << "Wrong value for property key " << CPUConfigParams::KEY_CPU_MEMORY_ARENA
+                           << ". Expected only " << CPUConfigParams::CPU_ARENA_DEFAULT << "/" << CPUConfigParams::CPU_ARENA_NUMA
+                           << "/" << CPUConfigParams::CPU_ARENA_NUMA_THP << "/" << CPUConfigParams::CPU_ARENA_NUMA_HUGETLB;
+        } else if (key == CPUConfigParams::KEY_CPU_SNIPPETS) {
+            if (val == PluginConfigParams::YES)
+                enableSnippets = true;
+            else if (val == PluginConfigParams::NO)
+                enableSnippets = false;
+            else
+                IE_THROW() << "Wrong value for property key " << CPUConfigParams::KEY_CPU_SNIPPETS
+                           << ". Expected only YES/NO";
+        } else if (key == CPUConfigParams::KEY_CPU_SPARSE_WEIGHTS_THRESHOLD) {
+            float val_f = -1.f;
+            try {
+                val_f = std::stof(val);
+            } catch (const std::exception&) {
+                IE_THROW() << "Wrong value for property key " << CPUConfigParams::KEY_CPU_SPARSE_WEIGHTS_THRESHOLD
+                           << ". Expected only floating point numbers in the [0, 1] range";
+            }
+            if (val_f < 0.f || val_f > 1.f)
+                IE_THROW() << "Wrong value for property key " << CPUConfigParams::KEY_CPU_SPARSE_WEIGHTS_THRESHOLD
+                           << ". Expected only floating point numbers in the [0, 1] range";
+            sparseWeightsThreshold = val_f;
+        } else if (key == CPUConfigParams::KEY_CPU_COMPRESSED_WEIGHTS) {
+            if (val == PluginConfigParams::YES)
+                compressedWeights = true;
+            else if (val == PluginConfigParams::NO)
+                compressedWeights = false;
+            else
+                IE_THROW() << "Wrong value for property key " << CPUConfigParams::KEY_CPU_COMPRESSED_WEIGHTS
+                           << ". Expected only YES/NO";
+        } else if (key == CPUConfigParams::KEY_CPU_THROUGHPUT_AUTO_TUNE) {
+            if (val == PluginConfigParams::YES)
+                throughputAutoTune = true;
+            else if (val == PluginConfigParams::NO)
+                throughputAutoTune = false;
+            else
+                IE_THROW() << "Wrong value for property key " << CPUConfigParams::KEY_CPU_THROUGHPUT_AUTO_TUNE
+                           << ". Expected only YES/NO";
+        } else if (key == CPUConfigParams::KEY_CPU_THROUGHPUT_AUTO_TUNE_LATENCY_LIMIT) {
+            float val_f = -1.f;
+            try {
+                val_f = std::stof(val);
+            } catch (const std::exception&) {
+                IE_THROW() << "Wrong value for property key " << CPUConfigParams::KEY_CPU_THROUGHPUT_AUTO_TUNE_LATENCY_LIMIT
+                           << ". Expected only non-negative floating point numbers";
+            }
+            if (val_f < 0.f)
+                IE_THROW() << "Wrong value for property key " << CPUConfigParams::KEY_CPU_THROUGHPUT_AUTO_TUNE_LATENCY_LIMIT
+                           << ". Expected only non-negative floating point numbers";
+            autoTuneLatencyLimit = val_f;
+        } else if (key == CPUConfigParams::KEY_CPU_BATCHING_MAX_BATCH) {
+            int val_i = -1;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                IE_THROW() << "Wrong value for property key " << CPUConfigParams::KEY_CPU_BATCHING_MAX_BATCH
+                           << ". Expected only non-negative integer numbers";
+            }
+            if (val_i < 0)
+                IE_THROW() << "Wrong value for property key " << CPUConfigParams::KEY_CPU_BATCHING_MAX_BATCH
+                           << ". Expected only non-negative integer numbers";
+            batchingMaxBatch = static_cast<size_t>(val_i);
+        } else if (key == CPUConfigParams::KEY_CPU_BATCHING_TIMEOUT) {
+            int val_i = -1;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                IE_THROW() << "Wrong value for property key " << CPUConfigParams::KEY_CPU_BATCHING_TIMEOUT
+                           << ". Expected only non-negative integer numbers";
+            }
+            if (val_i < 0)
+                IE_THROW() << "Wrong value for property key " << CPUConfigParams::KEY_CPU_BATCHING_TIMEOUT
+                           << ". Expected only non-negative integer numbers";
+            batchingTimeout = val_i;
+        } else if (key == CPUConfigParams::KEY_CPU_REQUEST_PRIORITY) {
+            if (val == CPUConfigParams::CPU_PRIORITY_NONE)
+                requestPriority = RequestPriority::None;
+            else if (val == CPUConfigParams::CPU_PRIORITY_NORMAL)
+                requestPriority = RequestPriority::Normal;
+            else if (val == CPUConfigParams::CPU_PRIORITY_HIGH)
+                requestPriority = RequestPriority::High;
+            else
+                IE_THROW() << "Wrong value for property key " << CPUConfigParams::KEY_CPU_REQUEST_PRIORITY
+                           << ". Expected only " << CPUConfigParams::CPU_PRIORITY_NONE << "/" << CPUConfigParams::CPU_PRIORITY_NORMAL
+                           << "/" << CPUConfigParams::CPU_PRIORITY_HIGH;
+        } else if (key == CPUConfigParams::KEY_CPU_HIGH_PRIORITY_STREAMS) {
+            int val_i = -1;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                IE_THROW() << "Wrong value for property key " << CPUConfigParams::KEY_CPU_HIGH_PRIORITY_STREAMS
+                           << ". Expected only non-negative integer numbers";
+            }
+            if (val_i < 0)
+                IE_THROW() << "Wrong value for property key " << CPUConfigParams::KEY_CPU_HIGH_PRIORITY_STREAMS
+                           << ". Expected only non-negative integer numbers";
+            streamExecutorConfig._highPriorityStreams = val_i;
         } else {
             IE_THROW(NotFound) << "Unsupported property " << key << " by CPU plugin";
         }
@@ -158,6 +334,43 @@ void Config::updateProperties() {
             _config.insert({ PluginConfigParams::KEY_ENFORCE_BF16, PluginConfigParams::YES });
         else
             _config.insert({ PluginConfigParams::KEY_ENFORCE_BF16, PluginConfigParams::NO });
+        _config.insert({ CPUConfigParams::KEY_CPU_SHAPE_CACHE_SIZE, std::to_string(shapeCacheSize) });
+        _config.insert({ CPUConfigParams::KEY_CPU_SHAPE_BUCKETS, shapeBucketsStr });
+        _config.insert({ CPUConfigParams::KEY_CPU_LAYOUT_ASSIGNMENT, layoutAssignment == LayoutAssignment::Global ?
+                                                                    CPUConfigParams::CPU_LAYOUT_GLOBAL : CPUConfigParams::CPU_LAYOUT_GREEDY });
+        switch (memoryArena) {
+            case MemoryArena::Default:
+                _config.insert({ CPUConfigParams::KEY_CPU_MEMORY_ARENA, CPUConfigParams::CPU_ARENA_DEFAULT });
+                break;
+            case MemoryArena::Numa:
+                _config.insert({ CPUConfigParams::KEY_CPU_MEMORY_ARENA, CPUConfigParams::CPU_ARENA_NUMA });
+                break;
+            case MemoryArena::NumaTransparentHugePages:
+                _config.insert({ CPUConfigParams::KEY_CPU_MEMORY_ARENA, CPUConfigParams::CPU_ARENA_NUMA_THP });
+                break;
+            case MemoryArena::NumaExplicitHugePages:
+                _config.insert({ CPUConfigParams::KEY_CPU_MEMORY_ARENA, CPUConfigParams::CPU_ARENA_NUMA_HUGETLB });
+                break;
+        }
+        _config.insert({ CPUConfigParams::KEY_CPU_SNIPPETS, enableSnippets ? PluginConfigParams::YES : PluginConfigParams::NO });
+        _config.insert({ CPUConfigParams::KEY_CPU_SPARSE_WEIGHTS_THRESHOLD, std::to_string(sparseWeightsThreshold) });
+        _config.insert({ CPUConfigParams::KEY_CPU_COMPRESSED_WEIGHTS, compressedWeights ? PluginConfigParams::YES : PluginConfigParams::NO });
+        _config.insert({ CPUConfigParams::KEY_CPU_THROUGHPUT_AUTO_TUNE, throughputAutoTune ? PluginConfigParams::YES : PluginConfigParams::NO });
+        _config.insert({ CPUConfigParams::KEY_CPU_THROUGHPUT_AUTO_TUNE_LATENCY_LIMIT, std::to_string(autoTuneLatencyLimit) });
+        _config.insert({ CPUConfigParams::KEY_CPU_BATCHING_MAX_BATCH, std::to_string(batchingMaxBatch) });
+        _config.insert({ CPUConfigParams::KEY_CPU_BATCHING_TIMEOUT, std::to_string(batchingTimeout) });
+        switch (requestPriority) {
+            case RequestPriority::None:
+                _config.insert({ CPUConfigParams::KEY_CPU_REQUEST_PRIORITY, CPUConfigParams::CPU_PRIORITY_NONE });
+                break;
+            case RequestPriority::Normal:
+                _config.insert({ CPUConfigParams::KEY_CPU_REQUEST_PRIORITY, CPUConfigParams::CPU_PRIORITY_NORMAL });
+                break;
+            case RequestPriority::High:
+                _config.insert({ CPUConfigParams::KEY_CPU_REQUEST_PRIORITY, CPUConfigParams::CPU_PRIORITY_HIGH });
+                break;
+        }
+        _config.insert({ CPUConfigParams::KEY_CPU_HIGH_PRIORITY_STREAMS, std::to_string(streamExecutorConfig._highPriorityStreams) });
     }
 }
 
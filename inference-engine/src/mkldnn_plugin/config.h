@@ -4,11 +4,13 @@
 
 #pragma once
 
+#include <ie_common.h>
 #include <threading/ie_istreams_executor.hpp>
 #include "utils/debug_capabilities.h"
 
 #include <string>
 #include <map>
+#include <vector>
 
 namespace MKLDNNPlugin {
 
@@ -20,12 +22,48 @@ struct Config {
         On,
     };
 
+    enum class LayoutAssignment {
+        Greedy,
+        Global,
+    };
+
+    enum class MemoryArena {
+        Default,
+        Numa,
+        NumaTransparentHugePages,
+        NumaExplicitHugePages,
+    };
+
+    enum class RequestPriority {
+        None,
+        Normal,
+        High,
+    };
+
     bool collectPerfCounters = false;
     bool exclusiveAsyncRequests = false;
     bool enableDynamicBatch = false;
     std::string dumpToDot = "";
     int batchLimit = 0;
     InferenceEngine::IStreamsExecutor::Config streamExecutorConfig;
+    size_t shapeCacheSize = 0;
+    // Input shapes to compile at the network loading. An empty input name stands for the only network input
+    std::vector<std::map<std::string, InferenceEngine::SizeVector>> shapeBuckets;
+    std::string shapeBucketsStr = "";
+    LayoutAssignment layoutAssignment = LayoutAssignment::Greedy;
+    MemoryArena memoryArena = MemoryArena::Default;
+    bool enableSnippets = false;
+    float sparseWeightsThreshold = 0.f;
+    bool compressedWeights = false;
+    bool throughputAutoTune = false;
+    // milliseconds, 0 means no limit
+    float autoTuneLatencyLimit = 0.f;
+    // 0 and 1 disable the batching of the asynchronous requests
+    size_t batchingMaxBatch = 0;
+    // microseconds
+    int batchingTimeout = 1000;
+    // None keeps an own streams executor, the others share it between the networks
+    RequestPriority requestPriority = RequestPriority::None;
 
 #if defined(__arm__) || defined(__aarch64__)
     // Currently INT8 mode is not optimized on ARM, fallback to FP32 mode.
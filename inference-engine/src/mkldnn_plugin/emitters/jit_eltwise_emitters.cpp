@@ -1294,7 +1294,8 @@ jit_power_static_emitter::jit_power_static_emitter(jit_generator *host, cpu_isa_
     if (!(node->input(1).get_shape() == ngraph::Shape() || ngraph::shape_size(node->input(1).get_shape()) == 1)) {
         throw ngraph::ngraph_error("unsupported non scalar power");
     }
-    power = ngraph::as_type_ptr<ngraph::op::Constant>(parent)->get_data_ptr<float>()[0];
+    // snippets Scalar derives from Constant without declaring it as the RTTI parent, as_type_ptr misses it
+    power = std::dynamic_pointer_cast<ngraph::op::Constant>(parent)->cast_vector<float>()[0];
     scale = 1.f;
     shift = 0.f;
     push_arg_entry_of("power", float2int(power), true);
@@ -1611,6 +1612,11 @@ jit_erf_emitter::jit_erf_emitter(jit_generator *host, cpu_isa_t host_isa, const
     prepare_table();
 }
 
+jit_erf_emitter::jit_erf_emitter(jit_generator *host, cpu_isa_t host_isa, const std::shared_ptr<ngraph::Node>& node, Precision exec_prc)
+: jit_emitter(host, host_isa, node, exec_prc) {
+    prepare_table();
+}
+
 size_t jit_erf_emitter::get_inputs_num() const { return 1; }
 
 void jit_erf_emitter::emit_impl(
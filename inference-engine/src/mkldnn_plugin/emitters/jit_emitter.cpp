@@ -103,9 +103,11 @@ void jit_emitter::emitter_preamble(const std::vector<size_t> &in_idxs, const std
     }
     assert(aux_vec_idxs.size() >= aux_vecs_count());
 
-    // Same logic but to allocate gprs
-    for (auto idx : pool_gpr_idxs)
+    // Same logic but to allocate gprs, the pool may hold more gprs than the emitter needs
+    for (auto idx : pool_gpr_idxs) {
+        if (aux_gpr_idxs.size() >= aux_gprs_count()) break;
         aux_gpr_idxs.push_back(idx);
+    }
 
     for (size_t gpr_idx = 0; gpr_idx <= Operand::R15; ++gpr_idx) {
         size_t _idx = Operand::R15 - gpr_idx; // we allocate from the end
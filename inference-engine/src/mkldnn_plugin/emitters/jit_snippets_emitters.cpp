@@ -0,0 +1,260 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "jit_snippets_emitters.hpp"
+
+#include <snippets/op/kernel.hpp>
+#include <snippets/op/tile.hpp>
+
+using namespace InferenceEngine;
+using namespace mkldnn::impl::utils;
+using namespace mkldnn::impl;
+using namespace mkldnn::impl::cpu::x64;
+using namespace Xbyak;
+
+#define GET_OFF(field) offsetof(jit_snippets_call_args, field)
+
+namespace MKLDNNPlugin {
+
+/// KERNEL ///
+KernelEmitter::KernelEmitter(jit_generator* h, cpu_isa_t isa, const std::shared_ptr<ngraph::Node>& n)
+    : jit_emitter(h, isa, n), region(ngraph::as_type_ptr<ngraph::snippets::op::Kernel>(n)->region) {
+}
+
+void KernelEmitter::emit_code(const std::vector<size_t> &in, const std::vector<size_t> &out,
+                              const std::vector<size_t> &pool, const std::vector<size_t> &gpr) const {
+    const size_t num_inputs = in[0];
+    const size_t num_outputs = in[1];
+    if (num_inputs + num_outputs > SNIPPETS_MAX_SNIPPETS_ARGS)
+        IE_THROW() << "Snippet kernel supports up to " << SNIPPETS_MAX_SNIPPETS_ARGS << " inputs and outputs, got " << num_inputs + num_outputs;
+
+    const Reg64 reg_params = abi_param1;
+
+    h->preamble();
+
+    for (size_t i = 0; i < num_inputs; i++)
+        h->mov(Reg64(snippets_reg64_tmp_start + i), h->ptr[reg_params + GET_OFF(src_ptrs) + i * sizeof(void*)]);
+    for (size_t i = 0; i < num_outputs; i++)
+        h->mov(Reg64(snippets_reg64_tmp_start + num_inputs + i), h->ptr[reg_params + GET_OFF(dst_ptrs) + i * sizeof(void*)]);
+    h->mov(Reg64(snippets_reg64_tmp_start + num_inputs + num_outputs), h->ptr[reg_params + GET_OFF(work_amount)]);
+
+    // the arguments are not needed anymore and the preamble has saved the callee-saved gprs,
+    // so the emitters can use these gprs without preserving them
+    const std::vector<size_t> gpr_pool = {Operand::RAX, Operand::RBX, Operand::RCX, Operand::RDX, Operand::RSI, Operand::RDI};
+    for (const auto& c : region) {
+        c.first->emit_code(c.second.first, c.second.second, pool, gpr_pool);
+    }
+
+    h->postamble();
+}
+
+/// TILE ///
+TileEmitter::TileEmitter(jit_generator* h, cpu_isa_t isa, const std::shared_ptr<ngraph::Node>& n)
+    : jit_emitter(h, isa, n), region(ngraph::as_type_ptr<ngraph::snippets::op::Tile>(n)->region) {
+    std::set<size_t> used;
+    for (const auto& c : region) {
+        used.insert(c.second.first.begin(), c.second.first.end());
+        used.insert(c.second.second.begin(), c.second.second.end());
+    }
+    for (size_t idx = 0; idx < get_max_vecs_count(); idx++) {
+        if (used.find(idx) == used.end())
+            vec_pool.push_back(idx);
+    }
+}
+
+void TileEmitter::emit_code(const std::vector<size_t> &in, const std::vector<size_t> &out,
+                            const std::vector<size_t> &pool, const std::vector<size_t> &gpr) const {
+    const size_t inc = in[0];
+    const size_t num_args = in[1];
+    const Reg64 amount = Reg64(snippets_reg64_tmp_start + num_args);
+
+    Label for_body, for_end;
+
+    h->L(for_body);
+    {
+        h->cmp(amount, inc);
+        h->jl(for_end, CodeGenerator::T_NEAR);
+
+        for (const auto& c : region) {
+            c.first->emit_code(c.second.first, c.second.second, vec_pool, gpr);
+        }
+
+        h->sub(amount, inc);
+        h->jmp(for_body, CodeGenerator::T_NEAR);
+    }
+    h->L(for_end);
+}
+
+/// BROADCAST MOVE ///
+FakeBroadcastEmitter::FakeBroadcastEmitter(jit_generator* h, cpu_isa_t isa, const std::shared_ptr<ngraph::Node>& n)
+    : jit_emitter(h, isa, n) {
+    const auto& in_shape = n->get_input_shape(0);
+    const auto& out_shape = n->get_output_shape(0);
+    use_broadcast = in_shape.empty() || in_shape.back() != out_shape.back();
+}
+
+void FakeBroadcastEmitter::emit_impl(const std::vector<size_t>& in, const std::vector<size_t>& out,
+                                     const std::vector<size_t>& pool, const std::vector<size_t>& gpr,
+                                     const emitter_context *emit_context) const {
+    if (host_isa_ == cpu::x64::avx2) {
+        emit_isa<cpu::x64::avx2>(in, out);
+    } else if (host_isa_ == cpu::x64::avx512_common) {
+        emit_isa<cpu::x64::avx512_common>(in, out);
+    } else {
+        IE_THROW() << "Snippet BroadcastMove emitter doesn't support " << host_isa_;
+    }
+}
+
+template <mkldnn::impl::cpu::x64::cpu_isa_t isa>
+void FakeBroadcastEmitter::emit_isa(const std::vector<size_t> &in, const std::vector<size_t> &out) const {
+    using Vmm = typename conditional3<isa == cpu::x64::sse41, Xmm, isa == cpu::x64::avx2, Ymm, Zmm>::type;
+    Vmm vmm_dst = Vmm(out[0]);
+
+    if (use_broadcast) {
+        h->uni_vbroadcastss(vmm_dst, Xmm(in[0]));
+    } else if (in[0] != out[0]) {
+        h->uni_vmovups(vmm_dst, Vmm(in[0]));
+    }
+}
+
+/// SCALAR ///
+ScalarEmitter::ScalarEmitter(jit_generator* h, cpu_isa_t isa, const std::shared_ptr<ngraph::Node>& n)
+    : jit_emitter(h, isa, n) {
+    // snippets Scalar derives from Constant without declaring it as the RTTI parent, as_type_ptr misses it
+    const auto value = std::dynamic_pointer_cast<ngraph::op::Constant>(n)->cast_vector<float>()[0];
+    push_arg_entry_of("scalar", float2int(value), true);
+    prepare_table();
+}
+
+void ScalarEmitter::emit_impl(const std::vector<size_t>& in, const std::vector<size_t>& out,
+                              const std::vector<size_t>& pool, const std::vector<size_t>& gpr,
+                              const emitter_context *emit_context) const {
+    if (host_isa_ == cpu::x64::avx2) {
+        emit_isa<cpu::x64::avx2>(in, out);
+    } else if (host_isa_ == cpu::x64::avx512_common) {
+        emit_isa<cpu::x64::avx512_common>(in, out);
+    } else {
+        IE_THROW() << "Snippet Scalar emitter doesn't support " << host_isa_;
+    }
+}
+
+template <mkldnn::impl::cpu::x64::cpu_isa_t isa>
+void ScalarEmitter::emit_isa(const std::vector<size_t> &in, const std::vector<size_t> &out) const {
+    using Vmm = typename conditional3<isa == cpu::x64::sse41, Xmm, isa == cpu::x64::avx2, Ymm, Zmm>::type;
+    h->uni_vmovups(Vmm(out[0]), table_val("scalar"));
+}
+
+/// MEMORY ///
+MemoryEmitter::MemoryEmitter(jit_generator* h, cpu_isa_t isa, const std::shared_ptr<ngraph::Node>& n)
+    : jit_emitter(h, isa, n) {
+    auto& rt = n->get_rt_info();
+    auto it = rt.find("effectiveAddress");
+    if (it == rt.end())
+        IE_THROW() << "Snippet " << n->get_type_name() << " operation " << n->get_friendly_name() << " doesn't have an effective address assigned";
+    ea = static_cast<size_t>(ngraph::as_type_ptr<ngraph::VariantWrapper<int64_t>>(it->second)->get());
+
+    const auto& shape = n->get_input_shape(0);
+    shouldPostIncrement = !shape.empty() && shape.back() != 1;
+}
+
+/// STORE ///
+StoreEmitter::StoreEmitter(jit_generator* h, cpu_isa_t isa, const std::shared_ptr<ngraph::Node>& n)
+    : MemoryEmitter(h, isa, n) {
+    store_emitter.reset(new jit_store_emitter(h, isa, nullptr));
+}
+
+void StoreEmitter::emit_impl(const std::vector<size_t>& in, const std::vector<size_t>& out,
+                             const std::vector<size_t>& pool, const std::vector<size_t>& gpr,
+                             const emitter_context *emit_context) const {
+    const int lanes = static_cast<int>(get_vec_length() / sizeof(float));
+    store_emitter->emit_code({in[0]}, {ea}, std::make_shared<store_emitter_context>(Precision::FP32, Precision::FP32, lanes), pool, gpr);
+
+    if (shouldPostIncrement)
+        h->add(Reg64(ea), get_vec_length());
+}
+
+void StoreEmitter::emit_data() const {
+    store_emitter->emit_data();
+}
+
+/// SCALAR STORE ///
+void ScalarStoreEmitter::emit_impl(const std::vector<size_t>& in, const std::vector<size_t>& out,
+                                   const std::vector<size_t>& pool, const std::vector<size_t>& gpr,
+                                   const emitter_context *emit_context) const {
+    // jit_store_emitter stores a single value with the legacy encoded pextrd,
+    // which would mix SSE and AVX code inside the loop
+    h->uni_vmovss(h->ptr[Reg64(ea)], Xmm(in[0]));
+
+    if (shouldPostIncrement)
+        h->add(Reg64(ea), sizeof(float));
+}
+
+/// LOAD ///
+LoadEmitter::LoadEmitter(jit_generator* h, cpu_isa_t isa, const std::shared_ptr<ngraph::Node>& n)
+    : MemoryEmitter(h, isa, n) {
+    load_emitter.reset(new jit_load_emitter(h, isa, nullptr));
+}
+
+void LoadEmitter::emit_impl(const std::vector<size_t>& in, const std::vector<size_t>& out,
+                            const std::vector<size_t>& pool, const std::vector<size_t>& gpr,
+                            const emitter_context *emit_context) const {
+    if (!shouldPostIncrement) {
+        // the innermost dimension of the input is 1, so a single value is shared by all the lanes
+        if (host_isa_ == cpu::x64::avx2) {
+            emit_isa<cpu::x64::avx2>(out);
+        } else if (host_isa_ == cpu::x64::avx512_common) {
+            emit_isa<cpu::x64::avx512_common>(out);
+        } else {
+            IE_THROW() << "Snippet Load emitter doesn't support " << host_isa_;
+        }
+        return;
+    }
+
+    const int lanes = static_cast<int>(get_vec_length() / sizeof(float));
+    load_emitter->emit_code({ea}, {out[0]}, std::make_shared<load_emitter_context>(Precision::FP32, Precision::FP32, lanes), pool, gpr);
+    h->add(Reg64(ea), get_vec_length());
+}
+
+template <mkldnn::impl::cpu::x64::cpu_isa_t isa>
+void LoadEmitter::emit_isa(const std::vector<size_t> &out) const {
+    using Vmm = typename conditional3<isa == cpu::x64::sse41, Xmm, isa == cpu::x64::avx2, Ymm, Zmm>::type;
+    h->uni_vbroadcastss(Vmm(out[0]), h->ptr[Reg64(ea)]);
+}
+
+void LoadEmitter::emit_data() const {
+    load_emitter->emit_data();
+}
+
+/// BROADCAST LOAD ///
+void BroadcastLoadEmitter::emit_impl(const std::vector<size_t>& in, const std::vector<size_t>& out,
+                                     const std::vector<size_t>& pool, const std::vector<size_t>& gpr,
+                                     const emitter_context *emit_context) const {
+    if (host_isa_ == cpu::x64::avx2) {
+        emit_isa<cpu::x64::avx2>(out);
+    } else if (host_isa_ == cpu::x64::avx512_common) {
+        emit_isa<cpu::x64::avx512_common>(out);
+    } else {
+        IE_THROW() << "Snippet BroadcastLoad emitter doesn't support " << host_isa_;
+    }
+}
+
+template <mkldnn::impl::cpu::x64::cpu_isa_t isa>
+void BroadcastLoadEmitter::emit_isa(const std::vector<size_t> &out) const {
+    using Vmm = typename conditional3<isa == cpu::x64::sse41, Xmm, isa == cpu::x64::avx2, Ymm, Zmm>::type;
+    h->uni_vbroadcastss(Vmm(out[0]), h->ptr[Reg64(ea)]);
+}
+
+/// SCALAR LOAD ///
+void ScalarLoadEmitter::emit_impl(const std::vector<size_t>& in, const std::vector<size_t>& out,
+                                  const std::vector<size_t>& pool, const std::vector<size_t>& gpr,
+                                  const emitter_context *emit_context) const {
+    // jit_load_emitter loads a single value with the legacy encoded pinsrd,
+    // which would mix SSE and AVX code inside the loop
+    h->uni_vmovss(Xmm(out[0]), h->ptr[Reg64(ea)]);
+
+    if (shouldPostIncrement)
+        h->add(Reg64(ea), sizeof(float));
+}
+
+} // namespace MKLDNNPlugin
@@ -31,6 +31,8 @@ enum impl_desc_type {
     reorder = 1<<19,
     // winograd
     winograd = 1<<20,
+    // weights with skipped zero blocks
+    _sparse = 1<<21,
     // real types
     ref_any             = ref  | any,
 
@@ -61,6 +63,9 @@ enum impl_desc_type {
     jit_avx_dw          = jit  | avx    | _dw,
     jit_sse42_dw        = jit  | sse42  | _dw,
     jit_uni_dw          = jit  | uni    | _dw,
+
+    jit_avx512_sparse   = jit  | avx512 | _sparse,
+    jit_avx2_sparse     = jit  | avx2   | _sparse,
 };
 
 impl_desc_type parse_impl_name(std::string impl_desc_name);
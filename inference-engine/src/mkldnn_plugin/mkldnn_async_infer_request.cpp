@@ -7,9 +7,19 @@
 
 MKLDNNPlugin::MKLDNNAsyncInferRequest::MKLDNNAsyncInferRequest(const InferenceEngine::IInferRequestInternal::Ptr& inferRequest,
                                                                const InferenceEngine::ITaskExecutor::Ptr& taskExecutor,
-                                                               const InferenceEngine::ITaskExecutor::Ptr& callbackExecutor)
+                                                               const InferenceEngine::ITaskExecutor::Ptr& callbackExecutor,
+                                                               const MKLDNNBatchCollector::Ptr& batchCollector,
+                                                               InferenceEngine::IStreamsExecutor::TaskPriority priority)
     : InferenceEngine::AsyncInferRequestThreadSafeDefault(inferRequest, taskExecutor, callbackExecutor) {
     static_cast<MKLDNNInferRequest*>(inferRequest.get())->SetAsyncRequest(this);
+    _priority = priority;
+    // The request is inferred by the collector as a part of a batch, the synchronous inference isn't batched
+    if (batchCollector) {
+        auto stageExecutor = batchCollector->MakeStageExecutor(inferRequest.get());
+        _pipeline = {{stageExecutor, [stageExecutor] {
+            stageExecutor->CheckResult();
+        }}};
+    }
 }
 
 MKLDNNPlugin::MKLDNNAsyncInferRequest::~MKLDNNAsyncInferRequest() {
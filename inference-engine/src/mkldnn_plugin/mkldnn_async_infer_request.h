@@ -8,6 +8,7 @@
 #include <map>
 #include <cpp_interfaces/impl/ie_infer_async_request_thread_safe_default.hpp>
 #include "mkldnn_infer_request.h"
+#include "mkldnn_batch_collector.h"
 
 namespace MKLDNNPlugin {
 
@@ -15,7 +16,9 @@ class MKLDNNAsyncInferRequest : public InferenceEngine::AsyncInferRequestThreadS
 public:
     MKLDNNAsyncInferRequest(const InferenceEngine::IInferRequestInternal::Ptr &inferRequest,
                             const InferenceEngine::ITaskExecutor::Ptr &taskExecutor,
-                            const InferenceEngine::ITaskExecutor::Ptr &callbackExecutor);
+                            const InferenceEngine::ITaskExecutor::Ptr &callbackExecutor,
+                            const MKLDNNBatchCollector::Ptr &batchCollector = nullptr,
+                            InferenceEngine::IStreamsExecutor::TaskPriority priority = InferenceEngine::IStreamsExecutor::TaskPriority::NORMAL);
     ~MKLDNNAsyncInferRequest();
 };
 
@@ -0,0 +1,272 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_batch_collector.h"
+#include "mkldnn_itt.h"
+#include "nodes/common/cpu_convert.h"
+#include "nodes/common/cpu_memcpy.h"
+#include "utils/cpu_utils.hpp"
+
+#include <blob_factory.hpp>
+#include <ie_preprocess.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+#include <string>
+
+using namespace InferenceEngine;
+
+namespace MKLDNNPlugin {
+
+namespace {
+
+// Batches are concatenated along the first dimension, so it has to be the outermost one in memory
+void checkBatchable(const std::string& name, const TensorDesc& desc) {
+    const auto layout = desc.getLayout();
+    if (desc.getDims().empty() || layout == Layout::ANY || layout == Layout::BLOCKED || layout == Layout::SCALAR ||
+        desc.getBlockingDesc().getOrder().front() != 0) {
+        IE_THROW() << "Requests can't be batched: the first dimension of " << name << " must be the outermost one";
+    }
+}
+
+TensorDesc getBatchedDesc(const TensorDesc& desc, Precision precision, size_t batch) {
+    auto dims = desc.getDims();
+    dims[0] *= batch;
+    return TensorDesc(precision, dims, desc.getLayout());
+}
+
+}  // namespace
+
+MKLDNNBatchCollector::StageExecutor::StageExecutor(const MKLDNNBatchCollector::Ptr& collector, IInferRequestInternal* request) :
+    _collector(collector), _request(request) {}
+
+void MKLDNNBatchCollector::StageExecutor::run(Task task) {
+    _collector->Enqueue(this, std::move(task));
+}
+
+void MKLDNNBatchCollector::StageExecutor::CheckResult() {
+    auto error = _error;
+    _error = nullptr;
+    if (error)
+        std::rethrow_exception(error);
+}
+
+MKLDNNBatchCollector::MKLDNNBatchCollector(const BatchInfer& infer, const ITaskExecutor::Ptr& taskExecutor,
+                                           const InputsDataMap& inputs, const OutputsDataMap& outputs,
+                                           const std::vector<size_t>& batchSizes, std::chrono::microseconds timeout) :
+    _infer(infer), _taskExecutor(taskExecutor), _inputs(inputs), _outputs(outputs), _batchSizes(batchSizes), _timeout(timeout) {
+    if (_batchSizes.empty())
+        IE_THROW() << "Requests can't be batched without batch sizes";
+    std::sort(_batchSizes.begin(), _batchSizes.end());
+    _maxBatch = _batchSizes.back();
+    for (const auto& input : _inputs) {
+        checkBatchable("input " + input.first, input.second->getTensorDesc());
+        if (normalizeToSupportedPrecision(input.second->getPrecision()) == Precision::UNSPECIFIED)
+            IE_THROW() << "Requests can't be batched: unsupported precision " << input.second->getPrecision() << " of input " << input.first;
+    }
+    for (const auto& output : _outputs) {
+        checkBatchable("output " + output.first, output.second->getTensorDesc());
+    }
+    _thread = std::thread([this] { Run(); });
+}
+
+MKLDNNBatchCollector::~MKLDNNBatchCollector() {
+    {
+        std::lock_guard<std::mutex> lock{_mutex};
+        _stop = true;
+    }
+    _queueChanged.notify_all();
+    if (_thread.joinable())
+        _thread.join();
+}
+
+MKLDNNBatchCollector::StageExecutor::Ptr MKLDNNBatchCollector::MakeStageExecutor(IInferRequestInternal* request) {
+    return std::make_shared<StageExecutor>(shared_from_this(), request);
+}
+
+MKLDNNBatchCollector::Statistics MKLDNNBatchCollector::GetStatistics() const {
+    std::lock_guard<std::mutex> lock{_mutex};
+    return _statistics;
+}
+
+std::vector<size_t> MKLDNNBatchCollector::MakeBatchSizes(size_t maxBatch) {
+    std::vector<size_t> batchSizes;
+    for (size_t batch = 2; batch < maxBatch; batch *= 2)
+        batchSizes.push_back(batch);
+    if (maxBatch > 1)
+        batchSizes.push_back(maxBatch);
+    return batchSizes;
+}
+
+ICNNNetwork::InputShapes MKLDNNBatchCollector::GetBatchedShapes(const InputsDataMap& inputs, size_t batch) {
+    ICNNNetwork::InputShapes shapes;
+    for (const auto& input : inputs) {
+        auto dims = input.second->getTensorDesc().getDims();
+        if (!dims.empty())
+            dims[0] *= batch;
+        shapes[input.first] = dims;
+    }
+    return shapes;
+}
+
+void MKLDNNBatchCollector::Enqueue(StageExecutor* stage, Task task) {
+    {
+        std::lock_guard<std::mutex> lock{_mutex};
+        _queue.push_back({stage, std::move(task), Clock::now()});
+    }
+    _queueChanged.notify_one();
+}
+
+void MKLDNNBatchCollector::Run() {
+    std::unique_lock<std::mutex> lock{_mutex};
+    while (true) {
+        _queueChanged.wait(lock, [this] { return _stop || !_queue.empty(); });
+        if (_queue.empty())
+            return;
+        const auto deadline = _queue.front()._queued + _timeout;
+        _queueChanged.wait_until(lock, deadline, [this] { return _stop || _queue.size() >= _maxBatch; });
+
+        const auto size = std::min(_queue.size(), _maxBatch);
+        auto entries = std::make_shared<std::vector<Entry>>(std::make_move_iterator(_queue.begin()),
+                                                            std::make_move_iterator(_queue.begin() + size));
+        _queue.erase(_queue.begin(), _queue.begin() + size);
+        // The collected requests keep the collector alive. The task takes over the reference, so the collector
+        // isn't destroyed by this thread once the requests are completed.
+        auto self = shared_from_this();
+        auto task = [self, entries] { self->InferBatch(*entries); };
+        self.reset();
+        lock.unlock();
+        _taskExecutor->run(std::move(task));
+        lock.lock();
+    }
+}
+
+bool MKLDNNBatchCollector::CanBatch(IInferRequestInternal* request) const {
+    for (const auto& input : _inputs) {
+        const auto blob = request->GetBlob(input.first);
+        if (!blob->is<MemoryBlob>() || blob->getTensorDesc() != input.second->getTensorDesc())
+            return false;
+        const auto& preProcess = request->GetPreProcess(input.first);
+        if (preProcess.getResizeAlgorithm() != ResizeAlgorithm::NO_RESIZE || preProcess.getColorFormat() != ColorFormat::RAW)
+            return false;
+    }
+    for (const auto& output : _outputs) {
+        const auto blob = request->GetBlob(output.first);
+        if (!blob->is<MemoryBlob>() || blob->getTensorDesc() != output.second->getTensorDesc())
+            return false;
+    }
+    return true;
+}
+
+MKLDNNBatchCollector::Buffers MKLDNNBatchCollector::AcquireBuffers(size_t batch) {
+    {
+        std::lock_guard<std::mutex> lock{_buffersMutex};
+        auto& freeBuffers = _freeBuffers[batch];
+        if (!freeBuffers.empty()) {
+            auto buffers = std::move(freeBuffers.back());
+            freeBuffers.pop_back();
+            return buffers;
+        }
+    }
+    auto allocate = [&] (const TensorDesc& desc, Precision precision) {
+        auto blob = make_blob_with_precision(getBatchedDesc(desc, precision, batch));
+        blob->allocate();
+        return blob;
+    };
+    Buffers buffers;
+    for (const auto& input : _inputs) {
+        const auto& desc = input.second->getTensorDesc();
+        buffers._inputs[input.first] = allocate(desc, normalizeToSupportedPrecision(desc.getPrecision()));
+    }
+    for (const auto& output : _outputs) {
+        const auto& desc = output.second->getTensorDesc();
+        buffers._outputs[output.first] = allocate(desc, desc.getPrecision());
+    }
+    return buffers;
+}
+
+void MKLDNNBatchCollector::ReleaseBuffers(size_t batch, Buffers buffers) {
+    std::lock_guard<std::mutex> lock{_buffersMutex};
+    _freeBuffers[batch].push_back(std::move(buffers));
+}
+
+void MKLDNNBatchCollector::InferBatch(std::vector<Entry>& entries) {
+    OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "MKLDNNBatchCollector::InferBatch");
+    const auto start = Clock::now();
+
+    std::vector<Entry*> batched, alone;
+    for (auto& entry : entries) {
+        (CanBatch(entry._stage->_request) ? batched : alone).push_back(&entry);
+    }
+    if (batched.size() == 1) {
+        alone.push_back(batched.front());
+        batched.clear();
+    }
+
+    // The statistics are updated first, since the collector may be released by the completed requests
+    {
+        std::lock_guard<std::mutex> lock{_mutex};
+        _statistics.requests += entries.size();
+        _statistics.batches += alone.size() + (batched.empty() ? 0 : 1);
+        for (const auto& entry : entries) {
+            const auto queueTime = std::chrono::duration<double, std::milli>(start - entry._queued).count();
+            _statistics.queueTimeSum += queueTime;
+            _statistics.maxQueueTime = std::max(_statistics.maxQueueTime, queueTime);
+        }
+    }
+
+    if (!batched.empty()) {
+        std::exception_ptr error;
+        try {
+            const auto batch = *std::lower_bound(_batchSizes.begin(), _batchSizes.end(), batched.size());
+            auto buffers = AcquireBuffers(batch);
+            for (const auto& input : buffers._inputs) {
+                auto dst = as<MemoryBlob>(input.second)->wmap();
+                const auto dstPrecision = input.second->getTensorDesc().getPrecision();
+                const auto elements = input.second->size() / batch;
+                const auto bytes = input.second->byteSize() / batch;
+                for (size_t i = 0; i < batched.size(); i++) {
+                    auto blob = as<MemoryBlob>(batched[i]->_stage->_request->GetBlob(input.first));
+                    auto src = blob->rmap();
+                    cpu_convert(src.as<const void*>(), dst.as<uint8_t*>() + i * bytes, blob->getTensorDesc().getPrecision(),
+                                dstPrecision, elements);
+                }
+                // The buffers are reused, so the padding rows are cleared of the data of the previous batches
+                std::memset(dst.as<uint8_t*>() + batched.size() * bytes, 0, (batch - batched.size()) * bytes);
+            }
+
+            _infer(buffers._inputs, buffers._outputs);
+
+            for (const auto& output : buffers._outputs) {
+                auto src = as<MemoryBlob>(output.second)->rmap();
+                const auto bytes = output.second->byteSize() / batch;
+                for (size_t i = 0; i < batched.size(); i++) {
+                    auto dst = as<MemoryBlob>(batched[i]->_stage->_request->GetBlob(output.first))->wmap();
+                    cpu_memcpy(dst.as<void*>(), src.as<const uint8_t*>() + i * bytes, bytes);
+                }
+            }
+            ReleaseBuffers(batch, std::move(buffers));
+        } catch (...) {
+            error = std::current_exception();
+        }
+        for (auto entry : batched) {
+            entry->_stage->_error = error;
+        }
+        for (auto entry : batched) {
+            entry->_task();
+        }
+    }
+
+    for (auto entry : alone) {
+        try {
+            entry->_stage->_request->InferImpl();
+        } catch (...) {
+            entry->_stage->_error = std::current_exception();
+        }
+        entry->_task();
+    }
+}
+
+}  // namespace MKLDNNPlugin
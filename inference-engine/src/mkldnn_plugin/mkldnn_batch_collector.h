@@ -0,0 +1,137 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cpp_interfaces/interface/ie_iinfer_request_internal.hpp>
+#include <ie_icnn_network.hpp>
+#include <threading/ie_itask_executor.hpp>
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief Collects the asynchronous requests started concurrently and infers them as one batch.
+ *
+ * The requests are queued until the maximal batch is collected or the first of them waits for the timeout. The inputs
+ * of the requests are copied into the blobs of the smallest batch size which fits them, the rest is padded with zeros.
+ * The batch is inferred on the task executor and the outputs are copied back to the requests, which are completed
+ * one by one. A single request and the requests with blobs other than the network ones are inferred alone.
+ */
+class MKLDNNBatchCollector : public std::enable_shared_from_this<MKLDNNBatchCollector> {
+public:
+    using Ptr = std::shared_ptr<MKLDNNBatchCollector>;
+
+    /**
+     * @brief Infers the batched input blobs into the batched output blobs, the batch size is the first dimension
+     */
+    using BatchInfer = std::function<void(const InferenceEngine::BlobMap&, const InferenceEngine::BlobMap&)>;
+
+    struct Statistics {
+        uint64_t requests = 0;
+        uint64_t batches = 0;
+        // milliseconds
+        double queueTimeSum = 0.0;
+        double maxQueueTime = 0.0;
+    };
+
+    /**
+     * @brief Executor of the pipeline stage which infers the request as a part of a batch.
+     * The stage task is run once the batch is inferred and should call CheckResult().
+     */
+    class StageExecutor : public InferenceEngine::ITaskExecutor {
+    public:
+        using Ptr = std::shared_ptr<StageExecutor>;
+
+        StageExecutor(const MKLDNNBatchCollector::Ptr& collector, InferenceEngine::IInferRequestInternal* request);
+
+        void run(InferenceEngine::Task task) override;
+
+        /**
+         * @brief Throws the error of the last inference of the request if any
+         */
+        void CheckResult();
+
+    private:
+        friend class MKLDNNBatchCollector;
+        MKLDNNBatchCollector::Ptr               _collector;
+        InferenceEngine::IInferRequestInternal* _request = nullptr;
+        std::exception_ptr                      _error;
+    };
+
+    /**
+     * @param taskExecutor Executor of the batches, it must run the tasks in other threads than the calling one
+     * @param batchSizes The batch sizes the network is compiled for, the greatest one is the maximal batch
+     */
+    MKLDNNBatchCollector(const BatchInfer& infer, const InferenceEngine::ITaskExecutor::Ptr& taskExecutor,
+                         const InferenceEngine::InputsDataMap& inputs, const InferenceEngine::OutputsDataMap& outputs,
+                         const std::vector<size_t>& batchSizes, std::chrono::microseconds timeout);
+
+    ~MKLDNNBatchCollector();
+
+    StageExecutor::Ptr MakeStageExecutor(InferenceEngine::IInferRequestInternal* request);
+
+    Statistics GetStatistics() const;
+
+    /**
+     * @brief Returns the sizes of the batches the network should be compiled for to collect up to maxBatch requests:
+     * the powers of two and maxBatch itself
+     */
+    static std::vector<size_t> MakeBatchSizes(size_t maxBatch);
+
+    /**
+     * @brief Returns the shapes of the network inputs with the first dimension multiplied by the batch size
+     */
+    static InferenceEngine::ICNNNetwork::InputShapes GetBatchedShapes(const InferenceEngine::InputsDataMap& inputs, size_t batch);
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    struct Entry {
+        StageExecutor*          _stage;
+        InferenceEngine::Task   _task;
+        Clock::time_point       _queued;
+    };
+
+    struct Buffers {
+        InferenceEngine::BlobMap _inputs;
+        InferenceEngine::BlobMap _outputs;
+    };
+
+    void Enqueue(StageExecutor* stage, InferenceEngine::Task task);
+    void Run();
+    void InferBatch(std::vector<Entry>& entries);
+    bool CanBatch(InferenceEngine::IInferRequestInternal* request) const;
+    Buffers AcquireBuffers(size_t batch);
+    void ReleaseBuffers(size_t batch, Buffers buffers);
+
+    BatchInfer                                  _infer;
+    InferenceEngine::ITaskExecutor::Ptr         _taskExecutor;
+    InferenceEngine::InputsDataMap              _inputs;
+    InferenceEngine::OutputsDataMap             _outputs;
+    std::vector<size_t>                         _batchSizes;
+    size_t                                      _maxBatch;
+    std::chrono::microseconds                   _timeout;
+
+    mutable std::mutex                          _mutex;
+    std::condition_variable                     _queueChanged;
+    std::deque<Entry>                           _queue;
+    bool                                        _stop = false;
+    Statistics                                  _statistics;
+    std::thread                                 _thread;
+
+    std::mutex                                  _buffersMutex;
+    std::map<size_t, std::vector<Buffers>>      _freeBuffers;
+};
+
+}  // namespace MKLDNNPlugin
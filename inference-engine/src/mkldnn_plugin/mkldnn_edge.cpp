@@ -165,6 +165,22 @@ void MKLDNNEdge::allocate(const void* mem_ptr) {
     if (status != Status::NeedAllocation)
         return;
 
+    auto desc = getDescToAllocate();
+    memoryPtr.reset(new MKLDNNMemory(getParent()->getEngine()));
+    memoryPtr->Create(MKLDNNMemoryDesc(desc), mem_ptr, false);  // no pads zeroing
+    status = Status::Allocated;
+}
+
+void MKLDNNEdge::allocate(MKLDNNMemoryArena& arena) {
+    if (status != Status::NeedAllocation)
+        return;
+
+    auto desc = getDescToAllocate();
+    memoryPtr = arena.createMemory(getParent()->getEngine(), MKLDNNMemoryDesc(desc));
+    status = Status::Allocated;
+}
+
+InferenceEngine::TensorDesc MKLDNNEdge::getDescToAllocate() {
     if (memoryPtr)
         IE_THROW() << "Unexpected behaviour: status == NeedAllocation but memory is already allocated.";
 
@@ -177,11 +193,7 @@ void MKLDNNEdge::allocate(const void* mem_ptr) {
         IE_THROW() << "Cannot allocate memory. Nodes have primitive descriptors with different formats.";
     if (inputDesc.getLayout() == InferenceEngine::Layout::ANY)
         IE_THROW() << "Cannot get input descriptor!";
-
-    auto parentPtr = getParent();
-    memoryPtr.reset(new MKLDNNMemory(parentPtr->getEngine()));
-    memoryPtr->Create(MKLDNNMemoryDesc(inputDesc), mem_ptr, false);  // no pads zeroing
-    status = Status::Allocated;
+    return inputDesc;
 }
 
 std::string MKLDNNEdge::name() {
@@ -209,20 +221,26 @@ std::string MKLDNNEdge::name() {
             + "<->" + childPtr->getName() + std::to_string(child_port);
 }
 
-void MKLDNNEdge::externalAllocate(MKLDNNWeightsSharing::Ptr weightsCache) {
+void MKLDNNEdge::externalAllocate(MKLDNNWeightsSharing::Ptr weightsCache, const MKLDNNMemoryArena::Ptr& arena, uint64_t valuesHash) {
     if (status != Status::NeedAllocation)
         return;
 
     if (weightsCache) {
-        auto alloc = [this] () {
-            allocate();
+        auto alloc = [this, &arena] () {
+            if (arena)
+                allocate(*arena);
+            else
+                allocate();
             return memoryPtr;
         };
 
-        auto ptr = weightsCache->findOrCreate(name(), alloc, false);
+        externalMemoryKey = name() + "_" + std::to_string(valuesHash);
+        auto ptr = weightsCache->findOrCreate(externalMemoryKey, alloc, false);
         memoryPtr = *ptr;
         externalMemoryPtr = true;
         status = Status::Allocated;
+    } else if (arena) {
+        allocate(*arena);
     } else {
         allocate();
     }
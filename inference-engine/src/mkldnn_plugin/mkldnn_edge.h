@@ -45,7 +45,12 @@ public:
 
     void init();
     void allocate(const void* mem_ptr = nullptr);
-    void externalAllocate(MKLDNNWeightsSharing::Ptr weightsCache);
+    void allocate(MKLDNNMemoryArena& arena);
+    /**
+     * @brief Allocates the memory of the constant edge shared through the weights cache
+     * @param valuesHash Identifies the values of the edge among the ones of the same name and dims
+     */
+    void externalAllocate(MKLDNNWeightsSharing::Ptr weightsCache, const MKLDNNMemoryArena::Ptr& arena = nullptr, uint64_t valuesHash = 0);
     void reuse(MKLDNNMemoryPtr ptr);
     void validate();
     void drop();
@@ -85,12 +90,14 @@ private:
     int child_port;
 
     bool externalMemoryPtr = false;
+    std::string externalMemoryKey;
     MKLDNNEdgeWeakPtr memoryFromEdge;
     MKLDNNDims dims;
     MKLDNNMemoryPtr memoryPtr;
     Status status = Status::Uninitialized;
 
     InferenceEngine::TensorDesc getInputDesc();
+    InferenceEngine::TensorDesc getDescToAllocate();
     InferenceEngine::TensorDesc getOutputDesc();
     InferenceEngine::TensorDesc getSpecifiedInputDesc(std::map<mkldnn::memory::format_tag, size_t> formats,
                                                       size_t enterCountUp = 1, size_t enterCountDown = 0);
@@ -4,6 +4,7 @@
 
 #include <ie_metric_helpers.hpp>
 #include <precision_utils.h>
+#include <cpu/cpu_config.hpp>
 #include "mkldnn_exec_network.h"
 
 #include "mkldnn_async_infer_request.h"
@@ -11,6 +12,7 @@
 #include "mkldnn_memory_state.h"
 #include "mkldnn_itt.h"
 #include "nodes/mkldnn_memory_node.hpp"
+#include "nodes/common/cpu_convert.h"
 #include <threading/ie_executor_manager.hpp>
 
 #include <threading/ie_cpu_streams_executor.hpp>
@@ -18,8 +20,13 @@
 #include <algorithm>
 #include <unordered_set>
 #include <utility>
+#include <map>
+#include <vector>
 #include <cstring>
+#include <blob_factory.hpp>
 #include <ngraph/opsets/opset1.hpp>
+#include <ngraph/op/mvn.hpp>
+#include <ngraph/op/read_value.hpp>
 #include <transformations/utils/utils.hpp>
 
 using namespace MKLDNNPlugin;
@@ -35,13 +42,15 @@ MKLDNNExecNetwork::CreateInferRequestImpl(InferenceEngine::InputsDataMap network
 MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
                                      const Config &cfg,
                                      const MKLDNNExtensionManager::Ptr& extMgr,
-                                     NumaNodesWeights &numaNodesWeights) :
+                                     NumaNodesWeights &numaNodesWeights,
+                                     const NetworkCompiler &compiler) :
     InferenceEngine::ExecutableNetworkThreadSafeDefault{nullptr, nullptr},
     extensionManager(extMgr),
     _cfg{cfg},
     _name{network.getName()},
     _numaNodesWeights(numaNodesWeights),
-        _network(network) {
+        _network(network),
+    _compiler(compiler) {
     auto function = network.getFunction();
     if (function == nullptr) {
         IE_THROW() << "CPU plug-in doesn't support not ngraph-based model!";
@@ -55,13 +64,40 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
         }
     }
 
+    // The batches of the requests are inferred by the graphs compiled for the batched shapes in the shape cache
+    const auto batchSizes = MKLDNNBatchCollector::MakeBatchSizes(_cfg.batchingMaxBatch);
+    if (!batchSizes.empty()) {
+        if (_cfg.batchLimit > 0) {
+            IE_THROW() << CPUConfigParams::KEY_CPU_BATCHING_MAX_BATCH << " can't be used together with dynamic batch";
+        }
+        if (ngraph::op::util::has_op_with_type<ngraph::op::ReadValueBase>(function)) {
+            IE_THROW() << CPUConfigParams::KEY_CPU_BATCHING_MAX_BATCH << " can't be used for networks with memory states";
+        }
+        if (!_compiler) {
+            IE_THROW() << CPUConfigParams::KEY_CPU_BATCHING_MAX_BATCH << " requires the network to be compiled for the batched shapes";
+        }
+    }
+
+    if (_compiler) {
+        if (_cfg.batchLimit > 0) {
+            IE_THROW() << "Input shapes cache can't be used together with dynamic batch";
+        }
+        for (const auto& input : _network.getInputsInfo()) {
+            _inputShapes[input.first] = input.second->getTensorDesc().getDims();
+        }
+        _shapeCacheSize = std::max(_cfg.shapeCacheSize, _cfg.shapeBuckets.size() + batchSizes.size());
+    }
+
     if (cfg.exclusiveAsyncRequests) {
         // special case when all InferRequests are muxed into a single queue
         _taskExecutor = InferenceEngine::ExecutorManager::getInstance()->getExecutor("CPU");
     } else {
         auto streamsExecutorConfig = InferenceEngine::IStreamsExecutor::Config::MakeDefaultMultiThreaded(_cfg.streamExecutorConfig, isFloatModel);
         streamsExecutorConfig._name = "CPUStreamsExecutor";
-        _taskExecutor = InferenceEngine::ExecutorManager::getInstance()->getIdleCPUStreamsExecutor(streamsExecutorConfig);
+        // the priorities are taken into account only between the requests of one executor
+        _taskExecutor = _cfg.requestPriority == Config::RequestPriority::None
+            ? InferenceEngine::ExecutorManager::getInstance()->getIdleCPUStreamsExecutor(streamsExecutorConfig)
+            : InferenceEngine::ExecutorManager::getInstance()->getSharedCPUStreamsExecutor(streamsExecutorConfig);
     }
     if (0 != cfg.streamExecutorConfig._streams) {
         _callbackExecutor = InferenceEngine::ExecutorManager::getInstance()->getIdleCPUStreamsExecutor(
@@ -79,7 +115,11 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
 
     int streams = std::max(1, _cfg.streamExecutorConfig._streams);
     std::vector<Task> tasks; tasks.resize(streams);
+    // the high priority streams have their own graphs, which are compiled on the first request
+    if (_cfg.requestPriority == Config::RequestPriority::High && _cfg.streamExecutorConfig._streams != 0)
+        streams += _cfg.streamExecutorConfig._highPriorityStreams;
     _graphs.resize(streams);
+    _shapeCaches.resize(streams);
     if (_cfg.streamExecutorConfig._streams != 0) {
         for (auto&& task : tasks) {
             task = [this] {
@@ -91,6 +131,58 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
         MKLDNNExecNetwork::GetGraph();
     }
 
+    if (IsShapeCacheEnabled() && (!_cfg.shapeBuckets.empty() || !batchSizes.empty())) {
+        std::vector<InferenceEngine::ICNNNetwork::InputShapes> buckets;
+        for (const auto& bucket : _cfg.shapeBuckets) {
+            auto shapes = _inputShapes;
+            for (const auto& input : bucket) {
+                auto name = input.first;
+                if (name.empty()) {
+                    if (_inputShapes.size() != 1)
+                        IE_THROW() << "Input name must be specified in " << CPUConfigParams::KEY_CPU_SHAPE_BUCKETS
+                                   << " for network with " << _inputShapes.size() << " inputs";
+                    name = _inputShapes.begin()->first;
+                }
+                auto shape = shapes.find(name);
+                if (shape == shapes.end())
+                    IE_THROW() << "Network doesn't have input " << name << " specified in " << CPUConfigParams::KEY_CPU_SHAPE_BUCKETS;
+                if (shape->second.size() != input.second.size())
+                    IE_THROW() << "Rank of input " << name << " specified in " << CPUConfigParams::KEY_CPU_SHAPE_BUCKETS
+                               << " doesn't match the network one";
+                shape->second = input.second;
+            }
+            buckets.push_back(shapes);
+        }
+        for (auto batch : batchSizes) {
+            buckets.push_back(MKLDNNBatchCollector::GetBatchedShapes(_network.getInputsInfo(), batch));
+        }
+
+        if (_cfg.streamExecutorConfig._streams != 0) {
+            for (auto&& task : tasks) {
+                task = [this, &buckets] {
+                    for (const auto& shapes : buckets)
+                        MKLDNNExecNetwork::GetGraph(shapes);
+                };
+            }
+            _taskExecutor->runAndWait(tasks);
+        } else {
+            for (const auto& shapes : buckets)
+                MKLDNNExecNetwork::GetGraph(shapes);
+        }
+        // Only the shapes of infer requests are accounted
+        _shapeCacheHits = 0;
+        _shapeCacheMisses = 0;
+    }
+
+    if (!batchSizes.empty()) {
+        _batchCollector = std::make_shared<MKLDNNBatchCollector>(
+            [this] (const BlobMap& inputs, const BlobMap& outputs) {
+                InferBatch(inputs, outputs);
+            },
+            _taskExecutor, _network.getInputsInfo(), _network.getOutputsInfo(), batchSizes,
+            std::chrono::microseconds(_cfg.batchingTimeout));
+    }
+
     // Save all MemoryLayer data tensors. Will use insight about mechanics
     // of MemoryLayer implementation. It uses output edge of MemoryLayer
     // producer as storage for tensor to keep it between infer calls.
@@ -122,28 +214,175 @@ MKLDNNExecNetwork::Graph::Lock MKLDNNExecNetwork::GetGraph() {
     }
     auto graphLock = Graph::Lock(_graphs[streamId % _graphs.size()]);
     if (!graphLock._graph.IsReady()) {
-        std::exception_ptr exception;
-        auto makeGraph = [&] {
-            try {
-                {
-                    std::lock_guard<std::mutex> lock{_cfgMutex};
-                    graphLock._graph.setConfig(_cfg);
-                }
-                graphLock._graph.CreateGraph(_network, extensionManager, _numaNodesWeights[numaNodeId]);
-            } catch(...) {
-                exception = std::current_exception();
+        MakeGraph(graphLock._graph, [this] { return _network; }, numaNodeId, _graphs.size() > 1);
+    }
+    return graphLock;
+}
+
+MKLDNNExecNetwork::Graph::Lock MKLDNNExecNetwork::GetGraph(const InferenceEngine::ICNNNetwork::InputShapes& shapes) {
+    if (shapes == _inputShapes) {
+        ++_shapeCacheHits;
+        return GetGraph();
+    }
+    if (!IsShapeCacheEnabled()) {
+        IE_THROW() << "Input shapes don't match the network ones. Set " << CPUConfigParams::KEY_CPU_SHAPE_CACHE_SIZE
+                   << " to compile the network for the new shapes";
+    }
+
+    int streamId = 0;
+    int numaNodeId = 0;
+    auto streamsExecutor = dynamic_cast<InferenceEngine::IStreamsExecutor*>(_taskExecutor.get());
+    if (nullptr != streamsExecutor) {
+        streamId = streamsExecutor->GetStreamId();
+        numaNodeId = streamsExecutor->GetNumaNodeId();
+    }
+    auto& cache = _shapeCaches[streamId % _shapeCaches.size()];
+    auto sameShapes = [&shapes] (const std::pair<InferenceEngine::ICNNNetwork::InputShapes, std::shared_ptr<Graph>>& entry) {
+        return entry.first == shapes;
+    };
+    {
+        std::lock_guard<std::mutex> lock{cache._mutex};
+        auto found = std::find_if(cache._graphs.begin(), cache._graphs.end(), sameShapes);
+        if (found != cache._graphs.end()) {
+            cache._graphs.splice(cache._graphs.begin(), cache._graphs, found);
+            ++_shapeCacheHits;
+            return Graph::Lock(found->second);
+        }
+    }
+
+    ++_shapeCacheMisses;
+    auto graphLock = Graph::Lock(std::make_shared<Graph>());
+    MakeGraph(graphLock._graph, [&] {
+        // Transformations are not guaranteed to be thread safe for the same source network
+        std::lock_guard<std::mutex> lock{_compilerMutex};
+        return _compiler(shapes);
+    }, numaNodeId);
+    {
+        std::lock_guard<std::mutex> lock{cache._mutex};
+        // The same shapes could be compiled by other request of this stream meanwhile
+        cache._graphs.remove_if(sameShapes);
+        cache._graphs.emplace_front(shapes, graphLock.owner());
+        while (cache._graphs.size() > _shapeCacheSize) {
+            cache._graphs.pop_back();
+        }
+    }
+    return graphLock;
+}
+
+void MKLDNNExecNetwork::MakeGraph(Graph& graph, const std::function<InferenceEngine::CNNNetwork()>& getNetwork, int numaNodeId,
+                                  bool fromTemplate) {
+    std::exception_ptr exception;
+    auto makeGraph = [&] {
+        try {
+            MKLDNNWeightsSharing::Ptr weightsCache;
+            {
+                std::lock_guard<std::mutex> lock{_cfgMutex};
+                graph.setConfig(_cfg);
+                weightsCache = _numaNodesWeights.get(numaNodeId, _cfg.memoryArena);
+                // the graph doesn't use the weights cache if it's the only one, while the arena is used anyway
+                graph.setMemoryArena(_numaNodesWeights.getArena(numaNodeId, _cfg.memoryArena));
+                graph.setConstantsKeyedByValues(IsShapeCacheEnabled());
             }
-        };
-        if (nullptr != streamsExecutor) {
-            streamsExecutor->Execute(makeGraph);
+            if (fromTemplate && MakeGraphFromTemplate(graph, numaNodeId, weightsCache))
+                return;
+            const InferenceEngine::CNNNetwork network = getNetwork();
+            graph.CreateGraph(network, extensionManager, weightsCache);
+        } catch(...) {
+            exception = std::current_exception();
+        }
+    };
+    auto streamsExecutor = dynamic_cast<InferenceEngine::IStreamsExecutor*>(_taskExecutor.get());
+    if (nullptr != streamsExecutor) {
+        streamsExecutor->Execute(makeGraph);
+    } else {
+        makeGraph();
+    }
+    if (exception) {
+        std::rethrow_exception(exception);
+    }
+}
+
+bool MKLDNNExecNetwork::MakeGraphFromTemplate(Graph& graph, int numaNodeId, MKLDNNWeightsSharing::Ptr& weightsCache) {
+    std::shared_ptr<MKLDNNGraph> graphTemplate;
+    {
+        // the templates of different NUMA nodes are compiled one by one as well, which is rare enough
+        std::lock_guard<std::mutex> lock{_graphTemplatesMutex};
+        auto found = _graphTemplates.find(numaNodeId);
+        if (found != _graphTemplates.end()) {
+            graphTemplate = found->second;
         } else {
-            makeGraph();
+            graphTemplate = std::make_shared<MKLDNNGraph>();
+            graphTemplate->setConfig(graph.getConfig());
+            graphTemplate->setMemoryArena(graph.getMemoryArena());
+            graphTemplate->setConstantsKeyedByValues(graph.getConstantsKeyedByValues());
+            graphTemplate->CreateGraphTemplate(_network, extensionManager, weightsCache);
+            _graphTemplates[numaNodeId] = graphTemplate;
         }
-        if (exception) {
-            std::rethrow_exception(exception);
+    }
+    if (!graphTemplate)
+        return false;
+
+    if (!graph.CreateGraph(*graphTemplate)) {
+        std::lock_guard<std::mutex> lock{_graphTemplatesMutex};
+        _graphTemplates[numaNodeId] = nullptr;
+        return false;
+    }
+    return true;
+}
+
+MKLDNNGraph::ReorderStatistics MKLDNNExecNetwork::GetGreedyReorderStatistics() {
+    if (_cfg.layoutAssignment == Config::LayoutAssignment::Greedy)
+        return GetGraph()._graph.getReorderStatistics();
+
+    std::lock_guard<std::mutex> lock{_greedyReorderStatisticsMutex};
+    if (!_greedyReorderStatistics) {
+        Config config;
+        {
+            std::lock_guard<std::mutex> cfgLock{_cfgMutex};
+            config = _cfg;
         }
+        config.layoutAssignment = Config::LayoutAssignment::Greedy;
+        // the graph is compiled up to the memory allocation just to count its reorders, so it shares nothing
+        MKLDNNGraph graph;
+        graph.setConfig(config);
+        MKLDNNWeightsSharing::Ptr weightsCache;
+        graph.CreateGraphTemplate(_network, extensionManager, weightsCache);
+        _greedyReorderStatistics.reset(new MKLDNNGraph::ReorderStatistics(graph.getReorderStatistics()));
     }
-    return graphLock;
+    return *_greedyReorderStatistics;
+}
+
+void MKLDNNExecNetwork::InferBatch(const InferenceEngine::BlobMap& inputs, const InferenceEngine::BlobMap& outputs) {
+    InferenceEngine::ICNNNetwork::InputShapes shapes;
+    for (const auto& input : inputs) {
+        shapes[input.first] = input.second->getTensorDesc().getDims();
+    }
+    auto graphLock = GetGraph(shapes);
+    auto& graph = graphLock._graph;
+
+    InferenceEngine::BlobMap graphOutputs;
+    graph.getOutputBlobs(graphOutputs);
+    for (const auto& output : outputs) {
+        if (graphOutputs.at(output.first)->getTensorDesc().getDims() != output.second->getTensorDesc().getDims())
+            IE_THROW() << "Requests can't be batched: the first dimension of output " << output.first
+                       << " doesn't follow the batch size of the inputs";
+    }
+
+    for (const auto& input : inputs) {
+        auto blob = input.second;
+        // the mean image is applied to FP32 data only
+        if (graph.hasMeanImageFor(input.first) && blob->getTensorDesc().getPrecision() != Precision::FP32) {
+            const auto& desc = blob->getTensorDesc();
+            auto converted = make_blob_with_precision(TensorDesc(Precision::FP32, desc.getDims(), desc.getLayout()));
+            converted->allocate();
+            cpu_convert(blob->cbuffer().as<const void*>(), converted->buffer().as<void*>(), desc.getPrecision(),
+                        Precision::FP32, blob->size());
+            blob = converted;
+        }
+        graph.PushInputData(input.first, blob);
+    }
+    graph.Infer();
+    graph.PullOutputData(outputs);
 }
 
 void MKLDNNExecNetwork::setProperty(const std::map<std::string, std::string> &properties) {
@@ -160,14 +399,45 @@ void MKLDNNExecNetwork::setProperty(const std::map<std::string, std::string> &pr
 }
 
 InferenceEngine::IInferRequestInternal::Ptr MKLDNNExecNetwork::CreateInferRequest() {
-    return CreateAsyncInferRequestFromSync<MKLDNNAsyncInferRequest>();
+    auto syncRequest = CreateInferRequestImpl(_networkInputs, _networkOutputs);
+    syncRequest->setPointerToExecutableNetworkInternal(shared_from_this());
+    const auto priority = _cfg.requestPriority == Config::RequestPriority::High ? IStreamsExecutor::TaskPriority::HIGH
+                                                                               : IStreamsExecutor::TaskPriority::NORMAL;
+    return std::make_shared<MKLDNNAsyncInferRequest>(syncRequest, _taskExecutor, _callbackExecutor, _batchCollector, priority);
+}
+
+std::shared_ptr<InferenceEngine::RemoteContext> MKLDNNExecNetwork::GetContext() const {
+    if (_plugin == nullptr)
+        IE_THROW() << "The network isn't loaded by the plugin";
+    return _plugin->GetDefaultContext({});
 }
 
 InferenceEngine::CNNNetwork MKLDNNExecNetwork::GetExecGraphInfo() {
     if (_graphs.size() == 0)
         IE_THROW() << "No graph was found";
 
-    return GetGraph()._graph.dump();
+    // The inputs and outputs are counted by the graphs of all the streams and of the cached shapes,
+    // the graphs evicted from the shape cache are not counted
+    std::map<std::string, MKLDNNGraph::IOStatistics> ioStatistics;
+    for (auto& graph : _graphs) {
+        auto graphLock = Graph::Lock(graph);
+        if (graphLock._graph.IsReady())
+            graphLock._graph.AccumulateIOStatistics(ioStatistics);
+    }
+    for (auto& cache : _shapeCaches) {
+        std::vector<std::shared_ptr<Graph>> graphs;
+        {
+            std::lock_guard<std::mutex> lock{cache._mutex};
+            for (const auto& entry : cache._graphs)
+                graphs.push_back(entry.second);
+        }
+        for (const auto& graph : graphs) {
+            auto graphLock = Graph::Lock(graph);
+            graphLock._graph.AccumulateIOStatistics(ioStatistics);
+        }
+    }
+
+    return GetGraph()._graph.dump(ioStatistics);
 }
 
 Parameter MKLDNNExecNetwork::GetConfig(const std::string &name) const {
@@ -195,6 +465,27 @@ InferenceEngine::Parameter MKLDNNExecNetwork::GetMetric(const std::string &name)
         metrics.push_back(METRIC_KEY(SUPPORTED_METRICS));
         metrics.push_back(METRIC_KEY(SUPPORTED_CONFIG_KEYS));
         metrics.push_back(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS));
+        if (IsShapeCacheEnabled()) {
+            metrics.push_back(CPU_METRIC_KEY(SHAPE_CACHE_HITS));
+            metrics.push_back(CPU_METRIC_KEY(SHAPE_CACHE_MISSES));
+        }
+        metrics.push_back(CPU_METRIC_KEY(GREEDY_REORDER_COUNT));
+        metrics.push_back(CPU_METRIC_KEY(GREEDY_REORDER_BYTES));
+        metrics.push_back(CPU_METRIC_KEY(REORDER_COUNT));
+        metrics.push_back(CPU_METRIC_KEY(REORDER_BYTES));
+        if (_cfg.throughputAutoTune)
+            metrics.push_back(CPU_METRIC_KEY(THROUGHPUT_AUTO_TUNE_RESULT));
+        if (_batchCollector) {
+            metrics.push_back(CPU_METRIC_KEY(BATCHING_AVERAGE_BATCH_SIZE));
+            metrics.push_back(CPU_METRIC_KEY(BATCHING_AVERAGE_QUEUE_TIME));
+            metrics.push_back(CPU_METRIC_KEY(BATCHING_MAX_QUEUE_TIME));
+        }
+        if (_cfg.requestPriority != Config::RequestPriority::None) {
+            metrics.push_back(CPU_METRIC_KEY(NORMAL_PRIORITY_AVERAGE_LATENCY));
+            metrics.push_back(CPU_METRIC_KEY(NORMAL_PRIORITY_MAX_LATENCY));
+            metrics.push_back(CPU_METRIC_KEY(HIGH_PRIORITY_AVERAGE_LATENCY));
+            metrics.push_back(CPU_METRIC_KEY(HIGH_PRIORITY_MAX_LATENCY));
+        }
         IE_SET_METRIC_RETURN(SUPPORTED_METRICS, metrics);
     } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
         std::vector<std::string> configKeys;
@@ -209,11 +500,141 @@ InferenceEngine::Parameter MKLDNNExecNetwork::GetMetric(const std::string &name)
         auto streams = std::stoi(option->second);
         IE_SET_METRIC_RETURN(OPTIMAL_NUMBER_OF_INFER_REQUESTS, static_cast<unsigned int>(
             streams ? streams : 1));
+    } else if (IsShapeCacheEnabled() && name == CPU_METRIC_KEY(SHAPE_CACHE_HITS)) {
+        IE_SET_METRIC_RETURN(CPU_SHAPE_CACHE_HITS, _shapeCacheHits.load());
+    } else if (IsShapeCacheEnabled() && name == CPU_METRIC_KEY(SHAPE_CACHE_MISSES)) {
+        IE_SET_METRIC_RETURN(CPU_SHAPE_CACHE_MISSES, _shapeCacheMisses.load());
+    } else if (name == CPU_METRIC_KEY(GREEDY_REORDER_COUNT)) {
+        IE_SET_METRIC_RETURN(CPU_GREEDY_REORDER_COUNT,
+                             const_cast<MKLDNNExecNetwork*>(this)->GetGreedyReorderStatistics().reorders);
+    } else if (name == CPU_METRIC_KEY(GREEDY_REORDER_BYTES)) {
+        IE_SET_METRIC_RETURN(CPU_GREEDY_REORDER_BYTES,
+                             const_cast<MKLDNNExecNetwork*>(this)->GetGreedyReorderStatistics().bytes);
+    } else if (name == CPU_METRIC_KEY(REORDER_COUNT)) {
+        IE_SET_METRIC_RETURN(CPU_REORDER_COUNT,
+                             const_cast<MKLDNNExecNetwork*>(this)->GetGraph()._graph.getReorderStatistics().reorders);
+    } else if (name == CPU_METRIC_KEY(REORDER_BYTES)) {
+        IE_SET_METRIC_RETURN(CPU_REORDER_BYTES,
+                             const_cast<MKLDNNExecNetwork*>(this)->GetGraph()._graph.getReorderStatistics().bytes);
+    } else if (_cfg.throughputAutoTune && name == CPU_METRIC_KEY(THROUGHPUT_AUTO_TUNE_RESULT)) {
+        std::map<std::string, std::string> result = {
+            {PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, std::to_string(_cfg.streamExecutorConfig._streams)},
+            {PluginConfigParams::KEY_CPU_THREADS_NUM, std::to_string(_cfg.streamExecutorConfig._threads)}};
+        IE_SET_METRIC_RETURN(CPU_THROUGHPUT_AUTO_TUNE_RESULT, result);
+    } else if (_batchCollector && name == CPU_METRIC_KEY(BATCHING_AVERAGE_BATCH_SIZE)) {
+        const auto statistics = _batchCollector->GetStatistics();
+        IE_SET_METRIC_RETURN(CPU_BATCHING_AVERAGE_BATCH_SIZE, statistics.batches == 0 ? 0.f :
+                             static_cast<float>(statistics.requests) / statistics.batches);
+    } else if (_batchCollector && name == CPU_METRIC_KEY(BATCHING_AVERAGE_QUEUE_TIME)) {
+        const auto statistics = _batchCollector->GetStatistics();
+        IE_SET_METRIC_RETURN(CPU_BATCHING_AVERAGE_QUEUE_TIME, statistics.requests == 0 ? 0.f :
+                             static_cast<float>(statistics.queueTimeSum / statistics.requests));
+    } else if (_batchCollector && name == CPU_METRIC_KEY(BATCHING_MAX_QUEUE_TIME)) {
+        IE_SET_METRIC_RETURN(CPU_BATCHING_MAX_QUEUE_TIME, static_cast<float>(_batchCollector->GetStatistics().maxQueueTime));
+    } else if (_cfg.requestPriority != Config::RequestPriority::None && name == CPU_METRIC_KEY(NORMAL_PRIORITY_AVERAGE_LATENCY)) {
+        const auto statistics = GetLatencyStatistics(IStreamsExecutor::TaskPriority::NORMAL);
+        IE_SET_METRIC_RETURN(CPU_NORMAL_PRIORITY_AVERAGE_LATENCY, statistics.tasks == 0 ? 0.f :
+                             static_cast<float>(statistics.latencySum / statistics.tasks));
+    } else if (_cfg.requestPriority != Config::RequestPriority::None && name == CPU_METRIC_KEY(NORMAL_PRIORITY_MAX_LATENCY)) {
+        IE_SET_METRIC_RETURN(CPU_NORMAL_PRIORITY_MAX_LATENCY,
+                             static_cast<float>(GetLatencyStatistics(IStreamsExecutor::TaskPriority::NORMAL).maxLatency));
+    } else if (_cfg.requestPriority != Config::RequestPriority::None && name == CPU_METRIC_KEY(HIGH_PRIORITY_AVERAGE_LATENCY)) {
+        const auto statistics = GetLatencyStatistics(IStreamsExecutor::TaskPriority::HIGH);
+        IE_SET_METRIC_RETURN(CPU_HIGH_PRIORITY_AVERAGE_LATENCY, statistics.tasks == 0 ? 0.f :
+                             static_cast<float>(statistics.latencySum / statistics.tasks));
+    } else if (_cfg.requestPriority != Config::RequestPriority::None && name == CPU_METRIC_KEY(HIGH_PRIORITY_MAX_LATENCY)) {
+        IE_SET_METRIC_RETURN(CPU_HIGH_PRIORITY_MAX_LATENCY,
+                             static_cast<float>(GetLatencyStatistics(IStreamsExecutor::TaskPriority::HIGH).maxLatency));
     } else {
         IE_THROW() << "Unsupported ExecutableNetwork metric: " << name;
     }
 }
 
+CPUStreamsExecutor::LatencyStatistics MKLDNNExecNetwork::GetLatencyStatistics(IStreamsExecutor::TaskPriority priority) const {
+    auto streamsExecutor = std::dynamic_pointer_cast<CPUStreamsExecutor>(_taskExecutor);
+    return streamsExecutor == nullptr ? CPUStreamsExecutor::LatencyStatistics{} : streamsExecutor->GetLatencyStatistics(priority);
+}
+
+// Returns true if the constant input of the operation doesn't contain the batch axis
+static bool isBatchNotInConstAxes(const std::shared_ptr<ngraph::Node>& op, size_t port) {
+    const auto axesNode = std::dynamic_pointer_cast<const ngraph::opset1::Constant>(op->get_input_node_shared_ptr(port));
+    if (!axesNode)
+        return false;
+    const auto rank = static_cast<int64_t>(op->get_input_shape(0).size());
+    const auto axes = axesNode->cast_vector<int64_t>();
+    return std::none_of(axes.begin(), axes.end(), [rank](int64_t axis) { return axis == 0 || axis == -rank; });
+}
+
+// Returns true if the first value of the constant input of the operation is the expected one
+static bool isFirstConstValue(const std::shared_ptr<ngraph::Node>& op, size_t port, int64_t expected) {
+    const auto constNode = std::dynamic_pointer_cast<const ngraph::opset1::Constant>(op->get_input_node_shared_ptr(port));
+    if (!constNode)
+        return false;
+    const auto values = constNode->cast_vector<int64_t>();
+    return !values.empty() && values[0] == expected;
+}
+
+// Returns true if the operation processes the items of the batch independently, so the first items of the dynamic
+// batch can be inferred alone. The nodes which don't support dynamic batch still process the whole batch.
+static bool isBatchIndependent(const std::shared_ptr<ngraph::Node>& op) {
+    switch (TypeFromName(op->get_type_name())) {
+        case Input:
+        case Output:
+        case Convolution:
+        case Deconvolution:
+        case Lrn:
+        case Pooling:
+        case FullyConnected:
+        case MatMul:
+        case Softmax:
+        case Eltwise:
+        case Math:
+        case Convert:
+        case DepthToSpace:
+        case SpaceToDepth:
+            return true;
+        case Tile:
+            return isFirstConstValue(op, 1, 1);
+        case Reshape:
+            return op->get_input_shape(0)[0] == op->get_output_shape(0)[0];
+        case Split:
+            return isBatchNotInConstAxes(op, 1);
+        case Concatenation: {
+            const auto concat = std::dynamic_pointer_cast<const ngraph::opset1::Concat>(op);
+            const auto rank = static_cast<int64_t>(op->get_output_shape(0).size());
+            return concat && concat->get_axis() != 0 && concat->get_axis() != -rank;
+        }
+        case ShuffleChannels: {
+            const auto shuffle = std::dynamic_pointer_cast<const ngraph::opset1::ShuffleChannels>(op);
+            const auto rank = static_cast<int64_t>(op->get_input_shape(0).size());
+            return shuffle && shuffle->get_axis() != 0 && shuffle->get_axis() != -rank;
+        }
+        case Transpose:
+            return isFirstConstValue(op, 1, 0);
+        case Pad:
+            return isFirstConstValue(op, 1, 0) && isFirstConstValue(op, 2, 0);
+        case MVN:
+            if (const auto mvn = std::dynamic_pointer_cast<const ngraph::op::v0::MVN>(op))
+                return mvn->get_reduction_axes().count(0) == 0;
+            return isBatchNotInConstAxes(op, 1);
+        case NormalizeL2:
+        case Reduce:
+            return isBatchNotInConstAxes(op, 1);
+        case Interpolate:
+            return op->get_input_shape(0)[0] == op->get_output_shape(0)[0];
+        case FakeQuantize:
+            // the quantization ranges must be broadcasted along the batch
+            for (size_t port = 1; port < op->get_input_size(); port++) {
+                const auto& shape = op->get_input_shape(port);
+                if (shape.size() == op->get_input_shape(0).size() && shape[0] != 1)
+                    return false;
+            }
+            return true;
+        default:
+            return false;
+    }
+}
+
 bool MKLDNNExecNetwork::CanProcessDynBatch(const InferenceEngine::CNNNetwork &network) const {
     InputsDataMap inputs = network.getInputsInfo();
 
@@ -226,39 +647,7 @@ bool MKLDNNExecNetwork::CanProcessDynBatch(const InferenceEngine::CNNNetwork &ne
     }
 
     auto ops = function->get_ordered_ops();
-    for (auto op : ops) {
-        auto type = TypeFromName(op->get_type_name());
-        if (type == Tile) {
-            const auto tile = std::dynamic_pointer_cast<const ngraph::opset1::Tile>(op);
-            const auto repeatsNode = std::dynamic_pointer_cast<const ngraph::opset1::Constant>(tile->get_input_node_shared_ptr(1));
-            if (!repeatsNode)
-                return false;
-            if (tile && repeatsNode->cast_vector<int64_t>()[0] == 1)
-                continue;
-        }
-
-        if (type == Reshape) {
-            if (op->get_input_shape(0)[0] == op->get_output_shape(0)[0])
-                continue;
-        }
-
-        if (type != Input &&
-            type != Output &&
-            type != Convolution &&
-            type != Deconvolution &&
-            type != Lrn &&
-            type != Pooling &&
-            type != FullyConnected &&
-            type != MatMul &&
-            type != Softmax &&
-            type != Split &&
-            type != Concatenation &&
-                type != Eltwise) {
-            return false;
-        }
-    }
-
-    return true;
+    return std::all_of(ops.begin(), ops.end(), isBatchIndependent);
 }
 
 IE_SUPPRESS_DEPRECATED_START
@@ -9,13 +9,17 @@
 
 #include "mkldnn_graph.h"
 #include "mkldnn_extension_mngr.h"
+#include "mkldnn_batch_collector.h"
 #include <threading/ie_thread_local.hpp>
+#include <threading/ie_cpu_streams_executor.hpp>
 
 #include <vector>
 #include <memory>
 #include <map>
 #include <string>
 #include <unordered_map>
+#include <functional>
+#include <list>
 
 namespace MKLDNNPlugin {
 
@@ -23,6 +27,11 @@ class MKLDNNExecNetwork: public InferenceEngine::ExecutableNetworkThreadSafeDefa
 public:
     typedef std::shared_ptr<MKLDNNExecNetwork> Ptr;
 
+    /**
+     * @brief Returns the network reshaped to the given input shapes and transformed for the CPU plugin
+     */
+    using NetworkCompiler = std::function<InferenceEngine::CNNNetwork(const InferenceEngine::ICNNNetwork::InputShapes&)>;
+
     std::shared_ptr<InferenceEngine::IInferRequestInternal>
     CreateInferRequestImpl(InferenceEngine::InputsDataMap networkInputs,
                            InferenceEngine::OutputsDataMap networkOutputs) override;
@@ -30,7 +39,8 @@ public:
     InferenceEngine::IInferRequestInternal::Ptr CreateInferRequest() override;
 
     MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network, const Config &cfg,
-                      const MKLDNNExtensionManager::Ptr &extMgr, NumaNodesWeights &weightsSharing);
+                      const MKLDNNExtensionManager::Ptr &extMgr, NumaNodesWeights &weightsSharing,
+                      const NetworkCompiler &compiler = {});
 
     void setProperty(const std::map<std::string, std::string> &properties);
 
@@ -40,6 +50,8 @@ public:
 
     InferenceEngine::CNNNetwork GetExecGraphInfo() override;
 
+    std::shared_ptr<InferenceEngine::RemoteContext> GetContext() const override;
+
     INFERENCE_ENGINE_DEPRECATED("Use InferRequest::QueryState instead")
     std::vector<InferenceEngine::IVariableStateInternal::Ptr> QueryState() override;
 
@@ -54,8 +66,15 @@ protected:
     std::string                                 _name;
     struct Graph : public MKLDNNGraph {
         std::mutex  _mutex;
-        struct Lock : public std::unique_lock<std::mutex> {
+        // Keeps the graph compiled for non-default shapes alive while it is locked, even if it is evicted from the cache
+        struct Owner {
+            std::shared_ptr<Graph>          _owner;
+        };
+        struct Lock : private Owner, public std::unique_lock<std::mutex> {
             explicit Lock(Graph& graph) : std::unique_lock<std::mutex>(graph._mutex), _graph(graph) {}
+            explicit Lock(const std::shared_ptr<Graph>& graph) :
+                Owner{graph}, std::unique_lock<std::mutex>(graph->_mutex), _graph(*graph) {}
+            std::shared_ptr<Graph> owner() const { return _owner; }
             Graph&                          _graph;
         };
     };
@@ -63,12 +82,69 @@ protected:
     std::deque<Graph>                           _graphs;
     NumaNodesWeights&                           _numaNodesWeights;
 
+    // The network is compiled once per NUMA node and the graphs of the streams are made from the copies of the
+    // template nodes. The templates are kept alive, since the graphs share the data prepared by the template nodes.
+    // nullptr means that the graph can't be made from the template, so each stream compiles the network on its own.
+    std::map<int, std::shared_ptr<MKLDNNGraph>> _graphTemplates;
+    std::mutex                                  _graphTemplatesMutex;
+
+    // Graphs compiled for non-default input shapes, the most recently used go first
+    struct ShapeCache {
+        std::mutex                                                                          _mutex;
+        std::list<std::pair<InferenceEngine::ICNNNetwork::InputShapes, std::shared_ptr<Graph>>> _graphs;
+    };
+    // WARNING: Do not use _shapeCaches directly.
+    std::deque<ShapeCache>                      _shapeCaches;
+    NetworkCompiler                             _compiler;
+    std::mutex                                  _compilerMutex;
+    InferenceEngine::ICNNNetwork::InputShapes   _inputShapes;
+    size_t                                      _shapeCacheSize = 0;
+    std::atomic<uint64_t>                       _shapeCacheHits = {0};
+    std::atomic<uint64_t>                       _shapeCacheMisses = {0};
+    // Collects the asynchronous requests into batches if CPU_BATCHING_MAX_BATCH is set
+    MKLDNNBatchCollector::Ptr                   _batchCollector;
+    // Reorders of the network compiled with the greedy layout assignment, counted on the first query if the graphs
+    // use the global one
+    std::unique_ptr<MKLDNNGraph::ReorderStatistics> _greedyReorderStatistics;
+    std::mutex                                  _greedyReorderStatisticsMutex;
+
+    bool IsShapeCacheEnabled() const { return _shapeCacheSize != 0; }
+
+    MKLDNNGraph::ReorderStatistics GetGreedyReorderStatistics();
+
     /* WARNING: Use GetGraph() function to get access to graph in current stream.
      * NOTE: Main thread is interpreted as master thread of external stream so use this function to get access to graphs
      *       even from main thread
      */
     Graph::Lock GetGraph();
 
+    /* Returns the graph in current stream compiled for the given input shapes.
+     * The graph is compiled on the first request and kept in the per stream least recently used cache.
+     */
+    Graph::Lock GetGraph(const InferenceEngine::ICNNNetwork::InputShapes& shapes);
+
+    /* Compiles the graph in the current stream. The graph for the default input shapes of the network with several
+     * streams is made from the template if possible.
+     */
+    void MakeGraph(Graph& graph, const std::function<InferenceEngine::CNNNetwork()>& getNetwork, int numaNodeId,
+                   bool fromTemplate = false);
+
+    /* Makes the graph from the template compiled for the NUMA node of the stream. The template is compiled by the first
+     * stream of the NUMA node, the others wait for it.
+     * Returns false if the graph can't be made from the template.
+     */
+    bool MakeGraphFromTemplate(Graph& graph, int numaNodeId, MKLDNNWeightsSharing::Ptr& weightsCache);
+
+    /* Infers the inputs of the requests collected into a batch with the graph of the current stream compiled for
+     * the batched input shapes.
+     */
+    void InferBatch(const InferenceEngine::BlobMap& inputs, const InferenceEngine::BlobMap& outputs);
+
+    /* Returns the latencies of the requests with the given priority run by the streams executor of the network,
+     * including the requests of the other networks sharing the executor.
+     */
+    InferenceEngine::CPUStreamsExecutor::LatencyStatistics GetLatencyStatistics(InferenceEngine::IStreamsExecutor::TaskPriority priority) const;
+
     bool CanProcessDynBatch(const InferenceEngine::CNNNetwork &network) const;
 };
 
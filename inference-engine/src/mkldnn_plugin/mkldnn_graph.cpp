@@ -13,10 +13,12 @@
 #include <unordered_map>
 #include <memory>
 #include <utility>
+#include <functional>
 
 #include "mkldnn_graph.h"
 #include "mkldnn_graph_dumper.h"
 #include "mkldnn_graph_optimizer.h"
+#include "mkldnn_layout_assignment.h"
 #include "mkldnn_extension_utils.h"
 #include "mkldnn_extension_mngr.h"
 #include "mkldnn_memory_solver.hpp"
@@ -25,6 +27,7 @@
 #include <nodes/mkldnn_input_node.h>
 #include <nodes/mkldnn_reorder_node.h>
 #include <nodes/mkldnn_convert_node.h>
+#include <nodes/mkldnn_fullyconnected_node.h>
 
 #include <ie_algorithm.hpp>
 #include <blob_factory.hpp>
@@ -71,10 +74,12 @@ void MKLDNNGraph::CreateGraph(NET &net, const MKLDNNExtensionManager::Ptr& extMg
         MKLDNNWeightsSharing::Ptr &w_cache) {
     OV_ITT_SCOPE(FIRST_INFERENCE, MKLDNNPlugin::itt::domains::MKLDNN_LT, "CreateGraph");
 
-    if (IsReady())
+    if (status != NotReady)
         ForgetGraphData();
     // disable caching if graph was created only once
-    weightsCache = config.streamExecutorConfig._streams != 1 ? w_cache : nullptr;
+    // graphs compiled for other input shapes share weights with the default one
+    const bool hasShapeVariants = config.shapeCacheSize != 0 || !config.shapeBuckets.empty() || config.batchingMaxBatch > 1;
+    weightsCache = config.streamExecutorConfig._streams != 1 || hasShapeVariants ? w_cache : nullptr;
 
     Replicate(net, extMgr);
     InitGraph();
@@ -89,6 +94,108 @@ template void MKLDNNGraph::CreateGraph(const std::shared_ptr<const ngraph::Funct
 template void MKLDNNGraph::CreateGraph(const CNNNetwork&,
         const MKLDNNExtensionManager::Ptr&, MKLDNNWeightsSharing::Ptr&);
 
+void MKLDNNGraph::CreateGraphTemplate(const CNNNetwork &network, const MKLDNNExtensionManager::Ptr& extMgr,
+                                      MKLDNNWeightsSharing::Ptr &w_cache) {
+    OV_ITT_SCOPE(FIRST_INFERENCE, MKLDNNPlugin::itt::domains::MKLDNN_LT, "CreateGraphTemplate");
+
+    if (status != NotReady)
+        ForgetGraphData();
+    // the graphs made from the template share the weights with it
+    weightsCache = w_cache;
+
+    Replicate(network, extMgr);
+    CompileGraph();
+
+    status = Template;
+}
+
+bool MKLDNNGraph::CreateGraph(const MKLDNNGraph &graphTemplate) {
+    OV_ITT_SCOPE(FIRST_INFERENCE, MKLDNNPlugin::itt::domains::MKLDNN_LT, "CreateGraphFromTemplate");
+
+    if (graphTemplate.status != Template)
+        IE_THROW() << "Graph " << graphTemplate._name << " isn't compiled as a template";
+    if (status != NotReady)
+        ForgetGraphData();
+
+    // The fused nodes aren't in the graph, but they are copied as well, since they prepare the data of the post ops
+    // when the primitive of the node they are fused into is created.
+    std::unordered_map<const MKLDNNNode*, MKLDNNNodePtr> nodes;
+    std::function<MKLDNNNodePtr(const MKLDNNNodePtr&)> cloneNode = [&](const MKLDNNNodePtr& node) -> MKLDNNNodePtr {
+        auto found = nodes.find(node.get());
+        if (found != nodes.end())
+            return found->second;
+
+        auto copy = node->clone();
+        if (!copy)
+            return nullptr;
+        copy->setMemoryArena(memoryArena);
+        nodes[node.get()] = copy;
+        for (auto* related : {&copy->fusedWith, &copy->mergedWith}) {
+            for (auto& relatedNode : *related) {
+                relatedNode = cloneNode(relatedNode);
+                if (!relatedNode)
+                    return nullptr;
+            }
+        }
+        return copy;
+    };
+
+    for (const auto& node : graphTemplate.graphNodes) {
+        auto copy = cloneNode(node);
+        if (!copy) {
+            ForgetGraphData();
+            return false;
+        }
+        graphNodes.push_back(copy);
+    }
+
+    std::unordered_map<const MKLDNNEdge*, MKLDNNEdgePtr> edges;
+    for (const auto& edge : graphTemplate.graphEdges) {
+        auto copy = std::make_shared<MKLDNNEdge>(*edge);
+        copy->parent = nodes.at(edge->getParent().get());
+        copy->child = nodes.at(edge->getChild().get());
+        copy->memoryPtr.reset();
+        edges[edge.get()] = copy;
+        graphEdges.push_back(copy);
+    }
+    for (auto& edge : graphEdges) {
+        auto memoryFromEdge = edge->memoryFromEdge.lock();
+        edge->memoryFromEdge = memoryFromEdge ? edges.at(memoryFromEdge.get()) : MKLDNNEdgePtr();
+    }
+
+    // the edges keep their positions, since the nodes access them by index
+    auto remapEdges = [&](std::vector<MKLDNNEdgeWeakPtr>& nodeEdges) {
+        for (auto& nodeEdge : nodeEdges) {
+            auto found = edges.find(nodeEdge.lock().get());
+            nodeEdge = found != edges.end() ? found->second : MKLDNNEdgePtr();
+        }
+    };
+    for (auto& node : nodes) {
+        remapEdges(node.second->parentEdges);
+        remapEdges(node.second->childEdges);
+    }
+
+    for (const auto& input : graphTemplate.inputNodesMap)
+        inputNodesMap[input.first] = nodes.at(input.second.get());
+    for (const auto& output : graphTemplate.outputNodesMap)
+        outputNodesMap[output.first] = nodes.at(output.second.get());
+
+    _name = graphTemplate._name;
+    reuse_io_tensors = graphTemplate.reuse_io_tensors;
+    isQuantizedFlag = graphTemplate.isQuantizedFlag;
+    _normalizePreprocMap = graphTemplate._normalizePreprocMap;
+    reorderStatistics = graphTemplate.reorderStatistics;
+    weightsCache = graphTemplate.weightsCache;
+
+    InstantiateGraph();
+
+    status = Ready;
+
+    ENABLE_CPU_DEBUG_CAP(serialize(*this));
+
+    return true;
+}
+
 void MKLDNNGraph::Replicate(const std::shared_ptr<const ngraph::Function> &subgraph, const MKLDNNExtensionManager::Ptr& extMgr) {
     this->_name = "subgraph";
     this->reuse_io_tensors = false;
@@ -116,9 +223,16 @@ void MKLDNNGraph::Replicate(const std::shared_ptr<const ngraph::Function> &subgr
 
     for (const auto op : subgraph->get_ordered_ops()) {
         const MKLDNNNodePtr node {MKLDNNNode::factory().create(op, getEngine(), extMgr, weightsCache)};
+        node->setMemoryArena(memoryArena);
+        if (node->getType() == Input) {
+            std::static_pointer_cast<MKLDNNInputNode>(node)->setKeyedByValues(constantsKeyedByValues);
+        }
         if (isQuantized()) {
             node->setQuantizedGraphFlag(true);
         }
+        if (auto fcNode = std::dynamic_pointer_cast<MKLDNNFullyConnectedNode>(node)) {
+            fcNode->setSparseWeightsThreshold(config.sparseWeightsThreshold);
+        }
 
         graphNodes.push_back(node);
 
@@ -216,9 +330,16 @@ void MKLDNNGraph::Replicate(const CNNNetwork &network, const MKLDNNExtensionMana
     // Replicate All Nodes in topological order
     for (const auto& op : orderedOps) {
         const MKLDNNNodePtr node(MKLDNNNode::factory().create(op, getEngine(), extMgr, weightsCache));
+        node->setMemoryArena(memoryArena);
+        if (node->getType() == Input) {
+            std::static_pointer_cast<MKLDNNInputNode>(node)->setKeyedByValues(constantsKeyedByValues);
+        }
         if (isQuantized()) {
             node->setQuantizedGraphFlag(true);
         }
+        if (auto fcNode = std::dynamic_pointer_cast<MKLDNNFullyConnectedNode>(node)) {
+            fcNode->setSparseWeightsThreshold(config.sparseWeightsThreshold);
+        }
         graphNodes.push_back(node);
 
         if (op->get_type_info() == ngraph::op::v0::Parameter::type_info) {
@@ -320,6 +441,11 @@ void MKLDNNGraph::Replicate(const CNNNetwork &network, const MKLDNNExtensionMana
 }
 
 void MKLDNNGraph::InitGraph() {
+    CompileGraph();
+    InstantiateGraph();
+}
+
+void MKLDNNGraph::CompileGraph() {
     MKLDNNGraphOptimizer optimizer;
 
     SortTopologically();
@@ -331,6 +457,8 @@ void MKLDNNGraph::InitGraph() {
     InitDescriptors();
     RemoveDroppedEdges();
 
+    AssignLayouts();
+
     InitOptimalPrimitiveDescriptors();
 
     InitEdges();
@@ -338,6 +466,10 @@ void MKLDNNGraph::InitGraph() {
     optimizer.ApplyImplSpecificGraphOptimizations(*this);
     SortTopologically();
 
+    reorderStatistics = CountReorders();
+}
+
+void MKLDNNGraph::InstantiateGraph() {
     Allocate();
 
     CreatePrimitives();
@@ -382,6 +514,28 @@ void MKLDNNGraph::InitDescriptors() {
     }
 }
 
+void MKLDNNGraph::AssignLayouts() {
+    OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::MKLDNN_LT, "MKLDNNGraph::AssignLayouts");
+    if (config.layoutAssignment == Config::LayoutAssignment::Global) {
+        MKLDNNLayoutAssignment().Run(*this);
+    }
+}
+
+MKLDNNGraph::ReorderStatistics MKLDNNGraph::CountReorders() const {
+    ReorderStatistics statistics;
+    for (const auto& node : graphNodes) {
+        auto reorder = std::dynamic_pointer_cast<MKLDNNReorderNode>(node);
+        // the constant reorders are executed once, the optimized ones don't copy the data
+        if (!reorder || reorder->isConstant() || reorder->getOptimized())
+            continue;
+        const auto& precision = reorder->getOutput().getPrecision();
+        statistics.reorders++;
+        statistics.bytes += static_cast<uint64_t>(reorder->getChildEdgeAt(0)->getDims().size()) *
+                            (precision == Precision::BIN ? 1 : precision.size());
+    }
+    return statistics;
+}
+
 void MKLDNNGraph::InitOptimalPrimitiveDescriptors() {
     OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "MKLDNNGraph::InitOptimalPrimitiveDescriptors");
     for (auto &node : graphNodes) {
@@ -405,7 +559,7 @@ void MKLDNNGraph::ExecuteConstantNodesOnly() {
             auto edgePtr = graphNode->getChildEdgeAt(i);
             if (edgePtr) {
                 if (edgePtr->isUseExternalMemory()) {
-                    auto ptr = weightsCache->get(edgePtr->name());
+                    auto ptr = weightsCache->get(edgePtr->externalMemoryKey);
                     outputs.emplace_back(ptr);
                     if (!ptr->isValid())
                         hasExternalInvalidEdges = true;
@@ -563,6 +717,26 @@ static edge_clusters_t findEdgeClusters(const std::vector<MKLDNNEdgePtr> & graph
 void MKLDNNGraph::AllocateWithReuse() {
     edge_clusters_t edge_clusters = findEdgeClusters(graphEdges);
 
+    // The graphs compiled for other input shapes may have the constants of the same name and dims, but of other values
+    // (e.g. the reshape targets), so the shared constant memory is identified by the constant inputs it's computed from.
+    // The inputs are identified by the data address unless the constants are keyed by values.
+    std::unordered_map<const MKLDNNNode*, uint64_t> valuesHashes;
+    std::function<uint64_t(const MKLDNNNodePtr&)> getValuesHash = [&](const MKLDNNNodePtr& node) -> uint64_t {
+        auto found = valuesHashes.find(node.get());
+        if (found != valuesHashes.end())
+            return found->second;
+
+        uint64_t hash = 0;
+        if (node->getType() == Input) {
+            hash = std::static_pointer_cast<MKLDNNInputNode>(node)->getDataId();
+        } else {
+            for (size_t i = 0; i < node->getParentEdges().size(); i++)
+                hash ^= getValuesHash(node->getParentEdgeAt(i)->getParent()) + 0x9e3779b97f4a7c15 + (hash << 6) + (hash >> 2);
+        }
+        valuesHashes[node.get()] = hash;
+        return hash;
+    };
+
     size_t edge_clusters_count = edge_clusters.size();
 
     for (size_t i = 0; i < edge_clusters_count;) {
@@ -575,7 +749,7 @@ void MKLDNNGraph::AllocateWithReuse() {
                     auto constNode = std::static_pointer_cast<MKLDNNInputNode>(edge->getParent());
                     edge->reuse(std::const_pointer_cast<MKLDNNMemory>(constNode->getMemoryPtr()));
                 } else {
-                    edge->externalAllocate(weightsCache);
+                    edge->externalAllocate(weightsCache, memoryArena, weightsCache ? getValuesHash(edge->getParent()) : 0);
                 }
                 erase = true;
             }
@@ -649,8 +823,14 @@ void MKLDNNGraph::AllocateWithReuse() {
     MemorySolver memSolver(boxes);
     size_t total_size = static_cast<size_t>(memSolver.solve()) * alignment;
 
-    memWorkspace = std::make_shared<MKLDNNMemory>(eng);
-    memWorkspace->Create(MKLDNNMemoryDesc(TensorDesc(Precision::I8, {total_size}, Layout::C)));
+    const MKLDNNMemoryDesc workspaceDesc(TensorDesc(Precision::I8, {total_size}, Layout::C));
+    if (memoryArena) {
+        // the graph is created by the stream thread, so the arena memory is first-touched on the stream NUMA node
+        memWorkspace = memoryArena->createMemory(eng, workspaceDesc);
+    } else {
+        memWorkspace = std::make_shared<MKLDNNMemory>(eng);
+        memWorkspace->Create(workspaceDesc);
+    }
 
     if (edge_clusters.empty())
         return;
@@ -705,23 +885,50 @@ void MKLDNNGraph::CreatePrimitives() {
     }
 }
 
-void MKLDNNGraph::PushInputData(const std::string& name, const InferenceEngine::Blob::Ptr &in) {
+// Returns the descriptor of the first batch items of the memory, the batch must be the outermost dimension
+static mkldnn::memory::desc getBatchDesc(const mkldnn::memory::desc& desc, int batch) {
+    mkldnn::memory::desc batchDesc(desc);
+    batchDesc.data.dims[0] = batch;
+    batchDesc.data.padded_dims[0] = batch;
+    return batchDesc;
+}
+
+void MKLDNNGraph::PushInputData(const std::string& name, const InferenceEngine::Blob::Ptr &in, int batch) {
     if (!IsReady()) IE_THROW()<< "Wrong state. Topology not ready.";
 
     auto input = inputNodesMap.find(name);
     if (input != inputNodesMap.end()) {
+        // the inputs are the Input nodes, which keep their own counters
+        auto& statistics = static_cast<MKLDNNInputNode&>(*input->second).getIOStatistics();
         MKLDNNDims outDims = input->second->getChildEdgeAt(0)->getDims();
+        const MKLDNNMemory& inter_mem = input->second->getChildEdgeAt(0)->getMemory();
 
         const void *ext_data_ptr = in->cbuffer();
-        void *inter_data_ptr = input->second->getChildEdgeAt(0)->getMemory().GetData();
+        void *inter_data_ptr = inter_mem.GetData();
+
+        // only the first items of the dynamic batch are copied and normalized
+        const bool partialBatch = batch > 0 && outDims.ndims() > 0 && batch < outDims[0] &&
+                                  isBatchOutermost(in->getTensorDesc()) && isBatchOutermost(inter_mem.GetDesc());
+        if (partialBatch)
+            outDims[0] = batch;
 
         if (ext_data_ptr != inter_data_ptr) {
             auto ext_tdesc = MKLDNNMemoryDesc {in->getTensorDesc()};
 
             auto ext_mem = MKLDNNMemory(eng);
-            ext_mem.Create(ext_tdesc, ext_data_ptr, false);
+            if (partialBatch) {
+                ext_mem.Create(getBatchDesc(ext_tdesc, batch), ext_data_ptr, false);
 
-            input->second->getChildEdgeAt(0)->getMemory().SetData(ext_mem, 0, false);
+                auto inter_batch_mem = MKLDNNMemory(eng);
+                inter_batch_mem.Create(getBatchDesc(inter_mem.GetDescriptor(), batch), inter_data_ptr, false);
+                inter_batch_mem.SetData(ext_mem, 0, false);
+            } else {
+                ext_mem.Create(ext_tdesc, ext_data_ptr, false);
+                inter_mem.SetData(ext_mem, 0, false);
+            }
+            statistics.copied++;
+        } else {
+            statistics.zeroCopy++;
         }
 
         // todo: make sure 'name' exists in this map...
@@ -746,6 +953,7 @@ void MKLDNNGraph::PullOutputData(const BlobMap &out) {
         auto name = outputMap.first;
         auto node = outputMap.second;
         const MKLDNNMemory& intr_blob = node->getParentEdgeAt(0)->getMemory();
+        auto& statistics = static_cast<MKLDNNInputNode&>(*node).getIOStatistics();
 
         if (!out.count(name)) {
             IE_THROW(Unexpected) << "The network outputs do not contain mkldnn graph output node name: \"" << name << "\"";
@@ -766,18 +974,24 @@ void MKLDNNGraph::PullOutputData(const BlobMap &out) {
         void *intr_blob_ptr = intr_blob.GetData();
 
         // That is the same memory. No need to copy
-        if (ext_blob_ptr == intr_blob_ptr) continue;
+        if (ext_blob_ptr == intr_blob_ptr) {
+            statistics.zeroCopy++;
+            continue;
+        }
+        statistics.copied++;
 
         int MB = intr_blob.GetDims()[0];
         int MB_to_process = node->batchToProcess();
         // TODO: Should we support InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_LIMIT???
         if (config.batchLimit)
             MB_to_process = std::min<int>(config.batchLimit, MB_to_process);
-        size_t size_to_copy = intr_blob.GetElementsCount() * MB_to_process / MB;
-
         const auto actualDesc = node->getParentEdgeAt(0)->getDesc();
         const auto expectedDesc = ext_blob->getTensorDesc();
 
+        // only the first items of the dynamic batch are copied
+        const bool partialBatch = MB_to_process < MB && isBatchOutermost(actualDesc) && isBatchOutermost(expectedDesc);
+        size_t size_to_copy = partialBatch ? intr_blob.GetElementsCount() * MB_to_process / MB : intr_blob.GetElementsCount();
+
         // TODO [NM]: need to create universal reorder which will be detect cases when we really need to use it
         // WA: for cases when output shape after transformation will be 1x1x1x1 but model output is scalar
         bool isScalarOutput = false;
@@ -792,9 +1006,16 @@ void MKLDNNGraph::PullOutputData(const BlobMap &out) {
         if (actualDesc.getBlockingDesc() != expectedDesc.getBlockingDesc() && !isScalarOutput) {
             auto outBlobDesc = MKLDNNMemoryDesc{expectedDesc};
             auto outBloMem = MKLDNNMemory(eng);
-            outBloMem.Create(outBlobDesc, ext_blob_ptr, false);
+            if (partialBatch) {
+                outBloMem.Create(getBatchDesc(outBlobDesc, MB_to_process), ext_blob_ptr, false);
 
-            outBloMem.SetData(intr_blob, 0, false);
+                auto intrBatchMem = MKLDNNMemory(eng);
+                intrBatchMem.Create(getBatchDesc(intr_blob.GetDescriptor(), MB_to_process), intr_blob_ptr, false);
+                outBloMem.SetData(intrBatchMem, 0, false);
+            } else {
+                outBloMem.Create(outBlobDesc, ext_blob_ptr, false);
+                outBloMem.SetData(intr_blob, 0, false);
+            }
         } else {
             cpu_convert(intr_blob_ptr, ext_blob_ptr, srcPrec, dstPrec, size_to_copy);
         }
@@ -813,6 +1034,7 @@ void MKLDNNGraph::Infer(MKLDNNInferRequest* request, int batch) {
     for (int i = 0; i < graphNodes.size(); i++) {
         if (request != nullptr) {
             request->ThrowIfCanceled();
+            request->YieldToHighPriority();
         }
 
         PERF(graphNodes[i]);
@@ -1218,5 +1440,24 @@ void MKLDNNGraph::EnforceBF16() {
 }
 
 InferenceEngine::CNNNetwork MKLDNNGraph::dump() const {
-    return dump_graph_as_ie_ngraph_net(*this);
+    std::map<std::string, IOStatistics> ioStatistics;
+    AccumulateIOStatistics(ioStatistics);
+    return dump(ioStatistics);
+}
+
+InferenceEngine::CNNNetwork MKLDNNGraph::dump(const std::map<std::string, IOStatistics>& ioStatistics) const {
+    return dump_graph_as_ie_ngraph_net(*this, ioStatistics);
+}
+
+void MKLDNNGraph::AccumulateIOStatistics(std::map<std::string, IOStatistics>& ioStatistics) const {
+    auto accumulate = [&ioStatistics] (const std::map<std::string, MKLDNNNodePtr>& ioNodes) {
+        for (const auto& ioNode : ioNodes) {
+            const auto& statistics = std::static_pointer_cast<MKLDNNInputNode>(ioNode.second)->getIOStatistics();
+            auto& total = ioStatistics[ioNode.first];
+            total.zeroCopy += statistics.zeroCopy;
+            total.copied += statistics.copied;
+        }
+    };
+    accumulate(inputNodesMap);
+    accumulate(outputNodesMap);
 }
@@ -10,6 +10,7 @@
 #include "normalize_preprocess.h"
 #include "mkldnn_node.h"
 #include "mkldnn_edge.h"
+#include "nodes/mkldnn_input_node.h"
 #include <map>
 #include <string>
 #include <vector>
@@ -26,6 +27,8 @@ public:
     enum Status {
         NotReady = 0,
         Ready = 1,
+        // compiled only to make other graphs from it, can't be inferred
+        Template = 2,
     };
 
     MKLDNNGraph() = default;
@@ -41,6 +44,26 @@ public:
     void setConfig(const Config &cfg);
     const Config& getConfig() const;
 
+    /**
+     * @brief Sets the arena the graph memory and the node internal data are reserved from, the default allocation is used if it's nullptr
+     */
+    void setMemoryArena(const MKLDNNMemoryArena::Ptr& arena) {
+        memoryArena = arena;
+    }
+    const MKLDNNMemoryArena::Ptr& getMemoryArena() const {
+        return memoryArena;
+    }
+
+    /**
+     * @brief Makes the shared constants keyed by their values, required if the graphs of other input shapes share them
+     */
+    void setConstantsKeyedByValues(bool keyedByValues) {
+        constantsKeyedByValues = keyedByValues;
+    }
+    bool getConstantsKeyedByValues() const {
+        return constantsKeyedByValues;
+    }
+
     void setProperty(const std::map<std::string, std::string> &properties);
     Config getProperty() const;
 
@@ -52,11 +75,31 @@ public:
                      const MKLDNNExtensionManager::Ptr& extMgr,
                      MKLDNNWeightsSharing::Ptr &w_cache);
 
+    /**
+     * @brief Compiles the network up to the memory allocation, so the graph can be used as a template of the graphs
+     * of other streams. The template keeps the optimized nodes with the selected primitive descriptors and the
+     * inserted reorders, while the memory and the primitives are created by each graph made from the template.
+     */
+    void CreateGraphTemplate(const InferenceEngine::CNNNetwork &network,
+                             const MKLDNNExtensionManager::Ptr& extMgr,
+                             MKLDNNWeightsSharing::Ptr &w_cache);
+
+    /**
+     * @brief Creates the graph from the copies of the template graph nodes. The copies share the weights and other
+     * read-only data with the template nodes, so the template must outlive the graph.
+     * @return false if some node of the template can't be copied
+     */
+    bool CreateGraph(const MKLDNNGraph &graphTemplate);
+
     bool hasMeanImageFor(const std::string& name) {
         return _normalizePreprocMap.find(name) != _normalizePreprocMap.end();
     }
 
-    void PushInputData(const std::string& name, const InferenceEngine::Blob::Ptr &in);
+    /**
+     * @brief Copies the input blob into the graph input memory
+     * @param batch The number of the first batch items to copy for the dynamic batch, the whole blob is copied if it isn't positive
+     */
+    void PushInputData(const std::string& name, const InferenceEngine::Blob::Ptr &in, int batch = -1);
     void PullOutputData(const InferenceEngine::BlobMap &out);
 
     void Infer(MKLDNNInferRequest* request = nullptr, int batch = -1);
@@ -171,6 +214,33 @@ public:
         return isQuantizedFlag;
     }
 
+    using IOStatistics = MKLDNNInputNode::IOStatistics;
+
+    /**
+     * @brief Adds the counters of the graph inputs and outputs to the counters of the same names
+     */
+    void AccumulateIOStatistics(std::map<std::string, IOStatistics>& ioStatistics) const;
+
+    /**
+     * @brief Dumps the graph with the given counters of the inputs and outputs in place of the graph ones
+     */
+    InferenceEngine::CNNNetwork dump(const std::map<std::string, IOStatistics>& ioStatistics) const;
+
+    /**
+     * @brief Number of edges which require a reorder and the total size of the reordered data
+     */
+    struct ReorderStatistics {
+        uint64_t reorders = 0;
+        uint64_t bytes = 0;
+    };
+
+    /**
+     * @brief Reorder nodes executed by the graph on each inference
+     */
+    const ReorderStatistics& getReorderStatistics() const {
+        return reorderStatistics;
+    }
+
 protected:
     void VisitNode(MKLDNNNodePtr node, std::vector<MKLDNNNodePtr>& sortedNodes);
 
@@ -183,6 +253,7 @@ protected:
         graphNodes.clear();
         graphEdges.clear();
         _normalizePreprocMap.clear();
+        reorderStatistics = {};
     }
     Status status { NotReady };
     Config config;
@@ -194,6 +265,8 @@ protected:
     bool reuse_io_tensors = true;
 
     MKLDNNMemoryPtr memWorkspace;
+    MKLDNNMemoryArena::Ptr memoryArena;
+    bool constantsKeyedByValues = false;
 
     std::map<std::string, MKLDNNNodePtr> inputNodesMap;
     std::map<std::string, MKLDNNNodePtr> outputNodesMap;
@@ -201,6 +274,7 @@ protected:
     std::vector<MKLDNNEdgePtr> graphEdges;
 
     std::map<std::string, NormalizePreprocess> _normalizePreprocMap;
+    ReorderStatistics reorderStatistics;
     std::string _name;
 
     bool isQuantizedFlag = false;
@@ -210,8 +284,12 @@ protected:
     void Replicate(const InferenceEngine::CNNNetwork &network, const MKLDNNExtensionManager::Ptr& extMgr);
     void Replicate(const std::shared_ptr<const ngraph::Function> &subgraph, const MKLDNNExtensionManager::Ptr& extMgr);
     void InitGraph();
+    void CompileGraph();
+    void InstantiateGraph();
     void InitNodes();
     void InitDescriptors();
+    void AssignLayouts();
+    ReorderStatistics CountReorders() const;
     void InitOptimalPrimitiveDescriptors();
     void InitEdges();
     void Allocate();
@@ -221,7 +299,8 @@ protected:
 
     friend class MKLDNNInferRequest;
     friend class MKLDNNGraphlessInferRequest;
-    friend InferenceEngine::CNNNetwork dump_graph_as_ie_ngraph_net(const MKLDNNGraph &graph);
+    friend InferenceEngine::CNNNetwork dump_graph_as_ie_ngraph_net(const MKLDNNGraph &graph,
+                                                                   const std::map<std::string, IOStatistics>& ioStatistics);
 
 private:
     void EnforceBF16();
@@ -25,6 +25,13 @@ void serializeToXML(const MKLDNNGraph &graph, const std::string& path);
 
 namespace {
 
+// Number of inferences which used the user blob as the graph input/output memory
+const char ZERO_COPY_COUNT[] = "zeroCopyCount";
+// Number of inferences which copied the user blob to/from the graph memory
+const char COPY_COUNT[] = "copyCount";
+// Number of bytes of the constant weights held for the node, set for the nodes which read weights only
+const char WEIGHTS_BYTES[] = "weightsBytes";
+
 std::map<std::string, std::string> extract_node_metadata(const MKLDNNNodePtr &node) {
     std::map<std::string, std::string> serialization_info;
 
@@ -107,12 +114,17 @@ std::map<std::string, std::string> extract_node_metadata(const MKLDNNNodePtr &no
 
     serialization_info[ExecGraphInfoSerialization::RUNTIME_PRECISION] = node->getRuntimePrecision().name();
 
+    const size_t weightsBytes = node->getWeightsBytes();
+    if (weightsBytes != 0)
+        serialization_info[WEIGHTS_BYTES] = std::to_string(weightsBytes);
+
     return serialization_info;
 }
 
 }  // namespace
 
-InferenceEngine::CNNNetwork dump_graph_as_ie_ngraph_net(const MKLDNNGraph &graph) {
+InferenceEngine::CNNNetwork dump_graph_as_ie_ngraph_net(const MKLDNNGraph &graph,
+                                                        const std::map<std::string, MKLDNNGraph::IOStatistics>& ioStatistics) {
     std::map<MKLDNNNodePtr, std::shared_ptr<ngraph::Node> > node2layer;
 
     ngraph::ResultVector results;
@@ -140,9 +152,11 @@ InferenceEngine::CNNNetwork dump_graph_as_ie_ngraph_net(const MKLDNNGraph &graph
 
     auto create_ngraph_node = [&](const MKLDNNNodePtr &node) {
         bool is_input = false, is_output = false, should_be_hold = false;
+        std::string io_name;
         for (auto && kvp : graph.inputNodesMap) {
             if (kvp.second == node) {
                 is_input = true;
+                io_name = kvp.first;
                 break;
             }
         }
@@ -150,6 +164,7 @@ InferenceEngine::CNNNetwork dump_graph_as_ie_ngraph_net(const MKLDNNGraph &graph
         for (auto && kvp : graph.outputNodesMap) {
             if (kvp.second == node) {
                 is_output = true;
+                io_name = kvp.first;
                 break;
             }
         }
@@ -161,6 +176,13 @@ InferenceEngine::CNNNetwork dump_graph_as_ie_ngraph_net(const MKLDNNGraph &graph
         }
 
         auto meta_data = extract_node_metadata(node);
+        if (is_input || is_output) {
+            auto io_stats = ioStatistics.find(io_name);
+            const auto zero_copy = io_stats != ioStatistics.end() ? io_stats->second.zeroCopy : 0;
+            const auto copied = io_stats != ioStatistics.end() ? io_stats->second.copied : 0;
+            meta_data[ZERO_COPY_COUNT] = std::to_string(zero_copy);
+            meta_data[COPY_COUNT] = std::to_string(copied);
+        }
         std::shared_ptr<ngraph::Node> return_node;
         if (is_input) {
             auto desc = node->getChildEdgeAt(0)->getDesc();
@@ -8,11 +8,14 @@
 #include "mkldnn_graph.h"
 #include "utils/debug_capabilities.h"
 
+#include <map>
 #include <memory>
+#include <string>
 
 namespace MKLDNNPlugin {
 
-InferenceEngine::CNNNetwork dump_graph_as_ie_ngraph_net(const MKLDNNGraph &graph);
+InferenceEngine::CNNNetwork dump_graph_as_ie_ngraph_net(const MKLDNNGraph &graph,
+                                                        const std::map<std::string, MKLDNNGraph::IOStatistics>& ioStatistics);
 #ifdef CPU_DEBUG_CAPS
 void serialize(const MKLDNNGraph &graph);
 #endif // CPU_DEBUG_CAPS
@@ -115,6 +115,10 @@ void MKLDNNGraphOptimizer::ApplyCommonGraphOptimizations(MKLDNNGraph &graph) {
     FuseFullyConnectedAndSimpleOperation(graph);
     graph.RemoveDroppedNodes();
 
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseFullyConnectedAndCompressedWeightsConvert");
+    FuseFullyConnectedAndCompressedWeightsConvert(graph);
+    graph.RemoveDroppedNodes();
+
     OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseMVNAndSimpleOperation");
     FuseMVNAndSimpleOperation(graph);
     graph.RemoveDroppedNodes();
@@ -628,6 +632,38 @@ void MKLDNNGraphOptimizer::FuseFullyConnectedAndSimpleOperation(MKLDNNGraph &gra
     }
 }
 
+void MKLDNNGraphOptimizer::FuseFullyConnectedAndCompressedWeightsConvert(MKLDNNGraph &graph) {
+    auto& graphNodes = graph.GetNodes();
+
+    // The FP16 and BF16 weights are kept compressed only when the FullyConnected node is executed by the own kernel,
+    // which loads the weights in their precision and widens them to FP32
+    auto isSutableFullyConnected = [](const MKLDNNNodePtr& node) {
+        return node->getType() == FullyConnected && impl::cpu::x64::mayiuse(impl::cpu::x64::avx2) &&
+               one_of(node->getParentEdgeAt(0)->getDims().ndims(), 2, 3) && node->getParentEdgeAt(1)->getDims().ndims() == 2;
+    };
+
+    auto isSutableConvert = [](const MKLDNNNodePtr& node) {
+        if (node->getType() != Convert || node->getChildEdges().size() != 1 || node->getOriginalOutputPrecisionAtPort(0) != Precision::FP32)
+            return false;
+        auto parent = node->getParentEdgeAt(0)->getParent();
+        return parent->getType() == Input && parent->isConstant() &&
+               one_of(parent->getOriginalOutputPrecisionAtPort(0), Precision::FP16, Precision::BF16);
+    };
+
+    for (size_t i = 0; i < graphNodes.size(); i++) {
+        auto fcNode = graphNodes[i];
+        if (!isSutableFullyConnected(fcNode))
+            continue;
+
+        auto convertNode = fcNode->getParentEdgeAt(1)->getParent();
+        if (!isSutableConvert(convertNode))
+            continue;
+
+        fcNode->setOriginalInputPrecisionAtPort(1, convertNode->getOriginalInputPrecisionAtPort(0));
+        graph.DropNode(convertNode);
+    }
+}
+
 void MKLDNNGraphOptimizer::FuseConvolutionAndDWConvolution(MKLDNNGraph &graph) {
     auto& graphNodes = graph.GetNodes();
 
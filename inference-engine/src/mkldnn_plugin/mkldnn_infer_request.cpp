@@ -11,6 +11,7 @@
 #include <nodes/mkldnn_concat_node.h>
 #include <nodes/mkldnn_split_node.h>
 #include <ie_compound_blob.h>
+#include <cpu/cpu_context_api.hpp>
 #include <ie_common.h>
 #include "mkldnn_exec_network.h"
 #include "mkldnn_itt.h"
@@ -34,6 +35,8 @@ MKLDNNPlugin::MKLDNNInferRequest::MKLDNNInferRequest(InferenceEngine::InputsData
     if (execNetwork->_graphs.size() == 0)
         IE_THROW() << "No graph was found";
     graph = &(execNetwork->GetGraph()._graph);
+    if (execNetwork->_cfg.requestPriority == Config::RequestPriority::Normal)
+        _streamsExecutor = dynamic_cast<InferenceEngine::IStreamsExecutor*>(execNetwork->_taskExecutor.get());
 
     // Allocate all input blobs
     for (const auto& it : _networkInputs) {
@@ -94,10 +97,15 @@ void MKLDNNPlugin::MKLDNNInferRequest::pushInput(const std::string& inputName, I
         if (dstData == nullptr) {
             IE_THROW() << "Converted input blob has no allocated memory";
         }
-        cpu_convert(srcData, dstData, inputBlob->getTensorDesc().getPrecision(), iconv->getTensorDesc().getPrecision(), iconv->size());
+        // only the first items of the dynamic batch are converted
+        size_t elementsCount = iconv->size();
+        const auto& dims = inputBlob->getTensorDesc().getDims();
+        if (m_curBatch > 0 && isBatchOutermost(inputBlob->getTensorDesc()) && static_cast<size_t>(m_curBatch) < dims[0])
+            elementsCount = elementsCount / dims[0] * m_curBatch;
+        cpu_convert(srcData, dstData, inputBlob->getTensorDesc().getPrecision(), iconv->getTensorDesc().getPrecision(), elementsCount);
     }
 
-    graph->PushInputData(inputName, needConvert ? iconv : inputBlob);
+    graph->PushInputData(inputName, needConvert ? iconv : inputBlob, m_curBatch);
 }
 
 void MKLDNNPlugin::MKLDNNInferRequest::PushInputData() {
@@ -168,13 +176,22 @@ void MKLDNNPlugin::MKLDNNInferRequest::PullStates() {
 void MKLDNNPlugin::MKLDNNInferRequest::InferImpl() {
     using namespace openvino::itt;
     OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, profilingTask);
-    auto graphLock = execNetwork->GetGraph();
+    auto graphLock = execNetwork->IsShapeCacheEnabled() ? execNetwork->GetGraph(getInputShapes()) : execNetwork->GetGraph();
     graph = &(graphLock._graph);
+    variantGraph = graphLock.owner();
 
     ThrowIfCanceled();
 
+    if (variantGraph && memoryStates.size() != 0) {
+        IE_THROW(NotImplemented) << "Networks with memory states can't be inferred with input shapes other than the network ones";
+    }
+
     execDataPreprocessing(_inputs);
 
+    if (execNetwork->IsShapeCacheEnabled()) {
+        redefineBlobs();
+    }
+
     changeDefaultPtr();
 
     ThrowIfCanceled();
@@ -196,6 +213,48 @@ void MKLDNNPlugin::MKLDNNInferRequest::InferImpl() {
     graph->PullOutputData(_outputs);
 }
 
+InferenceEngine::ICNNNetwork::InputShapes MKLDNNPlugin::MKLDNNInferRequest::getInputShapes() const {
+    InferenceEngine::ICNNNetwork::InputShapes shapes;
+    for (const auto& input : _inputs) {
+        shapes[input.first] = input.second->getTensorDesc().getDims();
+    }
+    return shapes;
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::redefineBlobs() {
+    InferenceEngine::BlobMap graphInputs, graphOutputs;
+    graph->getInputBlobs(graphInputs);
+    graph->getOutputBlobs(graphOutputs);
+
+    // Output shapes follow the input ones, so the output blobs are reallocated if the graph shapes differ
+    for (auto& output : _outputs) {
+        const auto& graphDims = graphOutputs.at(output.first)->getTensorDesc().getDims();
+        const auto& desc = output.second->getTensorDesc();
+        if (desc.getDims() != graphDims) {
+            auto layout = graphDims.size() == desc.getDims().size() ? _networkOutputs[output.first]->getLayout()
+                                                                    : InferenceEngine::TensorDesc::getLayoutByDims(graphDims);
+            output.second = make_blob_with_precision(InferenceEngine::TensorDesc(desc.getPrecision(), graphDims, layout));
+            output.second->allocate();
+        }
+    }
+
+    // Blobs are used in place of the graph memory only if they match the memory of the selected graph
+    externalPtr.clear();
+    if (graph->getProperty().batchLimit)
+        return;
+    for (auto& input : _inputs) {
+        if (input.second->getTensorDesc() == graphInputs.at(input.first)->getTensorDesc() &&
+            graph->_normalizePreprocMap.find(input.first) == graph->_normalizePreprocMap.end()) {
+            externalPtr[input.first] = input.second->buffer();
+        }
+    }
+    for (auto& output : _outputs) {
+        if (!externalPtr.count(output.first) && output.second->getTensorDesc() == graphOutputs.at(output.first)->getTensorDesc()) {
+            externalPtr[output.first] = output.second->buffer();
+        }
+    }
+}
+
 std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> MKLDNNPlugin::MKLDNNInferRequest::GetPerformanceCounts() const {
     if (!graph || !graph->IsReady())
         IE_THROW() << "Graph is not ready!";
@@ -322,6 +381,10 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetBlob(const std::string& name, const In
     if (data->size() == 0) {
         IE_THROW() << "Input data is empty. Input name: \'" << name << "\'";
     }
+    // Shared memory blobs are host memory and are used in place as any other blob with the matching descriptor
+    if (data->is<InferenceEngine::RemoteBlob>() && !data->is<InferenceEngine::cpu::SharedMemoryBlob>()) {
+        IE_THROW(NotImplemented) << "Remote blobs of other devices are not supported. Blob name: \'" << name << "\'";
+    }
 
     InferenceEngine::InputInfo::Ptr foundInput;
     InferenceEngine::DataPtr foundOutput;
@@ -352,17 +415,21 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetBlob(const std::string& name, const In
             size_t inputSize = foundInput->getTensorDesc().getLayout() != InferenceEngine::Layout::SCALAR
                 ? InferenceEngine::details::product(foundInput->getTensorDesc().getDims())
                 : 1;
-            if (dataSize != inputSize) {
+            // Graphs are compiled for the new input shapes on demand if the shapes cache is enabled
+            const bool shapeChanged = execNetwork->IsShapeCacheEnabled() &&
+                                      foundInput->getTensorDesc().getDims().size() == data->getTensorDesc().getDims().size() &&
+                                      foundInput->getTensorDesc().getLayout() == data->getTensorDesc().getLayout();
+            if (dataSize != inputSize && !shapeChanged) {
                 IE_THROW() << "Input blob size is not equal network input size ("
                                    << dataSize << "!=" << inputSize << ").";
             }
 
-            if (foundInput->getTensorDesc().getDims() != data->getTensorDesc().getDims()) {
+            if (foundInput->getTensorDesc().getDims() != data->getTensorDesc().getDims() && !shapeChanged) {
                 IE_THROW(ParameterMismatch) << "Failed to set input blob. Dimensions mismatch.";
             }
 
             if (data->getTensorDesc().getLayout() != InferenceEngine::Layout::ANY && foundInput->getTensorDesc().getLayout() != InferenceEngine::Layout::ANY &&
-                foundInput->getTensorDesc().getBlockingDesc() != data->getTensorDesc().getBlockingDesc()) {
+                foundInput->getTensorDesc().getBlockingDesc() != data->getTensorDesc().getBlockingDesc() && !shapeChanged) {
                 IE_THROW(ParameterMismatch) << "Failed to set input blob. Blocking descriptor mismatch.";
             }
 
@@ -389,18 +456,22 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetBlob(const std::string& name, const In
             IE_THROW(ParameterMismatch) << "Failed to set output blob with precision: "
                                << data->getTensorDesc().getPrecision() << ", if CNNNetwork output blob precision is: " << foundOutput->getPrecision();
         }
+        // Output blobs of other shapes are replaced at inference if they don't match the shapes of the selected graph
+        const bool shapeChanged = execNetwork->IsShapeCacheEnabled() &&
+                                  foundOutput->getTensorDesc().getDims().size() == data->getTensorDesc().getDims().size() &&
+                                  foundOutput->getTensorDesc().getLayout() == data->getTensorDesc().getLayout();
         size_t outputSize = foundOutput->getTensorDesc().getLayout() != InferenceEngine::Layout::SCALAR
             ? InferenceEngine::details::product(foundOutput->getDims())
             : 1;
-        if (dataSize != outputSize) {
+        if (dataSize != outputSize && !shapeChanged) {
             IE_THROW() << "Output blob size is not equal network output size ("
                                << dataSize << "!=" << outputSize << ").";
         }
-        if (foundOutput->getTensorDesc().getDims() != data->getTensorDesc().getDims()) {
+        if (foundOutput->getTensorDesc().getDims() != data->getTensorDesc().getDims() && !shapeChanged) {
             IE_THROW(ParameterMismatch) << "Failed to set output Blob. Dimensions mismatch.";
         }
         if (data->getTensorDesc().getLayout() != InferenceEngine::Layout::ANY && foundOutput->getTensorDesc().getLayout() != InferenceEngine::Layout::ANY &&
-            foundOutput->getTensorDesc().getBlockingDesc() != data->getTensorDesc().getBlockingDesc()) {
+            foundOutput->getTensorDesc().getBlockingDesc() != data->getTensorDesc().getBlockingDesc() && !shapeChanged) {
                 IE_THROW(ParameterMismatch) << "Failed to set output blob. Blocking descriptor mismatch.";
         }
 
@@ -521,3 +592,9 @@ void MKLDNNPlugin::MKLDNNInferRequest::ThrowIfCanceled() const {
         _asyncRequest->ThrowIfCanceled();
     }
 }
+
+void MKLDNNPlugin::MKLDNNInferRequest::YieldToHighPriority() const {
+    if (_streamsExecutor != nullptr) {
+        _streamsExecutor->YieldToHighPriority();
+    }
+}
@@ -9,6 +9,7 @@
 #include <string>
 #include <map>
 #include <cpp_interfaces/interface/ie_iinfer_request_internal.hpp>
+#include <threading/ie_istreams_executor.hpp>
 
 namespace MKLDNNPlugin {
 
@@ -47,6 +48,12 @@ public:
      */
     void ThrowIfCanceled() const;
 
+    /**
+     * @brief A yield point between the nodes. Pauses the normal priority request while the high priority requests
+     * of the shared streams executor are run on the cores of the current stream
+     */
+    void YieldToHighPriority() const;
+
 private:
     void PushInputData();
     void PushStates();
@@ -55,11 +62,17 @@ private:
     void pushInput(const std::string& inputName, InferenceEngine::Blob::Ptr& inputBlob, InferenceEngine::Precision dataType);
 
     void changeDefaultPtr();
+    InferenceEngine::ICNNNetwork::InputShapes getInputShapes() const;
+    void redefineBlobs();
     std::shared_ptr<MKLDNNExecNetwork>  execNetwork;
     MKLDNNGraph*                        graph = nullptr;
+    // Graph compiled for non-default input shapes which was used by the last inference
+    std::shared_ptr<MKLDNNGraph>        variantGraph;
     std::map<std::string, void*>        externalPtr;
     openvino::itt::handle_t             profilingTask;
     std::vector<std::shared_ptr<InferenceEngine::IVariableStateInternal>> memoryStates;
     MKLDNNAsyncInferRequest*            _asyncRequest = nullptr;
+    // Set for the networks with the request priority only
+    InferenceEngine::IStreamsExecutor*  _streamsExecutor = nullptr;
 };
 }  // namespace MKLDNNPlugin
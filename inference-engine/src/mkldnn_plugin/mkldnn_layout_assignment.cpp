@@ -0,0 +1,145 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_layout_assignment.h"
+#include "mkldnn_extension_utils.h"
+#include "mkldnn_itt.h"
+
+#include <vector>
+
+using namespace InferenceEngine;
+
+namespace MKLDNNPlugin {
+
+namespace {
+
+constexpr int maxRefinementSweeps = 16;
+
+bool getOutputDesc(const MKLDNNNodePtr& node, int candidate, int port, TensorDesc& desc) {
+    if (candidate < 0 || candidate >= node->getSupportedPrimitiveDescriptors().size())
+        return false;
+    const auto config = node->getSupportedPrimitiveDescriptors()[candidate].getConfig();
+    if (config.outConfs.empty())
+        return false;
+    // the same fallback as used by MKLDNNNode::selectPreferPrimitiveDescriptor
+    if (port < 0 || port >= config.outConfs.size())
+        port = 0;
+    desc = config.outConfs[port].desc;
+    return true;
+}
+
+bool getInputDesc(const MKLDNNNodePtr& node, int candidate, int port, TensorDesc& desc) {
+    if (candidate < 0 || candidate >= node->getSupportedPrimitiveDescriptors().size())
+        return false;
+    const auto config = node->getSupportedPrimitiveDescriptors()[candidate].getConfig();
+    if (port < 0 || port >= config.inConfs.size())
+        return false;
+    desc = config.inConfs[port].desc;
+    return true;
+}
+
+/**
+ * @brief Returns the number of bytes to reorder on the edge if the parent and the child use the given candidates
+ */
+uint64_t edgeCost(const MKLDNNEdgePtr& edge, int parentCandidate, int childCandidate) {
+    auto parent = edge->getParent();
+    auto child = edge->getChild();
+    if (parent->isConstant())
+        return 0;
+    TensorDesc parentDesc, childDesc;
+    if (!getOutputDesc(parent, parentCandidate, edge->getInputNum(), parentDesc) ||
+            !getInputDesc(child, childCandidate, edge->getOutputNum(), childDesc) ||
+            MKLDNNExtensionUtils::initTensorsAreEqual(parentDesc, childDesc))
+        return 0;
+    const auto& precision = childDesc.getPrecision();
+    return static_cast<uint64_t>(edge->getDims().size()) * (precision == Precision::BIN ? 1 : precision.size());
+}
+
+}  // namespace
+
+bool MKLDNNLayoutAssignment::IsReassignable(MKLDNNNode& node) {
+    switch (node.getType()) {
+        // these nodes either have the fixed layouts or select the descriptor considering in-place memory usage
+        case Input:
+        case Output:
+        case Reorder:
+        case Concatenation:
+        case Split:
+        case MemoryInput:
+        case MemoryOutput:
+        case RNNCell:
+        case RNNSeq:
+            return false;
+        default:
+            break;
+    }
+    if (node.isConstant() || node.getSupportedPrimitiveDescriptors().size() < 2)
+        return false;
+    for (const auto& pd : node.getSupportedPrimitiveDescriptors()) {
+        for (const auto& configs : {pd.getConfig().inConfs, pd.getConfig().outConfs}) {
+            for (const auto& dc : configs) {
+                if (dc.inPlace >= 0)
+                    return false;
+            }
+        }
+    }
+    return true;
+}
+
+uint64_t MKLDNNLayoutAssignment::NodeCost(MKLDNNNode& node, int candidate) {
+    uint64_t cost = 0;
+    for (size_t i = 0; i < node.getParentEdges().size(); i++) {
+        auto edge = node.getParentEdgeAt(i);
+        cost += edgeCost(edge, edge->getParent()->getSelectedPrimitiveDescriptorIndex(), candidate);
+    }
+    for (size_t i = 0; i < node.getChildEdges().size(); i++) {
+        auto edge = node.getChildEdgeAt(i);
+        cost += edgeCost(edge, candidate, edge->getChild()->getSelectedPrimitiveDescriptorIndex());
+    }
+    return cost;
+}
+
+void MKLDNNLayoutAssignment::Run(MKLDNNGraph& graph) {
+    OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "MKLDNNLayoutAssignment::Run");
+
+    std::vector<MKLDNNNodePtr> nodes;
+    for (auto& node : graph.GetNodes()) {
+        if (IsReassignable(*node))
+            nodes.push_back(node);
+    }
+
+    // Each step doesn't increase the total cost and the current choice wins the ties, so the refinement converges.
+    // The sweeps limit only bounds the compilation time for the large graphs.
+    for (int sweep = 0; sweep < maxRefinementSweeps; sweep++) {
+        bool changed = false;
+        for (auto& node : nodes) {
+            const int selected = node->getSelectedPrimitiveDescriptorIndex();
+            const auto* selectedPd = node->getSelectedPrimitiveDescriptor();
+            if (selectedPd == nullptr)
+                continue;
+
+            int best = selected;
+            uint64_t bestCost = NodeCost(*node, selected);
+            const auto& pds = node->getSupportedPrimitiveDescriptors();
+            for (int candidate = 0; candidate < pds.size() && bestCost != 0; candidate++) {
+                if (candidate == selected || pds[candidate].getImplementationType() != selectedPd->getImplementationType() ||
+                        pds[candidate].getConfig().inConfs.size() > node->getParentEdges().size())
+                    continue;
+                auto cost = NodeCost(*node, candidate);
+                if (cost < bestCost) {
+                    best = candidate;
+                    bestCost = cost;
+                }
+            }
+            if (best != selected) {
+                node->selectPrimitiveDescriptorByIndex(best);
+                changed = true;
+            }
+        }
+        if (!changed)
+            break;
+    }
+}
+
+}  // namespace MKLDNNPlugin
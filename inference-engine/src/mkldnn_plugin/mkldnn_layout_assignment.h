@@ -0,0 +1,30 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "mkldnn_graph.h"
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief Reconsiders the primitive descriptors selected by the nodes one by one for the whole graph.
+ *
+ * The cost of an assignment is the number of bytes which have to be reordered between the adjacent nodes.
+ * The implementation type chosen by the node stays untouched, so only the descriptors with the same kernel
+ * are the candidates and a faster kernel is never traded for fewer reorders. The assignment is refined
+ * iteratively: each node takes the candidate with the lowest cost given the choices of its neighbours
+ * until no node changes its choice. Edges from the constant nodes are not taken into account since
+ * reorders on them are executed once on the load network stage.
+ */
+class MKLDNNLayoutAssignment {
+public:
+    void Run(MKLDNNGraph& graph);
+
+private:
+    static bool IsReassignable(MKLDNNNode& node);
+    static uint64_t NodeCost(MKLDNNNode& node, int candidate);
+};
+
+}  // namespace MKLDNNPlugin
@@ -60,6 +60,7 @@ void MKLDNNMemory::Create(const memory::dims& dims, memory::data_type data_type,
 }
 
 void MKLDNNMemory::Create(const mkldnn::memory::desc& desc, const void *data, bool pads_zeroing) {
+    storage.reset();
     if (data == nullptr) {
         prim.reset(new memory(desc, eng));
 
@@ -89,6 +90,13 @@ void MKLDNNMemory::Create(const mkldnn::memory::desc& desc, const void *data, bo
     }
 }
 
+void MKLDNNMemory::Create(const mkldnn::memory::desc& desc, const std::shared_ptr<void>& storage, bool pads_zeroing) {
+    if (storage == nullptr)
+        IE_THROW() << "Cannot create memory over empty storage";
+    Create(desc, storage.get(), pads_zeroing);
+    this->storage = storage;
+}
+
 void MKLDNNMemory::reorderData(const MKLDNNMemory &input, const MKLDNNMemory &output, size_t size) {
     if (size != 0)
         IE_ASSERT(size <= output.GetDescriptor().get_size());
@@ -97,7 +105,7 @@ void MKLDNNMemory::reorderData(const MKLDNNMemory &input, const MKLDNNMemory &ou
         auto dstPtr = static_cast<uint8_t*>(output.GetPtr());
 
         auto copySize = size == 0 ? output.GetSize() : size;
-        cpu_memcpy(dstPtr, srcPtr, copySize);
+        cpu_parallel_memcpy(dstPtr, srcPtr, copySize);
     } else {
         std::unique_ptr<mkldnn::reorder> pReorder;
         std::shared_ptr<memory> srcMemoryPtr;
@@ -149,7 +157,7 @@ void MKLDNNMemory::SetData(memory::data_type dataType, memory::format_tag format
         uint8_t* dataPtr = static_cast<uint8_t*>(GetData());
         // We cannot support strides for i/o blobs because it affects performance.
         dataPtr += itemSize * prim->get_desc().data.offset0;
-        cpu_memcpy(dataPtr, data, size);
+        cpu_parallel_memcpy(dataPtr, data, size);
     } else {
         auto memData = this->GetDescriptor().data;
         memory::dims dims(memData.dims, memData.dims + memData.ndims);
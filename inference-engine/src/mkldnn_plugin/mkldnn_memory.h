@@ -149,6 +149,8 @@ public:
                 const void* data = nullptr);
 
     void Create(const mkldnn::memory::desc& desc, const void* data = nullptr, bool pads_zeroing = true);
+    // The storage is kept alive while the memory object exists
+    void Create(const mkldnn::memory::desc& desc, const std::shared_ptr<void>& storage, bool pads_zeroing = true);
 
     // Like a plain format
     void SetData(mkldnn::memory::data_type dataType, mkldnn::memory::format_tag format, const void* data, size_t size, bool ftz = true) const;
@@ -168,6 +170,7 @@ public:
 
 private:
     std::shared_ptr<mkldnn::memory> prim;
+    std::shared_ptr<void> storage;
     mkldnn::engine eng;
 };
 
@@ -0,0 +1,130 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_memory_arena.h"
+#include "utils/general_utils.h"
+
+#include <ie_system_conf.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace MKLDNNPlugin {
+
+namespace {
+
+constexpr size_t hugePageSize = 2 * 1024 * 1024;
+constexpr size_t chunkSize = 16 * hugePageSize;
+// blocks larger than this are reserved separately to not keep the partly released chunks
+constexpr size_t maxChunkBlockSize = chunkSize / 4;
+constexpr size_t blockAlignment = 64;
+
+#ifdef __linux__
+// MPOL_PREFERRED from linux/mempolicy.h: allocate on the node if possible, fall back to the other nodes otherwise
+constexpr int mpolPreferred = 1;
+
+void* mapAligned(size_t size, size_t alignment) {
+    // mmap guarantees the page alignment only, so the extra space is reserved and trimmed
+    auto ptr = mmap(nullptr, size + alignment, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (ptr == MAP_FAILED)
+        return nullptr;
+    auto begin = reinterpret_cast<uintptr_t>(ptr);
+    auto aligned = rnd_up(begin, alignment);
+    if (aligned != begin)
+        munmap(ptr, aligned - begin);
+    if (aligned + size != begin + size + alignment)
+        munmap(reinterpret_cast<void*>(aligned + size), begin + alignment - aligned);
+    return reinterpret_cast<void*>(aligned);
+}
+
+void bindToNumaNode(void* ptr, size_t size, int numaNodeId) {
+    if (numaNodeId < 0 || InferenceEngine::getAvailableNUMANodes().size() < 2)
+        return;
+    constexpr size_t maskBits = 8 * sizeof(unsigned long);
+    std::vector<unsigned long> mask(numaNodeId / maskBits + 1, 0);
+    mask[numaNodeId / maskBits] |= 1ul << (numaNodeId % maskBits);
+    // the binding is an optimization only, so the failure (e.g. forbidden by the cgroup) is ignored
+    syscall(SYS_mbind, ptr, size, mpolPreferred, mask.data(), mask.size() * maskBits + 1, 0);
+}
+#endif
+
+}  // namespace
+
+MKLDNNMemoryArena::MKLDNNMemoryArena(int numaNodeId, Config::MemoryArena mode)
+    : numaNodeId(numaNodeId), mode(mode) {
+    if (mode == Config::MemoryArena::Default)
+        IE_THROW() << "The memory arena can't be created for the default memory allocation";
+}
+
+std::shared_ptr<void> MKLDNNMemoryArena::reserve(size_t size) {
+#ifdef __linux__
+    const bool hugePages = mode != Config::MemoryArena::Numa;
+    size = rnd_up(size, hugePages ? hugePageSize : static_cast<size_t>(sysconf(_SC_PAGESIZE)));
+
+    void* ptr = nullptr;
+#ifdef MAP_HUGETLB
+    if (mode == Config::MemoryArena::NumaExplicitHugePages) {
+        ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        if (ptr == MAP_FAILED)
+            ptr = nullptr;
+    }
+#endif
+    if (ptr == nullptr) {
+        ptr = mapAligned(size, hugePages ? hugePageSize : static_cast<size_t>(sysconf(_SC_PAGESIZE)));
+        if (ptr == nullptr)
+            IE_THROW() << "Failed to reserve " << size << " bytes for the memory arena on NUMA node " << numaNodeId;
+#ifdef MADV_HUGEPAGE
+        // the advice fails if the transparent huge pages are disabled, the regular pages are used then
+        if (hugePages)
+            madvise(ptr, size, MADV_HUGEPAGE);
+#endif
+    }
+    bindToNumaNode(ptr, size, numaNodeId);
+    // The first touch places the pages if the binding isn't applied and faults them in on the reserving stream thread
+    std::memset(ptr, 0, size);
+    reservedSize += size;
+    return std::shared_ptr<void>(ptr, [size] (void* p) { munmap(p, size); });
+#else
+    auto raw = std::malloc(size + hugePageSize);
+    if (raw == nullptr)
+        IE_THROW() << "Failed to reserve " << size << " bytes for the memory arena";
+    auto ptr = reinterpret_cast<void*>(rnd_up(reinterpret_cast<uintptr_t>(raw), hugePageSize));
+    std::memset(ptr, 0, size);
+    reservedSize += size;
+    return std::shared_ptr<void>(ptr, [raw] (void*) { std::free(raw); });
+#endif
+}
+
+std::shared_ptr<void> MKLDNNMemoryArena::allocate(size_t size) {
+    size = rnd_up(std::max<size_t>(size, 1), blockAlignment);
+    if (size > maxChunkBlockSize)
+        return reserve(size);
+
+    std::lock_guard<std::mutex> lock(guard);
+    if (!chunk || chunkOffset + size > chunkSize) {
+        chunk = reserve(chunkSize);
+        chunkOffset = 0;
+    }
+    // the block shares the ownership of the chunk
+    std::shared_ptr<void> block(chunk, static_cast<uint8_t*>(chunk.get()) + chunkOffset);
+    chunkOffset += size;
+    return block;
+}
+
+MKLDNNMemoryPtr MKLDNNMemoryArena::createMemory(const mkldnn::engine& eng, const mkldnn::memory::desc& desc) {
+    auto memory = std::make_shared<MKLDNNMemory>(eng);
+    memory->Create(desc, allocate(desc.get_size()), false);  // the block is already zeroed
+    return memory;
+}
+
+}  // namespace MKLDNNPlugin
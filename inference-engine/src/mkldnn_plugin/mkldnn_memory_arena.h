@@ -0,0 +1,62 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "config.h"
+#include "mkldnn_memory.h"
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief Reserves memory directly from the system bound to a NUMA node and optionally backed by huge pages.
+ *
+ * The pages are initialized (first-touched) by the thread which reserves them, so the arenas are expected
+ * to be used from the threads of the streams pinned to the same NUMA node. Large blocks are reserved
+ * separately, small ones are carved out of the shared chunks to not waste a (huge) page per block.
+ * A chunk is returned to the system when all its blocks are released.
+ *
+ * Is a thread safe
+ */
+class MKLDNNMemoryArena {
+public:
+    typedef std::shared_ptr<MKLDNNMemoryArena> Ptr;
+
+    MKLDNNMemoryArena(int numaNodeId, Config::MemoryArena mode);
+
+    /**
+     * @brief Returns a zero initialized block of at least the given size. The block is alive while the pointer is alive.
+     */
+    std::shared_ptr<void> allocate(size_t size);
+
+    /**
+     * @brief Creates the memory object over the block reserved from the arena
+     */
+    MKLDNNMemoryPtr createMemory(const mkldnn::engine& eng, const mkldnn::memory::desc& desc);
+
+    int getNumaNodeId() const { return numaNodeId; }
+    Config::MemoryArena getMode() const { return mode; }
+
+    /**
+     * @brief Returns the total size of the memory reserved from the system so far, the released memory isn't subtracted
+     */
+    size_t getReservedSize() const { return reservedSize; }
+
+private:
+    std::shared_ptr<void> reserve(size_t size);
+
+    const int numaNodeId;
+    const Config::MemoryArena mode;
+
+    std::mutex guard;
+    std::shared_ptr<void> chunk;
+    size_t chunkOffset = 0;
+    std::atomic<size_t> reservedSize{0};
+};
+
+}  // namespace MKLDNNPlugin
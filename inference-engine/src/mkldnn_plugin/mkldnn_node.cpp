@@ -223,7 +223,8 @@ static const InferenceEngine::details::caseless_unordered_map<std::string, Type>
         { "ExperimentalDetectronPriorGridGenerator", ExperimentalDetectronPriorGridGenerator},
         { "ExperimentalDetectronGenerateProposalsSingleImage", ExperimentalDetectronGenerateProposalsSingleImage},
         { "ExtractImagePatches", ExtractImagePatches},
-        { "NonMaxSuppressionIEInternal", NonMaxSuppression}
+        { "NonMaxSuppressionIEInternal", NonMaxSuppression},
+        { "Subgraph", Subgraph}
 };
 
 Type TypeFromName(const std::string type) {
@@ -531,6 +532,7 @@ std::string MKLDNNNode::getPrimitiveDescriptorType() {
     SEARCH_TYPE(winograd);
     SEARCH_TYPE(_dw);
     SEARCH_TYPE(_1x1);
+    SEARCH_TYPE(_sparse);
 
     if (type == impl_desc_type::unknown)
         str_type = "unknown";
@@ -784,6 +786,14 @@ void MKLDNNNode::initDescriptor(const InferenceEngine::LayerConfig &config) {
     selectedPD->getConfig() = rightConfig;
 }
 
+MKLDNNMemoryPtr MKLDNNNode::createMemory(const mkldnn::memory::desc& desc) const {
+    if (memoryArena)
+        return memoryArena->createMemory(engine, desc);
+    auto memory = std::make_shared<MKLDNNMemory>(engine);
+    memory->Create(desc);
+    return memory;
+}
+
 void MKLDNNNode::prepareMemory(const PrimitiveDescInfo *selected_pd, mkldnn::primitive_desc_iterator& itpd) {
     for (size_t i = 0; i < getChildEdges().size(); i++) {
         auto &dstMemPtr = getChildEdgeAt(i)->getMemoryPtr();
@@ -811,8 +821,7 @@ void MKLDNNNode::prepareMemory(const PrimitiveDescInfo *selected_pd, mkldnn::pri
             MKLDNNMemory memory{ engine };
             memory.Create(newDesc, internalBlob->buffer());
 
-            MKLDNNMemoryPtr _ptr = MKLDNNMemoryPtr(new MKLDNNMemory(engine));
-            _ptr->Create(intDescs[i]);
+            MKLDNNMemoryPtr _ptr = createMemory(intDescs[i]);
             _ptr->SetData(memory);
 
             return _ptr;
@@ -1141,7 +1150,18 @@ int MKLDNNNode::getMaxBatch() {
     return 0;
 }
 
+bool MKLDNNNode::isDynBatchSupported() const {
+    const auto selectedPD = getSelectedPrimitiveDescriptor();
+    return selectedPD != nullptr && selectedPD->getConfig().dynBatchSupport;
+}
+
 void MKLDNNNode::setDynamicBatchLim(int lim) {
+    // The items beyond the limit aren't read by the nodes supporting dynamic batch, so the node which doesn't support
+    // it pads the processed batch up to the whole one
+    if (!isDynBatchSupported()) {
+        dynBatchLim = 0;
+        return;
+    }
     dynBatchLim = lim;
 
     auto setDynamicBatch = [this](int argType, int newBatch) {
@@ -1238,6 +1258,23 @@ InferenceEngine::Precision MKLDNNNode::getRuntimePrecision() const {
     return runtimePrecision;
 }
 
+size_t MKLDNNNode::getWeightsBytes() {
+    if (isConstant())
+        return 0;
+
+    size_t bytes = 0;
+    for (size_t i = 0; i < getParentEdges().size(); i++) {
+        auto parentEdge = getParentEdgeAt(i);
+        if (parentEdge->getParent()->isConstant() && parentEdge->getMemoryPtr())
+            bytes += parentEdge->getMemoryPtr()->GetSize();
+    }
+    for (const auto& blob : internalBlobMemory) {
+        if (blob)
+            bytes += blob->GetSize();
+    }
+    return bytes;
+}
+
 MKLDNNNode* MKLDNNNode::NodesFactory::create(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng,
                                              const MKLDNNExtensionManager::Ptr& extMgr, MKLDNNWeightsSharing::Ptr &w_cache) {
     MKLDNNNode *newNode = nullptr;
@@ -10,6 +10,7 @@
 #include <string>
 #include <cassert>
 #include <algorithm>
+#include <type_traits>
 #include <caseless.hpp>
 #include "mkldnn_dims.h"
 #include "mkldnn_memory.h"
@@ -192,6 +193,8 @@ static std::string NameFromType(Type type) {
             return "ExtractImagePatches";
         case NonMaxSuppression:
             return "NonMaxSuppression";
+        case Subgraph:
+            return "Subgraph";
         default:
             return "Unknown";
     }
@@ -323,6 +326,16 @@ public:
     virtual void cleanup();
     void remove();
 
+    /**
+     * @brief Creates a copy of the node with the selected primitive descriptor, which isn't connected to any edges.
+     * The copy shares the weights and other data prepared before the primitive creation with the original node, so
+     * it can be made only before createPrimitive() call.
+     * @return Copy of the node or nullptr if the node can't be copied
+     */
+    virtual MKLDNNNodePtr clone() const {
+        return nullptr;
+    }
+
     const std::vector<MKLDNNEdgeWeakPtr> &getParentEdges() const noexcept {
         return parentEdges;
     }
@@ -438,6 +451,10 @@ public:
         return &supportedPrimitiveDescriptors[selectedPrimitiveDescriptorIndex];
     }
 
+    int getSelectedPrimitiveDescriptorIndex() const {
+        return selectedPrimitiveDescriptorIndex;
+    }
+
     void selectPrimitiveDescriptorByIndex(int index) {
         if (index < 0 || index >= supportedPrimitiveDescriptors.size())
             selectedPrimitiveDescriptorIndex = -1;
@@ -449,8 +466,18 @@ public:
 
     PerfCount &PerfCounter() { return perfCounter; }
 
+    /**
+     * @brief Sets the number of the batch items processed by the next inferences. Has no effect on the node which
+     * doesn't support dynamic batch, it processes the whole batch.
+     */
     virtual void setDynamicBatchLim(int lim);
 
+    /**
+     * @brief Returns true if the selected primitive descriptor supports processing of the first batchToProcess()
+     * items of the batch only
+     */
+    bool isDynBatchSupported() const;
+
     void resolveNotAllocatedEdges();
     virtual void execute(mkldnn::stream strm);
     virtual void initSupportedPrimitiveDescriptors();
@@ -566,6 +593,13 @@ public:
      */
     virtual InferenceEngine::Precision getRuntimePrecision() const;
 
+    /**
+     * @brief Returns the number of bytes taken by the constant weights the node reads: the memory of the constant inputs
+     * and the internal copies of the weights made by the node
+     * @return Number of bytes, 0 for the nodes on the constant path themselves
+     */
+    virtual size_t getWeightsBytes();
+
     const std::vector<InferenceEngine::Precision>& getOriginalInputPrecisions() const {
         return originalInputPrecisions;
     }
@@ -632,6 +666,10 @@ public:
         isInQuantizedGraph = flag;
     }
 
+    void setMemoryArena(const MKLDNNMemoryArena::Ptr& arena) {
+        memoryArena = arena;
+    }
+
     bool canBePerformedAsScaleShift(const MKLDNNNode *parentNode = nullptr) const;
 
 protected:
@@ -645,6 +683,10 @@ protected:
 
     virtual int getMaxBatch();
 
+    /**
+     * @brief Creates the memory of the node internal data: reserves it from the memory arena of the graph if it has one
+     */
+    MKLDNNMemoryPtr createMemory(const mkldnn::memory::desc& desc) const;
 
     virtual InferenceEngine::TensorDesc getConfiguredInputDesc(const InferenceEngine::LayerConfig& config, size_t idx) const;
     virtual InferenceEngine::TensorDesc getConfiguredOutputDesc(const InferenceEngine::LayerConfig& config, size_t idx) const;
@@ -696,6 +738,7 @@ protected:
 
     InferenceEngine::Blob::Ptr ext_scales;
     MKLDNNWeightsSharing::Ptr weightCache;
+    MKLDNNMemoryArena::Ptr memoryArena;
 
     Algorithm algorithm = Algorithm::Undefined;
 
@@ -834,6 +877,20 @@ struct MKLDNNNodeImpl : public MKLDNNNodeType {
         : MKLDNNNodeType(op, eng, cache) {
         MKLDNNNodeType::perfCounters().template buildClassCounters<MKLDNNNodeType>(NameFromType(MKLDNNNodeType::getType()));
     }
+
+    // the node types which can't share their state between the copies delete the copy constructor
+    MKLDNNNodePtr clone() const override {
+        return cloneImpl(std::is_copy_constructible<MKLDNNNodeType>());
+    }
+
+private:
+    MKLDNNNodePtr cloneImpl(std::true_type) const {
+        return std::make_shared<MKLDNNNodeImpl>(*this);
+    }
+
+    MKLDNNNodePtr cloneImpl(std::false_type) const {
+        return nullptr;
+    }
 };
 
 #define REG_MKLDNN_CONCAT3_(X, Y, Z) X ## Y ## Z
@@ -7,6 +7,7 @@
 #include "mkldnn_extension_mngr.h"
 #include "mkldnn_weights_cache.hpp"
 #include "mkldnn_itt.h"
+#include "mkldnn_streams_tuner.h"
 
 #include <threading/ie_executor_manager.hpp>
 #include <memory>
@@ -61,6 +62,7 @@
 #include <transformations/rt_info/fused_names_attribute.hpp>
 #include <transformations/op_conversions/fq_decomposition.hpp>
 #include <transformations/utils/utils.hpp>
+#include <snippets/pass/collapse_subgraph.hpp>
 
 #include <ngraph/opsets/opset2.hpp>
 #include <ngraph/opsets/opset3.hpp>
@@ -88,6 +90,8 @@
 #include "nodes/mkldnn_mvn_node.h"
 #include "nodes/mkldnn_fake_quantize_node.h"
 #include "ngraph_transformations/convert_to_cpu_specific_opset.hpp"
+#include "ngraph_transformations/mark_compressed_weights.hpp"
+#include "ngraph_transformations/fc_low_bit_weights_fusion.hpp"
 
 #if !defined(__arm__) && !defined(_M_ARM) && !defined(__aarch64__) && !defined(_M_ARM64)
 # ifdef _WIN32
@@ -148,6 +152,11 @@ static void Transformation(CNNNetwork& clonedNetwork, const Config& conf) {
 
     static const auto precisions = get_convert_precisions();
 
+    // the low-bit weights are packed before the constant folding converts them to a wider precision
+    if (conf.compressedWeights && with_cpu_x86_avx2()) {
+        manager.register_pass<FullyConnectedLowBitWeightsFusion>();
+    }
+
     // WA: ConvertPriorBox must be executed before the 1st ConstantFolding pass
     manager.register_pass<ngraph::pass::CommonOptimizations>();
     manager.register_pass<ngraph::pass::ConvertRNNSequenceToTensorIterator>();
@@ -171,6 +180,14 @@ static void Transformation(CNNNetwork& clonedNetwork, const Config& conf) {
         manager.register_pass<ngraph::pass::low_precision::ConvertSubtractConstant>(
             std::vector<ngraph::element::Type>{ ngraph::element::i8, ngraph::element::u8, ngraph::element::i4, ngraph::element::u4 });
     }
+    if (conf.compressedWeights && with_cpu_x86_avx2()) {
+        std::vector<ngraph::element::Type> compressedPrecisions;
+        for (const auto& precision : precisions) {
+            if (precision.second == ngraph::element::f32 && (precision.first == ngraph::element::f16 || precision.first == ngraph::element::bf16))
+                compressedPrecisions.push_back(precision.first);
+        }
+        manager.register_pass<MarkCompressedWeights>(compressedPrecisions);
+    }
     manager.register_pass<ngraph::pass::ConvertPrecision>(precisions);
 
     auto pass_config = manager.get_pass_config();
@@ -366,6 +383,12 @@ static void Transformation(CNNNetwork& clonedNetwork, const Config& conf) {
 
     postLPTPassManager.run_passes(nGraphFunc);
 
+    if (conf.enableSnippets && with_cpu_x86_avx2()) {
+        ngraph::pass::Manager tokenization_manager;
+        tokenization_manager.register_pass<ngraph::snippets::pass::TokenizeSnippets>();
+        tokenization_manager.run_passes(nGraphFunc);
+    }
+
     ConvertToCPUSpecificOpset(nGraphFunc);
 }
 
@@ -404,9 +427,49 @@ Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network, const std
 
     CNNNetwork clonedNetwork = InferenceEngine::details::cloneNetwork(network);
 
+    // Keep the original network to reshape and transform it for input shapes which are met later or batched requests
+    MKLDNNExecNetwork::NetworkCompiler compiler;
+    if (conf.shapeCacheSize != 0 || !conf.shapeBuckets.empty() || conf.batchingMaxBatch > 1) {
+        CNNNetwork sourceNetwork = InferenceEngine::details::cloneNetwork(network);
+        compiler = [sourceNetwork, conf] (const ICNNNetwork::InputShapes& shapes) {
+            CNNNetwork reshapedNetwork = InferenceEngine::details::cloneNetwork(sourceNetwork);
+            reshapedNetwork.reshape(shapes);
+            Transformation(reshapedNetwork, conf);
+            return reshapedNetwork;
+        };
+    }
+
     Transformation(clonedNetwork, conf);
 
-    return std::make_shared<MKLDNNExecNetwork>(clonedNetwork, conf, extensionManager, weightsSharing);
+    // The networks with the priority share the executor, so the layout is the same for all of them
+    if (conf.throughputAutoTune && !conf.exclusiveAsyncRequests && conf.requestPriority == Config::RequestPriority::None) {
+        auto makeNetwork = [&] (const Config& candidateConfig) {
+            return std::make_shared<MKLDNNExecNetwork>(clonedNetwork, candidateConfig, extensionManager, weightsSharing, compiler);
+        };
+        return TuneStreamsLayout(makeNetwork, network.getInputsInfo(), network.getOutputsInfo(), conf);
+    }
+
+    return std::make_shared<MKLDNNExecNetwork>(clonedNetwork, conf, extensionManager, weightsSharing, compiler);
+}
+
+InferenceEngine::IExecutableNetworkInternal::Ptr
+Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network, const RemoteContext::Ptr &context,
+                           const std::map<std::string, std::string> &config) {
+    // The shared memory context keeps no state, the networks loaded on it accept the context blobs as any others
+    if (std::dynamic_pointer_cast<InferenceEngine::cpu::SharedMemoryContext>(context) == nullptr)
+        IE_THROW() << "Invalid remote context passed: CPU shared memory context is expected";
+    return LoadExeNetworkImpl(network, config);
+}
+
+RemoteContext::Ptr Engine::CreateContext(const ParamMap& params) {
+    return std::make_shared<MKLDNNRemoteContext>(params);
+}
+
+RemoteContext::Ptr Engine::GetDefaultContext(const ParamMap& params) {
+    std::lock_guard<std::mutex> lock{defaultContextMutex};
+    if (defaultContext == nullptr)
+        defaultContext = std::make_shared<MKLDNNRemoteContext>(params);
+    return defaultContext;
 }
 
 void Engine::SetConfig(const std::map<std::string, std::string> &config) {
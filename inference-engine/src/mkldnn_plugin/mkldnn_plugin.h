@@ -6,6 +6,7 @@
 
 #include <cpp_interfaces/interface/ie_iplugin_internal.hpp>
 #include "mkldnn_exec_network.h"
+#include "mkldnn_remote_context.h"
 
 #include <string>
 #include <map>
@@ -13,6 +14,7 @@
 #include <memory>
 #include <functional>
 #include <vector>
+#include <mutex>
 
 namespace MKLDNNPlugin {
 
@@ -25,6 +27,14 @@ public:
     LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network,
                        const std::map<std::string, std::string> &config) override;
 
+    std::shared_ptr<InferenceEngine::IExecutableNetworkInternal>
+    LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network,
+                       const InferenceEngine::RemoteContext::Ptr &context,
+                       const std::map<std::string, std::string> &config) override;
+
+    InferenceEngine::RemoteContext::Ptr CreateContext(const InferenceEngine::ParamMap& params) override;
+    InferenceEngine::RemoteContext::Ptr GetDefaultContext(const InferenceEngine::ParamMap& params) override;
+
     void AddExtension(const InferenceEngine::IExtensionPtr& extension) override;
 
     void SetConfig(const std::map<std::string, std::string> &config) override;
@@ -39,6 +49,8 @@ public:
 private:
     Config engConfig;
     NumaNodesWeights weightsSharing;
+    std::mutex defaultContextMutex;
+    InferenceEngine::RemoteContext::Ptr defaultContext;
     MKLDNNExtensionManager::Ptr extensionManager = std::make_shared<MKLDNNExtensionManager>();
 };
 
@@ -0,0 +1,180 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_remote_context.h"
+
+#include <details/ie_pre_allocator.hpp>
+
+#include <cerrno>
+#include <cstring>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+#ifdef __linux__
+#include <sys/syscall.h>
+#endif
+
+using namespace InferenceEngine;
+
+namespace MKLDNNPlugin {
+
+namespace {
+
+template <typename T>
+T getParam(const ParamMap& params, const std::string& key, const T& defaultValue) {
+    auto found = params.find(key);
+    if (found == params.end())
+        return defaultValue;
+    if (!found->second.is<T>())
+        IE_THROW() << "Unexpected type of the shared memory blob parameter " << key;
+    return found->second.as<T>();
+}
+
+template <typename T>
+T getParam(const ParamMap& params, const std::string& key) {
+    if (params.find(key) == params.end())
+        IE_THROW() << "The shared memory blob parameter " << key << " is not found";
+    return getParam<T>(params, key, T{});
+}
+
+}  // namespace
+
+MKLDNNSharedMemoryBlob::MKLDNNSharedMemoryBlob(const RemoteContext::Ptr& context, const TensorDesc& desc, const ParamMap& params)
+    : cpu::SharedMemoryBlob(desc), _context(context) {
+#ifdef _WIN32
+    IE_THROW(NotImplemented) << "Shared memory blobs are supported on POSIX systems only";
+#else
+    _memType = getParam<std::string>(params, CPU_PARAM_KEY(SHARED_MEM_TYPE), CPU_PARAM_VALUE(MEMFD));
+    _offset = getParam<size_t>(params, CPU_PARAM_KEY(MEM_OFFSET), 0);
+    if (_memType == CPU_PARAM_VALUE(SHM)) {
+        _shmName = getParam<std::string>(params, CPU_PARAM_KEY(SHM_NAME));
+        _fd = shm_open(_shmName.c_str(), O_RDWR | O_CREAT, S_IRUSR | S_IWUSR);
+        if (_fd < 0)
+            IE_THROW() << "Failed to open shared memory object " << _shmName << ": " << std::strerror(errno);
+    } else if (_memType == CPU_PARAM_VALUE(MEMFD)) {
+        if (params.find(CPU_PARAM_KEY(MEM_FD)) != params.end()) {
+            _fd = dup(getParam<int>(params, CPU_PARAM_KEY(MEM_FD)));
+            if (_fd < 0)
+                IE_THROW() << "Failed to duplicate shared memory descriptor: " << std::strerror(errno);
+        } else {
+#if defined(__linux__) && defined(SYS_memfd_create)
+            // MFD_CLOEXEC: the descriptor is expected to be passed over a socket rather than inherited
+            _fd = static_cast<int>(syscall(SYS_memfd_create, "openvino_cpu_blob", 1u));
+            if (_fd < 0)
+                IE_THROW() << "Failed to create memfd: " << std::strerror(errno);
+#else
+            IE_THROW(NotImplemented) << "memfd is not supported on this system, pass " << CPU_PARAM_KEY(MEM_FD) << " or use "
+                                     << CPU_PARAM_VALUE(SHM) << " shared memory";
+#endif
+        }
+    } else {
+        IE_THROW() << "Unsupported shared memory type " << _memType;
+    }
+
+    // the destructor isn't called if the constructor throws, so the descriptor is closed here
+    auto fail = [this] (const std::string& what) {
+        std::string error = std::strerror(errno);
+        close(_fd);
+        _fd = -1;
+        IE_THROW() << what << ": " << error;
+    };
+
+    const size_t bytes = byteSize();
+    struct stat info;
+    if (fstat(_fd, &info) != 0)
+        fail("Failed to get shared memory size");
+    if (static_cast<size_t>(info.st_size) < _offset + bytes && ftruncate(_fd, _offset + bytes) != 0)
+        fail("Failed to grow shared memory to fit the blob");
+
+    // mmap offset has to be a multiple of the page size
+    const size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    const size_t mappingOffset = _offset / pageSize * pageSize;
+    _mappingSize = bytes + _offset - mappingOffset;
+    _mapping = mmap(nullptr, _mappingSize, PROT_READ | PROT_WRITE, MAP_SHARED, _fd, static_cast<off_t>(mappingOffset));
+    if (_mapping == MAP_FAILED)
+        fail("Failed to map shared memory");
+    _data = static_cast<uint8_t*>(_mapping) + (_offset - mappingOffset);
+    _allocator = details::make_pre_allocator(static_cast<uint8_t*>(_data), bytes);
+#endif
+}
+
+MKLDNNSharedMemoryBlob::~MKLDNNSharedMemoryBlob() {
+#ifndef _WIN32
+    if (_mapping != nullptr)
+        munmap(_mapping, _mappingSize);
+    if (_fd >= 0)
+        close(_fd);
+#endif
+}
+
+ParamMap MKLDNNSharedMemoryBlob::getParams() const {
+    ParamMap params = {
+        { CPU_PARAM_KEY(SHARED_MEM_TYPE), _memType },
+        { CPU_PARAM_KEY(MEM_FD), _fd },
+        { CPU_PARAM_KEY(MEM_OFFSET), _offset }
+    };
+    if (!_shmName.empty())
+        params[CPU_PARAM_KEY(SHM_NAME)] = _shmName;
+    return params;
+}
+
+std::string MKLDNNSharedMemoryBlob::getDeviceName() const noexcept {
+    return _context->getDeviceName();
+}
+
+std::shared_ptr<RemoteContext> MKLDNNSharedMemoryBlob::getContext() const noexcept {
+    return _context;
+}
+
+LockedMemory<void> MKLDNNSharedMemoryBlob::buffer() noexcept {
+    return LockedMemory<void>(_allocator.get(), _data, 0);
+}
+
+LockedMemory<const void> MKLDNNSharedMemoryBlob::cbuffer() const noexcept {
+    return LockedMemory<const void>(_allocator.get(), _data, 0);
+}
+
+LockedMemory<void> MKLDNNSharedMemoryBlob::rwmap() noexcept {
+    return LockedMemory<void>(_allocator.get(), _data, 0);
+}
+
+LockedMemory<const void> MKLDNNSharedMemoryBlob::rmap() const noexcept {
+    return LockedMemory<const void>(_allocator.get(), _data, 0);
+}
+
+LockedMemory<void> MKLDNNSharedMemoryBlob::wmap() noexcept {
+    return LockedMemory<void>(_allocator.get(), _data, 0);
+}
+
+const std::shared_ptr<IAllocator>& MKLDNNSharedMemoryBlob::getAllocator() const noexcept {
+    return _allocator;
+}
+
+void* MKLDNNSharedMemoryBlob::getHandle() const noexcept {
+    return _data;
+}
+
+MKLDNNRemoteContext::MKLDNNRemoteContext(const ParamMap& params) {
+    auto type = getParam<std::string>(params, CPU_PARAM_KEY(CONTEXT_TYPE), CPU_PARAM_VALUE(SHARED_MEMORY));
+    if (type != CPU_PARAM_VALUE(SHARED_MEMORY))
+        IE_THROW() << "Unsupported CPU context type " << type;
+}
+
+RemoteBlob::Ptr MKLDNNRemoteContext::CreateBlob(const TensorDesc& desc, const ParamMap& params) {
+    return std::make_shared<MKLDNNSharedMemoryBlob>(shared_from_this(), desc, params);
+}
+
+std::string MKLDNNRemoteContext::getDeviceName() const noexcept {
+    return "CPU";
+}
+
+ParamMap MKLDNNRemoteContext::getParams() const {
+    return { { CPU_PARAM_KEY(CONTEXT_TYPE), CPU_PARAM_VALUE(SHARED_MEMORY) } };
+}
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,66 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cpu/cpu_context_api.hpp>
+#include <ie_allocator.hpp>
+
+#include <memory>
+#include <string>
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief Blob mapping POSIX shared memory or a memfd. The mapping and the duplicated descriptor are owned by the blob.
+ */
+class MKLDNNSharedMemoryBlob : public InferenceEngine::cpu::SharedMemoryBlob {
+public:
+    MKLDNNSharedMemoryBlob(const InferenceEngine::RemoteContext::Ptr& context,
+                           const InferenceEngine::TensorDesc& desc,
+                           const InferenceEngine::ParamMap& params);
+    ~MKLDNNSharedMemoryBlob() override;
+
+    InferenceEngine::ParamMap getParams() const override;
+    std::string getDeviceName() const noexcept override;
+    std::shared_ptr<InferenceEngine::RemoteContext> getContext() const noexcept override;
+
+    // the memory is mapped at the construction and can't be reallocated
+    void allocate() noexcept override {}
+    bool deallocate() noexcept override { return false; }
+
+    InferenceEngine::LockedMemory<void> buffer() noexcept override;
+    InferenceEngine::LockedMemory<const void> cbuffer() const noexcept override;
+    InferenceEngine::LockedMemory<void> rwmap() noexcept override;
+    InferenceEngine::LockedMemory<const void> rmap() const noexcept override;
+    InferenceEngine::LockedMemory<void> wmap() noexcept override;
+
+protected:
+    const std::shared_ptr<InferenceEngine::IAllocator>& getAllocator() const noexcept override;
+    void* getHandle() const noexcept override;
+
+private:
+    InferenceEngine::RemoteContext::Ptr _context;
+    std::string _memType;
+    std::string _shmName;
+    int _fd = -1;
+    size_t _offset = 0;
+    void* _mapping = nullptr;
+    size_t _mappingSize = 0;
+    void* _data = nullptr;
+    std::shared_ptr<InferenceEngine::IAllocator> _allocator;
+};
+
+class MKLDNNRemoteContext : public InferenceEngine::cpu::SharedMemoryContext,
+                            public std::enable_shared_from_this<MKLDNNRemoteContext> {
+public:
+    explicit MKLDNNRemoteContext(const InferenceEngine::ParamMap& params);
+
+    InferenceEngine::RemoteBlob::Ptr CreateBlob(const InferenceEngine::TensorDesc& desc,
+                                                const InferenceEngine::ParamMap& params = {}) override;
+    std::string getDeviceName() const noexcept override;
+    InferenceEngine::ParamMap getParams() const override;
+};
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,178 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_streams_tuner.h"
+#include "mkldnn_itt.h"
+
+#include <cpp/ie_infer_request.hpp>
+#include <ie_metric_helpers.hpp>
+#include <ie_system_conf.h>
+#include <ie_parallel.hpp>
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstring>
+#include <exception>
+#include <mutex>
+#include <string>
+
+using namespace InferenceEngine;
+
+namespace MKLDNNPlugin {
+
+std::vector<StreamsLayout> MakeStreamsLayoutCandidates(int cores, int processors, int numaNodes) {
+    cores = std::max(1, cores);
+    processors = std::max(cores, processors);
+    numaNodes = std::max(1, numaNodes);
+
+    std::vector<int> streams;
+    for (int s = 1; s < cores; s *= 2)
+        streams.push_back(s);
+    streams.push_back(cores);
+    if (numaNodes <= cores && std::find(streams.begin(), streams.end(), numaNodes) == streams.end())
+        streams.push_back(numaNodes);
+    std::sort(streams.begin(), streams.end());
+
+    std::vector<StreamsLayout> layouts;
+    for (auto s : streams) {
+        StreamsLayout layout;
+        layout.streams = s;
+        layouts.push_back(layout);
+        if (processors != cores) {
+            // by default the streams up to the number of NUMA nodes use the cores only and the others use all
+            // the hardware threads, so the opposite option is tried as well
+            layout.threads = s <= numaNodes ? processors : cores;
+            layouts.push_back(layout);
+        }
+    }
+    return layouts;
+}
+
+bool IsBetterStreamsLayout(const StreamsLayout& layout, const StreamsLayout& other, float latencyLimit) {
+    const bool fits = latencyLimit <= 0.f || layout.latency <= latencyLimit;
+    const bool otherFits = latencyLimit <= 0.f || other.latency <= latencyLimit;
+    if (fits != otherFits)
+        return fits;
+    return fits ? layout.throughput > other.throughput : layout.latency < other.latency;
+}
+
+void MeasureStreamsLayout(const MKLDNNExecNetwork::Ptr& network, StreamsLayout& layout, std::chrono::milliseconds duration) {
+    using Clock = std::chrono::steady_clock;
+
+    const auto numRequests = network->GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>();
+    std::vector<IInferRequestInternal::Ptr> requests;
+    for (unsigned int i = 0; i < numRequests; i++) {
+        auto request = network->CreateInferRequest();
+        for (const auto& input : network->GetInputsInfo()) {
+            auto blob = as<MemoryBlob>(request->GetBlob(input.first));
+            if (blob) {
+                auto data = blob->wmap();
+                std::memset(data.as<void*>(), 0, blob->byteSize());
+            }
+        }
+        requests.push_back(request);
+    }
+
+    // The first inferences of the streams are slower, so they aren't measured
+    for (auto& request : requests)
+        request->StartAsync();
+    for (auto& request : requests)
+        request->Wait(InferRequest::RESULT_READY);
+
+    std::mutex mutex;
+    std::condition_variable finished;
+    size_t active = requests.size();
+    size_t inferences = 0;
+    double latencySum = 0.0;
+    std::exception_ptr error;
+    std::vector<Clock::time_point> starts(requests.size());
+
+    const auto begin = Clock::now();
+    const auto deadline = begin + duration;
+    for (size_t i = 0; i < requests.size(); i++) {
+        // Each request is restarted by its callback until the time is over
+        requests[i]->SetCallback([&, i] (std::exception_ptr exception) {
+            const auto end = Clock::now();
+            std::unique_lock<std::mutex> lock(mutex);
+            if (exception) {
+                error = exception;
+            } else {
+                inferences++;
+                latencySum += std::chrono::duration<double, std::milli>(end - starts[i]).count();
+            }
+            if (!error && end < deadline) {
+                starts[i] = Clock::now();
+                lock.unlock();
+                try {
+                    requests[i]->StartAsync();
+                    return;
+                } catch (...) {
+                    lock.lock();
+                    error = std::current_exception();
+                }
+            }
+            if (--active == 0)
+                finished.notify_all();
+        });
+    }
+    std::unique_lock<std::mutex> lock(mutex);
+    for (size_t i = 0; i < requests.size(); i++) {
+        starts[i] = Clock::now();
+        lock.unlock();
+        try {
+            requests[i]->StartAsync();
+            lock.lock();
+        } catch (...) {
+            lock.lock();
+            error = std::current_exception();
+            active--;
+        }
+    }
+    finished.wait(lock, [&] { return active == 0; });
+    const auto end = Clock::now();
+    lock.unlock();
+    for (auto& request : requests) {
+        request->Wait(InferRequest::RESULT_READY);
+        request->SetCallback({});
+    }
+    if (error)
+        std::rethrow_exception(error);
+
+    layout.throughput = inferences / std::chrono::duration<double>(end - begin).count();
+    layout.latency = inferences ? latencySum / inferences : 0.0;
+}
+
+MKLDNNExecNetwork::Ptr TuneStreamsLayout(const std::function<MKLDNNExecNetwork::Ptr(const Config&)>& makeNetwork,
+                                         const InputsDataMap& inputs,
+                                         const OutputsDataMap& outputs,
+                                         const Config& config) {
+    OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "TuneStreamsLayout");
+
+    // Time each layout runs for, it is enough to get the stable throughput for the most of the networks
+    const std::chrono::milliseconds measureDuration(500);
+
+    const auto candidates = MakeStreamsLayoutCandidates(getNumberOfCPUCores(), parallel_get_max_threads(),
+                                                        static_cast<int>(getAvailableNUMANodes().size()));
+    MKLDNNExecNetwork::Ptr bestNetwork;
+    StreamsLayout bestLayout;
+    for (auto layout : candidates) {
+        Config candidateConfig = config;
+        candidateConfig.streamExecutorConfig._streams = layout.streams;
+        candidateConfig.streamExecutorConfig._threads = layout.threads;
+        candidateConfig._config.clear();
+        candidateConfig.updateProperties();
+
+        auto network = makeNetwork(candidateConfig);
+        network->setNetworkInputs(inputs);
+        network->setNetworkOutputs(outputs);
+        MeasureStreamsLayout(network, layout, measureDuration);
+        if (!bestNetwork || IsBetterStreamsLayout(layout, bestLayout, config.autoTuneLatencyLimit)) {
+            bestNetwork = network;
+            bestLayout = layout;
+        }
+    }
+    return bestNetwork;
+}
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,58 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "config.h"
+#include "mkldnn_exec_network.h"
+
+#include <chrono>
+#include <functional>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief The number of streams and threads the network is executed with and its measured performance
+ */
+struct StreamsLayout {
+    int streams = 1;
+    // 0 means the default number of threads for the streams
+    int threads = 0;
+    // inferences per second
+    double throughput = 0.0;
+    // average latency of an inference in milliseconds
+    double latency = 0.0;
+};
+
+/**
+ * @brief Returns the layouts to try: the numbers of streams are the powers of two up to the number of cores, the number
+ * of cores and the number of NUMA nodes. If the cores have several hardware threads, each number of streams is tried
+ * with and without them.
+ */
+std::vector<StreamsLayout> MakeStreamsLayoutCandidates(int cores, int processors, int numaNodes);
+
+/**
+ * @brief Checks if the layout is better than the other one: it fits the latency limit while the other one doesn't,
+ * or gives higher throughput if both fit, or lower latency if neither does. The limit is in milliseconds, 0 means
+ * no limit.
+ */
+bool IsBetterStreamsLayout(const StreamsLayout& layout, const StreamsLayout& other, float latencyLimit);
+
+/**
+ * @brief Measures the throughput and latency of the network running as many requests as it reports optimal
+ * for the given time. The inputs are filled with zeros.
+ */
+void MeasureStreamsLayout(const MKLDNNExecNetwork::Ptr& network, StreamsLayout& layout, std::chrono::milliseconds duration);
+
+/**
+ * @brief Loads the network with each candidate layout, measures it and returns the best network
+ * @param makeNetwork Loads the network with the given configuration
+ */
+MKLDNNExecNetwork::Ptr TuneStreamsLayout(const std::function<MKLDNNExecNetwork::Ptr(const Config&)>& makeNetwork,
+                                         const InferenceEngine::InputsDataMap& inputs,
+                                         const InferenceEngine::OutputsDataMap& outputs,
+                                         const Config& config);
+
+}  // namespace MKLDNNPlugin
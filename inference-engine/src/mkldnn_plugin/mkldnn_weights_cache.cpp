@@ -71,8 +71,14 @@ MKLDNNWeightsSharing::MKLDNNSharedMemory::Ptr MKLDNNWeightsSharing::get(const st
 }
 
 NumaNodesWeights::NumaNodesWeights() {
-    for (auto numa_id : InferenceEngine::getAvailableNUMANodes())
+    for (auto numa_id : InferenceEngine::getAvailableNUMANodes()) {
         _cache_map[numa_id] = std::make_shared<MKLDNNWeightsSharing>();
+        // the arenas reserve nothing until the first allocation
+        for (auto arena : {Config::MemoryArena::Numa, Config::MemoryArena::NumaTransparentHugePages, Config::MemoryArena::NumaExplicitHugePages}) {
+            _arena_cache_map[{numa_id, arena}] = std::make_shared<MKLDNNWeightsSharing>();
+            _arena_map[{numa_id, arena}] = std::make_shared<MKLDNNMemoryArena>(numa_id, arena);
+        }
+    }
 }
 
 MKLDNNWeightsSharing::Ptr& NumaNodesWeights::operator[](int numa_id) {
@@ -89,4 +95,22 @@ const MKLDNNWeightsSharing::Ptr& NumaNodesWeights::operator[](int numa_id) const
     return found->second;
 }
 
+const MKLDNNWeightsSharing::Ptr& NumaNodesWeights::get(int numa_id, Config::MemoryArena arena) const {
+    if (arena == Config::MemoryArena::Default)
+        return (*this)[numa_id];
+    auto found = _arena_cache_map.find({numa_id, arena});
+    if (found == _arena_cache_map.end())
+        IE_THROW() << "Unknown numa node id " << numa_id;
+    return found->second;
+}
+
+MKLDNNMemoryArena::Ptr NumaNodesWeights::getArena(int numa_id, Config::MemoryArena arena) const {
+    if (arena == Config::MemoryArena::Default)
+        return nullptr;
+    auto found = _arena_map.find({numa_id, arena});
+    if (found == _arena_map.end())
+        IE_THROW() << "Unknown numa node id " << numa_id;
+    return found->second;
+}
+
 }  // namespace MKLDNNPlugin
@@ -5,6 +5,7 @@
 #pragma once
 
 #include <mkldnn_memory.h>
+#include "mkldnn_memory_arena.h"
 
 #include <unordered_map>
 #include <functional>
@@ -13,6 +14,7 @@
 #include <atomic>
 #include <mutex>
 #include <map>
+#include <utility>
 
 // TODO: While CPU plugin has no ease way to clone graph object we use weight
 //       caching in global Engine context to avoid tensor memory duplication.
@@ -113,8 +115,21 @@ public:
     MKLDNNWeightsSharing::Ptr& operator[](int i);
     const MKLDNNWeightsSharing::Ptr& operator[](int i) const;
 
+    /**
+     * Returns the caching store of the graphs which reserve memory from the arena of the given kind bound to NUMA node
+     * The stores of the different arena kinds don't share the cached objects, since the objects are placed in the arena
+     */
+    const MKLDNNWeightsSharing::Ptr& get(int numa_id, Config::MemoryArena arena) const;
+
+    /**
+     * Returns the arena of the given kind bound to NUMA node or nullptr for the default memory allocation
+     */
+    MKLDNNMemoryArena::Ptr getArena(int numa_id, Config::MemoryArena arena) const;
+
 private:
     std::map<int, MKLDNNWeightsSharing::Ptr> _cache_map;
+    std::map<std::pair<int, Config::MemoryArena>, MKLDNNWeightsSharing::Ptr> _arena_cache_map;
+    std::map<std::pair<int, Config::MemoryArena>, MKLDNNMemoryArena::Ptr> _arena_map;
 };
 
 }  // namespace MKLDNNPlugin
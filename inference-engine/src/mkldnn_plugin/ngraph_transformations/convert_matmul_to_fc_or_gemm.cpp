@@ -99,11 +99,19 @@ MKLDNNPlugin::ConvertMatMulToFC::ConvertMatMulToFC() {
         // vector of new nGraph operations
         ngraph::NodeVector new_ops;
 
+        // Constant weights which keep the compressed precision are decompressed by Convert, it is fused into FullyConnected node
+        auto is_compressed_weights = [](const std::shared_ptr<ngraph::Node>& node) {
+            return std::dynamic_pointer_cast<ngraph::opset1::Convert>(node) &&
+                   std::dynamic_pointer_cast<ngraph::opset1::Constant>(node->get_input_node_shared_ptr(0)) &&
+                   (node->get_input_element_type(0) == ngraph::element::f16 || node->get_input_element_type(0) == ngraph::element::bf16);
+        };
+
         // Check that if second inputs is Constant operation and it's shape without ones dimensions has length <= 2
         // we replace MatMul with FullyConnected operation.
         // Otherwise we replace MatMul with Gemm.
         if ((std::dynamic_pointer_cast<ngraph::opset1::Constant>(fc_input_b.get_node_shared_ptr()) ||
-             std::dynamic_pointer_cast<ngraph::opset1::FakeQuantize>(fc_input_b.get_node_shared_ptr())) &&
+             std::dynamic_pointer_cast<ngraph::opset1::FakeQuantize>(fc_input_b.get_node_shared_ptr()) ||
+             is_compressed_weights(fc_input_b.get_node_shared_ptr())) &&
              std::count_if(shape_b.begin(), shape_b.end(), [](size_t x) { return x != 1; }) <= 2) {
             ngraph::Shape shape_a_aligned, shape_b_aligned;
             std::tie(shape_a_aligned, shape_b_aligned) = get_aligned_shapes();
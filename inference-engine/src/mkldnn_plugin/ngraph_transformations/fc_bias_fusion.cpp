@@ -24,7 +24,8 @@ MKLDNNPlugin::FullyConnectedBiasFusion::FullyConnectedBiasFusion() {
         auto add = pattern_to_output[m_add].get_node_shared_ptr();
         auto bias = pattern_to_output[m_bias].get_node_shared_ptr();
         auto fc = std::dynamic_pointer_cast<MKLDNNPlugin::FullyConnectedNode>(pattern_to_output[m_fc].get_node_shared_ptr());
-        if (!fc) {
+        // the Add after FullyConnected with the bias or the low-bit weights inputs is fused as a post operation
+        if (!fc || fc->get_input_size() != 2) {
             return false;
         }
 
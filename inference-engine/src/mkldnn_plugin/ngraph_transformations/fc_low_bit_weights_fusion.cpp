@@ -0,0 +1,174 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "fc_low_bit_weights_fusion.hpp"
+#include "op/fully_connected.hpp"
+#include <cmath>
+#include <vector>
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/rt_info.hpp>
+#include <ngraph/pattern/op/wrap_type.hpp>
+
+NGRAPH_RTTI_DEFINITION(MKLDNNPlugin::FullyConnectedLowBitWeightsFusion, "FullyConnectedLowBitWeightsFusion", 0);
+
+namespace {
+
+bool hasSingleConsumer(const std::shared_ptr<ngraph::Node>& node) {
+    return node->get_output_size() == 1 && node->output(0).get_target_inputs().size() == 1;
+}
+
+// Constant or Constant converted to another precision
+std::shared_ptr<ngraph::opset1::Constant> getConstant(const ngraph::Output<ngraph::Node>& output) {
+    auto node = output.get_node_shared_ptr();
+    if (ngraph::is_type<ngraph::opset1::Convert>(node))
+        node = node->get_input_node_shared_ptr(0);
+    return std::dynamic_pointer_cast<ngraph::opset1::Constant>(node);
+}
+
+// Values of the constant broadcasted to the weights [OC, IC] or [OC, groups, group size] for each output channel and
+// group, empty if the constant differs inside a group
+std::vector<float> getPerGroupValues(const std::shared_ptr<ngraph::opset1::Constant>& constant, const ngraph::Shape& weightsShape) {
+    auto shape = constant->get_shape();
+    if (shape.size() > weightsShape.size())
+        return {};
+    shape.insert(shape.begin(), weightsShape.size() - shape.size(), 1);
+    if (shape.back() != 1)
+        return {};
+    for (size_t i = 0; i < shape.size(); i++) {
+        if (shape[i] != 1 && shape[i] != weightsShape[i])
+            return {};
+    }
+
+    const auto values = constant->cast_vector<float>();
+    const size_t OC = weightsShape[0];
+    const size_t G = weightsShape.size() == 3 ? weightsShape[1] : 1;
+    const size_t constantG = weightsShape.size() == 3 ? shape[1] : 1;
+    std::vector<float> result(OC * G);
+    for (size_t oc = 0; oc < OC; oc++) {
+        for (size_t g = 0; g < G; g++) {
+            const size_t idx = (shape[0] == 1 ? 0 : oc) * constantG + (constantG == 1 ? 0 : g);
+            result[oc * G + g] = values[idx];
+        }
+    }
+    return result;
+}
+
+}  // namespace
+
+MKLDNNPlugin::FullyConnectedLowBitWeightsFusion::FullyConnectedLowBitWeightsFusion() {
+    auto m_matmul = ngraph::pattern::wrap_type<ngraph::opset1::MatMul>(ngraph::pattern::has_static_shape());
+
+    ngraph::matcher_pass_callback callback = [=](ngraph::pattern::Matcher &m) {
+        auto matmul = std::dynamic_pointer_cast<ngraph::opset1::MatMul>(m.get_match_root());
+        if (!matmul || matmul->get_transpose_a() || !matmul->get_transpose_b())
+            return false;
+        const auto& dataShape = matmul->get_input_shape(0);
+        if (dataShape.size() != 2 && dataShape.size() != 3)
+            return false;
+
+        ngraph::NodeVector decompression;
+        auto node = matmul->get_input_node_shared_ptr(1);
+        const bool withReshape = ngraph::is_type<ngraph::opset1::Reshape>(node);
+        if (withReshape) {
+            decompression.push_back(node);
+            node = node->get_input_node_shared_ptr(0);
+        }
+
+        auto multiply = std::dynamic_pointer_cast<ngraph::opset1::Multiply>(node);
+        if (!multiply)
+            return false;
+        auto scalesConst = getConstant(multiply->input_value(1));
+        if (!scalesConst)
+            return false;
+        decompression.push_back(multiply);
+        node = multiply->get_input_node_shared_ptr(0);
+
+        std::shared_ptr<ngraph::opset1::Constant> zeroPointsConst;
+        if (auto subtract = std::dynamic_pointer_cast<ngraph::opset1::Subtract>(node)) {
+            zeroPointsConst = getConstant(subtract->input_value(1));
+            if (!zeroPointsConst)
+                return false;
+            decompression.push_back(subtract);
+            node = subtract->get_input_node_shared_ptr(0);
+        }
+
+        auto convert = std::dynamic_pointer_cast<ngraph::opset1::Convert>(node);
+        if (!convert || !convert->get_output_element_type(0).is_real())
+            return false;
+        decompression.push_back(convert);
+
+        auto weights = std::dynamic_pointer_cast<ngraph::opset1::Constant>(convert->get_input_node_shared_ptr(0));
+        if (!weights || (weights->get_element_type() != ngraph::element::u4 && weights->get_element_type() != ngraph::element::i4))
+            return false;
+        for (const auto& decompressionNode : decompression) {
+            if (!hasSingleConsumer(decompressionNode))
+                return false;
+        }
+
+        // [OC, IC] or [OC, groups, group size] reshaped to [OC, IC]
+        const auto& weightsShape = weights->get_shape();
+        if (weightsShape.size() != (withReshape ? 3 : 2) || multiply->get_shape() != weightsShape)
+            return false;
+        const size_t OC = weightsShape[0];
+        const size_t IC = dataShape.back();
+        const size_t G = withReshape ? weightsShape[1] : 1;
+        if (matmul->get_input_shape(1) != ngraph::Shape{OC, IC} || G * weightsShape.back() != IC)
+            return false;
+        // every block of the packed weights belongs to one group
+        const size_t block = FullyConnectedNode::lowBitWeightsBlock;
+        if ((IC / G) % block != 0)
+            return false;
+
+        auto scales = getPerGroupValues(scalesConst, weightsShape);
+        if (scales.empty())
+            return false;
+        std::vector<float> zeroPoints(OC * G, 0.f);
+        if (zeroPointsConst) {
+            zeroPoints = getPerGroupValues(zeroPointsConst, weightsShape);
+            if (zeroPoints.empty())
+                return false;
+        }
+
+        // i4 weights are biased to u4 by 8, which is compensated by the zero points kept in u8
+        const bool isSigned = weights->get_element_type() == ngraph::element::i4;
+        const uint8_t bias = isSigned ? 0x8 : 0x0;
+        std::vector<uint8_t> packedZeroPoints(OC * G);
+        for (size_t i = 0; i < zeroPoints.size(); i++) {
+            const float zp = zeroPoints[i] + static_cast<float>(bias);
+            if (zp < 0.f || zp > 255.f || zp != std::round(zp))
+                return false;
+            packedZeroPoints[i] = static_cast<uint8_t>(zp);
+        }
+
+        // the constant holds two values per byte, the first one in the high nibble
+        const auto src = weights->get_data_ptr<uint8_t>();
+        auto getNibble = [&](size_t i) {
+            return static_cast<uint8_t>(((src[i / 2] >> (i % 2 ? 0 : 4)) & 0xF) ^ bias);
+        };
+        std::vector<uint8_t> packed(OC * IC / 2);
+        for (size_t oc = 0; oc < OC; oc++) {
+            for (size_t b = 0; b < IC / block; b++) {
+                const size_t start = oc * IC + b * block;
+                for (size_t j = 0; j < block / 2; j++)
+                    packed[start / 2 + j] = getNibble(start + j) | static_cast<uint8_t>(getNibble(start + j + block / 2) << 4);
+            }
+        }
+
+        auto packedWeights = ngraph::opset1::Constant::create(ngraph::element::u8, ngraph::Shape{OC, IC / 2}, packed);
+        auto fcBias = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{OC}, std::vector<float>(OC, 0.f));
+        auto fcScales = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{OC, G}, scales);
+        auto fcZeroPoints = ngraph::opset1::Constant::create(ngraph::element::u8, ngraph::Shape{OC, G}, packedZeroPoints);
+        auto fc = std::make_shared<MKLDNNPlugin::FullyConnectedNode>(matmul->input_value(0), packedWeights, fcBias, fcScales, fcZeroPoints,
+                                                                     matmul->get_shape());
+
+        fc->set_friendly_name(matmul->get_friendly_name());
+        decompression.push_back(matmul);
+        ngraph::copy_runtime_info(decompression, fc);
+        ngraph::replace_node(matmul, fc);
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(m_matmul, "FullyConnectedLowBitWeightsFusion");
+    this->register_matcher(m, callback);
+}
@@ -0,0 +1,23 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/pass/graph_rewrite.hpp>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Replaces MatMul with the u4/i4 constant weights decompressed by Convert -> [Subtract] -> Multiply [-> Reshape] with
+ * FullyConnected holding the packed 4-bit weights, the scales and the zero points, so the weights are not converted
+ * to a wider precision. The zero points and the scales may be per output channel or per group of the input channels
+ * ([OC, groups, group size] weights reshaped to [OC, IC]). The pass is executed before the constant folding.
+ */
+class FullyConnectedLowBitWeightsFusion : public ngraph::pass::MatcherPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    FullyConnectedLowBitWeightsFusion();
+};
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,42 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mark_compressed_weights.hpp"
+
+#include <algorithm>
+#include <string>
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/variant.hpp>
+#include <ngraph/pattern/op/wrap_type.hpp>
+
+NGRAPH_RTTI_DEFINITION(MKLDNNPlugin::MarkCompressedWeights, "MarkCompressedWeights", 0);
+
+MKLDNNPlugin::MarkCompressedWeights::MarkCompressedWeights(const std::vector<ngraph::element::Type>& precisions) {
+    auto weights = ngraph::pattern::wrap_type<ngraph::opset1::Constant>(ngraph::pattern::consumers_count(1));
+    auto matmul = ngraph::pattern::wrap_type<ngraph::opset1::MatMul>({ngraph::pattern::any_input(ngraph::pattern::has_static_shape()), weights},
+                                                                     ngraph::pattern::has_static_shape());
+
+    ngraph::matcher_pass_callback callback = [=](ngraph::pattern::Matcher& m) {
+        auto& pattern_to_output = m.get_pattern_value_map();
+        auto matmulNode = std::dynamic_pointer_cast<ngraph::opset1::MatMul>(pattern_to_output[matmul].get_node_shared_ptr());
+        auto weightsNode = pattern_to_output[weights].get_node_shared_ptr();
+        if (!matmulNode || !matmulNode->get_transpose_b())
+            return false;
+
+        const auto& weightsType = weightsNode->get_output_element_type(0);
+        if (std::find(precisions.begin(), precisions.end(), weightsType) == precisions.end())
+            return false;
+
+        // the compressed weights are supported by the FullyConnected kernel for 2D and 3D inputs only
+        const auto dataRank = matmulNode->get_input_shape(0).size();
+        if (weightsNode->get_output_shape(0).size() != 2 || (dataRank != 2 && dataRank != 3))
+            return false;
+
+        weightsNode->get_rt_info()["KEEP_CONST_PRECISION"] = std::make_shared<ngraph::VariantWrapper<std::string>>("");
+        return false;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(matmul, "MarkCompressedWeights");
+    this->register_matcher(m, callback);
+}
@@ -0,0 +1,23 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <vector>
+#include <ngraph/pass/graph_rewrite.hpp>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Marks the constant weights of the given precisions which are consumed by MatMul only to keep their precision
+ * during ConvertPrecision. Only the weights which become FullyConnected weights without any transformation
+ * (2D, transposed) are marked, so the Convert inserted after them can be fused into the FullyConnected node.
+ */
+class MarkCompressedWeights : public ngraph::pass::MatcherPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    explicit MarkCompressedWeights(const std::vector<ngraph::element::Type>& precisions);
+};
+
+}  // namespace MKLDNNPlugin
@@ -5,6 +5,7 @@
 #include "fully_connected.hpp"
 
 constexpr ngraph::NodeTypeInfo MKLDNNPlugin::FullyConnectedNode::type_info;
+constexpr size_t MKLDNNPlugin::FullyConnectedNode::lowBitWeightsBlock;
 
 MKLDNNPlugin::FullyConnectedNode::FullyConnectedNode(const ngraph::Output<Node>& A,
                                                      const ngraph::Output<Node>& B,
@@ -23,12 +24,26 @@ MKLDNNPlugin::FullyConnectedNode::FullyConnectedNode(const ngraph::Output<Node>&
     constructor_validate_and_infer_types();
 }
 
+MKLDNNPlugin::FullyConnectedNode::FullyConnectedNode(const ngraph::Output<Node>& A,
+                                                     const ngraph::Output<Node>& B,
+                                                     const ngraph::Output<Node>& C,
+                                                     const ngraph::Output<Node>& scales,
+                                                     const ngraph::Output<Node>& zero_points,
+                                                     const ngraph::Shape& output_shape,
+                                                     const ngraph::element::Type output_type)
+    : Op({A, B, C, scales, zero_points}), m_output_shape(output_shape), m_output_type(output_type) {
+    constructor_validate_and_infer_types();
+}
+
 std::shared_ptr<ngraph::Node> MKLDNNPlugin::FullyConnectedNode::clone_with_new_inputs(const ngraph::OutputVector& new_args) const {
     check_new_args_count(this, new_args);
     if (new_args.size() == 2) {
         return std::make_shared<MKLDNNPlugin::FullyConnectedNode>(new_args.at(0), new_args.at(1), m_output_shape);
     } else if (new_args.size() == 3) {
         return std::make_shared<MKLDNNPlugin::FullyConnectedNode>(new_args.at(0), new_args.at(1), new_args.at(2), m_output_shape);
+    } else if (new_args.size() == 5) {
+        return std::make_shared<MKLDNNPlugin::FullyConnectedNode>(new_args.at(0), new_args.at(1), new_args.at(2), new_args.at(3), new_args.at(4),
+                                                                  m_output_shape);
     }
 
     throw ngraph::ngraph_error("Unsupported number of arguments for FullyConnected operation");
@@ -28,6 +28,22 @@ public:
                        const ngraph::Shape &output_shape,
                        const ngraph::element::Type output_type = ngraph::element::undefined);
 
+    /**
+     * FullyConnected with the 4-bit weights which are decompressed as (weights - zero_points) * scales per group of
+     * the input channels. B holds the unsigned 4-bit weights [OC, IC] packed by blocks of lowBitWeightsBlock input
+     * channels: the byte j of a block holds the channel j in the low nibble and the channel j + lowBitWeightsBlock / 2
+     * in the high one. Scales are FP32 and zero points are U8 [OC, groups] tensors.
+     */
+    FullyConnectedNode(const ngraph::Output<Node> &A,
+                       const ngraph::Output<Node> &B,
+                       const ngraph::Output<Node> &C,
+                       const ngraph::Output<Node> &scales,
+                       const ngraph::Output<Node> &zero_points,
+                       const ngraph::Shape &output_shape,
+                       const ngraph::element::Type output_type = ngraph::element::undefined);
+
+    static constexpr size_t lowBitWeightsBlock = 32;
+
     bool visit_attributes(ngraph::AttributeVisitor &visitor) override;
 
     void validate_and_infer_types() override;
@@ -5,6 +5,7 @@
 #include "cpu_convert.h"
 #include "cpu_memcpy.h"
 #include "utils/bfloat16.hpp"
+#include <ngraph/type/float16.hpp>
 #include <mkldnn_selective_build.h>
 #include <type_traits>
 #include <tuple>
@@ -17,7 +18,7 @@ namespace {
 template<typename srcType, typename dstType>
 void convert(const void *srcPtr, void *dstPtr, const size_t size) {
     if (std::is_same<srcType, dstType>::value) {
-        cpu_memcpy(dstPtr, srcPtr, size*sizeof(dstType));
+        cpu_parallel_memcpy(dstPtr, srcPtr, size*sizeof(dstType));
     } else {
         const srcType *srcData = reinterpret_cast<const srcType *>(srcPtr);
         dstType *dstData = reinterpret_cast<dstType *>(dstPtr);
@@ -38,6 +39,11 @@ struct PrecisionInfo<Precision::BF16> {
     using value_type = MKLDNNPlugin::bfloat16_t;
 };
 
+template <>
+struct PrecisionInfo<Precision::FP16> {
+    using value_type = ngraph::float16;
+};
+
 struct ConvertContext {
     const void *srcPtr;
     void *dstPtr;
@@ -67,7 +73,7 @@ void cpu_convert(const void *srcPtr, void *dstPtr, Precision srcPrc, Precision d
         IE_THROW() << "cpu_convert has null data pointer";
 
     if (srcPrc == dstPrc) {
-        cpu_memcpy(dstPtr, srcPtr, size*dstPrc.size());
+        cpu_parallel_memcpy(dstPtr, srcPtr, size*dstPrc.size());
         return;
     }
 
@@ -103,7 +109,8 @@ void cpu_convert(const void *srcPtr, void *dstPtr, Precision srcPrc, Precision d
     MKLDNN_CVT(BF16, I64), MKLDNN_CVT(BF16, FP32), MKLDNN_CVT(BF16, BOOL),
     MKLDNN_CVT(BOOL, U8),  MKLDNN_CVT(BOOL, I8),   MKLDNN_CVT(BOOL, U16),
     MKLDNN_CVT(BOOL, I16), MKLDNN_CVT(BOOL, I32),  MKLDNN_CVT(BOOL, U64),
-    MKLDNN_CVT(BOOL, I64), MKLDNN_CVT(BOOL, FP32), MKLDNN_CVT(BOOL, BF16));
+    MKLDNN_CVT(BOOL, I64), MKLDNN_CVT(BOOL, FP32), MKLDNN_CVT(BOOL, BF16),
+    MKLDNN_CVT(FP16, FP32), MKLDNN_CVT(FP32, FP16));
 
     if (!ctx.converted)
         IE_THROW() << "cpu_convert can't convert from: " << srcPrc << " precision to: " << dstPrc;
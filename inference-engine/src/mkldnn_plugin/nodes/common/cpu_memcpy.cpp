@@ -0,0 +1,100 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cpu_memcpy.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+
+#include <ie_parallel.hpp>
+#include "mkldnn/ie_mkldnn.h"
+#include "utils/general_utils.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define CPU_MEMCPY_HAS_STREAM_STORES
+#endif
+
+using namespace MKLDNNPlugin;
+
+namespace {
+
+// Smaller copies are not worth waking up the stream threads
+constexpr size_t parallelCopyThreshold = 256 * 1024;
+constexpr size_t minChunkSize = 64 * 1024;
+// Chunks start at cache line boundary to avoid false sharing between threads
+constexpr size_t chunkAlignment = 64;
+
+size_t nonTemporalCopyThreshold() {
+    static const size_t threshold = [] {
+        int llcSize = mkldnn::utils::get_cache_size(3, false);
+        if (llcSize <= 0)
+            llcSize = mkldnn::utils::get_cache_size(2, false);
+        return llcSize > 0 ? static_cast<size_t>(llcSize) : std::numeric_limits<size_t>::max();
+    }();
+    return threshold;
+}
+
+/**
+ * Copies the buffer bypassing the caches, so the data which doesn't fit LLC anyway
+ * doesn't evict the working set of the graph
+ */
+void stream_memcpy(uint8_t* dst, const uint8_t* src, size_t count) {
+#ifdef CPU_MEMCPY_HAS_STREAM_STORES
+    constexpr size_t vecSize = sizeof(__m128i);
+    constexpr size_t blockSize = 4 * vecSize;
+
+    const size_t head = std::min((vecSize - reinterpret_cast<uintptr_t>(dst) % vecSize) % vecSize, count);
+    cpu_memcpy(dst, src, head);
+    dst += head;
+    src += head;
+    count -= head;
+
+    const size_t body = count / blockSize * blockSize;
+    for (size_t i = 0; i < body; i += blockSize) {
+        const auto v0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        const auto v1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i + vecSize));
+        const auto v2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i + 2 * vecSize));
+        const auto v3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i + 3 * vecSize));
+        _mm_stream_si128(reinterpret_cast<__m128i*>(dst + i), v0);
+        _mm_stream_si128(reinterpret_cast<__m128i*>(dst + i + vecSize), v1);
+        _mm_stream_si128(reinterpret_cast<__m128i*>(dst + i + 2 * vecSize), v2);
+        _mm_stream_si128(reinterpret_cast<__m128i*>(dst + i + 3 * vecSize), v3);
+    }
+    // Non-temporal stores are weakly ordered, make them visible before the thread reports completion
+    _mm_sfence();
+
+    cpu_memcpy(dst + body, src + body, count - body);
+#else
+    cpu_memcpy(dst, src, count);
+#endif
+}
+
+}  // namespace
+
+void cpu_parallel_memcpy(void* dst, const void* src, size_t count) {
+    const size_t chunks = std::min<size_t>(parallel_get_max_threads(), count / minChunkSize);
+    if (count < parallelCopyThreshold || chunks < 2) {
+        cpu_memcpy(dst, src, count);
+        return;
+    }
+
+    const bool nonTemporal = count > nonTemporalCopyThreshold();
+    const size_t chunkSize = rnd_up(div_up(count, chunks), chunkAlignment);
+    auto dstPtr = static_cast<uint8_t*>(dst);
+    auto srcPtr = static_cast<const uint8_t*>(src);
+
+    parallel_for(chunks, [&](size_t chunk) {
+        const size_t offset = chunk * chunkSize;
+        if (offset >= count)
+            return;
+        const size_t size = std::min(chunkSize, count - offset);
+        if (nonTemporal) {
+            stream_memcpy(dstPtr + offset, srcPtr + offset, size);
+        } else {
+            cpu_memcpy(dstPtr + offset, srcPtr + offset, size);
+        }
+    });
+}
@@ -47,3 +47,16 @@ inline int cpu_memcpy_s(void* dst, size_t dst_size, const void* src, size_t coun
 #endif
     return 0;
 }
+
+/**
+ * @brief Copies bytes between buffers using all threads of the current stream
+ * Large buffers are split into chunks copied in parallel. If the buffer doesn't fit
+ * last level cache, non-temporal stores are used to keep the cache for the graph data.
+ * @param dst
+ * pointer to the object to copy to
+ * @param src
+ * pointer to the object to copy from
+ * @param count
+ * number of bytes to copy
+ */
+void cpu_parallel_memcpy(void* dst, const void* src, size_t count);
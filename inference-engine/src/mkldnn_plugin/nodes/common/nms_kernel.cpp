@@ -0,0 +1,305 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "nms_kernel.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <algorithm>
+#include <vector>
+#if defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+#include <immintrin.h>
+#endif
+#include "ie_parallel.hpp"
+
+namespace InferenceEngine {
+namespace Extensions {
+namespace Cpu {
+namespace XARCH {
+
+namespace {
+
+// Suppression is tracked with one bit per box, 16 boxes per group
+constexpr int group_size = 16;
+// The selection is resolved serially within a block, then the boxes selected in the block suppress the rest ones
+constexpr int block_size = 32 * group_size;
+constexpr int radix_sort_min_size = 256;
+// minimal number of IoU computations to split the suppression among threads
+constexpr size_t parallel_work_threshold = 64 * 1024;
+
+inline uint32_t descending_key(float score) {
+    uint32_t bits;
+    std::memcpy(&bits, &score, sizeof(bits));
+    if (score == 0.f)
+        bits = 0;  // -0 is equal to +0
+    // flipping the sign bit of positive floats and all bits of negative ones gives the ascending order of unsigned values
+    bits = (bits & 0x80000000u) ? ~bits : (bits | 0x80000000u);
+    return ~bits;
+}
+
+// Sorts the indices by decreasing scores, equal scores keep the ascending order of indices
+void sort_by_scores(const float* scores, std::vector<int>& indices) {
+    const size_t size = indices.size();
+    if (size < radix_sort_min_size) {
+        std::sort(indices.begin(), indices.end(), [scores](int l, int r) {
+            return scores[l] > scores[r] || (scores[l] == scores[r] && l < r);
+        });
+        return;
+    }
+
+    // LSD radix sort by the key in the upper half, the stability keeps the ascending indices in the lower half
+    std::vector<uint64_t> keys(size), sorted(size);
+    for (size_t i = 0; i < size; i++)
+        keys[i] = (static_cast<uint64_t>(descending_key(scores[indices[i]])) << 32) | static_cast<uint32_t>(indices[i]);
+
+    for (int shift = 32; shift < 64; shift += 8) {
+        size_t offsets[256] = {};
+        for (size_t i = 0; i < size; i++)
+            offsets[(keys[i] >> shift) & 0xFF]++;
+        if (offsets[(keys[0] >> shift) & 0xFF] == size)
+            continue;  // the digit is the same for all keys
+
+        size_t sum = 0;
+        for (auto& offset : offsets) {
+            size_t count = offset;
+            offset = sum;
+            sum += count;
+        }
+        for (size_t i = 0; i < size; i++)
+            sorted[offsets[(keys[i] >> shift) & 0xFF]++] = keys[i];
+        keys.swap(sorted);
+    }
+
+    for (size_t i = 0; i < size; i++)
+        indices[i] = static_cast<int>(keys[i] & 0xFFFFFFFF);
+}
+
+std::vector<int> filter_by_score(const float* scores, int num_boxes, float threshold) {
+    std::vector<int> indices;
+    indices.reserve(num_boxes);
+    int i = 0;
+#if defined(HAVE_AVX512F)
+    const __m512 vthreshold = _mm512_set1_ps(threshold);
+    for (; i <= num_boxes - group_size; i += group_size) {
+        uint32_t mask = _mm512_cmp_ps_mask(_mm512_loadu_ps(scores + i), vthreshold, _CMP_GT_OQ);
+        for (int k = 0; mask != 0; k++, mask >>= 1) {
+            if (mask & 1)
+                indices.push_back(i + k);
+        }
+    }
+#elif defined(HAVE_AVX2)
+    const __m256 vthreshold = _mm256_set1_ps(threshold);
+    for (; i <= num_boxes - 8; i += 8) {
+        uint32_t mask = _mm256_movemask_ps(_mm256_cmp_ps(_mm256_loadu_ps(scores + i), vthreshold, _CMP_GT_OQ));
+        for (int k = 0; mask != 0; k++, mask >>= 1) {
+            if (mask & 1)
+                indices.push_back(i + k);
+        }
+    }
+#endif
+    for (; i < num_boxes; i++) {
+        if (scores[i] > threshold)
+            indices.push_back(i);
+    }
+    return indices;
+}
+
+// Sorted boxes as separate arrays padded to the whole number of groups
+struct sorted_boxes {
+    std::vector<float> a0, b0, a1, b1, area;
+
+    sorted_boxes(const float* boxes, const std::vector<int>& order, float offset) {
+        const size_t padded = (order.size() + group_size - 1) / group_size * group_size;
+        for (auto vec : {&a0, &b0, &a1, &b1, &area})
+            vec->resize(padded, 0.f);
+        for (size_t i = 0; i < order.size(); i++) {
+            const float* box = boxes + 4 * order[i];
+            a0[i] = box[0];
+            b0[i] = box[1];
+            a1[i] = box[2];
+            b1[i] = box[3];
+            area[i] = (a1[i] - a0[i] + offset) * (b1[i] - b0[i] + offset);
+        }
+    }
+};
+
+#if defined(HAVE_AVX512F)
+template <int predicate>
+void suppress_groups(const sorted_boxes& s, int i, int first_group, int last_group, uint16_t* suppressed, const nms_conf& conf) {
+    const __m512 a0i = _mm512_set1_ps(s.a0[i]);
+    const __m512 b0i = _mm512_set1_ps(s.b0[i]);
+    const __m512 a1i = _mm512_set1_ps(s.a1[i]);
+    const __m512 b1i = _mm512_set1_ps(s.b1[i]);
+    const __m512 areai = _mm512_set1_ps(s.area[i]);
+    const __m512 offset = _mm512_set1_ps(conf.coordinates_offset);
+    const __m512 threshold = _mm512_set1_ps(conf.iou_threshold);
+    const __m512 zero = _mm512_setzero_ps();
+
+    for (int g = first_group; g < last_group; g++) {
+        if (suppressed[g] == 0xFFFF)
+            continue;
+        const int j = g * group_size;
+        const __m512 a0j = _mm512_loadu_ps(&s.a0[j]);
+        const __m512 b0j = _mm512_loadu_ps(&s.b0[j]);
+        const __m512 a1j = _mm512_loadu_ps(&s.a1[j]);
+        const __m512 b1j = _mm512_loadu_ps(&s.b1[j]);
+
+        __mmask16 mask = _mm512_cmp_ps_mask(a0j, a1i, _CMP_LE_OQ);
+        mask = _mm512_mask_cmp_ps_mask(mask, a1j, a0i, _CMP_GE_OQ);
+        mask = _mm512_mask_cmp_ps_mask(mask, b0j, b1i, _CMP_LE_OQ);
+        mask = _mm512_mask_cmp_ps_mask(mask, b1j, b0i, _CMP_GE_OQ);
+        const __m512 width_a = _mm512_add_ps(_mm512_sub_ps(_mm512_min_ps(a1i, a1j), _mm512_max_ps(a0i, a0j)), offset);
+        const __m512 width_b = _mm512_add_ps(_mm512_sub_ps(_mm512_min_ps(b1i, b1j), _mm512_max_ps(b0i, b0j)), offset);
+        mask = _mm512_mask_cmp_ps_mask(mask, width_a, zero, _CMP_GT_OQ);
+        mask = _mm512_mask_cmp_ps_mask(mask, width_b, zero, _CMP_GT_OQ);
+        if (mask == 0)
+            continue;
+
+        const __m512 intersection = _mm512_mul_ps(width_a, width_b);
+        const __m512 iou = _mm512_div_ps(intersection,
+                                         _mm512_sub_ps(_mm512_add_ps(areai, _mm512_loadu_ps(&s.area[j])), intersection));
+        suppressed[g] |= _mm512_mask_cmp_ps_mask(mask, iou, threshold, predicate);
+    }
+}
+#elif defined(HAVE_AVX2)
+template <int predicate>
+void suppress_groups(const sorted_boxes& s, int i, int first_group, int last_group, uint16_t* suppressed, const nms_conf& conf) {
+    const __m256 a0i = _mm256_set1_ps(s.a0[i]);
+    const __m256 b0i = _mm256_set1_ps(s.b0[i]);
+    const __m256 a1i = _mm256_set1_ps(s.a1[i]);
+    const __m256 b1i = _mm256_set1_ps(s.b1[i]);
+    const __m256 areai = _mm256_set1_ps(s.area[i]);
+    const __m256 offset = _mm256_set1_ps(conf.coordinates_offset);
+    const __m256 threshold = _mm256_set1_ps(conf.iou_threshold);
+    const __m256 zero = _mm256_setzero_ps();
+
+    for (int g = first_group; g < last_group; g++) {
+        if (suppressed[g] == 0xFFFF)
+            continue;
+        for (int half = 0; half < 2; half++) {
+            const int j = g * group_size + half * 8;
+            const __m256 a0j = _mm256_loadu_ps(&s.a0[j]);
+            const __m256 b0j = _mm256_loadu_ps(&s.b0[j]);
+            const __m256 a1j = _mm256_loadu_ps(&s.a1[j]);
+            const __m256 b1j = _mm256_loadu_ps(&s.b1[j]);
+
+            __m256 mask = _mm256_and_ps(_mm256_cmp_ps(a0j, a1i, _CMP_LE_OQ), _mm256_cmp_ps(a1j, a0i, _CMP_GE_OQ));
+            mask = _mm256_and_ps(mask, _mm256_and_ps(_mm256_cmp_ps(b0j, b1i, _CMP_LE_OQ), _mm256_cmp_ps(b1j, b0i, _CMP_GE_OQ)));
+            const __m256 width_a = _mm256_add_ps(_mm256_sub_ps(_mm256_min_ps(a1i, a1j), _mm256_max_ps(a0i, a0j)), offset);
+            const __m256 width_b = _mm256_add_ps(_mm256_sub_ps(_mm256_min_ps(b1i, b1j), _mm256_max_ps(b0i, b0j)), offset);
+            mask = _mm256_and_ps(mask, _mm256_and_ps(_mm256_cmp_ps(width_a, zero, _CMP_GT_OQ), _mm256_cmp_ps(width_b, zero, _CMP_GT_OQ)));
+            if (_mm256_movemask_ps(mask) == 0)
+                continue;
+
+            const __m256 intersection = _mm256_mul_ps(width_a, width_b);
+            const __m256 iou = _mm256_div_ps(intersection,
+                                             _mm256_sub_ps(_mm256_add_ps(areai, _mm256_loadu_ps(&s.area[j])), intersection));
+            mask = _mm256_and_ps(mask, _mm256_cmp_ps(iou, threshold, predicate));
+            suppressed[g] |= static_cast<uint16_t>(_mm256_movemask_ps(mask) << (half * 8));
+        }
+    }
+}
+#else
+template <int predicate>
+void suppress_groups(const sorted_boxes& s, int i, int first_group, int last_group, uint16_t* suppressed, const nms_conf& conf) {
+    const float offset = conf.coordinates_offset;
+    for (int g = first_group; g < last_group; g++) {
+        if (suppressed[g] == 0xFFFF)
+            continue;
+        // branchless to let the compiler vectorize the loop
+        uint32_t mask = 0;
+        for (int k = 0; k < group_size; k++) {
+            const int j = g * group_size + k;
+            const float width_a = (std::min)(s.a1[i], s.a1[j]) - (std::max)(s.a0[i], s.a0[j]) + offset;
+            const float width_b = (std::min)(s.b1[i], s.b1[j]) - (std::max)(s.b0[i], s.b0[j]) + offset;
+            const float intersection = width_a * width_b;
+            const float iou = intersection / (s.area[i] + s.area[j] - intersection);
+            const bool overlapped = (s.a0[j] <= s.a1[i]) & (s.a1[j] >= s.a0[i]) & (s.b0[j] <= s.b1[i]) & (s.b1[j] >= s.b0[i]) &
+                                    (width_a > 0.f) & (width_b > 0.f);
+            const bool above = predicate ? iou >= conf.iou_threshold : iou > conf.iou_threshold;
+            mask |= static_cast<uint32_t>(overlapped & above) << k;
+        }
+        suppressed[g] |= static_cast<uint16_t>(mask);
+    }
+}
+#endif
+
+#if defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+constexpr int suppress_equal_predicate = _CMP_GE_OQ;
+constexpr int suppress_greater_predicate = _CMP_GT_OQ;
+#else
+constexpr int suppress_equal_predicate = 1;
+constexpr int suppress_greater_predicate = 0;
+#endif
+
+// Marks the boxes of the groups [first_group, last_group) suppressed by the box i. The bits of the boxes preceding
+// the box i in its group may be set too, they are already processed and aren't checked anymore.
+inline void suppress(const sorted_boxes& s, int i, int first_group, int last_group, uint16_t* suppressed, const nms_conf& conf) {
+    if (conf.suppress_equal_iou)
+        suppress_groups<suppress_equal_predicate>(s, i, first_group, last_group, suppressed, conf);
+    else
+        suppress_groups<suppress_greater_predicate>(s, i, first_group, last_group, suppressed, conf);
+}
+
+}  // namespace
+
+int nms_exec(const float* scores, const float* boxes, int num_boxes, const nms_conf& conf, int* selected) {
+    std::vector<int> order = filter_by_score(scores, num_boxes, conf.score_threshold);
+    sort_by_scores(scores, order);
+    if (conf.pre_nms_topn >= 0 && static_cast<int>(order.size()) > conf.pre_nms_topn)
+        order.resize(conf.pre_nms_topn);
+
+    const int size = static_cast<int>(order.size());
+    const int limit = conf.post_nms_topn >= 0 ? (std::min)(size, conf.post_nms_topn) : size;
+    // IoU of disjoint boxes is 0, so any box suppresses all the rest ones if 0 passes the threshold
+    const bool suppress_all = conf.suppress_equal_iou ? conf.iou_threshold <= 0.f : conf.iou_threshold < 0.f;
+    if (suppress_all || limit == 0) {
+        if (limit > 0)
+            selected[0] = order[0];
+        return (std::min)(limit, 1);
+    }
+
+    const int groups = (size + group_size - 1) / group_size;
+    const sorted_boxes sorted(boxes, order, conf.coordinates_offset);
+    std::vector<uint16_t> suppressed(groups, 0);
+
+    int count = 0;
+    for (int block_begin = 0; block_begin < size && count < limit; block_begin += block_size) {
+        const int block_end = (std::min)(size, block_begin + block_size);
+        const int block_selected_begin = count;
+        for (int i = block_begin; i < block_end && count < limit; i++) {
+            if (suppressed[i / group_size] & (1u << (i % group_size)))
+                continue;
+            selected[count++] = i;
+            suppress(sorted, i, i / group_size, (block_end + group_size - 1) / group_size, suppressed.data(), conf);
+        }
+
+        const int rest_begin = block_end / group_size;
+        if (count == limit || rest_begin >= groups)
+            break;
+        auto suppress_rest = [&](int first_group, int last_group) {
+            for (int k = block_selected_begin; k < count; k++)
+                suppress(sorted, selected[k], first_group, last_group, suppressed.data(), conf);
+        };
+        const size_t work = static_cast<size_t>(count - block_selected_begin) * (size - block_end);
+        if (conf.parallel && work >= parallel_work_threshold) {
+            parallel_nt(0, [&](const int ithr, const int nthr) {
+                int start = 0, end = 0;
+                splitter(groups - rest_begin, nthr, ithr, start, end);
+                suppress_rest(rest_begin + start, rest_begin + end);
+            });
+        } else {
+            suppress_rest(rest_begin, groups);
+        }
+    }
+
+    for (int k = 0; k < count; k++)
+        selected[k] = order[selected[k]];
+    return count;
+}
+
+}  // namespace XARCH
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace InferenceEngine
@@ -0,0 +1,38 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+namespace InferenceEngine {
+namespace Extensions {
+namespace Cpu {
+
+/**
+ * @brief Parameters of the greedy hard non-maximum suppression shared by NonMaxSuppression, DetectionOutput and
+ * ExperimentalDetectronDetectionOutput nodes.
+ */
+struct nms_conf {
+    float score_threshold;     // boxes with scores not greater than the threshold are skipped
+    int pre_nms_topn;          // number of the best scored boxes to process, -1 to process all of them
+    int post_nms_topn;         // maximum number of the selected boxes, -1 for no limit
+    float iou_threshold;
+    bool suppress_equal_iou;   // suppress boxes with IoU equal to the threshold (NonMaxSuppression) or keep them (Caffe)
+    float coordinates_offset;  // 1 for the boxes in pixels with inclusive maximum coordinates, 0 otherwise
+    bool parallel;             // split suppression of a large number of boxes among threads
+};
+
+namespace XARCH {
+
+/**
+ * Boxes are given in the corner format with 4 coordinates per box: the minimums along both axes followed by
+ * the maximums, e.g. (y0, x0, y1, x1) or (x0, y0, x1, y1). Boxes with equal scores are ordered by their indices.
+ * The indices of the selected boxes are written in the order of decreasing scores,
+ * so selected has to fit num_boxes or conf.post_nms_topn elements. Returns the number of the selected boxes.
+ */
+int nms_exec(const float* scores, const float* boxes, int num_boxes, const nms_conf& conf, int* selected);
+
+}  // namespace XARCH
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace InferenceEngine
@@ -494,7 +494,10 @@ void MKLDNNConcatNode::execNspcSpecCase() {
         channels_size += num_channels * dataSize;
     }
 
-    const size_t iter_count = getParentEdgeAt(0)->getMemory().GetSize() / channelsDataSize[0];
+    size_t iter_count = getParentEdgeAt(0)->getMemory().GetSize() / channelsDataSize[0];
+    // the batch is the outermost dimension of the nspc layout, so the items beyond the processed batch are skipped
+    if (batchToProcess() < getMaxBatch())
+        iter_count = iter_count / getMaxBatch() * batchToProcess();
 
     parallel_for(iter_count, [&](int i) {
         const size_t dst_off = i * channels_size;
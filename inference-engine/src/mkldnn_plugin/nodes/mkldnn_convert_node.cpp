@@ -87,6 +87,8 @@ void MKLDNNConvertNode::initSupportedPrimitiveDescriptors() {
 
         config.inConfs.push_back(dataIn);
         config.outConfs.push_back(dataConfigOut);
+        // the batch is the outermost dimension of the common layouts
+        config.dynBatchSupport = insDims.size() > 1;
 
         auto creators = TensorDescCreator::getCommonCreators();
         auto range = TensorDescCreator::makeFilteredRange(creators, insDims.size());
@@ -121,7 +123,11 @@ void MKLDNNConvertNode::execute(mkldnn::stream strm) {
 
     void* srcPtr = parentMem.GetPtr();
     void* dstPtr = childMem.GetPtr();
-    cpu_convert(srcPtr, dstPtr, getParentEdgeAt(0)->getDesc().getPrecision(), getChildEdgeAt(0)->getDesc().getPrecision(), parentMem.GetElementsCount());
+    // the batch is the outermost dimension, so only the first items of the dynamic batch are converted
+    size_t elementsCount = parentMem.GetElementsCount();
+    if (batchToProcess() < getMaxBatch())
+        elementsCount = elementsCount / getMaxBatch() * batchToProcess();
+    cpu_convert(srcPtr, dstPtr, getParentEdgeAt(0)->getDesc().getPrecision(), getChildEdgeAt(0)->getDesc().getPrecision(), elementsCount);
 }
 
 bool MKLDNNConvertNode::created() const {
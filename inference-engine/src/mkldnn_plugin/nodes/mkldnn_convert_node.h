@@ -25,6 +25,10 @@ public:
     bool canBeInPlace() const override {
         return false;
     }
+    // the node is also inserted into the graph without the factory, so the copy is made here
+    MKLDNNNodePtr clone() const override {
+        return std::make_shared<MKLDNNConvertNode>(*this);
+    }
 
     // This is the interface extension designed to provide inp and output tensor descriptors without the CNNLayer.
     // In that case the Convert node is instantiated with default CNNLayer and inp/out tensor descriptors are set via this method.
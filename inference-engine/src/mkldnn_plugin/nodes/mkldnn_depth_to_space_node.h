@@ -33,7 +33,7 @@ private:
     size_t blockSize;
     size_t blockStep;
 
-    std::unique_ptr<PermuteKernel> permuteKernel;
+    std::shared_ptr<PermuteKernel> permuteKernel;
 };
 
 }  // namespace MKLDNNPlugin
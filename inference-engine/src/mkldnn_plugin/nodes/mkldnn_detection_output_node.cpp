@@ -9,6 +9,7 @@
 #include <ngraph/op/detection_output.hpp>
 #include "ie_parallel.hpp"
 #include "mkldnn_detection_output_node.h"
+#include "common/nms_kernel.hpp"
 
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
@@ -214,21 +215,17 @@ void MKLDNNDetectionOutputNode::execute(mkldnn::stream strm) {
             parallel_for(_num_classes, [&](int c) {
                 if (c != _background_label_id) {  // Ignore background class
                     int *pindices    = indices_data + n*_num_classes*_num_priors + c*_num_priors;
-                    int *pbuffer     = buffer_data + c*_num_priors;
                     int *pdetections = detections_data + n*_num_classes + c;
 
                     const float *pconf = reordered_conf_data + n*_num_classes*_num_priors + c*_num_priors;
                     const float *pboxes;
-                    const float *psizes;
                     if (_share_location) {
                         pboxes = decoded_bboxes_data + n*4*_num_priors;
-                        psizes = bbox_sizes_data + n*_num_priors;
                     } else {
                         pboxes = decoded_bboxes_data + n*4*_num_classes*_num_priors + c*4*_num_priors;
-                        psizes = bbox_sizes_data + n*_num_classes*_num_priors + c*_num_priors;
                     }
 
-                    nms_cf(pconf, pboxes, psizes, pbuffer, pindices, *pdetections, num_priors_actual[n]);
+                    nms_cf(pconf, pboxes, pindices, *pdetections, num_priors_actual[n]);
                 }
             });
         } else {
@@ -498,42 +495,19 @@ void MKLDNNDetectionOutputNode::decodeBBoxes(const float *prior_data,
 
 void MKLDNNDetectionOutputNode::nms_cf(const float* conf_data,
                                  const float* bboxes,
-                                 const float* sizes,
-                                 int* buffer,
                                  int* indices,
                                  int& detections,
                                  int num_priors_actual) {
-    int count = 0;
-    for (int i = 0; i < num_priors_actual; ++i) {
-        if (conf_data[i] > _confidence_threshold) {
-            indices[count] = i;
-            count++;
-        }
-    }
-
-    int num_output_scores = (_top_k == -1 ? count : (std::min)(_top_k, count));
-
-    std::partial_sort_copy(indices, indices + count,
-                           buffer, buffer + num_output_scores,
-                           ConfidenceComparator(conf_data));
-
-    for (int i = 0; i < num_output_scores; ++i) {
-        const int idx = buffer[i];
-
-        bool keep = true;
-        for (int k = 0; k < detections; ++k) {
-            const int kept_idx = indices[k];
-            float overlap = JaccardOverlap(bboxes, sizes, idx, kept_idx);
-            if (overlap > _nms_threshold) {
-                keep = false;
-                break;
-            }
-        }
-        if (keep) {
-            indices[detections] = idx;
-            detections++;
-        }
-    }
+    Extensions::Cpu::nms_conf conf;
+    conf.score_threshold = _confidence_threshold;
+    conf.pre_nms_topn = _top_k;
+    conf.post_nms_topn = -1;
+    conf.iou_threshold = _nms_threshold;
+    conf.suppress_equal_iou = false;
+    conf.coordinates_offset = 0.f;
+    conf.parallel = _num_classes < parallel_get_max_threads();
+
+    detections = Extensions::Cpu::XARCH::nms_exec(conf_data, bboxes, num_priors_actual, conf, indices);
 }
 
 void MKLDNNDetectionOutputNode::nms_mx(const float* conf_data,
@@ -9,6 +9,7 @@
 #include <ngraph/op/experimental_detectron_detection_output.hpp>
 #include "ie_parallel.hpp"
 #include "mkldnn_experimental_detectron_detection_output_node.h"
+#include "common/nms_kernel.hpp"
 
 
 struct Indexer {
@@ -40,7 +41,7 @@ using namespace InferenceEngine;
 
 static
 void refine_boxes(const float* boxes, const float* deltas, const float* weights, const float* scores,
-                  float* refined_boxes, float* refined_boxes_areas, float* refined_scores,
+                  float* refined_boxes, float* refined_scores,
                   const int rois_num, const int classes_num,
                   const float img_H, const float img_W,
                   const float max_delta_log_wh,
@@ -95,17 +96,11 @@ void refine_boxes(const float* boxes, const float* deltas, const float* weights,
             x1_new = std::max<float>(0.0f, x1_new);
             y1_new = std::max<float>(0.0f, y1_new);
 
-            // recompute new width & height
-            const float box_w = x1_new - x0_new + coordinates_offset;
-            const float box_h = y1_new - y0_new + coordinates_offset;
-
             refined_boxes[refined_box_idx({class_idx, roi_idx, 0})] = x0_new;
             refined_boxes[refined_box_idx({class_idx, roi_idx, 1})] = y0_new;
             refined_boxes[refined_box_idx({class_idx, roi_idx, 2})] = x1_new;
             refined_boxes[refined_box_idx({class_idx, roi_idx, 3})] = y1_new;
 
-            refined_boxes_areas[refined_score_idx({class_idx, roi_idx})] = box_w * box_h;
-
             refined_scores[refined_score_idx({class_idx, roi_idx})] = scores[score_idx({roi_idx, class_idx})];
         }
     }
@@ -118,104 +113,6 @@ static bool SortScorePairDescend(const std::pair<float, T>& pair1,
 }
 
 
-struct ConfidenceComparator {
-    explicit ConfidenceComparator(const float* conf_data) : _conf_data(conf_data) {}
-
-    bool operator()(int idx1, int idx2) {
-        if (_conf_data[idx1] > _conf_data[idx2]) return true;
-        if (_conf_data[idx1] < _conf_data[idx2]) return false;
-        return idx1 < idx2;
-    }
-
-    const float* _conf_data;
-};
-
-static inline float JaccardOverlap(const float *decoded_bbox,
-                                   const float *bbox_sizes,
-                                   const int idx1,
-                                   const int idx2,
-                                   const float coordinates_offset = 1) {
-    float xmin1 = decoded_bbox[idx1 * 4 + 0];
-    float ymin1 = decoded_bbox[idx1 * 4 + 1];
-    float xmax1 = decoded_bbox[idx1 * 4 + 2];
-    float ymax1 = decoded_bbox[idx1 * 4 + 3];
-
-    float xmin2 = decoded_bbox[idx2 * 4 + 0];
-    float ymin2 = decoded_bbox[idx2 * 4 + 1];
-    float ymax2 = decoded_bbox[idx2 * 4 + 3];
-    float xmax2 = decoded_bbox[idx2 * 4 + 2];
-
-    if (xmin2 > xmax1 || xmax2 < xmin1 || ymin2 > ymax1 || ymax2 < ymin1) {
-        return 0.0f;
-    }
-
-    float intersect_xmin = (std::max)(xmin1, xmin2);
-    float intersect_ymin = (std::max)(ymin1, ymin2);
-    float intersect_xmax = (std::min)(xmax1, xmax2);
-    float intersect_ymax = (std::min)(ymax1, ymax2);
-
-    float intersect_width  = intersect_xmax - intersect_xmin + coordinates_offset;
-    float intersect_height = intersect_ymax - intersect_ymin + coordinates_offset;
-
-    if (intersect_width <= 0 || intersect_height <= 0) {
-        return 0.0f;
-    }
-
-    float intersect_size = intersect_width * intersect_height;
-    float bbox1_size = bbox_sizes[idx1];
-    float bbox2_size = bbox_sizes[idx2];
-
-    return intersect_size / (bbox1_size + bbox2_size - intersect_size);
-}
-
-
-static void nms_cf(const float* conf_data,
-                   const float* bboxes,
-                   const float* sizes,
-                   int* buffer,
-                   int* indices,
-                   int& detections,
-                   const int boxes_num,
-                   const int pre_nms_topn,
-                   const int post_nms_topn,
-                   const float confidence_threshold,
-                   const float nms_threshold) {
-    int count = 0;
-    for (int i = 0; i < boxes_num; ++i) {
-        if (conf_data[i] > confidence_threshold) {
-            indices[count] = i;
-            count++;
-        }
-    }
-
-    int num_output_scores = (pre_nms_topn == -1 ? count : (std::min)(pre_nms_topn, count));
-
-    std::partial_sort_copy(indices, indices + count,
-                           buffer, buffer + num_output_scores,
-                           ConfidenceComparator(conf_data));
-
-    detections = 0;
-    for (int i = 0; i < num_output_scores; ++i) {
-        const int idx = buffer[i];
-
-        bool keep = true;
-        for (int k = 0; k < detections; ++k) {
-            const int kept_idx = indices[k];
-            float overlap = JaccardOverlap(bboxes, sizes, idx, kept_idx);
-            if (overlap > nms_threshold) {
-                keep = false;
-                break;
-            }
-        }
-        if (keep) {
-            indices[detections] = idx;
-            detections++;
-        }
-    }
-
-    detections = (post_nms_topn == -1 ? detections : (std::min)(post_nms_topn, detections));
-}
-
 bool MKLDNNExperimentalDetectronDetectionOutputNode::isSupportedOperation(const std::shared_ptr<ngraph::Node>& op, std::string& errorMessage) noexcept {
     try {
         const auto doOp = ngraph::as_type_ptr<const ngraph::op::v6::ExperimentalDetectronDetectionOutput>(op);
@@ -285,35 +182,36 @@ void MKLDNNExperimentalDetectronDetectionOutputNode::execute(mkldnn::stream strm
     // Apply deltas.
     std::vector<float> refined_boxes(classes_num_ * rois_num * 4, 0);
     std::vector<float> refined_scores(classes_num_ * rois_num, 0);
-    std::vector<float> refined_boxes_areas(classes_num_ * rois_num, 0);
     Indexer refined_box_idx({classes_num_, rois_num, 4});
     Indexer refined_score_idx({classes_num_, rois_num});
 
     refine_boxes(boxes, deltas, &deltas_weights_[0], scores,
-                 &refined_boxes[0], &refined_boxes_areas[0], &refined_scores[0],
+                 &refined_boxes[0], &refined_scores[0],
                  rois_num, classes_num_,
                  img_H, img_W,
                  max_delta_log_wh_,
                  1.0f);
 
     // Apply NMS class-wise.
-    std::vector<int> buffer(rois_num, 0);
     std::vector<int> indices(classes_num_ * rois_num, 0);
     std::vector<int> detections_per_class(classes_num_, 0);
     int total_detections_num = 0;
 
+    Extensions::Cpu::nms_conf conf;
+    conf.score_threshold = score_threshold_;
+    conf.pre_nms_topn = -1;
+    conf.post_nms_topn = max_detections_per_class_;
+    conf.iou_threshold = nms_threshold_;
+    conf.suppress_equal_iou = false;
+    conf.coordinates_offset = 1.0f;
+    conf.parallel = true;
+
     for (int class_idx = 1; class_idx < classes_num_; ++class_idx) {
-        nms_cf(&refined_scores[refined_score_idx({class_idx, 0})],
-               &refined_boxes[refined_box_idx({class_idx, 0, 0})],
-               &refined_boxes_areas[refined_score_idx({class_idx, 0})],
-               &buffer[0],
-               &indices[total_detections_num],
-               detections_per_class[class_idx],
-               rois_num,
-               -1,
-               max_detections_per_class_,
-               score_threshold_,
-               nms_threshold_);
+        detections_per_class[class_idx] = Extensions::Cpu::XARCH::nms_exec(&refined_scores[refined_score_idx({class_idx, 0})],
+                                                                           &refined_boxes[refined_box_idx({class_idx, 0, 0})],
+                                                                           rois_num,
+                                                                           conf,
+                                                                           &indices[total_detections_num]);
         total_detections_num += detections_per_class[class_idx];
     }
 
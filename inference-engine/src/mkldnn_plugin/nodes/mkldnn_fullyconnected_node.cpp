@@ -5,17 +5,740 @@
 #include "mkldnn_fullyconnected_node.h"
 #include "mkldnn_eltwise_node.h"
 #include "mkldnn_fake_quantize_node.h"
+#include "mkldnn_input_node.h"
 #include "ngraph_transformations/op/fully_connected.hpp"
 #include <ngraph/opsets/opset1.hpp>
 #include <string>
 #include <vector>
+#include <numeric>
 #include <mkldnn_extension_utils.h>
 #include <mkldnn.hpp>
+#include "ie_parallel.hpp"
 #include "utils/general_utils.h"
+#include "utils/bfloat16.hpp"
+#include "common/cpu_convert.h"
+#include "common/fp16_utils.h"
+#include "emitters/jit_load_store_emitters.hpp"
+
+#include <cpu/x64/jit_generator.hpp>
+#include <cpu/x64/jit_uni_eltwise_injector.hpp>
+#include <cpu/x64/jit_uni_depthwise_injector.hpp>
+#include <cpu/x64/jit_uni_quantization_injector.hpp>
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
+using namespace mkldnn::impl;
+using namespace mkldnn::impl::cpu::x64;
+
+#define GET_OFF(field) offsetof(jit_sparse_fc_call_args, field)
+#define GET_COMPRESSED_OFF(field) offsetof(jit_compressed_fc_call_args, field)
+
+constexpr size_t MKLDNNFullyConnectedNode::sparseOCBlock;
+
+/**
+ * Applies the fused operations of FullyConnected to a vector of the output channels for the own kernels.
+ * reg_oc_off holds the byte offset of the first output channel of the kernel call in the per-channel data.
+ */
+template <cpu_isa_t isa>
+struct jit_uni_fc_post_ops {
+    using Vmm = typename conditional3<isa == cpu::x64::sse41, Xbyak::Xmm, isa == cpu::x64::avx2,
+            Xbyak::Ymm, Xbyak::Zmm>::type;
+
+    jit_uni_fc_post_ops(jit_generator *host, const mkldnn_primitive_attr &attr, Precision dst_prc, Xbyak::Reg64 reg_oc_off,
+                        Xbyak::Reg64 reg_d_weights, Xbyak::Reg64 reg_d_bias, Vmm vmm_d_weights, Vmm vmm_d_bias)
+        : h(host), attr_(attr), dst_prc_(dst_prc), reg_oc_off_(reg_oc_off), reg_d_weights_(reg_d_weights), reg_d_bias_(reg_d_bias) {
+        const auto &p = attr_.post_ops_;
+        for (int i = 0; i < p.len(); i++) {
+            auto &post_op = p.entry_[i];
+            if (post_op.is_eltwise()) {
+                eltwise_injectors.push_back(std::make_shared<jit_uni_eltwise_injector_f32<isa>>(
+                        h, post_op.eltwise.alg, post_op.eltwise.alpha, post_op.eltwise.beta, post_op.eltwise.scale));
+            } else if (post_op.is_depthwise()) {
+                depthwise_injectors.push_back(std::make_shared<jit_uni_depthwise_injector_f32<isa>>(
+                        h, post_op.depthwise.alg));
+            } else if (post_op.is_quantization()) {
+                quantization_injectors.push_back(std::make_shared<jit_uni_quantization_injector_f32<isa>>(
+                        h, post_op, vmm_d_weights, vmm_d_bias, reg_d_weights, reg_d_bias));
+            }
+        }
+    }
+
+    void apply(const Vmm& vmm_dst, int oc_off) {
+        const auto &p = attr_.post_ops_;
+        if (p.len() == 0)
+            return;
+
+        if (oc_off != 0)
+            h->add(reg_oc_off_, oc_off);
+
+        int eltwise_inj_idx = 0;
+        int depthwise_inj_idx = 0;
+        int quantization_inj_idx = 0;
+        for (int i = 0; i < p.len(); i++) {
+            auto& post_op = p.entry_[i];
+            if (post_op.is_eltwise()) {
+                eltwise_injectors[eltwise_inj_idx]->compute_vector_range(vmm_dst.getIdx(), vmm_dst.getIdx() + 1);
+                eltwise_inj_idx++;
+            } else if (post_op.is_depthwise()) {
+                h->mov(reg_d_weights_, reinterpret_cast<size_t>(post_op.depthwise.weights_data));
+                h->mov(reg_d_bias_, reinterpret_cast<size_t>(post_op.depthwise.biases_data));
+                h->add(reg_d_weights_, reg_oc_off_);
+                h->add(reg_d_bias_, reg_oc_off_);
+                depthwise_injectors[depthwise_inj_idx]->compute_vector_range(vmm_dst.getIdx(), vmm_dst.getIdx() + 1, reg_d_weights_, reg_d_bias_, false);
+                depthwise_inj_idx++;
+            } else if (post_op.is_quantization()) {
+                bool do_dequantization = post_op.quantization.alg == alg_kind::quantization_quantize_dequantize;
+                bool do_rounding = do_dequantization || one_of(dst_prc_, Precision::FP32, Precision::BF16) || i != p.len() - 1;
+                int s_idx = vmm_dst.getIdx();
+
+                quantization_injectors[quantization_inj_idx]->init_crop_ptrs(reg_oc_off_);
+                quantization_injectors[quantization_inj_idx]->compute_crop(s_idx, s_idx + 1, 0, false, false);
+
+                quantization_injectors[quantization_inj_idx]->init_input_scale_shift_ptrs(reg_oc_off_);
+                quantization_injectors[quantization_inj_idx]->compute_input_scale_shift(s_idx, s_idx + 1, 0, do_rounding, false, false);
+
+                quantization_injectors[quantization_inj_idx]->init_output_scale_shift_ptrs(reg_oc_off_);
+                quantization_injectors[quantization_inj_idx]->compute_output_scale_shift(s_idx, s_idx + 1, 0, false, false);
+
+                quantization_inj_idx++;
+            }
+        }
+
+        if (oc_off != 0)
+            h->sub(reg_oc_off_, oc_off);
+    }
+
+    void prepare_table() {
+        for (auto& inj : eltwise_injectors)
+            inj->prepare_table();
+    }
+
+private:
+    jit_generator *h;
+    const mkldnn_primitive_attr &attr_;
+    Precision dst_prc_;
+    Xbyak::Reg64 reg_oc_off_;
+    Xbyak::Reg64 reg_d_weights_;
+    Xbyak::Reg64 reg_d_bias_;
+
+    std::vector<std::shared_ptr<jit_uni_eltwise_injector_f32<isa>>> eltwise_injectors;
+    std::vector<std::shared_ptr<jit_uni_depthwise_injector_f32<isa>>> depthwise_injectors;
+    std::vector<std::shared_ptr<jit_uni_quantization_injector_f32<isa>>> quantization_injectors;
+};
+
+/**
+ * Multiplies a block of the source rows by the non-zero blocks of weights of sparseOCBlock output channels.
+ * The accumulators of several rows are kept in registers, so each weights block is loaded once per rows block.
+ * INT8 products are accumulated in I32, FP32, BF16 and FP16 ones in FP32.
+ */
+template <cpu_isa_t isa>
+struct jit_uni_sparse_fc_kernel_f32 : public jit_uni_sparse_fc_kernel, public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_sparse_fc_kernel_f32)
+
+    explicit jit_uni_sparse_fc_kernel_f32(jit_sparse_fc_config_params jcp, const mkldnn_primitive_attr &attr)
+        : jit_uni_sparse_fc_kernel(jcp, attr), jit_generator() {}
+
+    void create_ker() override {
+        jit_generator::create_kernel();
+        ker_ = (decltype(ker_))jit_ker();
+    }
+
+    void generate() override {
+        post_ops.reset(new jit_uni_fc_post_ops<isa>(this, attr_, jcp_.dst_prc, reg_oc_off, reg_d_weights, reg_d_bias,
+                                                    vmm_d_weights, vmm_d_bias));
+
+        store_emitter.reset(new jit_store_emitter(this, isa, nullptr));
+        store_pool_gpr_idxs = {static_cast<size_t>(reg_load_store_mask.getIdx())};
+        store_pool_vec_idxs = {static_cast<size_t>(vmm_aux.getIdx())};
+
+        this->preamble();
+
+        mov(reg_src, ptr[reg_params + GET_OFF(src)]);
+        mov(reg_dst, ptr[reg_params + GET_OFF(dst)]);
+        mov(reg_bias, ptr[reg_params + GET_OFF(bias)]);
+        mov(reg_rows, ptr[reg_params + GET_OFF(rows)]);
+        mov(reg_oc_off, ptr[reg_params + GET_OFF(oc_off)]);
+
+        Xbyak::Label rows_loop_label;
+        Xbyak::Label rows_tail_loop_label;
+        Xbyak::Label rows_loop_end_label;
+
+        L(rows_loop_label);
+        {
+            cmp(reg_rows, rows_block);
+            jl(rows_tail_loop_label, T_NEAR);
+
+            compute_rows(rows_block);
+
+            add(reg_src, rows_block * static_cast<int>(jcp_.src_stride));
+            add(reg_dst, rows_block * static_cast<int>(jcp_.dst_stride));
+            sub(reg_rows, rows_block);
+
+            jmp(rows_loop_label, T_NEAR);
+        }
+        L(rows_tail_loop_label);
+        {
+            cmp(reg_rows, 0);
+            jle(rows_loop_end_label, T_NEAR);
+
+            compute_rows(1);
+
+            add(reg_src, static_cast<int>(jcp_.src_stride));
+            add(reg_dst, static_cast<int>(jcp_.dst_stride));
+            sub(reg_rows, 1);
+
+            jmp(rows_tail_loop_label, T_NEAR);
+        }
+        L(rows_loop_end_label);
+
+        this->postamble();
+
+        store_emitter->emit_data();
+        post_ops->prepare_table();
+    }
+
+private:
+    using Vmm = typename conditional3<isa == cpu::x64::sse41, Xbyak::Xmm, isa == cpu::x64::avx2,
+            Xbyak::Ymm, Xbyak::Zmm>::type;
+
+    const int vlen = cpu_isa_traits<isa>::vlen;
+    const int simd_w = vlen / sizeof(float);
+    const int vecs_per_block = static_cast<int>(MKLDNNFullyConnectedNode::sparseOCBlock) / simd_w;
+    // rows_block * vecs_per_block accumulators
+    const int rows_block = isa == cpu::x64::avx512_common ? 8 : 4;
+
+    Xbyak::Reg64 reg_src = r8;
+    Xbyak::Reg64 reg_dst = r9;
+    Xbyak::Reg64 reg_rows = r10;
+    Xbyak::Reg64 reg_ic_offsets = r11;
+    Xbyak::Reg64 reg_weights = r12;
+    Xbyak::Reg64 reg_nnz = r13;
+    Xbyak::Reg64 reg_bias = r14;
+    Xbyak::Reg64 reg_ic_off = r15;
+    Xbyak::Reg64 reg_tmp = rsi;
+    Xbyak::Reg64 reg_params = abi_param1;
+
+    Xbyak::Reg64 reg_oc_off = rax;
+    Xbyak::Reg64 reg_d_weights = rbx;
+    Xbyak::Reg64 reg_d_bias = rdx;
+
+    Xbyak::Reg64 reg_load_store_mask = rbp;
+
+    Vmm vmm_src = Vmm(10);
+    Vmm vmm_d_weights = Vmm(11);
+    Vmm vmm_d_bias = Vmm(12);
+    Vmm vmm_aux = Vmm(13);
+    Vmm vmm_prod = Vmm(14);
+
+    std::unique_ptr<jit_store_emitter> store_emitter = nullptr;
+    std::unique_ptr<jit_uni_fc_post_ops<isa>> post_ops = nullptr;
+
+    std::vector<size_t> store_pool_gpr_idxs;
+    std::vector<size_t> store_pool_vec_idxs;
+
+    inline Vmm get_acc(int row, int vec) const {
+        return Vmm(row * vecs_per_block + vec);
+    }
+
+    inline Vmm get_wei(int vec) const {
+        return Vmm(rows_block * vecs_per_block + vec);
+    }
+
+    inline bool is_int8() const {
+        return jcp_.wei_prc == Precision::I8;
+    }
+
+    inline void load_weights(const Vmm& vmm_wei, int offset) {
+        switch (jcp_.wei_prc) {
+            case Precision::FP32:
+                uni_vmovups(vmm_wei, ptr[reg_weights + offset]);
+                break;
+            case Precision::BF16:
+                vpmovzxwd(vmm_wei, ptr[reg_weights + offset]);
+                uni_vpslld(vmm_wei, vmm_wei, 16);
+                break;
+            case Precision::FP16:
+                vcvtph2ps(vmm_wei, ptr[reg_weights + offset]);
+                break;
+            case Precision::I8:
+                vpmovsxbd(vmm_wei, ptr[reg_weights + offset]);
+                break;
+            default:
+                assert(!"unsupported weights precision");
+        }
+    }
+
+    // broadcasts the source value of the current input channel to all the lanes
+    inline void load_src(int offset) {
+        Xbyak::Xmm xmm_src = Xbyak::Xmm(vmm_src.getIdx());
+        switch (jcp_.src_prc) {
+            case Precision::FP32:
+                uni_vbroadcastss(vmm_src, ptr[reg_src + reg_ic_off + offset]);
+                break;
+            case Precision::BF16:
+                movzx(reg_tmp.cvt32(), word[reg_src + reg_ic_off + offset]);
+                shl(reg_tmp.cvt32(), 16);
+                vmovd(xmm_src, reg_tmp.cvt32());
+                uni_vbroadcastss(vmm_src, xmm_src);
+                break;
+            case Precision::U8:
+                movzx(reg_tmp.cvt32(), byte[reg_src + reg_ic_off + offset]);
+                vmovd(xmm_src, reg_tmp.cvt32());
+                vpbroadcastd(vmm_src, xmm_src);
+                break;
+            case Precision::I8:
+                movsx(reg_tmp.cvt32(), byte[reg_src + reg_ic_off + offset]);
+                vmovd(xmm_src, reg_tmp.cvt32());
+                vpbroadcastd(vmm_src, xmm_src);
+                break;
+            default:
+                assert(!"unsupported source precision");
+        }
+    }
+
+    void compute_rows(int rows) {
+        for (int r = 0; r < rows; r++) {
+            for (int v = 0; v < vecs_per_block; v++)
+                uni_vpxor(get_acc(r, v), get_acc(r, v), get_acc(r, v));
+        }
+
+        mov(reg_ic_offsets, ptr[reg_params + GET_OFF(ic_offsets)]);
+        mov(reg_weights, ptr[reg_params + GET_OFF(weights)]);
+        mov(reg_nnz, ptr[reg_params + GET_OFF(nnz_blocks)]);
+
+        const int wei_size = jcp_.wei_prc.size();
+
+        Xbyak::Label blocks_loop_label;
+        Xbyak::Label blocks_loop_end_label;
+
+        L(blocks_loop_label);
+        {
+            cmp(reg_nnz, 0);
+            jle(blocks_loop_end_label, T_NEAR);
+
+            mov(reg_ic_off.cvt32(), dword[reg_ic_offsets]);
+            for (int v = 0; v < vecs_per_block; v++)
+                load_weights(get_wei(v), v * simd_w * wei_size);
+
+            for (int r = 0; r < rows; r++) {
+                load_src(r * static_cast<int>(jcp_.src_stride));
+                for (int v = 0; v < vecs_per_block; v++) {
+                    if (is_int8()) {
+                        vpmulld(vmm_prod, vmm_src, get_wei(v));
+                        uni_vpaddd(get_acc(r, v), get_acc(r, v), vmm_prod);
+                    } else {
+                        uni_vfmadd231ps(get_acc(r, v), vmm_src, get_wei(v));
+                    }
+                }
+            }
+
+            add(reg_ic_offsets, sizeof(int32_t));
+            add(reg_weights, vecs_per_block * simd_w * wei_size);
+            sub(reg_nnz, 1);
+
+            jmp(blocks_loop_label, T_NEAR);
+        }
+        L(blocks_loop_end_label);
+
+        const int dst_size = jcp_.dst_prc.size();
+        for (int r = 0; r < rows; r++) {
+            for (int v = 0; v < vecs_per_block; v++) {
+                const int oc_num = std::min(simd_w, static_cast<int>(jcp_.oc_valid) - v * simd_w);
+                if (oc_num <= 0)
+                    break;
+
+                const Vmm vmm_dst = get_acc(r, v);
+                if (is_int8())
+                    uni_vcvtdq2ps(vmm_dst, vmm_dst);
+                uni_vaddps(vmm_dst, vmm_dst, ptr[reg_bias + v * vlen]);
+
+                post_ops->apply(vmm_dst, v * vlen);
+
+                store_emitter->emit_code({static_cast<size_t>(vmm_dst.getIdx())}, {static_cast<size_t>(reg_dst.getIdx())},
+                    std::make_shared<store_emitter_context>(Precision::FP32, jcp_.dst_prc, oc_num,
+                                                            r * static_cast<int>(jcp_.dst_stride) + v * simd_w * dst_size),
+                    {store_pool_vec_idxs}, {store_pool_gpr_idxs});
+            }
+        }
+    }
+};
+
+/**
+ * Multiplies the source rows by the FP16 or BF16 weights of up to simd_w output channels in their original [OC, IC]
+ * layout, so the weights are widened to FP32 in registers only and no other copy of them is kept. Every output
+ * channel accumulates the products along the input channels in its own vector, the vectors are reduced to one vector
+ * of the output channels at the end of a row. The weights of the block stay in cache while the rows are processed.
+ * U4 weights packed by FullyConnectedLowBitWeightsFusion are unpacked and dequantized per group in registers as well.
+ */
+template <cpu_isa_t isa>
+struct jit_uni_compressed_fc_kernel_f32 : public jit_uni_compressed_fc_kernel, public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_compressed_fc_kernel_f32)
+
+    explicit jit_uni_compressed_fc_kernel_f32(jit_compressed_fc_config_params jcp, const mkldnn_primitive_attr &attr)
+        : jit_uni_compressed_fc_kernel(jcp, attr), jit_generator() {}
+
+    void create_ker() override {
+        jit_generator::create_kernel();
+        ker_ = (decltype(ker_))jit_ker();
+    }
+
+    void generate() override {
+        post_ops.reset(new jit_uni_fc_post_ops<isa>(this, attr_, jcp_.dst_prc, reg_oc_off, reg_d_weights, reg_d_bias,
+                                                    vmm_d_weights, vmm_d_bias));
+
+        store_emitter.reset(new jit_store_emitter(this, isa, nullptr));
+        store_pool_gpr_idxs = {static_cast<size_t>(reg_load_store_mask.getIdx())};
+        store_pool_vec_idxs = {static_cast<size_t>(vmm_aux.getIdx())};
+
+        this->preamble();
+
+        mov(reg_src, ptr[reg_params + GET_COMPRESSED_OFF(src)]);
+        mov(reg_dst, ptr[reg_params + GET_COMPRESSED_OFF(dst)]);
+        mov(reg_weights, ptr[reg_params + GET_COMPRESSED_OFF(weights)]);
+        mov(reg_bias, ptr[reg_params + GET_COMPRESSED_OFF(bias)]);
+        mov(reg_rows, ptr[reg_params + GET_COMPRESSED_OFF(rows)]);
+        mov(reg_oc_off, ptr[reg_params + GET_COMPRESSED_OFF(oc_off)]);
+
+        const bool low_bit = jcp_.wei_prc == Precision::U4;
+        const int ic_tail = low_bit ? 0 : static_cast<int>(jcp_.ic) % simd_w;
+        if (ic_tail || low_bit)
+            mov(reg_table, l_table);
+
+        Xbyak::Label rows_loop_label;
+        Xbyak::Label rows_loop_end_label;
+
+        L(rows_loop_label);
+        {
+            cmp(reg_rows, 0);
+            jle(rows_loop_end_label, T_NEAR);
+
+            compute_row();
+
+            add(reg_src, static_cast<int>(jcp_.src_stride));
+            add(reg_dst, static_cast<int>(jcp_.dst_stride));
+            sub(reg_rows, 1);
+
+            jmp(rows_loop_label, T_NEAR);
+        }
+        L(rows_loop_end_label);
+
+        this->postamble();
+
+        store_emitter->emit_data();
+        post_ops->prepare_table();
+
+        if (ic_tail) {
+            // the lanes of the last source vector which were processed by the previous one are zeroed
+            align(vlen);
+            L(l_table);
+            for (int i = 0; i < simd_w; i++)
+                dd(i < simd_w - ic_tail ? 0 : 0xFFFFFFFF);
+        } else if (low_bit) {
+            // the mask of the low nibbles of the U4 weights widened to dwords
+            align(vlen);
+            L(l_table);
+            for (int i = 0; i < simd_w; i++)
+                dd(0x0F);
+        }
+    }
+
+private:
+    using Vmm = typename conditional3<isa == cpu::x64::sse41, Xbyak::Xmm, isa == cpu::x64::avx2,
+            Xbyak::Ymm, Xbyak::Zmm>::type;
+
+    const int vlen = cpu_isa_traits<isa>::vlen;
+    const int simd_w = vlen / sizeof(float);
+
+    Xbyak::Reg64 reg_src = r8;
+    Xbyak::Reg64 reg_dst = r9;
+    Xbyak::Reg64 reg_rows = r10;
+    Xbyak::Reg64 reg_src_cur = r11;
+    Xbyak::Reg64 reg_wei_cur = r12;
+    Xbyak::Reg64 reg_ic_iter = r13;
+    Xbyak::Reg64 reg_bias = r14;
+    Xbyak::Reg64 reg_weights = r15;
+    Xbyak::Reg64 reg_table = rsi;
+    Xbyak::Reg64 reg_params = abi_param1;
+
+    Xbyak::Reg64 reg_oc_off = rax;
+    Xbyak::Reg64 reg_d_weights = rbx;
+    Xbyak::Reg64 reg_d_bias = rdx;
+
+    Xbyak::Reg64 reg_load_store_mask = rbp;
+
+    // the input channels loop of U4 weights borrows the registers of the post operations and the store, reg_oc_off is
+    // loaded again after the loop
+    Xbyak::Reg64 reg_chunk_iter = rax;
+    Xbyak::Reg64 reg_scales_cur = rbx;
+    Xbyak::Reg64 reg_zp_cur = rdx;
+    Xbyak::Reg64 reg_tmp = rbp;
+
+    // simd_w accumulators go first
+    Vmm vmm_src = Vmm(simd_w);
+    Vmm vmm_wei = Vmm(simd_w + 1);
+    Vmm vmm_d_weights = Vmm(simd_w + 2);
+    Vmm vmm_d_bias = Vmm(simd_w + 3);
+    Vmm vmm_aux = Vmm(simd_w + 4);
+
+    // a block of U4 weights holds low_bit_block input channels in low_bit_block / 2 bytes, the low nibbles are the first
+    // half of the channels and the high nibbles are the second one
+    const int low_bit_block = static_cast<int>(FullyConnectedNode::lowBitWeightsBlock);
+    const int low_bit_halves = low_bit_block / 2 / simd_w;
+    // U4 weights use the registers after the accumulators for the source vectors of the halves of a block
+    inline Vmm get_src_lo(int h) const { return Vmm(simd_w + 2 * h); }
+    inline Vmm get_src_hi(int h) const { return Vmm(simd_w + 2 * h + 1); }
+    Vmm vmm_wei_lo = Vmm(simd_w + 2 * low_bit_halves);
+    Vmm vmm_wei_hi = Vmm(simd_w + 2 * low_bit_halves + 1);
+    Vmm vmm_zp = Vmm(simd_w + 2 * low_bit_halves + 2);
+    Vmm vmm_scale = Vmm(simd_w + 2 * low_bit_halves + 3);
+
+    Xbyak::Label l_table;
+
+    std::unique_ptr<jit_store_emitter> store_emitter = nullptr;
+    std::unique_ptr<jit_uni_fc_post_ops<isa>> post_ops = nullptr;
+
+    std::vector<size_t> store_pool_gpr_idxs;
+    std::vector<size_t> store_pool_vec_idxs;
+
+    inline Vmm get_acc(int oc) const {
+        return Vmm(oc);
+    }
+
+    inline void load_vector(const Vmm& vmm, const Xbyak::Address& addr, Precision prc) {
+        switch (prc) {
+            case Precision::FP32:
+                uni_vmovups(vmm, addr);
+                break;
+            case Precision::BF16:
+                vpmovzxwd(vmm, addr);
+                uni_vpslld(vmm, vmm, 16);
+                break;
+            case Precision::FP16:
+                vcvtph2ps(vmm, addr);
+                break;
+            default:
+                assert(!"unsupported precision");
+        }
+    }
+
+    void compute_ic_block(bool masked) {
+        load_vector(vmm_src, ptr[reg_src_cur], jcp_.src_prc);
+        if (masked) {
+            if (isa == cpu::x64::avx512_common)
+                vpandd(vmm_src, vmm_src, ptr[reg_table]);
+            else
+                vandps(vmm_src, vmm_src, ptr[reg_table]);
+        }
+
+        for (int oc = 0; oc < static_cast<int>(jcp_.oc_valid); oc++) {
+            load_vector(vmm_wei, ptr[reg_wei_cur + oc * static_cast<int>(jcp_.wei_stride)], jcp_.wei_prc);
+            uni_vfmadd231ps(get_acc(oc), vmm_src, vmm_wei);
+        }
+    }
+
+    // unpacks low_bit_block U4 weights of each output channel, dequantizes them with the scale and the zero point of
+    // the group and accumulates the products with the source
+    void compute_low_bit_block() {
+        const int src_size = jcp_.src_prc.size();
+        const int groups = static_cast<int>(jcp_.groups);
+        for (int h = 0; h < low_bit_halves; h++) {
+            load_vector(get_src_lo(h), ptr[reg_src_cur + h * simd_w * src_size], jcp_.src_prc);
+            load_vector(get_src_hi(h), ptr[reg_src_cur + (low_bit_block / 2 + h * simd_w) * src_size], jcp_.src_prc);
+        }
+
+        for (int oc = 0; oc < static_cast<int>(jcp_.oc_valid); oc++) {
+            movzx(reg_tmp.cvt32(), byte[reg_zp_cur + oc * groups]);
+            vmovd(Xbyak::Xmm(vmm_zp.getIdx()), reg_tmp.cvt32());
+            vpbroadcastd(vmm_zp, Xbyak::Xmm(vmm_zp.getIdx()));
+            vbroadcastss(vmm_scale, ptr[reg_scales_cur + oc * groups * static_cast<int>(sizeof(float))]);
+
+            for (int h = 0; h < low_bit_halves; h++) {
+                vpmovzxbd(vmm_wei_lo, ptr[reg_wei_cur + oc * static_cast<int>(jcp_.wei_stride) + h * simd_w]);
+                vpsrld(vmm_wei_hi, vmm_wei_lo, 4);
+                if (isa == cpu::x64::avx512_common)
+                    vpandd(vmm_wei_lo, vmm_wei_lo, ptr[reg_table]);
+                else
+                    vpand(vmm_wei_lo, vmm_wei_lo, ptr[reg_table]);
+
+                for (const auto& vmm_wei_half : {vmm_wei_lo, vmm_wei_hi}) {
+                    vpsubd(vmm_wei_half, vmm_wei_half, vmm_zp);
+                    vcvtdq2ps(vmm_wei_half, vmm_wei_half);
+                    vmulps(vmm_wei_half, vmm_wei_half, vmm_scale);
+                }
+                uni_vfmadd231ps(get_acc(oc), get_src_lo(h), vmm_wei_lo);
+                uni_vfmadd231ps(get_acc(oc), get_src_hi(h), vmm_wei_hi);
+            }
+        }
+    }
+
+    void compute_low_bit_row() {
+        mov(reg_scales_cur, ptr[reg_params + GET_COMPRESSED_OFF(scales)]);
+        mov(reg_zp_cur, ptr[reg_params + GET_COMPRESSED_OFF(zero_points)]);
+
+        // the blocks don't cross the groups
+        const int src_size = jcp_.src_prc.size();
+        const int group_blocks = static_cast<int>(jcp_.ic / jcp_.groups) / low_bit_block;
+
+        Xbyak::Label group_loop_label;
+        Xbyak::Label block_loop_label;
+        mov(reg_ic_iter, static_cast<int>(jcp_.groups));
+        L(group_loop_label);
+        {
+            mov(reg_chunk_iter, group_blocks);
+            L(block_loop_label);
+            {
+                compute_low_bit_block();
+
+                add(reg_src_cur, low_bit_block * src_size);
+                add(reg_wei_cur, low_bit_block / 2);
+                sub(reg_chunk_iter, 1);
+                jnz(block_loop_label, T_NEAR);
+            }
+
+            add(reg_scales_cur, sizeof(float));
+            add(reg_zp_cur, sizeof(uint8_t));
+            sub(reg_ic_iter, 1);
+            jnz(group_loop_label, T_NEAR);
+        }
+
+        mov(reg_oc_off, ptr[reg_params + GET_COMPRESSED_OFF(oc_off)]);
+    }
+
+    // sums the lanes of 8 ymm accumulators starting from the base one into the lanes of the base one
+    void reduce_ymm(int base) {
+        auto y = [base](int i) { return Xbyak::Ymm(base + i); };
+        vhaddps(y(0), y(0), y(1));
+        vhaddps(y(2), y(2), y(3));
+        vhaddps(y(0), y(0), y(2));
+        vhaddps(y(4), y(4), y(5));
+        vhaddps(y(6), y(6), y(7));
+        vhaddps(y(4), y(4), y(6));
+        // the low halves hold the sums of the low lanes of the accumulators, the high halves of the high ones
+        vperm2f128(y(1), y(0), y(4), 0x20);
+        vperm2f128(y(2), y(0), y(4), 0x31);
+        vaddps(y(0), y(1), y(2));
+    }
+
+    void compute_row() {
+        for (int oc = 0; oc < simd_w; oc++)
+            uni_vpxor(get_acc(oc), get_acc(oc), get_acc(oc));
+
+        mov(reg_src_cur, reg_src);
+        mov(reg_wei_cur, reg_weights);
+
+        if (jcp_.wei_prc == Precision::U4) {
+            compute_low_bit_row();
+        } else {
+            const int src_size = jcp_.src_prc.size();
+            const int wei_size = jcp_.wei_prc.size();
+            const int ic_blocks = static_cast<int>(jcp_.ic) / simd_w;
+            const int ic_tail = static_cast<int>(jcp_.ic) % simd_w;
+
+            Xbyak::Label ic_loop_label;
+            mov(reg_ic_iter, ic_blocks);
+            L(ic_loop_label);
+            {
+                compute_ic_block(false);
+
+                add(reg_src_cur, simd_w * src_size);
+                add(reg_wei_cur, simd_w * wei_size);
+                sub(reg_ic_iter, 1);
+                jnz(ic_loop_label, T_NEAR);
+            }
+
+            // the layer has at least one vector of input channels, so the tail is the last vector of them
+            if (ic_tail) {
+                sub(reg_src_cur, (simd_w - ic_tail) * src_size);
+                sub(reg_wei_cur, (simd_w - ic_tail) * wei_size);
+                compute_ic_block(true);
+            }
+        }
+
+        if (isa == cpu::x64::avx512_common) {
+            // EVEX encoded ymm operations, the avx512 kernel is used with AVX512VL only
+            const Xbyak::Ymm ymm_tmp = Xbyak::Ymm(vmm_wei.getIdx());
+            for (int oc = 0; oc < simd_w; oc++) {
+                vextractf64x4(ymm_tmp, Xbyak::Zmm(oc), 1);
+                vaddps(Xbyak::Ymm(oc), Xbyak::Ymm(oc), ymm_tmp);
+            }
+            reduce_ymm(0);
+            reduce_ymm(8);
+            vinsertf64x4(Xbyak::Zmm(0), Xbyak::Zmm(0), Xbyak::Ymm(8), 1);
+        } else {
+            reduce_ymm(0);
+        }
+
+        const Vmm vmm_dst = get_acc(0);
+        uni_vaddps(vmm_dst, vmm_dst, ptr[reg_bias]);
+
+        post_ops->apply(vmm_dst, 0);
+
+        store_emitter->emit_code({static_cast<size_t>(vmm_dst.getIdx())}, {static_cast<size_t>(reg_dst.getIdx())},
+            std::make_shared<store_emitter_context>(Precision::FP32, jcp_.dst_prc, static_cast<int>(jcp_.oc_valid), 0),
+            {store_pool_vec_idxs}, {store_pool_gpr_idxs});
+    }
+};
+
+namespace {
+
+template <typename T>
+inline bool isZeroWeight(T value) {
+    return static_cast<float>(value) == 0.f;
+}
+
+// FP16 weights are handled as the raw bits, which are copied exactly through float by the packing
+inline bool isZeroWeight(ie_fp16 value) {
+    return (value & 0x7fff) == 0;
+}
+
+// Number of the blocks of sparseOCBlock output channels at one input channel with at least one non-zero weight
+template <typename T>
+size_t countNonZeroBlocks(const T* weights, size_t OC, size_t IC) {
+    const size_t blockSize = MKLDNNFullyConnectedNode::sparseOCBlock;
+    size_t nnz = 0;
+    for (size_t ocStart = 0; ocStart < OC; ocStart += blockSize) {
+        const size_t ocNum = std::min(blockSize, OC - ocStart);
+        for (size_t ic = 0; ic < IC; ic++) {
+            for (size_t oc = 0; oc < ocNum; oc++) {
+                if (!isZeroWeight(weights[(ocStart + oc) * IC + ic])) {
+                    nnz++;
+                    break;
+                }
+            }
+        }
+    }
+    return nnz;
+}
+
+template <typename src_t, typename dst_t>
+void packSparseWeights(const src_t* weights, size_t OC, size_t IC, size_t srcDataSize,
+                       int32_t* blockOffsets, int32_t* icOffsets, dst_t* values) {
+    const size_t blockSize = MKLDNNFullyConnectedNode::sparseOCBlock;
+    size_t nnz = 0;
+    for (size_t ocb = 0; ocb < div_up(OC, blockSize); ocb++) {
+        blockOffsets[ocb] = static_cast<int32_t>(nnz);
+        const size_t ocStart = ocb * blockSize;
+        const size_t ocNum = std::min(blockSize, OC - ocStart);
+        for (size_t ic = 0; ic < IC; ic++) {
+            bool isZeroBlock = true;
+            for (size_t oc = 0; oc < ocNum && isZeroBlock; oc++)
+                isZeroBlock = isZeroWeight(weights[(ocStart + oc) * IC + ic]);
+            if (isZeroBlock)
+                continue;
+
+            icOffsets[nnz] = static_cast<int32_t>(ic * srcDataSize);
+            for (size_t oc = 0; oc < blockSize; oc++) {
+                values[nnz * blockSize + oc] = oc < ocNum ? static_cast<dst_t>(static_cast<float>(weights[(ocStart + oc) * IC + ic]))
+                                                          : static_cast<dst_t>(0.f);
+            }
+            nnz++;
+        }
+    }
+    blockOffsets[div_up(OC, blockSize)] = static_cast<int32_t>(nnz);
+}
+
+}  // namespace
 
 bool MKLDNNFullyConnectedNode::isSupportedOperation(const std::shared_ptr<ngraph::Node>& op, std::string& errorMessage) noexcept {
     try {
@@ -24,10 +747,15 @@ bool MKLDNNFullyConnectedNode::isSupportedOperation(const std::shared_ptr<ngraph
             errorMessage = "Only legacy FullyConnected operation is supported";
             return false;
         }
-        if (fc->get_input_size() == 3 && std::dynamic_pointer_cast<const ngraph::opset1::Constant>(fc->get_input_node_shared_ptr(BIAS_ID)) == nullptr) {
+        if (fc->get_input_size() >= 3 && std::dynamic_pointer_cast<const ngraph::opset1::Constant>(fc->get_input_node_shared_ptr(BIAS_ID)) == nullptr) {
             errorMessage = "Only Constant operation on 'bias' input is supported";
             return false;
         }
+        if (fc->get_input_size() == 5 && (std::dynamic_pointer_cast<const ngraph::opset1::Constant>(fc->get_input_node_shared_ptr(SCALES_ID)) == nullptr ||
+                std::dynamic_pointer_cast<const ngraph::opset1::Constant>(fc->get_input_node_shared_ptr(ZERO_POINTS_ID)) == nullptr)) {
+            errorMessage = "Only Constant operations on 'scales' and 'zero points' inputs are supported";
+            return false;
+        }
         if (!one_of(fc->get_input_shape(DATA_ID).size(), 2, 3, 4)) {
             errorMessage = "Doesn't support 'data' input with rank: " + std::to_string(fc->get_input_shape(DATA_ID).size());
             return false;
@@ -44,7 +772,8 @@ MKLDNNFullyConnectedNode::MKLDNNFullyConnectedNode(const std::shared_ptr<ngraph:
     if (isSupportedOperation(op, errorMessage)) {
         errorPrefix = "FullyConnected node with name '" + getName() + "'";
 
-        withBiases = op->get_input_size() == 3;
+        withBiases = op->get_input_size() >= 3;
+        withLowBitWeights = op->get_input_size() == 5;
     } else {
         IE_THROW(NotImplemented) << errorMessage;
     }
@@ -67,7 +796,7 @@ std::vector<memory::format_tag> MKLDNNFullyConnectedNode::getAvailableFormatsFor
 }
 
 void MKLDNNFullyConnectedNode::getSupportedDescriptors() {
-    if (getParentEdges().size() != 2 && getParentEdges().size() != 3)
+    if (!one_of(getParentEdges().size(), 2, 3, 5))
         IE_THROW() << errorPrefix << " has incorrect number of input edges";
     if (getChildEdges().empty())
         IE_THROW()<< errorPrefix << " has incorrect number of output edges";
@@ -112,6 +841,37 @@ void MKLDNNFullyConnectedNode::getSupportedDescriptors() {
     }
     biasesDims.push_back(weightsDims[0]);
 
+    if (withLowBitWeights) {
+        // FullyConnectedLowBitWeightsFusion packs the weights for the compressed weights kernel on AVX2 and newer only
+        if (!mayiuse(avx2))
+            IE_THROW() << errorPrefix << " doesn't support U4 weights without AVX2";
+        compressedOCBlock = mayiuse(avx512_core) ? 16 : 8;
+        useCompressedWeights = true;
+        sparseSrcPrc = MKLDNNExtensionUtils::DataTypeToIEPrecision(inputDataType);
+        sparseWeiPrc = Precision::U4;
+        sparseDstPrc = MKLDNNExtensionUtils::DataTypeToIEPrecision(outputDataType);
+        return;
+    }
+
+    // FP16 weights and BF16 weights of FP32 layers stay compressed, the own kernels widen them to FP32
+    const auto rawWeightsPrc = getOriginalInputPrecisionAtPort(WEIGHTS_ID);
+    const bool compressed = rawWeightsPrc == Precision::FP16 || (rawWeightsPrc == Precision::BF16 && inputDataType == memory::data_type::f32);
+    if (isJitKernelApplicable(inputDataType, compressed)) {
+        // the compressed weights kernel processes at least one vector of the input channels
+        compressedOCBlock = mayiuse(avx512_core) ? 16 : 8;
+        useCompressedWeights = compressed && !useSparseWeights && weightsDims[1] >= compressedOCBlock;
+        usePackedWeights = !useCompressedWeights;
+        sparseSrcPrc = MKLDNNExtensionUtils::DataTypeToIEPrecision(inputDataType);
+        if (compressed)
+            sparseWeiPrc = rawWeightsPrc;
+        else
+            sparseWeiPrc = one_of(inputDataType, memory::data_type::u8, memory::data_type::s8) ? Precision::I8 : sparseSrcPrc;
+        sparseDstPrc = MKLDNNExtensionUtils::DataTypeToIEPrecision(outputDataType);
+        return;
+    }
+    if (rawWeightsPrc == Precision::FP16)
+        IE_THROW() << errorPrefix << " doesn't support FP16 weights";
+
     for (auto format : getAvailableFormatsForDims(inDims)) {
         MKLDNNMemoryDesc in_candidate(inDims, inputDataType, format);
         MKLDNNMemoryDesc out_candidate(outDims, outputDataType, memory::format_tag::any);
@@ -120,7 +880,315 @@ void MKLDNNFullyConnectedNode::getSupportedDescriptors() {
     }
 }
 
+void MKLDNNFullyConnectedNode::initSupportedPrimitiveDescriptors() {
+    if (!usePackedWeights && !useCompressedWeights) {
+        MKLDNNNode::initSupportedPrimitiveDescriptors();
+        return;
+    }
+
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    std::vector<DataConfigurator> inDataConf = {{TensorDescCreatorTypes::ncsp, sparseSrcPrc},
+                                                {TensorDescCreatorTypes::ncsp, getOriginalInputPrecisionAtPort(WEIGHTS_ID)}};
+    if (withBiases)
+        inDataConf.emplace_back(TensorDescCreatorTypes::ncsp, getOriginalInputPrecisionAtPort(BIAS_ID));
+    if (withLowBitWeights) {
+        inDataConf.emplace_back(TensorDescCreatorTypes::ncsp, getOriginalInputPrecisionAtPort(SCALES_ID));
+        inDataConf.emplace_back(TensorDescCreatorTypes::ncsp, getOriginalInputPrecisionAtPort(ZERO_POINTS_ID));
+    }
+
+    impl_desc_type implType;
+    if (useSparseWeights)
+        implType = mayiuse(avx512_common) ? impl_desc_type::jit_avx512_sparse : impl_desc_type::jit_avx2_sparse;
+    else if (useCompressedWeights)
+        implType = compressedOCBlock == 16 ? impl_desc_type::jit_avx512 : impl_desc_type::jit_avx2;
+    else
+        implType = mayiuse(avx512_common) ? impl_desc_type::jit_avx512 : impl_desc_type::jit_avx2;
+    addSupportedPrimDesc(inDataConf, {{TensorDescCreatorTypes::ncsp, sparseDstPrc}}, implType);
+}
+
+bool MKLDNNFullyConnectedNode::isJitKernelApplicable(memory::data_type inputDataType, bool compressed) {
+    if ((sparseWeightsThreshold <= 0.f && !compressed) || !mayiuse(avx2))
+        return false;
+    if (!one_of(getParentEdgeAt(DATA_ID)->getDims().ndims(), 2, 3) || weightsDims.size() != 2)
+        return false;
+
+    auto *weightsNode = dynamic_cast<MKLDNNInputNode *>(getParentEdgeAt(WEIGHTS_ID)->getParent().get());
+    if (!weightsNode || !weightsNode->isConstant() || !weightsNode->getMemoryPtr())
+        return false;
+    auto weights = weightsNode->getMemoryPtr();
+    const auto weightsPrc = MKLDNNExtensionUtils::DataTypeToIEPrecision(weights->GetDataType());
+    const bool isInt8 = one_of(inputDataType, memory::data_type::u8, memory::data_type::s8);
+    if (isInt8 ? weightsPrc != Precision::I8 : !one_of(weightsPrc, Precision::FP32, Precision::BF16, Precision::FP16))
+        return false;
+
+    MKLDNNMemoryCPtr biases;
+    if (withBiases) {
+        auto *biasesNode = dynamic_cast<MKLDNNInputNode *>(getParentEdgeAt(BIAS_ID)->getParent().get());
+        if (!biasesNode || !biasesNode->getMemoryPtr())
+            return false;
+        biases = biasesNode->getMemoryPtr();
+    }
+
+    const size_t OC = weightsDims[0];
+    const size_t IC = weightsDims[1];
+    const size_t blocks = div_up(OC, sparseOCBlock) * IC;
+    size_t nnz = blocks;
+    if (sparseWeightsThreshold > 0.f) {
+        switch (weightsPrc) {
+            case Precision::FP32:
+                nnz = countNonZeroBlocks(static_cast<const float*>(weights->GetPtr()), OC, IC);
+                break;
+            case Precision::BF16:
+                nnz = countNonZeroBlocks(static_cast<const bfloat16_t*>(weights->GetPtr()), OC, IC);
+                break;
+            case Precision::FP16:
+                nnz = countNonZeroBlocks(static_cast<const ie_fp16*>(weights->GetPtr()), OC, IC);
+                break;
+            default:
+                nnz = countNonZeroBlocks(static_cast<const int8_t*>(weights->GetPtr()), OC, IC);
+        }
+    }
+
+    useSparseWeights = sparseWeightsThreshold > 0.f && blocks != 0 && static_cast<float>(blocks - nnz) / blocks >= sparseWeightsThreshold;
+    if (!useSparseWeights && !compressed)
+        return false;
+
+    sparseNnzBlocks = nnz;
+    sparseRawWeights = weights;
+    sparseRawBiases = biases;
+    return true;
+}
+
+void MKLDNNFullyConnectedNode::createSparsePrimitive() {
+    if (sparseKernel)
+        return;
+
+    const size_t OC = weightsDims[0];
+    const size_t IC = weightsDims[1];
+    const size_t OCB = div_up(OC, sparseOCBlock);
+    const auto rawWeightsPrc = MKLDNNExtensionUtils::DataTypeToIEPrecision(sparseRawWeights->GetDataType());
+
+    sparseBiasOffset = rnd_up((OCB + 1 + sparseNnzBlocks) * sizeof(int32_t), 64);
+    sparseValuesOffset = sparseBiasOffset + OCB * sparseOCBlock * sizeof(float);
+    const size_t packedSize = sparseValuesOffset + sparseNnzBlocks * sparseOCBlock * sparseWeiPrc.size();
+
+    auto create = [&] () {
+        MKLDNNMemoryDesc desc(MKLDNNDims(SizeVector{packedSize}), memory::data_type::u8, memory::format_tag::x);
+        MKLDNNMemoryPtr ptr = createMemory(desc);
+
+        auto data = static_cast<uint8_t*>(ptr->GetData());
+        auto blockOffsets = reinterpret_cast<int32_t*>(data);
+        auto icOffsets = blockOffsets + OCB + 1;
+        auto values = data + sparseValuesOffset;
+        const auto weights = sparseRawWeights->GetPtr();
+        const size_t srcDataSize = sparseSrcPrc.size();
+        if (rawWeightsPrc == Precision::I8) {
+            packSparseWeights(static_cast<const int8_t*>(weights), OC, IC, srcDataSize, blockOffsets, icOffsets, reinterpret_cast<int8_t*>(values));
+        } else if (rawWeightsPrc == Precision::FP16) {
+            packSparseWeights(static_cast<const ie_fp16*>(weights), OC, IC, srcDataSize, blockOffsets, icOffsets, reinterpret_cast<ie_fp16*>(values));
+        } else if (rawWeightsPrc == Precision::FP32 && sparseWeiPrc == Precision::FP32) {
+            packSparseWeights(static_cast<const float*>(weights), OC, IC, srcDataSize, blockOffsets, icOffsets, reinterpret_cast<float*>(values));
+        } else if (rawWeightsPrc == Precision::FP32) {
+            packSparseWeights(static_cast<const float*>(weights), OC, IC, srcDataSize, blockOffsets, icOffsets, reinterpret_cast<bfloat16_t*>(values));
+        } else if (sparseWeiPrc == Precision::FP32) {
+            packSparseWeights(static_cast<const bfloat16_t*>(weights), OC, IC, srcDataSize, blockOffsets, icOffsets, reinterpret_cast<float*>(values));
+        } else {
+            packSparseWeights(static_cast<const bfloat16_t*>(weights), OC, IC, srcDataSize, blockOffsets, icOffsets, reinterpret_cast<bfloat16_t*>(values));
+        }
+
+        auto bias = reinterpret_cast<float*>(data + sparseBiasOffset);
+        std::fill(bias, bias + OCB * sparseOCBlock, 0.f);
+        if (sparseRawBiases)
+            cpu_convert(sparseRawBiases->GetPtr(), bias, MKLDNNExtensionUtils::DataTypeToIEPrecision(sparseRawBiases->GetDataType()),
+                        Precision::FP32, OC);
+
+        return ptr;
+    };
+
+    if (weightCache != nullptr) {
+        const uint64_t dataHash = weightCache->GetHashFunc().hash(static_cast<const unsigned char*>(sparseRawWeights->GetPtr()),
+                                                                  sparseRawWeights->GetSize());
+        const std::string key = getName() + "_sparse_" + std::to_string(packedSize) + "_" + std::to_string(dataHash);
+        sparseWeightsMemory = *weightCache->findOrCreate(key, create);
+    } else {
+        sparseWeightsMemory = create();
+    }
+    // the original weights are not needed anymore
+    sparseRawWeights.reset();
+    sparseRawBiases.reset();
+
+    auto attr = initPrimitiveAttr();
+
+    jit_sparse_fc_config_params jcp;
+    jcp.src_prc = sparseSrcPrc;
+    jcp.wei_prc = sparseWeiPrc;
+    jcp.dst_prc = sparseDstPrc;
+    jcp.src_stride = IC * sparseSrcPrc.size();
+    jcp.dst_stride = OC * sparseDstPrc.size();
+    jcp.oc_valid = sparseOCBlock;
+
+    const size_t ocTail = OC % sparseOCBlock;
+    if (mayiuse(avx512_common)) {
+        sparseKernel.reset(new jit_uni_sparse_fc_kernel_f32<avx512_common>(jcp, *attr->get()));
+        if (ocTail) {
+            jcp.oc_valid = ocTail;
+            sparseTailKernel.reset(new jit_uni_sparse_fc_kernel_f32<avx512_common>(jcp, *attr->get()));
+        }
+    } else {
+        sparseKernel.reset(new jit_uni_sparse_fc_kernel_f32<avx2>(jcp, *attr->get()));
+        if (ocTail) {
+            jcp.oc_valid = ocTail;
+            sparseTailKernel.reset(new jit_uni_sparse_fc_kernel_f32<avx2>(jcp, *attr->get()));
+        }
+    }
+
+    sparseKernel->create_ker();
+    if (sparseTailKernel)
+        sparseTailKernel->create_ker();
+}
+
+void MKLDNNFullyConnectedNode::executeSparse() {
+    const auto src = static_cast<const uint8_t*>(getParentEdgeAt(DATA_ID)->getMemoryPtr()->GetPtr());
+    const auto dst = static_cast<uint8_t*>(getChildEdgeAt(0)->getMemoryPtr()->GetPtr());
+
+    const auto inDims = getParentEdgeAt(DATA_ID)->getDims().ToSizeVector();
+    const size_t rows = std::accumulate(inDims.begin(), inDims.end() - 1, size_t(1), std::multiplies<size_t>());
+    const size_t OC = weightsDims[0];
+    const size_t IC = weightsDims[1];
+    const size_t OCB = div_up(OC, sparseOCBlock);
+    const size_t srcStride = IC * sparseSrcPrc.size();
+    const size_t dstStride = OC * sparseDstPrc.size();
+
+    const auto data = static_cast<const uint8_t*>(sparseWeightsMemory->GetData());
+    const auto blockOffsets = reinterpret_cast<const int32_t*>(data);
+    const auto icOffsets = blockOffsets + OCB + 1;
+    const auto bias = reinterpret_cast<const float*>(data + sparseBiasOffset);
+    const auto values = data + sparseValuesOffset;
+
+    // the weights of an output channels block stay in cache while the rows of a chunk are processed
+    const size_t rowsChunk = 64;
+    parallel_for2d(div_up(rows, rowsChunk), OCB, [&](size_t rc, size_t ocb) {
+        jit_sparse_fc_call_args args;
+        args.src = src + rc * rowsChunk * srcStride;
+        args.dst = dst + rc * rowsChunk * dstStride + ocb * sparseOCBlock * sparseDstPrc.size();
+        args.ic_offsets = icOffsets + blockOffsets[ocb];
+        args.weights = values + blockOffsets[ocb] * sparseOCBlock * sparseWeiPrc.size();
+        args.bias = bias + ocb * sparseOCBlock;
+        args.nnz_blocks = blockOffsets[ocb + 1] - blockOffsets[ocb];
+        args.rows = std::min(rowsChunk, rows - rc * rowsChunk);
+        args.oc_off = ocb * sparseOCBlock * sizeof(float);
+
+        if (ocb == OCB - 1 && sparseTailKernel)
+            (*sparseTailKernel)(&args);
+        else
+            (*sparseKernel)(&args);
+    });
+}
+
+void MKLDNNFullyConnectedNode::createCompressedPrimitive() {
+    if (compressedKernel)
+        return;
+
+    const size_t OC = weightsDims[0];
+    const size_t IC = weightsDims[1];
+
+    if (withLowBitWeights)
+        sparseRawBiases = getParentEdgeAt(BIAS_ID)->getMemoryPtr();
+    compressedBias.assign(rnd_up(OC, compressedOCBlock), 0.f);
+    if (sparseRawBiases)
+        cpu_convert(sparseRawBiases->GetPtr(), compressedBias.data(), MKLDNNExtensionUtils::DataTypeToIEPrecision(sparseRawBiases->GetDataType()),
+                    Precision::FP32, OC);
+    // the weights are read from the constant input at execution
+    sparseRawWeights.reset();
+    sparseRawBiases.reset();
+
+    auto attr = initPrimitiveAttr();
+
+    jit_compressed_fc_config_params jcp;
+    jcp.src_prc = sparseSrcPrc;
+    jcp.wei_prc = sparseWeiPrc;
+    jcp.dst_prc = sparseDstPrc;
+    jcp.ic = IC;
+    jcp.src_stride = IC * sparseSrcPrc.size();
+    jcp.dst_stride = OC * sparseDstPrc.size();
+    jcp.wei_stride = withLowBitWeights ? IC / 2 : IC * sparseWeiPrc.size();
+    jcp.oc_valid = compressedOCBlock;
+    jcp.groups = withLowBitWeights ? getParentEdgeAt(SCALES_ID)->getDims()[1] : 1;
+
+    const size_t ocTail = OC % compressedOCBlock;
+    if (compressedOCBlock == 16) {
+        compressedKernel.reset(new jit_uni_compressed_fc_kernel_f32<avx512_common>(jcp, *attr->get()));
+        if (ocTail) {
+            jcp.oc_valid = ocTail;
+            compressedTailKernel.reset(new jit_uni_compressed_fc_kernel_f32<avx512_common>(jcp, *attr->get()));
+        }
+    } else {
+        compressedKernel.reset(new jit_uni_compressed_fc_kernel_f32<avx2>(jcp, *attr->get()));
+        if (ocTail) {
+            jcp.oc_valid = ocTail;
+            compressedTailKernel.reset(new jit_uni_compressed_fc_kernel_f32<avx2>(jcp, *attr->get()));
+        }
+    }
+
+    compressedKernel->create_ker();
+    if (compressedTailKernel)
+        compressedTailKernel->create_ker();
+}
+
+void MKLDNNFullyConnectedNode::executeCompressed() {
+    const auto src = static_cast<const uint8_t*>(getParentEdgeAt(DATA_ID)->getMemoryPtr()->GetPtr());
+    const auto dst = static_cast<uint8_t*>(getChildEdgeAt(0)->getMemoryPtr()->GetPtr());
+    const auto weights = static_cast<const uint8_t*>(getParentEdgeAt(WEIGHTS_ID)->getMemoryPtr()->GetPtr());
+
+    const auto inDims = getParentEdgeAt(DATA_ID)->getDims().ToSizeVector();
+    const size_t rows = std::accumulate(inDims.begin(), inDims.end() - 1, size_t(1), std::multiplies<size_t>());
+    const size_t OC = weightsDims[0];
+    const size_t IC = weightsDims[1];
+    const size_t OCB = div_up(OC, compressedOCBlock);
+    const size_t srcStride = IC * sparseSrcPrc.size();
+    const size_t dstStride = OC * sparseDstPrc.size();
+    const size_t weiStride = withLowBitWeights ? IC / 2 : IC * sparseWeiPrc.size();
+
+    const float *scales = nullptr;
+    const uint8_t *zeroPoints = nullptr;
+    size_t groups = 0;
+    if (withLowBitWeights) {
+        scales = static_cast<const float*>(getParentEdgeAt(SCALES_ID)->getMemoryPtr()->GetPtr());
+        zeroPoints = static_cast<const uint8_t*>(getParentEdgeAt(ZERO_POINTS_ID)->getMemoryPtr()->GetPtr());
+        groups = getParentEdgeAt(SCALES_ID)->getDims()[1];
+    }
+
+    const size_t rowsChunk = 64;
+    parallel_for2d(div_up(rows, rowsChunk), OCB, [&](size_t rc, size_t ocb) {
+        jit_compressed_fc_call_args args;
+        args.src = src + rc * rowsChunk * srcStride;
+        args.dst = dst + rc * rowsChunk * dstStride + ocb * compressedOCBlock * sparseDstPrc.size();
+        args.weights = weights + ocb * compressedOCBlock * weiStride;
+        args.bias = compressedBias.data() + ocb * compressedOCBlock;
+        args.scales = scales ? scales + ocb * compressedOCBlock * groups : nullptr;
+        args.zero_points = zeroPoints ? zeroPoints + ocb * compressedOCBlock * groups : nullptr;
+        args.rows = std::min(rowsChunk, rows - rc * rowsChunk);
+        args.oc_off = ocb * compressedOCBlock * sizeof(float);
+
+        if (ocb == OCB - 1 && compressedTailKernel)
+            (*compressedTailKernel)(&args);
+        else
+            (*compressedKernel)(&args);
+    });
+}
+
 void MKLDNNFullyConnectedNode::createPrimitive() {
+    if (useCompressedWeights) {
+        createCompressedPrimitive();
+        return;
+    }
+    if (usePackedWeights) {
+        createSparsePrimitive();
+        return;
+    }
+
     if (prim)
         return;
 
@@ -141,6 +1209,15 @@ void MKLDNNFullyConnectedNode::createPrimitive() {
 }
 
 void MKLDNNFullyConnectedNode::execute(mkldnn::stream strm) {
+    if (useCompressedWeights) {
+        executeCompressed();
+        return;
+    }
+    if (usePackedWeights) {
+        executeSparse();
+        return;
+    }
+
     if (prim) {
         auto reshapeMemory = [this](int argType) {
             auto param = primArgs.find(argType);
@@ -167,6 +1244,10 @@ bool MKLDNNFullyConnectedNode::canFuse(const MKLDNNNodePtr& node) const {
     return canFuseSimpleOperation(node);
 }
 
+size_t MKLDNNFullyConnectedNode::getWeightsBytes() {
+    return MKLDNNNode::getWeightsBytes() + (sparseWeightsMemory ? sparseWeightsMemory->GetSize() : 0) + compressedBias.size() * sizeof(float);
+}
+
 void MKLDNNFullyConnectedNode::setPostOps(mkldnn::primitive_attr &attr, bool initWeights = false) {
     mkldnn::post_ops ops;
 
@@ -196,6 +1277,8 @@ bool MKLDNNFullyConnectedNode::created() const {
 const std::vector<impl_desc_type>& MKLDNNFullyConnectedNode::getPrimitivesPriority() {
     std::vector<impl_desc_type> priorities = {
             impl_desc_type::unknown,
+            impl_desc_type::jit_avx512_sparse,
+            impl_desc_type::jit_avx2_sparse,
             impl_desc_type::gemm_blas,
             impl_desc_type::gemm_avx512,
             impl_desc_type::gemm_avx2,
@@ -238,6 +1321,10 @@ std::shared_ptr<mkldnn::primitive_attr> MKLDNNFullyConnectedNode::initPrimitiveA
 
 void MKLDNNFullyConnectedNode::createDescriptor(const std::vector<InferenceEngine::TensorDesc> &inputDesc,
                                                 const std::vector<InferenceEngine::TensorDesc> &outputDesc) {
+    // the layer is executed by the own kernels, so the descriptors of the primitives library aren't created
+    if (usePackedWeights || useCompressedWeights)
+        return;
+
     TensorDesc inDesc = inputDesc[0], outDesc = outputDesc[0];
 
     mkldnn::memory::data_type wdt = MKLDNNExtensionUtils::IEPrecisionToDataType(inDesc.getPrecision());
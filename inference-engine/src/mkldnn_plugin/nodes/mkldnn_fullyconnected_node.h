@@ -12,12 +12,91 @@
 
 namespace MKLDNNPlugin {
 
+struct jit_sparse_fc_config_params {
+    InferenceEngine::Precision src_prc;
+    InferenceEngine::Precision wei_prc;
+    InferenceEngine::Precision dst_prc;
+    size_t src_stride;      // bytes between the rows of the source
+    size_t dst_stride;      // bytes between the rows of the destination
+    size_t oc_valid;        // number of the output channels written from the block, less than the block for the tail
+};
+
+struct jit_sparse_fc_call_args {
+    const void *src;
+    void *dst;
+    const int32_t *ic_offsets;  // byte offsets of the input channels of the non-zero weights blocks in a source row
+    const void *weights;        // values of the non-zero weights blocks
+    const float *bias;
+    size_t nnz_blocks;
+    size_t rows;
+    size_t oc_off;
+};
+
+struct jit_uni_sparse_fc_kernel {
+    void (*ker_)(const jit_sparse_fc_call_args *);
+
+    void operator()(const jit_sparse_fc_call_args *args) {
+        assert(ker_);
+        ker_(args);
+    }
+
+    explicit jit_uni_sparse_fc_kernel(jit_sparse_fc_config_params jcp, const mkldnn_primitive_attr &attr) : ker_(nullptr), jcp_(jcp), attr_(attr) {}
+    virtual ~jit_uni_sparse_fc_kernel() {}
+
+    virtual void create_ker() = 0;
+
+    jit_sparse_fc_config_params jcp_;
+    const mkldnn_primitive_attr &attr_;
+};
+
+struct jit_compressed_fc_config_params {
+    InferenceEngine::Precision src_prc;
+    InferenceEngine::Precision wei_prc;
+    InferenceEngine::Precision dst_prc;
+    size_t ic;
+    size_t src_stride;      // bytes between the rows of the source
+    size_t dst_stride;      // bytes between the rows of the destination
+    size_t wei_stride;      // bytes between the output channels of the weights
+    size_t oc_valid;        // number of the output channels written from the block, less than the block for the tail
+    size_t groups;          // number of the groups of the input channels sharing a scale and a zero point of U4 weights
+};
+
+struct jit_compressed_fc_call_args {
+    const void *src;
+    void *dst;
+    const void *weights;    // first output channel of the block in the original weights
+    const float *bias;
+    const float *scales;            // [OC, groups] scales of U4 weights starting from the block
+    const uint8_t *zero_points;     // [OC, groups] zero points of U4 weights starting from the block
+    size_t rows;
+    size_t oc_off;
+};
+
+struct jit_uni_compressed_fc_kernel {
+    void (*ker_)(const jit_compressed_fc_call_args *);
+
+    void operator()(const jit_compressed_fc_call_args *args) {
+        assert(ker_);
+        ker_(args);
+    }
+
+    explicit jit_uni_compressed_fc_kernel(jit_compressed_fc_config_params jcp, const mkldnn_primitive_attr &attr)
+        : ker_(nullptr), jcp_(jcp), attr_(attr) {}
+    virtual ~jit_uni_compressed_fc_kernel() {}
+
+    virtual void create_ker() = 0;
+
+    jit_compressed_fc_config_params jcp_;
+    const mkldnn_primitive_attr &attr_;
+};
+
 class MKLDNNFullyConnectedNode : public MKLDNNNode {
 public:
     MKLDNNFullyConnectedNode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache);
 
     std::vector<mkldnn::memory::format_tag> getAvailableFormatsForDims(const MKLDNNDims &dims) const override;
     void getSupportedDescriptors() override;
+    void initSupportedPrimitiveDescriptors() override;
     void createPrimitive() override;
     void execute(mkldnn::stream strm) override;
     bool created() const override;
@@ -41,8 +120,21 @@ public:
 
     bool canFuse(const MKLDNNNodePtr& node) const override;
 
+    size_t getWeightsBytes() override;
+
     static bool isSupportedOperation(const std::shared_ptr<ngraph::Node>& op, std::string& errorMessage) noexcept;
 
+    /**
+     * Sets the minimal ratio of the zero blocks of weights to execute the layer with the sparse weights kernel.
+     * 0 disables the sparse execution.
+     */
+    void setSparseWeightsThreshold(float threshold) {
+        sparseWeightsThreshold = threshold;
+    }
+
+    // Number of the output channels in a block of the sparse weights, the blocks consisting of zeros only are skipped
+    static constexpr size_t sparseOCBlock = 16;
+
 protected:
     std::shared_ptr<mkldnn::primitive_attr> initPrimitiveAttr();
 
@@ -55,10 +147,49 @@ private:
 
     bool withBiases = false;
 
+    bool isJitKernelApplicable(mkldnn::memory::data_type inputDataType, bool compressed);
+    void createSparsePrimitive();
+    void executeSparse();
+    void createCompressedPrimitive();
+    void executeCompressed();
+
+    float sparseWeightsThreshold = 0.f;
+    // The layer is executed by the packed weights kernel, either because the weights are sparse enough to skip
+    // the zero blocks, or because the FP16/BF16 weights are kept compressed and the layer is too narrow for
+    // the compressed weights kernel
+    bool usePackedWeights = false;
+    bool useSparseWeights = false;
+    // The layer is executed by the compressed weights kernel reading the FP16/BF16 weights of the constant input,
+    // or the U4 weights packed by FullyConnectedLowBitWeightsFusion together with their scales and zero points
+    bool useCompressedWeights = false;
+    bool withLowBitWeights = false;
+    InferenceEngine::Precision sparseSrcPrc;
+    InferenceEngine::Precision sparseWeiPrc;
+    InferenceEngine::Precision sparseDstPrc;
+    // The packed weights hold the range of the non-zero blocks of each output channels block, the input channel offsets
+    // and the values of the blocks, and the bias padded to the blocks. All of them share one buffer of the weights cache.
+    MKLDNNMemoryPtr sparseWeightsMemory;
+    MKLDNNMemoryCPtr sparseRawWeights;
+    MKLDNNMemoryCPtr sparseRawBiases;
+    size_t sparseNnzBlocks = 0;
+    size_t sparseBiasOffset = 0;
+    size_t sparseValuesOffset = 0;
+    std::shared_ptr<jit_uni_sparse_fc_kernel> sparseKernel;
+    std::shared_ptr<jit_uni_sparse_fc_kernel> sparseTailKernel;
+
+    // Number of the output channels reduced to one vector by the compressed weights kernel
+    size_t compressedOCBlock = 0;
+    // The bias converted to FP32 and padded to the output channels blocks
+    std::vector<float> compressedBias;
+    std::shared_ptr<jit_uni_compressed_fc_kernel> compressedKernel;
+    std::shared_ptr<jit_uni_compressed_fc_kernel> compressedTailKernel;
+
     std::string errorPrefix;
     static const size_t DATA_ID = 0;
     static const size_t WEIGHTS_ID = 1;
     static const size_t BIAS_ID = 2;
+    static const size_t SCALES_ID = 3;
+    static const size_t ZERO_POINTS_ID = 4;
 };
 
 }  // namespace MKLDNNPlugin
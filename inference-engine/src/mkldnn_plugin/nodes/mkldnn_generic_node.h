@@ -17,6 +17,8 @@ namespace MKLDNNPlugin {
 class MKLDNNGenericNode : public MKLDNNNode {
 public:
     MKLDNNGenericNode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache);
+    // the extension implementations aren't guaranteed to be thread safe, so they can't be shared between the copies
+    MKLDNNGenericNode(const MKLDNNGenericNode&) = delete;
     ~MKLDNNGenericNode() = default;
 
     void getSupportedDescriptors() override;
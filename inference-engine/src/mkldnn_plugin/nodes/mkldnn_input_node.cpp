@@ -241,11 +241,10 @@ MKLDNNInputNode::MKLDNNInputNode(const std::shared_ptr<ngraph::Node>& op, const
     constOp = ngraph::as_type_ptr<ngraph::op::Constant>(op);
     if (constOp) {
         constant = ConstantType::Const;
-        cloneBlobIfRequired();
      }
 }
 
-void MKLDNNInputNode::cloneBlobIfRequired() {
+void MKLDNNInputNode::cloneBlobIfRequired() const {
     MKLDNNDims dims(constOp->get_shape().empty() ? ngraph::Shape(1, 1) : constOp->get_shape());
     const auto prec = convertPrecision(constOp->get_element_type());
     const size_t size = dims.size();
@@ -255,8 +254,7 @@ void MKLDNNInputNode::cloneBlobIfRequired() {
         MKLDNNMemory memory{ getEngine() };
         memory.Create(memDesc, constOp->get_data_ptr());
 
-        MKLDNNMemoryPtr ptr = MKLDNNMemoryPtr(new MKLDNNMemory(getEngine()));
-        ptr->Create(memDesc);
+        MKLDNNMemoryPtr ptr = createMemory(memDesc);
         ptr->SetData(memory);
 
         return ptr;
@@ -330,11 +328,9 @@ void MKLDNNInputNode::cloneBlobIfRequired() {
     };
 
     auto blobKey = [&, this] () {
-        char ptr[32];
-        snprintf(ptr, sizeof ptr, "%p", constOp->get_data_ptr());
         return getName()
                 + "_" + std::to_string(size * prec.size())
-                + "_" + ptr;
+                + "_" + std::to_string(getDataId());
     };
 
     if (weightCache) {
@@ -366,7 +362,23 @@ void MKLDNNInputNode::withMeanImage() {
     isMeanImage = true;
 }
 
+uint64_t MKLDNNInputNode::getDataId() const {
+    // the constants of the graphs compiled for other input shapes may be placed at the address of the already released
+    // ones, so they are identified by the values, which are hashed only in this case, since it reads the whole data
+    if (!isKeyedByValues)
+        return constOp ? reinterpret_cast<uint64_t>(constOp->get_data_ptr()) : 0;
+    if (constOp && !isDataHashed) {
+        const size_t byteSize = (ngraph::shape_size(constOp->get_shape()) * constOp->get_element_type().bitwidth() + 7) / 8;
+        dataHash = MKLDNNWeightsSharing::GetHashFunc().hash(static_cast<const unsigned char*>(constOp->get_data_ptr()), byteSize);
+        isDataHashed = true;
+    }
+    return dataHash;
+}
+
 MKLDNNMemoryCPtr MKLDNNInputNode::getMemoryPtr() const {
+    // the node is created before the graph sets the memory arena, so the constant data is cloned on the first access
+    if (constOp && !memoryPtr)
+        cloneBlobIfRequired();
     return memoryPtr;
 }
 
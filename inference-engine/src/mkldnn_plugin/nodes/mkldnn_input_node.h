@@ -21,18 +21,50 @@ public:
     void initSupportedPrimitiveDescriptors() override;
     void createPrimitive() override;
     bool created() const override;
+    // the node is also inserted into the graph without the factory, so the copy is made here
+    MKLDNNNodePtr clone() const override {
+        return std::make_shared<MKLDNNInputNode>(*this);
+    }
 
     void withMeanImage();
     MKLDNNMemoryCPtr getMemoryPtr() const;
+    /**
+     * @brief Identifies the constant data among the constants of the same name and size: by the hash of the values
+     * if the constants are shared with the graphs of other input shapes, otherwise by the data address
+     */
+    uint64_t getDataId() const;
+    void setKeyedByValues(bool keyedByValues) {
+        isKeyedByValues = keyedByValues;
+    }
+
+    /**
+     * @brief Counters of inferences which used the user blob in place of the input/output memory
+     * and which copied the blob to/from the memory
+     */
+    struct IOStatistics {
+        uint64_t zeroCopy = 0;
+        uint64_t copied = 0;
+    };
+
+    IOStatistics& getIOStatistics() {
+        return ioStatistics;
+    }
+    const IOStatistics& getIOStatistics() const {
+        return ioStatistics;
+    }
 
 private:
-    void cloneBlobIfRequired();
+    void cloneBlobIfRequired() const;
 
 private:
     std::shared_ptr<ngraph::op::Constant> constOp;
     InferenceEngine::Precision precision;
-    MKLDNNMemoryCPtr memoryPtr;
+    mutable MKLDNNMemoryCPtr memoryPtr;
+    mutable uint64_t dataHash = 0;
+    mutable bool isDataHashed = false;
     bool isMeanImage = false;
+    bool isKeyedByValues = false;
+    IOStatistics ioStatistics;
 };
 
 }  // namespace MKLDNNPlugin
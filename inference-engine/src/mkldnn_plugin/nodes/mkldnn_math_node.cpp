@@ -56,11 +56,13 @@ void MKLDNNMathNode::initSupportedPrimitiveDescriptors() {
 
     addSupportedPrimDesc(inDataConf,
                          {{TensorDescCreatorTypes::ncsp, Precision::FP32}},
-                         impl_desc_type::ref_any);
+                         impl_desc_type::ref_any, outDims[0].ndims() > 1);
 }
 
 void MKLDNNMathNode::execute(mkldnn::stream strm) {
     size_t dataSize = getChildEdgeAt(0)->getBlob()->size();
+    if (batchToProcess() < getMaxBatch())
+        dataSize = dataSize / getMaxBatch() * batchToProcess();
     const float *src_data = reinterpret_cast<const float *>(getParentEdgeAt(0)->getMemoryPtr()->GetPtr());
     float* dst_data = reinterpret_cast<float *>(getChildEdgeAt(0)->getMemoryPtr()->GetPtr());
 
@@ -8,6 +8,7 @@
 #include "mkldnn_memory_node.hpp"
 #include "common/cpu_memcpy.h"
 #include "utils/general_utils.h"
+#include "utils/cpu_utils.hpp"
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
@@ -74,7 +75,7 @@ void MKLDNNMemoryOutputNode::execute(mkldnn::stream strm)  {
 
     auto inputMemoryNode = dynamic_cast<MKLDNNMemoryInputNode*>(inputNode);
     IE_ASSERT(inputMemoryNode != nullptr);
-    inputMemoryNode->storeState(srcMemory);
+    inputMemoryNode->storeState(srcMemory, batchToProcess());
 }
 
 bool MKLDNNMemoryInputNode::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
@@ -117,9 +118,10 @@ void MKLDNNMemoryInputNode::createPrimitive() {
  * As is. Assume that data is dense tensor with same layout.
  * @param dst destination memory object
  * @param src source memory object
+ * @param batch number of the first batch items to copy, the whole tensor is copied if the batch isn't the outermost dimension
  */
 inline
-static void simple_copy(MKLDNNMemory& dst, const MKLDNNMemory& src) {
+static void simple_copy(MKLDNNMemory& dst, const MKLDNNMemory& src, int batch) {
     auto srcPtr = static_cast<uint8_t*>(src.GetPtr());
     auto dstPtr = static_cast<uint8_t*>(dst.GetPtr());
     auto srcSizeInByte = src.GetSize();
@@ -127,6 +129,10 @@ static void simple_copy(MKLDNNMemory& dst, const MKLDNNMemory& src) {
 
     IE_ASSERT(srcSizeInByte == dstSizeInByte) << "Memory objects are not compatible. Has different sizes.";
 
+    const auto& dims = src.GetDims();
+    if (batch > 0 && isBatchOutermost(src.GetDesc()) && batch < dims[0])
+        srcSizeInByte = srcSizeInByte / dims[0] * batch;
+
     cpu_memcpy(dstPtr, srcPtr, srcSizeInByte);
 }
 
@@ -138,11 +144,11 @@ MKLDNNMemoryPtr MKLDNNMemoryInputNode::getStore() {
     return dataStore;
 }
 
-void MKLDNNMemoryInputNode::storeState(const MKLDNNMemory &new_state) {
+void MKLDNNMemoryInputNode::storeState(const MKLDNNMemory &new_state, int batch) {
     // TODO: Should be next one call:
     //           dataStore.SetData(new_state, false);
     //       But because of performance reason we use simple manual copy
-    simple_copy(*dataStore, new_state);
+    simple_copy(*dataStore, new_state, batch);
 }
 
 void MKLDNNMemoryInputNode::execute(mkldnn::stream strm) {
@@ -150,7 +156,7 @@ void MKLDNNMemoryInputNode::execute(mkldnn::stream strm) {
     // TODO: Should be simple call of:
     //           dst_mem.SetData(dataStore, false);
     //       But because of performance reason we use simple manual copy
-    simple_copy(dst_mem, *dataStore);
+    simple_copy(dst_mem, *dataStore, batchToProcess());
 }
 
 MKLDNNMemoryNodeVirtualEdge::Holder* MKLDNNMemoryNodeVirtualEdge::registerInput(MKLDNNMemoryInputNode * node) {
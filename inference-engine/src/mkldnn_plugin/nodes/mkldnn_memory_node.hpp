@@ -58,6 +58,8 @@ class MKLDNNMemoryNodeVirtualEdge {
 class MKLDNNMemoryOutputNode : public MKLDNNNode, public MKLDNNMemoryNode {
  public:
     MKLDNNMemoryOutputNode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache);
+    // the node is registered in the holder of the memory nodes by its id
+    MKLDNNMemoryOutputNode(const MKLDNNMemoryOutputNode&) = delete;
     ~MKLDNNMemoryOutputNode() override;
     static bool isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept;
     void getSupportedDescriptors() override;
@@ -83,6 +85,8 @@ class MKLDNNMemoryOutputNode : public MKLDNNNode, public MKLDNNMemoryNode {
 class MKLDNNMemoryInputNode : public MKLDNNInputNode, public MKLDNNMemoryNode {
 public:
     MKLDNNMemoryInputNode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache);
+    // the node is registered in the holder of the memory nodes by its id
+    MKLDNNMemoryInputNode(const MKLDNNMemoryInputNode&) = delete;
     ~MKLDNNMemoryInputNode() override;
 
     static bool isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept;
@@ -94,7 +98,10 @@ public:
     void createPrimitive() override;
 
     void setInputNode(MKLDNNNode* node) override {}
-    void storeState(const MKLDNNMemory& mem);
+    /**
+     * @brief Stores the first batch items of the memory into the state, the state of the rest items is kept
+     */
+    void storeState(const MKLDNNMemory& mem, int batch);
     MKLDNNMemoryPtr getStore();
  private:
     MKLDNNMemoryPtr dataStore;
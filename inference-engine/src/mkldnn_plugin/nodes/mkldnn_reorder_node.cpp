@@ -193,7 +193,7 @@ void MKLDNNReorderNode::optimizedNcsp2Nspc() {
     auto parentEdge = getParentEdgeAt(0);
     auto childEdge = getChildEdgeAt(0);
     const int ndims = parentEdge->getDims().ndims();
-    const size_t DIM0 = parentEdge->getDims()[0];
+    const size_t DIM0 = batchToProcess();
     const size_t DIM1 = parentEdge->getDims()[1];
     const size_t DIM2 = ndims == 5 ? parentEdge->getDims()[ndims - 3] : 1;
     const size_t DIM3 = parentEdge->getDims()[ndims - 2];
@@ -222,7 +222,7 @@ void MKLDNNReorderNode::optimizedNspc2Ncsp() {
     auto parentEdge = getParentEdgeAt(0);
     auto childEdge = getChildEdgeAt(0);
     const int ndims = parentEdge->getDims().ndims();
-    const size_t DIM0 = parentEdge->getDims()[0];
+    const size_t DIM0 = batchToProcess();
     const size_t DIM1 = parentEdge->getDims()[1];
     const size_t DIM2 = ndims == 5 ? parentEdge->getDims()[ndims - 3] : 1;
     const size_t DIM3 = parentEdge->getDims()[ndims - 2];
@@ -261,8 +261,10 @@ void MKLDNNReorderNode::execute(mkldnn::stream strm) {
 }
 
 void MKLDNNReorderNode::setDynamicBatchLim(int lim) {
+    const int prevBatch = batchToProcess();
     dynBatchLim = lim;
-    if (prim) {
+    // the primitive is recreated only if the processed batch is changed
+    if (prim && batchToProcess() != prevBatch) {
         auto &dstMemPtr = getChildEdgeAt(0)->getMemoryPtr();
         auto &srcMemPtr = getParentEdgeAt(0)->getMemoryPtr();
         memory::desc src_d = srcMemPtr->GetDescriptor();
@@ -23,6 +23,10 @@ public:
     void execute(mkldnn::stream strm) override;
     bool created() const override;
     const std::vector<impl_desc_type>& getPrimitivesPriority() override;
+    // the node is also inserted into the graph without the factory, so the copy is made here
+    MKLDNNNodePtr clone() const override {
+        return std::make_shared<MKLDNNReorderNode>(*this);
+    }
 
     void setDescs(const InferenceEngine::TensorDesc& input, const InferenceEngine::TensorDesc& output) {
         this->input = input;
@@ -33,6 +37,10 @@ public:
         this->isOptimized = isOptimized;
     }
 
+    bool getOptimized() const {
+        return isOptimized;
+    }
+
     void setDynamicBatchLim(int lim) override;
 
     bool canBeInPlace() const override {
@@ -33,7 +33,7 @@ private:
     size_t group_;
     size_t groupSize_;
 
-    std::unique_ptr<PermuteKernel> permuteKernel_;
+    std::shared_ptr<PermuteKernel> permuteKernel_;
     bool supportDynamicBatch_;
 };
 
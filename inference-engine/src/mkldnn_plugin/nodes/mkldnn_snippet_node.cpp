@@ -0,0 +1,276 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_snippet_node.h"
+
+#include <ie_parallel.hpp>
+#include <ngraph/opsets/opset1.hpp>
+
+#include "emitters/cpu_generator.hpp"
+#include "emitters/jit_snippets_emitters.hpp"
+#include "utils/general_utils.h"
+
+#include <algorithm>
+#include <numeric>
+
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+using namespace mkldnn::impl::cpu::x64;
+
+namespace {
+
+// the innermost dim is not split into the chunks smaller than that to amortize the kernel call
+constexpr size_t minInnermostChunk = 256;
+// the chunks are aligned to the vector length of any supported isa, so only the last chunk has a scalar tail
+constexpr size_t innermostChunkAlignment = 16;
+
+}  // namespace
+
+bool MKLDNNSnippetNode::isSupportedOperation(const std::shared_ptr<ngraph::Node>& op, std::string& errorMessage) noexcept {
+    try {
+        if (!ngraph::as_type_ptr<ngraph::snippets::op::Subgraph>(op)) {
+            errorMessage = "Only snippets Subgraph operation is supported";
+            return false;
+        }
+        if (!mayiuse(avx2)) {
+            errorMessage = "Snippets code generation requires AVX2 support";
+            return false;
+        }
+        if (op->get_input_size() + op->get_output_size() > SNIPPETS_MAX_SNIPPETS_ARGS) {
+            errorMessage = "Doesn't support more than " + std::to_string(SNIPPETS_MAX_SNIPPETS_ARGS) + " inputs and outputs in total";
+            return false;
+        }
+        if (op->is_dynamic()) {
+            errorMessage = "Doesn't support dynamic shapes";
+            return false;
+        }
+        for (const auto& input : op->inputs()) {
+            if (input.get_element_type() != ngraph::element::f32) {
+                errorMessage = "Doesn't support inputs of " + input.get_element_type().get_type_name() + " precision";
+                return false;
+            }
+        }
+        const auto& domain = op->get_output_shape(0);
+        for (const auto& output : op->outputs()) {
+            if (output.get_element_type() != ngraph::element::f32) {
+                errorMessage = "Doesn't support outputs of " + output.get_element_type().get_type_name() + " precision";
+                return false;
+            }
+            // every kernel call processes the same range of all the outputs
+            if (output.get_shape() != domain) {
+                errorMessage = "Doesn't support outputs of different shapes";
+                return false;
+            }
+        }
+        for (const auto& input : op->inputs()) {
+            const auto& shape = input.get_shape();
+            if (shape.size() > domain.size()) {
+                errorMessage = "Doesn't support inputs of higher rank than outputs";
+                return false;
+            }
+            const size_t offset = domain.size() - shape.size();
+            for (size_t i = 0; i < shape.size(); i++) {
+                if (shape[i] != 1 && shape[i] != domain[offset + i]) {
+                    errorMessage = "Doesn't support inputs which are not broadcasted to the outputs";
+                    return false;
+                }
+            }
+        }
+    } catch (...) {
+        return false;
+    }
+    return true;
+}
+
+MKLDNNSnippetNode::MKLDNNSnippetNode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache)
+        : MKLDNNNode(op, eng, cache) {
+    std::string errorMessage;
+    if (!isSupportedOperation(op, errorMessage)) {
+        IE_THROW(NotImplemented) << errorMessage;
+    }
+    errorPrefix = "Snippet node with name '" + getName() + "'";
+
+    host_isa = mayiuse(avx512_common) ? avx512_common : avx2;
+
+    // the copy is created with its own parameters, so the transformations of the body don't touch the original graph
+    const auto original = ngraph::as_type_ptr<ngraph::snippets::op::Subgraph>(op);
+    ngraph::OutputVector inputs;
+    for (const auto& input : original->inputs()) {
+        inputs.push_back(std::make_shared<ngraph::opset1::Parameter>(input.get_element_type(), input.get_shape()));
+    }
+    snippet = std::make_shared<ngraph::snippets::op::Subgraph>(inputs, ngraph::clone_function(*original->get_body()));
+    snippet->set_friendly_name(original->get_friendly_name());
+
+    auto generator = std::make_shared<CPUGenerator>(host_isa);
+    for (const auto& n : snippet->get_body()->get_ops()) {
+        // constants are turned into scalars during code generation
+        if (ngraph::is_type<ngraph::opset1::Constant>(n))
+            continue;
+        if (!generator->get_target_machine()->has(n->get_type_info())) {
+            IE_THROW(NotImplemented) << "Snippets don't have CPU code emitter for " << n->get_type_name() << " operation";
+        }
+    }
+    snippet->set_generator(generator);
+}
+
+void MKLDNNSnippetNode::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    const auto implType = mayiuse(avx512_common) ? impl_desc_type::jit_avx512 : impl_desc_type::jit_avx2;
+    auto addDesc = [&](TensorDescCreatorTypes type) {
+        std::vector<DataConfigurator> inDataConf(getOriginalInputsNumber(), {type, Precision::FP32});
+        std::vector<DataConfigurator> outDataConf(getOriginalOutputsNumber(), {type, Precision::FP32});
+        addSupportedPrimDesc(inDataConf, outDataConf, implType);
+    };
+
+    addDesc(TensorDescCreatorTypes::ncsp);
+
+    // the channels last layout is the same permutation for all the tensors only if their ranks are equal
+    const size_t rank = getChildEdgeAt(0)->getDims().ndims();
+    bool isChannelsLastApplicable = one_of(rank, 4, 5);
+    for (size_t i = 0; i < getParentEdges().size(); i++) {
+        isChannelsLastApplicable = isChannelsLastApplicable && getParentEdgeAt(i)->getDims().ndims() == rank;
+    }
+    if (isChannelsLastApplicable)
+        addDesc(TensorDescCreatorTypes::nspc);
+}
+
+void MKLDNNSnippetNode::selectOptimalPrimitiveDescriptor() {
+    selectPreferPrimitiveDescriptor(getPrimitivesPriority(), true);
+}
+
+void MKLDNNSnippetNode::createPrimitive() {
+    auto selectedPD = getSelectedPrimitiveDescriptor();
+    if (selectedPD == nullptr)
+        IE_THROW() << errorPrefix << " has unidentified preferable primitive descriptor";
+
+    const auto& config = selectedPD->getConfig();
+    const auto& order = config.outConfs[0].desc.getBlockingDesc().getOrder();
+    const size_t outRank = order.size();
+    // canonicalization of the snippet expects at least 4D tensors
+    const size_t rank = std::max<size_t>(outRank, 4);
+
+    // the shapes are padded with leading ones to the common rank and permuted to the physical order of the dims,
+    // so the innermost dim of every shape is the dense one
+    auto getPhysicalShape = [&](const SizeVector& dims) {
+        SizeVector shape(rank - dims.size(), 1);
+        if (dims.size() == outRank) {
+            for (auto axis : order)
+                shape.push_back(dims[axis]);
+        } else {
+            shape.insert(shape.end(), dims.begin(), dims.end());
+        }
+        return shape;
+    };
+
+    ngraph::AxisVector axes(rank);
+    std::iota(axes.begin(), axes.end(), 0);
+
+    std::vector<SizeVector> dims;
+    ngraph::snippets::op::Subgraph::BlockedShapeVector inputShapes, outputShapes;
+    for (size_t i = 0; i < getParentEdges().size(); i++) {
+        dims.push_back(getPhysicalShape(getParentEdgeAt(i)->getDims().ToSizeVector()));
+        inputShapes.emplace_back(ngraph::Shape(dims.back()), axes, ngraph::element::f32);
+    }
+    for (size_t i = 0; i < getOriginalOutputsNumber(); i++) {
+        dims.push_back(getPhysicalShape(getChildEdgesAtPort(i)[0]->getDims().ToSizeVector()));
+        outputShapes.emplace_back(ngraph::Shape(dims.back()), axes, ngraph::element::f32);
+    }
+
+    schedule = snippet->generate(outputShapes, inputShapes);
+
+    // The trailing dims are collapsed while every tensor is either dense or broadcasted in both of them, since the
+    // emitters generated for the innermost dim being dense or broadcasted stay valid for the collapsed one.
+    domain = dims.back();
+    while (domain.size() > 1 && domain.back() != 1) {
+        const size_t last = domain.size() - 1;
+        const bool canCollapse = std::all_of(dims.begin(), dims.end(), [&](const SizeVector& d) {
+            return (d[last] == domain[last] && d[last - 1] == domain[last - 1]) || (d[last] == 1 && d[last - 1] == 1);
+        });
+        if (!canCollapse)
+            break;
+
+        for (auto& d : dims) {
+            d[last - 1] *= d[last];
+            d.pop_back();
+        }
+        domain[last - 1] *= domain[last];
+        domain.pop_back();
+    }
+
+    strides.resize(dims.size());
+    for (size_t t = 0; t < dims.size(); t++) {
+        strides[t].assign(domain.size(), 0);
+        size_t stride = 1;
+        for (int d = static_cast<int>(domain.size()) - 1; d >= 0; d--) {
+            strides[t][d] = dims[t][d] == domain[d] ? stride : 0;
+            stride *= dims[t][d];
+        }
+    }
+
+    const size_t innermost = domain.back();
+    outerWork = std::accumulate(domain.begin(), domain.end() - 1, size_t(1), std::multiplies<size_t>());
+
+    const size_t nthr = static_cast<size_t>(parallel_get_max_threads());
+    innermostChunk = innermost;
+    if (outerWork < nthr) {
+        const size_t chunk = rnd_up(div_up(innermost, div_up(nthr, outerWork)), innermostChunkAlignment);
+        innermostChunk = std::min(innermost, std::max(chunk, minInnermostChunk));
+    }
+    chunksNum = div_up(innermost, innermostChunk);
+}
+
+void MKLDNNSnippetNode::execute(mkldnn::stream strm) {
+    const size_t inputsNum = getParentEdges().size();
+    const size_t outputsNum = getOriginalOutputsNumber();
+
+    std::vector<const float*> srcPtrs(inputsNum);
+    std::vector<float*> dstPtrs(outputsNum);
+    for (size_t i = 0; i < inputsNum; i++)
+        srcPtrs[i] = reinterpret_cast<const float*>(getParentEdgeAt(i)->getMemoryPtr()->GetPtr());
+    for (size_t i = 0; i < outputsNum; i++)
+        dstPtrs[i] = reinterpret_cast<float*>(getChildEdgesAtPort(i)[0]->getMemoryPtr()->GetPtr());
+
+    using kernel = void (*)(const jit_snippets_call_args*);
+    const auto ker = schedule.get_callable<kernel>();
+
+    const size_t innermost = domain.back();
+    const size_t outerRank = domain.size() - 1;
+
+    parallel_nt(0, [&](const int ithr, const int nthr) {
+        size_t start = 0, end = 0;
+        splitter(outerWork * chunksNum, nthr, ithr, start, end);
+
+        jit_snippets_call_args args;
+        std::vector<size_t> offsets(inputsNum + outputsNum);
+        for (size_t iwork = start; iwork < end; iwork++) {
+            const size_t innermostStart = (iwork % chunksNum) * innermostChunk;
+            for (size_t t = 0; t < offsets.size(); t++)
+                offsets[t] = innermostStart * strides[t][outerRank];
+
+            size_t outer = iwork / chunksNum;
+            for (int d = static_cast<int>(outerRank) - 1; d >= 0; d--) {
+                const size_t idx = outer % domain[d];
+                outer /= domain[d];
+                for (size_t t = 0; t < offsets.size(); t++)
+                    offsets[t] += idx * strides[t][d];
+            }
+
+            for (size_t i = 0; i < inputsNum; i++)
+                args.src_ptrs[i] = srcPtrs[i] + offsets[i];
+            for (size_t i = 0; i < outputsNum; i++)
+                args.dst_ptrs[i] = dstPtrs[i] + offsets[inputsNum + i];
+            args.work_amount = std::min(innermostChunk, innermost - innermostStart);
+
+            ker(&args);
+        }
+    });
+}
+
+bool MKLDNNSnippetNode::created() const {
+    return getType() == Subgraph;
+}
+
+REG_MKLDNN_PRIM_FOR(MKLDNNSnippetNode, Subgraph);
@@ -0,0 +1,55 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_common.h>
+#include <mkldnn_node.h>
+#include <cpu/x64/cpu_isa_traits.hpp>
+
+#include <snippets/op/subgraph.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+/// MKLDNNSnippetNode runs an elementwise subgraph collapsed by the snippets tokenization as a single jit kernel
+/// which is generated by the snippets code generator for the CPU target machine.
+class MKLDNNSnippetNode : public MKLDNNNode {
+public:
+    MKLDNNSnippetNode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache);
+    // the code generation transforms the body of the snippet, so it can't be shared between the copies of the node
+    MKLDNNSnippetNode(const MKLDNNSnippetNode&) = delete;
+    ~MKLDNNSnippetNode() override = default;
+
+    void getSupportedDescriptors() override {};
+    void initSupportedPrimitiveDescriptors() override;
+    void selectOptimalPrimitiveDescriptor() override;
+    void createPrimitive() override;
+    void execute(mkldnn::stream strm) override;
+    bool created() const override;
+
+    static bool isSupportedOperation(const std::shared_ptr<ngraph::Node>& op, std::string& errorMessage) noexcept;
+
+private:
+    // the code generation transforms the body, so the node owns a copy of the original snippet
+    std::shared_ptr<ngraph::snippets::op::Subgraph> snippet;
+    mkldnn::impl::cpu::x64::cpu_isa_t host_isa;
+    ngraph::snippets::Schedule schedule;
+
+    // dims of the outputs after the trailing dims are collapsed, the kernel processes the innermost one
+    std::vector<size_t> domain;
+    // element strides of the inputs followed by the outputs for every dim of the domain, 0 for the broadcasted dims
+    std::vector<std::vector<size_t>> strides;
+    // the innermost dim is split into chunks if there is not enough outer work for all the threads
+    size_t innermostChunk = 0;
+    size_t chunksNum = 0;
+    size_t outerWork = 0;
+
+    std::string errorPrefix;
+};
+
+}  // namespace MKLDNNPlugin
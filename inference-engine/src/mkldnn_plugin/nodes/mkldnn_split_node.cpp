@@ -290,10 +290,10 @@ void MKLDNNSplitNode::execute(mkldnn::stream strm) {
     uint8_t* srcData = reinterpret_cast<uint8_t*>(this->getParentEdgeAt(0)->getMemoryPtr()->GetPtr());
     size_t batch = this->getParentEdgeAt(0)->getDims()[0];
 
-    if (batch != MB)
-        optimizedParams.countStrides = optimizedParams.countStrides / batch * MB;
+    // the strides of the whole batch are kept for the next inferences
+    const size_t countStrides = optimizedParams.countStrides / batch * MB;
 
-    parallel_for2d(dstMemPtrs.size(), optimizedParams.countStrides, [&](size_t i, size_t j) {
+    parallel_for2d(dstMemPtrs.size(), countStrides, [&](size_t i, size_t j) {
         uint8_t* dstData = dstMemPtrs[i];
 
         cpu_memcpy(&dstData[j * optimizedParams.dataSize[i]],
@@ -58,6 +58,8 @@ protected:
 class MKLDNNTensorIteratorNode : public MKLDNNNode {
 public:
     MKLDNNTensorIteratorNode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache);
+    // the body graph can't be shared between the copies of the node
+    MKLDNNTensorIteratorNode(const MKLDNNTensorIteratorNode&) = delete;
 
     static bool isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept;
     void initSupportedPrimitiveDescriptors() override;
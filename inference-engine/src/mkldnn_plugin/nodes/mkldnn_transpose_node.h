@@ -46,7 +46,7 @@ private:
             std::vector<size_t>{0, 5, 1, 2, 3, 4},
     };
 
-    std::unique_ptr<PermuteKernel> permuteKernel;
+    std::shared_ptr<PermuteKernel> permuteKernel;
 
     struct TransposeContext {
         MKLDNNTransposeNode* nodePtr;
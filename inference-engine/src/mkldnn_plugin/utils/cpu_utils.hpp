@@ -54,6 +54,18 @@ inline bool isEmptyTensorDesc(const InferenceEngine::TensorDesc &td) {
     return std::any_of(dims.begin(), dims.end(), [](size_t dim) { return dim == 0; } );
 }
 
+/**
+* @brief Checks that the batch is the outermost not blocked dimension of the tensor, so the first items of the batch
+* are placed in the beginning of the tensor memory
+* @param td
+* tensor descriptor to check
+* @return true if the first items of the batch can be processed separately, false otherwise.
+*/
+inline bool isBatchOutermost(const InferenceEngine::TensorDesc &td) {
+    const auto& order = td.getBlockingDesc().getOrder();
+    return !td.getDims().empty() && !order.empty() && order[0] == 0 && std::count(order.begin(), order.end(), 0) == 1;
+}
+
 /**
 * @brief Return precision to which given precision must be converted to be supported in plug-in
 * @param precision
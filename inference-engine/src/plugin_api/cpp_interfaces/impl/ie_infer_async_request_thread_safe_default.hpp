@@ -288,7 +288,7 @@ protected:
                        const ITaskExecutor::Ptr callbackExecutor = {}) {
         auto& firstStageExecutor = std::get<Stage_e::executor>(*itBeginStage);
         IE_ASSERT(nullptr != firstStageExecutor);
-        firstStageExecutor->run(MakeNextStageTask(itBeginStage, itEndStage, std::move(callbackExecutor)));
+        RunStage(firstStageExecutor, MakeNextStageTask(itBeginStage, itEndStage, std::move(callbackExecutor)));
     }
 
     /**
@@ -323,6 +323,7 @@ protected:
     ITaskExecutor::Ptr _syncCallbackExecutor;  //!< Used to run post inference callback in synchronous pipline
     Pipeline _pipeline;  //!< Pipeline variable that should be filled by inherited class.
     Pipeline _syncPipeline;  //!< Synchronous pipeline variable that should be filled by inherited class.
+    IStreamsExecutor::TaskPriority _priority = IStreamsExecutor::TaskPriority::NORMAL;  //!< Priority of the stages run by IStreamsExecutor
 
     /**
      * @brief Starts an asynchronous pipeline thread unsafe.
@@ -348,6 +349,20 @@ protected:
     }
 
 private:
+    /**
+     * @brief Runs the stage task with AsyncInferRequestThreadSafeDefault::_priority if the stage executor is IStreamsExecutor
+     * @param[in]  executor The stage executor
+     * @param[in]  task The stage task
+     */
+    void RunStage(const ITaskExecutor::Ptr& executor, Task task) {
+        auto streamsExecutor = dynamic_cast<IStreamsExecutor*>(executor.get());
+        if (nullptr != streamsExecutor) {
+            streamsExecutor->RunWithPriority(std::move(task), _priority);
+        } else {
+            executor->run(std::move(task));
+        }
+    }
+
     /**
      * @brief Create a task with next pipeline stage.
      * Each call to MakeNextStageTask() generates @ref Task objects for each stage.
@@ -374,7 +389,7 @@ private:
                     auto& nextStage = *itNextStage;
                     auto& nextStageExecutor = std::get<Stage_e::executor>(nextStage);
                     IE_ASSERT(nullptr != nextStageExecutor);
-                    nextStageExecutor->run(MakeNextStageTask(itNextStage, itEndStage, std::move(callbackExecutor)));
+                    RunStage(nextStageExecutor, MakeNextStageTask(itNextStage, itEndStage, std::move(callbackExecutor)));
                 }
             } catch (...) {
                 currentException = std::current_exception();
@@ -9,6 +9,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
 #include <string>
 
@@ -21,6 +22,10 @@ namespace InferenceEngine {
  * @brief CPU Streams executor implementation. The executor splits the CPU into groups of threads,
  *        that can be pinned to cores or NUMA nodes.
  *        It uses custom threads to pull tasks from single queue.
+ *        The @ref IStreamsExecutor::HIGH priority tasks are pulled from a separate queue before the normal ones,
+ *        additionally they are run by the Config::_highPriorityStreams streams, which are bound to the same cores as
+ *        the first normal streams. The normal priority tasks on those streams are paused at YieldToHighPriority()
+ *        calls while high priority tasks are queued or running.
  */
 class INFERENCE_ENGINE_API_CLASS(CPUStreamsExecutor) : public IStreamsExecutor {
 public:
@@ -29,6 +34,15 @@ public:
      */
     using Ptr = std::shared_ptr<CPUStreamsExecutor>;
 
+    /**
+     * @brief Latency of the tasks passed to RunWithPriority() and run by the stream threads, from submission to completion
+     */
+    struct LatencyStatistics {
+        std::uint64_t tasks = 0;  //!< Number of completed tasks
+        double latencySum = 0.0;  //!< Sum of the latencies in milliseconds
+        double maxLatency = 0.0;  //!< Maximal latency in milliseconds
+    };
+
     /**
     * @brief Constructor
     * @param config Stream executor parameters
@@ -48,6 +62,17 @@ public:
 
     int GetNumaNodeId() override;
 
+    void RunWithPriority(Task task, TaskPriority priority) override;
+
+    void YieldToHighPriority() override;
+
+    /**
+     * @brief Returns the latency statistics of the tasks with the given priority
+     * @param priority The task priority
+     * @return The latency statistics
+     */
+    LatencyStatistics GetLatencyStatistics(TaskPriority priority) const;
+
 private:
     struct Impl;
     std::unique_ptr<Impl> _impl;
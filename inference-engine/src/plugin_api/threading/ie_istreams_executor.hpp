@@ -46,6 +46,14 @@ public:
         HYBRID_AWARE  //!< Let the runtime bind the inference threads depending on the cores type (default mode for the hybrid CPUs)
     };
 
+    /**
+     * @brief Defines the priority of a task run by the executor
+     */
+    enum TaskPriority : std::uint8_t {
+        NORMAL,  //!< Tasks are run in the order they are submitted
+        HIGH     //!< Tasks are run before the normal ones and may pause them at the yield points
+    };
+
     /**
      * @brief Defines IStreamsExecutor configuration
      */
@@ -93,6 +101,7 @@ public:
             BIG,
             ROUND_ROBIN // used w/multiple streams to populate the Big cores first, then the Little, then wrap around (for large #streams)
         }                  _threadPreferredCoreType = PreferredCoreType::ANY; //!< In case of @ref HYBRID_AWARE hints the TBB to affinitize
+        int                _highPriorityStreams     = 0;  //!< Number of additional streams which run only @ref HIGH priority tasks
 
         /**
          * @brief      A constructor with arguments
@@ -105,6 +114,7 @@ public:
          * @param[in]  threadBindingOffset  @copybrief Config::_threadBindingOffset
          * @param[in]  threads              @copybrief Config::_threads
          * @param[in]  threadPreferBigCores @copybrief Config::_threadPreferBigCores
+         * @param[in]  highPriorityStreams  @copybrief Config::_highPriorityStreams
          */
         Config(
             std::string        name                    = "StreamsExecutor",
@@ -114,14 +124,16 @@ public:
             int                threadBindingStep       = 1,
             int                threadBindingOffset     = 0,
             int                threads                 = 0,
-            PreferredCoreType  threadPreferredCoreType = PreferredCoreType::ANY) :
+            PreferredCoreType  threadPreferredCoreType = PreferredCoreType::ANY,
+            int                highPriorityStreams     = 0) :
         _name{name},
         _streams{streams},
         _threadsPerStream{threadsPerStream},
         _threadBindingType{threadBindingType},
         _threadBindingStep{threadBindingStep},
         _threadBindingOffset{threadBindingOffset},
-        _threads{threads}, _threadPreferredCoreType(threadPreferredCoreType){
+        _threads{threads}, _threadPreferredCoreType(threadPreferredCoreType),
+        _highPriorityStreams{highPriorityStreams} {
         }
     };
 
@@ -147,6 +159,19 @@ public:
     * @param task A task to start
     */
     virtual void Execute(Task task) = 0;
+
+    /**
+    * @brief Execute the task with the given priority. By default the priority is ignored and the task is passed to run()
+    * @param task A task to start
+    * @param priority The task priority
+    */
+    virtual void RunWithPriority(Task task, TaskPriority priority);
+
+    /**
+    * @brief A yield point of a long running task. Pauses the current @ref NORMAL priority task while @ref HIGH
+    *        priority tasks are run on the hardware resources of the current stream. Does nothing by default
+    */
+    virtual void YieldToHighPriority();
 };
 
 
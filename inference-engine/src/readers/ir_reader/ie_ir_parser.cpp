@@ -7,6 +7,7 @@
 
 #include <algorithm>
 #include <deque>
+#include <exception>
 #include <map>
 #include <memory>
 #include <ngraph/ngraph.hpp>
@@ -31,6 +32,7 @@
 #include <ie_ngraph_utils.hpp>
 #include "blob_factory.hpp"
 #include "caseless.hpp"
+#include "ie_parallel.hpp"
 #include "precision_utils.h"
 
 using namespace XMLParseUtils;
@@ -205,11 +207,31 @@ private:
 
     V10Parser::GenericLayerParams parseGenericParams(const pugi::xml_node& node);
 
+    /// \brief Operation created and filled with attributes before its inputs are known
+    struct PreparedNode {
+        std::shared_ptr<ngraph::Node> node;
+        bool visited = false;  // result of visit_attributes
+        std::exception_ptr error;
+    };
+
+    /// \brief Checks that the operation can be created and its attributes can be read in parallel
+    /// with other layers: only built-in operations without bodies and variables are allowed.
+    bool canPrepareConcurrently(
+        const pugi::xml_node& node, const V10Parser::GenericLayerParams& params) const;
+
+    /// \brief Returns the name of the opset the operation is created from
+    std::string resolveOpsetName(const V10Parser::GenericLayerParams& params) const;
+
+    /// \brief Creates the operation without inputs and attributes
+    /// \return nullptr if the opset of the operation isn't registered
+    std::shared_ptr<ngraph::Node> createOperation(const V10Parser::GenericLayerParams& params) const;
+
     std::shared_ptr<ngraph::Node> createNode(
         const ngraph::OutputVector& inputs,
         const pugi::xml_node& node,
         const Blob::CPtr& weights,
-        const V10Parser::GenericLayerParams& params);
+        const V10Parser::GenericLayerParams& params,
+        PreparedNode* prepared = nullptr);
 
     // -- DATA --
     const pugi::xml_node node;
@@ -226,6 +248,12 @@ private:
     bool m_use_framework_node{false};
 };
 
+void rethrowFirstError(const std::vector<std::exception_ptr>& errors) {
+    for (const auto& error : errors) {
+        if (error) std::rethrow_exception(error);
+    }
+}
+
 XmlDeserializer::IoMap XmlDeserializer::updated_io_map(const pugi::xml_node& node) {
     auto body_node = node.child("body");
 
@@ -585,25 +613,49 @@ std::shared_ptr<ngraph::Function> XmlDeserializer::parse_function(
         V10Parser::GenericLayerParams params;
     };
 
-    std::map<size_t/*layer-id*/, node_params> params;
+    std::vector<pugi::xml_node> layers;
+    FOREACH_CHILD(node, root.child("layers"), "layer") {
+        layers.push_back(node);
+    }
+
+    // Read parameters of all layers, the layers are independent so it is done concurrently
+    std::vector<node_params> params(layers.size());
+    std::vector<std::exception_ptr> errors(layers.size());
+    parallel_for(layers.size(), [&](size_t i) {
+        try {
+            params[i] = {layers[i], parseGenericParams(layers[i])};
+        } catch (...) {
+            errors[i] = std::current_exception();
+        }
+    });
+    rethrowFirstError(errors);
 
+    std::unordered_map<size_t/*layer-id*/, size_t/*index in params*/> id_to_index;
+    id_to_index.reserve(params.size());
     std::vector<size_t/*layer-id*/> outputs;
     std::unordered_set<std::string> opName;
+    opName.reserve(params.size());
 
-    // Read all layers and store their parameters in params map
-    FOREACH_CHILD(node, root.child("layers"), "layer") {
-        auto node_param = parseGenericParams(node);
+    for (size_t i = 0; i < params.size(); i++) {
+        const auto& node_param = params[i].params;
         if (opName.find(node_param.name) != opName.end() && node_param.type != "Result")
             IE_THROW() << "Invalid IR! " << node_param.name << " name is not unique!";
         opName.insert(node_param.name);
-        params[node_param.layerId] = {node, node_param};
+        id_to_index[node_param.layerId] = i;
         if (node_param.type == "Result" || node_param.type == "Assign") {
             outputs.push_back(node_param.layerId);
         }
     }
 
-    std::map<size_t/*to-layer-id*/, std::vector<edge>> edges;
-    std::map<size_t, std::shared_ptr<ngraph::Node>> id_to_node;
+    const auto getIndex = [&](size_t id) {
+        auto it = id_to_index.find(id);
+        if (it == id_to_index.end())
+            IE_THROW() << "Invalid IR! Layer with id: " << id << " is not found!";
+        return it->second;
+    };
+
+    std::unordered_map<size_t/*to-layer-id*/, std::vector<edge>> edges;
+    edges.reserve(params.size());
 
     // Read all edges and store them for further usage
     FOREACH_CHILD(_ec, root.child("edges"), "edge") {
@@ -614,45 +666,88 @@ std::shared_ptr<ngraph::Function> XmlDeserializer::parse_function(
         edges[toLayer].push_back({fromLayer, fromPort, toPort});
     }
 
-    // Run DFS starting from outputs to get nodes topological order
-    std::set<size_t> used;
+    const std::vector<edge> no_edges;
+    const auto getEdges = [&](size_t id) -> const std::vector<edge>& {
+        auto it = edges.find(id);
+        return it == edges.end() ? no_edges : it->second;
+    };
+
+    // Run DFS starting from outputs to get nodes topological order. The DFS keeps its own stack of
+    // layers with the index of the next input edge, so deep graphs don't exhaust the thread stack.
+    std::unordered_set<size_t> used;
+    used.reserve(params.size());
     std::vector<size_t> order;
-    std::function<void(size_t)> dfs = [&edges, &order, &used, &dfs](const size_t id) {
-        if (used.count(id)) return;
-        used.insert(id);
-        for (auto& edge : edges[id]) {
-            dfs(edge.fromLayerId);
+    order.reserve(params.size());
+    std::vector<std::pair<size_t/*layer-id*/, size_t/*next edge*/>> stack;
+    for (const auto output : outputs) {
+        if (!used.insert(output).second) continue;
+        stack.emplace_back(output, 0);
+        while (!stack.empty()) {
+            const size_t id = stack.back().first;
+            const auto& in_edges = getEdges(id);
+            if (stack.back().second < in_edges.size()) {
+                const size_t from = in_edges[stack.back().second++].fromLayerId;
+                if (used.insert(from).second) stack.emplace_back(from, 0);
+            } else {
+                order.push_back(id);
+                stack.pop_back();
+            }
         }
-        order.push_back(id);
-    };
-    std::for_each(outputs.begin(), outputs.end(), dfs);
+    }
+
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "ParseNgraphAttributes");
+
+    // Create operations and read their attributes concurrently, the inputs are connected and
+    // the operations are validated in topological order below
+    std::vector<PreparedNode> prepared(params.size());
+    parallel_for(order.size(), [&](size_t i) {
+        auto it = id_to_index.find(order[i]);
+        if (it == id_to_index.end()) return;
+        auto& p = params[it->second];
+        if (!canPrepareConcurrently(p.xml, p.params)) return;
+        auto& prepared_node = prepared[it->second];
+        try {
+            prepared_node.node = createOperation(p.params);
+            if (prepared_node.node) {
+                XmlDeserializer visitor(p.xml, weights, opsets, variables);
+                prepared_node.visited = prepared_node.node->visit_attributes(visitor);
+            }
+        } catch (...) {
+            prepared_node.node.reset();
+            prepared_node.error = std::current_exception();
+        }
+    });
 
     OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "ConstructNgraphNodes");
 
     FunctionNodes func_nodes;
 
+    std::unordered_map<size_t, std::shared_ptr<ngraph::Node>> id_to_node;
+    id_to_node.reserve(order.size());
     std::map<std::string, std::shared_ptr<ngraph::Node>> variable_id_to_read_value;
 
     //  Following topological order create nGraph operations
     for (auto& layer_id : order) {
-        auto& p = params[layer_id];
-        ngraph::OutputVector inputs(edges[layer_id].size());
-        for (auto& e : edges[layer_id]) {
-            auto input_node = id_to_node[e.fromLayerId];
-            if (!input_node) {
+        const size_t index = getIndex(layer_id);
+        auto& p = params[index];
+        const auto& in_edges = getEdges(layer_id);
+        ngraph::OutputVector inputs(in_edges.size());
+        for (auto& e : in_edges) {
+            auto input_node_it = id_to_node.find(e.fromLayerId);
+            if (input_node_it == id_to_node.end() || !input_node_it->second) {
                 IE_THROW() << "Attempt to access node " << e.fromLayerId
                                    << " that not in graph.";
             }
-            auto& p_output = params[e.fromLayerId].params;
+            auto& p_output = params[getIndex(e.fromLayerId)].params;
             size_t const realInputPortId = p.params.getRealInputPortId(e.toPortId);
             if (realInputPortId >= inputs.size())
                 IE_THROW() << p.params.type << " layer " << p.params.name
                                    << " with id: " << p.params.layerId << " is inconsistent!";
             inputs[realInputPortId] =
-                input_node->output(p_output.getRealOutputPortId(e.fromPortId));
+                input_node_it->second->output(p_output.getRealOutputPortId(e.fromPortId));
         }
 
-        auto node = createNode(inputs, p.xml, weights, p.params);
+        auto node = createNode(inputs, p.xml, weights, p.params, &prepared[index]);
         id_to_node[layer_id] = node;
 
         // Check that output shape after nGraph node validation the same as in IR
@@ -772,11 +867,66 @@ V10Parser::V10Parser::GenericLayerParams XmlDeserializer::parseGenericParams(
     return params;
 }
 
+std::string XmlDeserializer::resolveOpsetName(const V10Parser::GenericLayerParams& params) const {
+    // Try to create operation from loaded opsets
+    static const std::unordered_set<std::string> experimental_ops_added_to_opset = {
+        "ExperimentalDetectronDetectionOutput",
+        "ExperimentalDetectronGenerateProposalsSingleImage",
+        "ExperimentalDetectronPriorGridGenerator",
+        "ExperimentalDetectronROIFeatureExtractor",
+        "ExperimentalDetectronTopKROIs",
+        "GRUCell",
+        "RNNCell",
+        "Proposal"};
+
+    if (experimental_ops_added_to_opset.count(params.type) &&
+        (params.version == "experimental" || params.version == "extension")) {
+        return "opset6";
+    }
+
+    // MVN, ROIPooling and ReorgYolo were missing in opset1
+    if (params.version == "opset1" &&
+        (params.type == "MVN" || params.type == "ROIPooling" || params.type == "ReorgYolo")) {
+        return "opset2";
+    }
+    return params.version;
+}
+
+bool XmlDeserializer::canPrepareConcurrently(
+    const pugi::xml_node& node, const V10Parser::GenericLayerParams& params) const {
+    // Extensions aren't required to be thread safe, sub-graphs parse their bodies recursively and
+    // ReadValue/Assign register the variables shared between layers
+    static const std::unordered_set<std::string> builtin_opsets = {
+        "opset1", "opset2", "opset3", "opset4", "opset5", "opset6", "opset7"};
+
+    return builtin_opsets.count(resolveOpsetName(params)) && !node.child("body") &&
+           !node.child("port_map") && params.type != "ReadValue" && params.type != "Assign";
+}
+
+std::shared_ptr<ngraph::Node> XmlDeserializer::createOperation(
+    const V10Parser::GenericLayerParams& params) const {
+    auto opsetIt = opsets.find(resolveOpsetName(params));
+    if (opsetIt == opsets.end()) return nullptr;
+
+    auto const& type = params.type == "Const" ? "Constant" : params.type;
+    auto ngraphNode = std::shared_ptr<ngraph::Node>(opsetIt->second.create_insensitive(type));
+    if (!ngraphNode) {
+        IE_THROW() << "Opset " << params.version
+                           << " doesn't contain the operation with type: " << type;
+    }
+    // Share Weights form constant blob
+    if (auto constant = std::dynamic_pointer_cast<ngraph::opset6::Constant>(ngraphNode)) {
+        constant->alloc_buffer_on_visit_attributes(false);
+    }
+    return ngraphNode;
+}
+
 std::shared_ptr<ngraph::Node> XmlDeserializer::createNode(
     const std::vector<ngraph::Output<ngraph::Node>>& inputs,
     const pugi::xml_node& node,
     const Blob::CPtr& weights,
-    const V10Parser::GenericLayerParams& params) {
+    const V10Parser::GenericLayerParams& params,
+    PreparedNode* prepared) {
     // Check that inputs are correctly defined
     for (size_t i = 0; i < inputs.size(); i++) {
         if (!inputs[i].get_node())
@@ -789,59 +939,29 @@ std::shared_ptr<ngraph::Node> XmlDeserializer::createNode(
                                << " has undefined element type for input with index " << i << "!";
     }
 
-    std::shared_ptr<ngraph::Node> ngraphNode;
-
-    // Find registered opset
-    auto opsetIt = opsets.find(params.version);
-
-    // Try to create operation from loaded opsets
-    static const std::unordered_set<std::string> experimental_ops_added_to_opset = {
-        "ExperimentalDetectronDetectionOutput",
-        "ExperimentalDetectronGenerateProposalsSingleImage",
-        "ExperimentalDetectronPriorGridGenerator",
-        "ExperimentalDetectronROIFeatureExtractor",
-        "ExperimentalDetectronTopKROIs",
-        "GRUCell",
-        "RNNCell",
-        "Proposal"};
-
-    if (experimental_ops_added_to_opset.count(params.type) &&
-        (params.version == "experimental" || params.version == "extension")) {
-        opsetIt = opsets.find("opset6");
+    if (prepared && prepared->error) {
+        std::rethrow_exception(prepared->error);
     }
 
-    if (!ngraphNode && opsetIt != opsets.end()) {
-        auto const& type = params.type == "Const" ? "Constant" : params.type;
-
-        if (params.version == "opset1") {
-            // MVN, ROIPooling and ReorgYolo were missing in opset1
-            if (type == "MVN" || type == "ROIPooling" || type == "ReorgYolo") {
-                opsetIt = opsets.find("opset2");
-                if (opsetIt == opsets.end()) {
-                    IE_THROW() << "Cannot create " << params.type << " layer "
-                                       << params.name << " id:" << params.layerId
-                                       << " from unsupported opset: " << params.version;
-                }
-            }
-        }
-
-        auto const& opset = opsetIt->second;
+    std::shared_ptr<ngraph::Node> ngraphNode;
 
-        ngraphNode = std::shared_ptr<ngraph::Node>(opset.create_insensitive(type));
-        if (!ngraphNode) {
-            IE_THROW() << "Opset " << params.version
-                               << " doesn't contain the operation with type: " << type;
-        }
-        // Share Weights form constant blob
-        if (auto constant = std::dynamic_pointer_cast<ngraph::opset6::Constant>(ngraphNode)) {
-            constant->alloc_buffer_on_visit_attributes(false);
+    if (prepared && prepared->node) {
+        // Attributes are already read, the validation needs the inputs
+        ngraphNode = prepared->node;
+        ngraphNode->set_arguments(inputs);
+        if (prepared->visited) {
+            ngraphNode->constructor_validate_and_infer_types();
         }
+        prepared->node.reset();
+    } else if ((ngraphNode = createOperation(params))) {
         ngraphNode->set_arguments(inputs);
         XmlDeserializer visitor(node, weights, opsets, variables);
         if (ngraphNode->visit_attributes(visitor)) {
             ngraphNode->constructor_validate_and_infer_types();
         }
+    }
 
+    if (ngraphNode) {
         // To be sure that all default values will be initialized:
         ngraphNode = ngraphNode->clone_with_new_inputs(ngraphNode->input_values());
     }
@@ -24,6 +24,8 @@ TRANSFORMATIONS_API auto getRegisters(std::shared_ptr<ngraph::Node>& n) -> ngrap
  */
 class TRANSFORMATIONS_API TargetMachine {
 public:
+    virtual ~TargetMachine() = default;
+
     /**
      * @brief checks if target is natively supported
      * @return true, if supported
@@ -118,6 +120,14 @@ public:
      */
     code generate(std::shared_ptr<Function>& f) const;
 
+    /**
+     * @brief gets target machine the code is generated for
+     * @return target machine
+     */
+    std::shared_ptr<const TargetMachine> get_target_machine() const {
+        return target;
+    }
+
 protected:
     std::shared_ptr<TargetMachine> target;
 };
@@ -37,7 +37,7 @@ snippets::op::Subgraph::Subgraph(const NodeVector& args, std::shared_ptr<Functio
 
 std::shared_ptr<Node> snippets::op::Subgraph::clone_with_new_inputs(const OutputVector& inputs) const {
     INTERNAL_OP_SCOPE(Subgraph);
-    return make_shared<Subgraph>(inputs, ngraph::clone_function(*m_body.get()));
+    return make_shared<Subgraph>(inputs, ngraph::clone_function_trusted(*m_body.get()));
 }
 
 void snippets::op::Subgraph::validate_and_infer_types() {
@@ -162,6 +162,9 @@ public:
 
     void validate_and_infer_types() override;
 
+    /// Input tensors are retyped during validation, so other consumers of the inputs can't be validated meanwhile
+    bool has_thread_safe_validation() const override { return false; }
+
     std::shared_ptr<Node> clone_with_new_inputs(const OutputVector& new_args) const override;
 
 private:
@@ -69,6 +69,10 @@ class NGRAPH_API ConvertPrecision;
  *     GreaterEqual
  *     Less
  *     LessEqual
+ *
+ * Constants which have "KEEP_CONST_PRECISION" key in the runtime info keep their precision: Convert operation is
+ * inserted after such a Constant instead and the constant folding is disabled for it, so a plugin can consume
+ * the data in the original precision.
  */
 
 using type_to_fuse_map = std::unordered_map<ngraph::NodeTypeInfo, std::function<bool(const std::shared_ptr<ngraph::Node>&, ngraph::element::Type, size_t idx)>>;
@@ -614,7 +614,7 @@ bool resolve_dynamic_shapes(const ngraph::Function& f) {
         return false;
     }
 
-    auto f_clone = ngraph::clone_function(f);
+    auto f_clone = ngraph::clone_function_trusted(f);
     const auto & f_clone_ops = f_clone->get_ordered_ops();
     NGRAPH_CHECK(f_ops.size() == f_clone_ops.size(), "Unexpected get_ordered_ops method behaviour");
 
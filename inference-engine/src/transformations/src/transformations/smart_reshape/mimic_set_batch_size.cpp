@@ -11,7 +11,7 @@ NGRAPH_RTTI_DEFINITION(ngraph::pass::MimicSetBatchSize, "MimicSetBatchSize", 0);
 bool ngraph::pass::MimicSetBatchSize::run_on_function(std::shared_ptr<ngraph::Function> f) {
     RUN_ON_FUNCTION_SCOPE(MimicSetBatchSize);
     // extracting ratio of out to in 0-index dimension value from the folded function
-    auto specialized_function = ngraph::clone_function(*f);
+    auto specialized_function = ngraph::clone_function_trusted(*f);
     ngraph::pass::Manager manager;
     manager.register_pass<ngraph::pass::ConstantFolding>();
     manager.run_passes(specialized_function);
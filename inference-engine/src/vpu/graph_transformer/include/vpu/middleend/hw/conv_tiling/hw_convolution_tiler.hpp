@@ -11,6 +11,7 @@
 #include <limits>
 #include <algorithm>
 #include <vector>
+#include <map>
 #include <unordered_map>
 #include <vpu/model/data_desc.hpp>
 #include <vpu/middleend/hw/tiling.hpp>
@@ -142,13 +143,22 @@ public:
         _dirTiling(ConvGraphDataTilingFactory::makeDirTiling(*other._dirTiling)),
         _tilingOptions(other._tilingOptions) {}
     HWConvolutionTilingSearcher(ConvolutionOptions convolutionOptions, const Direction& direction,
-                                std::size_t maxTilingOptions) :
+                                std::size_t maxTilingOptions, int cmxLimit) :
         _convolutionOptions(std::move(convolutionOptions)),
         _dirTiling(ConvGraphDataTilingFactory::makeDirTiling(_convolutionOptions, direction)),
         _maxTilingOptions(maxTilingOptions) {
             IE_ASSERT(maxTilingOptions > 0);
             _dirTiling->initTileSizes();
-            _tilingOptions = selectBetterTiling();
+            _tilingOptions = selectBetterTiling(cmxLimit);
+        }
+    // uses the tiling options found by another searcher for the same convolution geometry
+    HWConvolutionTilingSearcher(ConvolutionOptions convolutionOptions, const Direction& direction,
+                                std::vector<TilingOption> tilingOptions) :
+        _convolutionOptions(std::move(convolutionOptions)),
+        _maxTilingOptions(std::max<std::size_t>(tilingOptions.size(), 1)),
+        _dirTiling(ConvGraphDataTilingFactory::makeDirTiling(_convolutionOptions, direction)),
+        _tilingOptions(std::move(tilingOptions)) {
+            _dirTiling->initTileSizes();
         }
 
     const std::vector<TilingOption>& tilingOptions() const {
@@ -160,7 +170,7 @@ public:
     HWConvolutionTileLayoutCut tileLayoutCut(const TilingOption& option) const;
 
 private:
-    std::vector<TilingOption> selectBetterTiling() const;
+    std::vector<TilingOption> selectBetterTiling(int cmxLimit) const;
 
     const ConvolutionOptions _convolutionOptions;
     const std::size_t _maxTilingOptions;
@@ -174,7 +184,7 @@ public:
     HWConvolutionTiler() = delete;
     HWConvolutionTiler(const HWConvolutionTiler&) = default;
     HWConvolutionTiler(ConvolutionOptions convolutionOptions, const Direction& direction, std::size_t maxTilingOptions);
-
+    HWConvolutionTiler(ConvolutionOptions convolutionOptions, const Direction& direction, std::vector<TilingOption> tilingOptions);
 
     bool isTilingPossible() const {
         return _tilingPossible;
@@ -197,6 +207,34 @@ private:
     const HWConvolutionTilingSearcher _searcher;
 };
 
+// Keeps the tiling options found for the convolutions of a model. The search depends on the convolution geometry and
+// the CMX limit only, so the identical convolutions are solved once. The search doesn't use the compile environment,
+// so the distinct convolutions are solved in parallel by prepare().
+class HWConvolutionTilingCache final {
+public:
+    HWConvolutionTilingCache(const Direction& direction, std::size_t maxTilingOptions, int cmxLimit) :
+        _direction(direction), _maxTilingOptions(maxTilingOptions), _cmxLimit(cmxLimit) {}
+
+    void prepare(const std::vector<ConvolutionOptions>& convolutionsOptions);
+
+    // searches the options of the convolution when they are not cached yet
+    const std::vector<TilingOption>& tilingOptions(const ConvolutionOptions& convolutionOptions);
+
+    std::size_t size() const { return _tilingOptions.size(); }
+    std::size_t hits() const { return _hits; }
+
+private:
+    using Key = std::vector<int>;
+
+    Key makeKey(const ConvolutionOptions& convolutionOptions) const;
+
+    const Direction _direction;
+    const std::size_t _maxTilingOptions;
+    const int _cmxLimit;
+    std::map<Key, std::vector<TilingOption>> _tilingOptions;
+    std::size_t _hits = 0;
+};
+
 SmallVector<HwPlaneTileInfo> calcHeightTiles(const ConvolutionOptions& convolutionOptions,
                                              const DimValues& outputTileDims, bool useCeil);
 SmallVector<HwPlaneTileInfo> calcWidthTiles(const ConvolutionOptions& convolutionOptions,
@@ -3,10 +3,12 @@
 //
 
 #include <algorithm>
+#include <exception>
 #include <limits>
 #include <vector>
 #include <memory>
 #include <utility>
+#include <ie_parallel.hpp>
 #include <vpu/middleend/hw/conv_tiling/hw_convolution_tiler.hpp>
 
 namespace vpu {
@@ -259,7 +261,14 @@ public:
 HWConvolutionTiler::HWConvolutionTiler(ConvolutionOptions convolutionOptions, const Direction& direction,
                                        std::size_t maxTilingOptions) :
     _convolutionOptions(std::move(convolutionOptions)),
-    _searcher(_convolutionOptions, direction, maxTilingOptions) {
+    _searcher(_convolutionOptions, direction, maxTilingOptions, CompileEnv::get().resources.tilingCMXLimit) {
+    _tilingPossible = tileForHW();
+}
+
+HWConvolutionTiler::HWConvolutionTiler(ConvolutionOptions convolutionOptions, const Direction& direction,
+                                       std::vector<TilingOption> tilingOptions) :
+    _convolutionOptions(std::move(convolutionOptions)),
+    _searcher(_convolutionOptions, direction, std::move(tilingOptions)) {
     _tilingPossible = tileForHW();
 }
 
@@ -617,9 +626,7 @@ std::unique_ptr<GraphDataTiling> ConvGraphDataTilingFactory::makeDirTiling(const
 //
 // Looks for the optimal tiling accordingly to the cost function. Modifies dimensions in dirTiling during search.
 //
-std::vector<TilingOption> HWConvolutionTilingSearcher::selectBetterTiling() const {
-    const auto& env = CompileEnv::get();
-
+std::vector<TilingOption> HWConvolutionTilingSearcher::selectBetterTiling(int cmxLimit) const {
     auto& dirTiling = *_dirTiling;
     FixedMaxHeap<TilingOption> tilingOptions(_maxTilingOptions);
 
@@ -644,7 +651,6 @@ std::vector<TilingOption> HWConvolutionTilingSearcher::selectBetterTiling() cons
 
     const auto& splitOver = dirTiling.splitOverTensorDims();
     const auto direction = dirTiling.getDirection();
-    const auto cmxLimit = env.resources.tilingCMXLimit;
 
     // split over Input tensor for the Channel dimension always
     for (int numChannelTiles = 1; numChannelTiles <= maxNumChannelTiles; numChannelTiles++) {
@@ -853,6 +859,65 @@ HWConvolutionTileLayoutCut HWConvolutionTilingSearcher::tileLayoutCut(const Tili
     return HWConvolutionTileLayoutCut(*_dirTiling, option);
 }
 
+HWConvolutionTilingCache::Key HWConvolutionTilingCache::makeKey(const ConvolutionOptions& convolutionOptions) const {
+    Key key;
+    for (const auto& dims : {convolutionOptions._inputDims, convolutionOptions._outputDims, convolutionOptions._origOutputDims}) {
+        const auto values = dims.toVector(-1);
+        key.insert(key.end(), values.begin(), values.end());
+    }
+    key.insert(key.end(), {
+        convolutionOptions._kernelSizeX, convolutionOptions._kernelSizeY, convolutionOptions._kernelStride,
+        convolutionOptions._paddingLeft, convolutionOptions._paddingRight,
+        convolutionOptions._paddingTop, convolutionOptions._paddingBottom,
+        static_cast<int>(convolutionOptions._withPool)});
+    return key;
+}
+
+void HWConvolutionTilingCache::prepare(const std::vector<ConvolutionOptions>& convolutionsOptions) {
+    std::map<Key, const ConvolutionOptions*> missing;
+    for (const auto& convolutionOptions : convolutionsOptions) {
+        auto key = makeKey(convolutionOptions);
+        if (_tilingOptions.count(key) == 0) {
+            missing.emplace(std::move(key), &convolutionOptions);
+        }
+    }
+
+    std::vector<std::pair<const Key*, const ConvolutionOptions*>> tasks;
+    for (const auto& entry : missing) {
+        tasks.emplace_back(&entry.first, entry.second);
+    }
+
+    // the errors are reported from the calling thread
+    std::vector<std::vector<TilingOption>> results(tasks.size());
+    std::vector<std::exception_ptr> errors(tasks.size());
+    ie::parallel_for(tasks.size(), [&](size_t i) {
+        try {
+            results[i] = HWConvolutionTilingSearcher(*tasks[i].second, _direction, _maxTilingOptions, _cmxLimit).tilingOptions();
+        } catch (...) {
+            errors[i] = std::current_exception();
+        }
+    });
+
+    for (size_t i = 0; i < tasks.size(); i++) {
+        if (errors[i]) {
+            std::rethrow_exception(errors[i]);
+        }
+        _tilingOptions.emplace(*tasks[i].first, std::move(results[i]));
+    }
+}
+
+const std::vector<TilingOption>& HWConvolutionTilingCache::tilingOptions(const ConvolutionOptions& convolutionOptions) {
+    auto key = makeKey(convolutionOptions);
+    auto it = _tilingOptions.find(key);
+    if (it != _tilingOptions.end()) {
+        ++_hits;
+        return it->second;
+    }
+
+    auto tilingOptions = HWConvolutionTilingSearcher(convolutionOptions, _direction, _maxTilingOptions, _cmxLimit).tilingOptions();
+    return _tilingOptions.emplace(std::move(key), std::move(tilingOptions)).first->second;
+}
+
 std::ostream& operator<<(std::ostream& stream, const TilingOption& tilingOption) {
     stream << "WHC: "
            << tilingOption.numWidthTiles << "x"
@@ -8,6 +8,9 @@
 #include <iomanip>
 #include <memory>
 #include <string>
+#include <map>
+#include <vector>
+#include <algorithm>
 
 #include <vpu/compile_env.hpp>
 #include <vpu/configuration/options/copy_optimization.hpp>
@@ -40,6 +43,10 @@ void PassSet::run(const Model& model) const {
     env.log->debug("MiddleEnd : Run passes");
     VPU_LOGGER_SECTION(env.log);
 
+    // total duration and number of runs of every pass
+    std::map<std::string, std::pair<double, int>> passDurations;
+    double totalDuration = 0.0;
+
     int passInd = 0;
     for (const auto& p : _passes) {
         env.log->debug("Start pass %m%d / %d [%s]", std::setw(2), passInd + 1, _passes.size(), p.second);
@@ -52,16 +59,40 @@ void PassSet::run(const Model& model) const {
         p.first->run(model);
 
         auto endTime = std::chrono::high_resolution_clock::now();
+        const auto duration = std::chrono::duration_cast<MilliSecondsFP64>(endTime - startTime).count();
 
         env.log->debug(
             "Pass %m%d / %d [%s] duration : %f ms",
-            std::setw(2), passInd + 1, _passes.size(), p.second,
-            std::chrono::duration_cast<MilliSecondsFP64>(endTime - startTime).count());
+            std::setw(2), passInd + 1, _passes.size(), p.second, duration);
+
+        auto& passDuration = passDurations[p.second];
+        passDuration.first += duration;
+        passDuration.second++;
+        totalDuration += duration;
 
         ++passInd;
     }
 
     model->cleanUp();
+
+    //
+    // Compile time report, the longest passes go first
+    //
+
+    if (env.log->isActive(LogLevel::Info)) {
+        std::vector<std::pair<std::string, std::pair<double, int>>> report(passDurations.begin(), passDurations.end());
+        std::stable_sort(report.begin(), report.end(), [](const std::pair<std::string, std::pair<double, int>>& lhs,
+                                                          const std::pair<std::string, std::pair<double, int>>& rhs) {
+            return lhs.second.first > rhs.second.first;
+        });
+
+        env.log->info("MiddleEnd : passes duration : %f ms", totalDuration);
+        VPU_LOGGER_SECTION(env.log);
+
+        for (const auto& entry : report) {
+            env.log->info("[%s] x %d : %f ms", entry.first, entry.second.second, entry.second.first);
+        }
+    }
 }
 
 //
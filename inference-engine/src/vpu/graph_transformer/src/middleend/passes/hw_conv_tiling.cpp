@@ -8,6 +8,7 @@
 #include <utility>
 #include <memory>
 #include <set>
+#include <vector>
 
 #include <vpu/compile_env.hpp>
 #include <vpu/stages/stub_stage.hpp>
@@ -31,9 +32,41 @@ private:
     StageBuilder::Ptr _stageBuilder;
 };
 
+HWTilingNS::ConvolutionOptions makeConvolutionOptions(const Stage& origStage) {
+    const HWConvStageOptions stageOptions(origStage);
+    const HWConvStageIO stageIO(origStage, origStage->output(0));
+
+    return HWTilingNS::ConvolutionOptions{
+        origStage->name(),
+        stageIO.origInput->desc().dims(),
+        stageIO.origOutput->desc().dims(),
+        stageIO.origOutputDesc.dims(),
+        stageOptions.kernelSizeX,
+        stageOptions.kernelSizeY,
+        stageOptions.kernelStride,
+        stageOptions.padLeft,
+        stageOptions.padRight,
+        stageOptions.padTop,
+        stageOptions.padBottom,
+        stageOptions.withPool
+    };
+}
+
 void PassImpl::run(const Model& model) {
     VPU_PROFILE(hwConvTiling);
 
+    const auto& env = CompileEnv::get();
+
+    const size_t tilingsCount = 1;
+    const HWTilingNS::Direction direction = HWTilingNS::Direction::INPUT_TO_OUTPUT;
+                                         // HWTilingNS::Direction::OUTPUT_TO_INPUT;
+
+    //
+    // Search the tilings of the distinct convolutions in parallel before changing the model
+    //
+
+    std::vector<Stage> hwStages;
+    std::vector<HWTilingNS::ConvolutionOptions> convolutionsOptions;
     for (const auto& origStage : model->getStages()) {
         if (origStage->type() != StageType::StubConv) {
             continue;
@@ -44,6 +77,17 @@ void PassImpl::run(const Model& model) {
             continue;
         }
 
+        hwStages.push_back(origStage);
+        convolutionsOptions.push_back(makeConvolutionOptions(origStage));
+    }
+
+    HWTilingNS::HWConvolutionTilingCache tilingCache(direction, tilingsCount, env.resources.tilingCMXLimit);
+    tilingCache.prepare(convolutionsOptions);
+
+    for (size_t stageInd = 0; stageInd < hwStages.size(); ++stageInd) {
+        const auto& origStage = hwStages[stageInd];
+        const auto& convolutionOptions = convolutionsOptions[stageInd];
+
         const HWConvStageOptions stageOptions(origStage);
         const HWConvStageIO stageIO(origStage, origStage->output(0));
 
@@ -55,26 +99,8 @@ void PassImpl::run(const Model& model) {
         // Try to find "best" tiling
         //
 
-        const size_t tilingsCount = 1;
-        const HWTilingNS::Direction direction = HWTilingNS::Direction::INPUT_TO_OUTPUT;
-                                             // HWTilingNS::Direction::OUTPUT_TO_INPUT;
-
-        const auto convolutionOptions = HWTilingNS::ConvolutionOptions{
-            origStage->name(),
-            stageIO.origInput->desc().dims(),
-            stageIO.origOutput->desc().dims(),
-            stageIO.origOutputDesc.dims(),
-            stageOptions.kernelSizeX,
-            stageOptions.kernelSizeY,
-            stageOptions.kernelStride,
-            stageOptions.padLeft,
-            stageOptions.padRight,
-            stageOptions.padTop,
-            stageOptions.padBottom,
-            stageOptions.withPool
-        };
-
-        const HWTilingNS::HWConvolutionTiler tiler1stAttempt(convolutionOptions, direction, tilingsCount);
+        const HWTilingNS::HWConvolutionTiler tiler1stAttempt(convolutionOptions, direction,
+                                                             tilingCache.tilingOptions(convolutionOptions));
 
 
         const HWTilingNS::HWConvolutionTiler& tiler = [&] {
@@ -94,7 +120,7 @@ void PassImpl::run(const Model& model) {
                     false
                 };
 
-                return HWTilingNS::HWConvolutionTiler{optionsWithoutPool, direction, tilingsCount};
+                return HWTilingNS::HWConvolutionTiler{optionsWithoutPool, direction, tilingCache.tilingOptions(optionsWithoutPool)};
             } else {
                 return tiler1stAttempt;
             }
@@ -233,6 +259,8 @@ void PassImpl::run(const Model& model) {
 
         model->removeStage(origStage);
     }
+
+    env.log->debug("HW convolutions : %d, distinct tilings searched : %d", hwStages.size(), tilingCache.size());
 }
 
 }  // namespace
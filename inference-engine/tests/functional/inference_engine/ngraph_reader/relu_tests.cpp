@@ -221,3 +221,59 @@ TEST_F(NGraphReaderTests, ReadReLUScalarNetwork) {
     Core reader;
     auto cnn = reader.ReadNetwork(model, blob);
 }
+
+TEST_F(NGraphReaderTests, ReadDeepReLUChainNetworkWithoutTopologicalOrder) {
+    const size_t depth = 5000;
+    const std::string port = R"V0G0N(
+                    <dim>1</dim>
+                    <dim>3</dim>
+                </port>)V0G0N";
+
+    // layers are listed from the output to the input
+    std::ostringstream model;
+    model << R"V0G0N(<net name="Network" version="10">
+    <layers>
+        <layer name="output" type="Result" id=")V0G0N" << depth + 1 << R"V0G0N(" version="opset1">
+            <input>
+                <port id="0" precision="FP32">)V0G0N" << port << R"V0G0N(
+            </input>
+        </layer>)V0G0N";
+    for (size_t id = depth; id > 0; id--) {
+        model << R"V0G0N(
+        <layer name="activation_)V0G0N" << id << R"V0G0N(" id=")V0G0N" << id << R"V0G0N(" type="ReLU" version="opset1">
+            <input>
+                <port id="0" precision="FP32">)V0G0N" << port << R"V0G0N(
+            </input>
+            <output>
+                <port id="1" precision="FP32">)V0G0N" << port << R"V0G0N(
+            </output>
+        </layer>)V0G0N";
+    }
+    model << R"V0G0N(
+        <layer name="in1" type="Parameter" id="0" version="opset1">
+            <data element_type="f32" shape="1,3"/>
+            <output>
+                <port id="0" precision="FP32">)V0G0N" << port << R"V0G0N(
+            </output>
+        </layer>
+    </layers>
+    <edges>)V0G0N";
+    for (size_t id = 1; id <= depth + 1; id++) {
+        model << R"V0G0N(
+        <edge from-layer=")V0G0N" << id - 1 << R"V0G0N(" from-port=")V0G0N" << (id == 1 ? 0 : 1)
+              << R"V0G0N(" to-layer=")V0G0N" << id << R"V0G0N(" to-port="0"/>)V0G0N";
+    }
+    model << R"V0G0N(
+    </edges>
+</net>
+)V0G0N";
+
+    Blob::CPtr blob;
+    Core reader;
+    auto cnn = reader.ReadNetwork(model.str(), blob);
+    auto function = cnn.getFunction();
+    ASSERT_NE(nullptr, function);
+    ASSERT_EQ(depth + 2, function->get_ops().size());
+    ASSERT_EQ("activation_" + std::to_string(depth),
+              function->get_result()->get_input_node_ptr(0)->get_friendly_name());
+}
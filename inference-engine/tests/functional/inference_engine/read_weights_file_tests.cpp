@@ -0,0 +1,81 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <ie_core.hpp>
+#include <ie_plugin_config.hpp>
+#include <ngraph/opsets/opset1.hpp>
+
+#include "common_test_utils/test_common.hpp"
+
+using namespace InferenceEngine;
+
+class ReadWeightsFileTests : public CommonTestUtils::TestsCommon {
+protected:
+    void SetUp() override {
+        CommonTestUtils::TestsCommon::SetUp();
+        const std::string testName = GetTestName() + "_" + GetTimestamp();
+        xmlPath = testName + ".xml";
+        binPath = testName + ".bin";
+
+        auto param = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{4});
+        auto constant = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{4}, weights);
+        auto add = std::make_shared<ngraph::opset1::Add>(param, constant);
+        auto function = std::make_shared<ngraph::Function>(ngraph::ResultVector{std::make_shared<ngraph::opset1::Result>(add)},
+                                                           ngraph::ParameterVector{param});
+        CNNNetwork(function).serialize(xmlPath, binPath);
+    }
+
+    void TearDown() override {
+        std::remove(xmlPath.c_str());
+        std::remove(binPath.c_str());
+        CommonTestUtils::TestsCommon::TearDown();
+    }
+
+    void rewriteWeightsFile() {
+        std::ifstream input(binPath, std::ios::binary);
+        const std::vector<char> content((std::istreambuf_iterator<char>(input)), std::istreambuf_iterator<char>());
+        input.close();
+        std::ofstream output(binPath, std::ios::binary | std::ios::trunc);
+        const std::vector<char> zeros(content.size(), 0);
+        output.write(zeros.data(), zeros.size());
+    }
+
+    static std::vector<float> getWeights(const CNNNetwork& network) {
+        for (const auto& op : network.getFunction()->get_ops()) {
+            if (auto constant = ngraph::as_type_ptr<ngraph::opset1::Constant>(op))
+                return constant->cast_vector<float>();
+        }
+        return {};
+    }
+
+    const std::vector<float> weights = {1.f, 2.f, 3.f, 4.f};
+    std::string xmlPath;
+    std::string binPath;
+};
+
+TEST_F(ReadWeightsFileTests, weightsAreNotChangedByRewritingFileAfterReadNetwork) {
+    Core ie;
+    auto network = ie.ReadNetwork(xmlPath, binPath);
+    rewriteWeightsFile();
+    EXPECT_EQ(weights, getWeights(network));
+}
+
+TEST_F(ReadWeightsFileTests, canReadMappedWeights) {
+    Core ie;
+    ie.SetConfig({{CONFIG_KEY(MMAP_WEIGHTS), CONFIG_VALUE(YES)}});
+    auto network = ie.ReadNetwork(xmlPath, binPath);
+    EXPECT_EQ(weights, getWeights(network));
+}
+
+TEST_F(ReadWeightsFileTests, throwsOnWrongMappingValue) {
+    Core ie;
+    ASSERT_THROW(ie.SetConfig({{CONFIG_KEY(MMAP_WEIGHTS), "ON"}}), Exception);
+}
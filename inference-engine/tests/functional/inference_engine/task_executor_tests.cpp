@@ -2,7 +2,13 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <atomic>
+#include <condition_variable>
 #include <future>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -11,6 +17,10 @@
 #include <threading/ie_immediate_executor.hpp>
 #include <ie_system_conf.h>
 
+#ifdef __linux__
+#include <sched.h>
+#endif
+
 using namespace ::testing;
 using namespace std;
 using namespace InferenceEngine;
@@ -139,6 +149,169 @@ TEST_P(TaskExecutorTests, executorNotReleasedUntilTasksAreDone) {
     ASSERT_EQ(MAX_NUMBER_OF_TASKS_IN_QUEUE, sharedVar);
 }
 
+// Blocks the tasks until it is opened
+class Gate {
+public:
+    void open() {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _opened = true;
+        }
+        _condVar.notify_all();
+    }
+    void wait() {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _condVar.wait(lock, [this] { return _opened; });
+    }
+
+private:
+    std::mutex _mutex;
+    std::condition_variable _condVar;
+    bool _opened = false;
+};
+
+template<typename F>
+static std::future<void> asyncWithPriority(const IStreamsExecutor::Ptr& executor, IStreamsExecutor::TaskPriority priority, F&& f) {
+    auto p = std::make_shared<std::packaged_task<void()>>(f);
+    auto future = p->get_future();
+    executor->RunWithPriority([p] {(*p)();}, priority);
+    return future;
+}
+
+TEST(CPUStreamsExecutorPriorityTests, highPriorityTaskIsRunBeforeQueuedNormalTasks) {
+    auto executor = std::make_shared<CPUStreamsExecutor>(IStreamsExecutor::Config{"TestCPUStreamsExecutor", 1});
+    Gate gate;
+    std::mutex mutex;
+    std::vector<int> order;
+    auto blocking = async(executor, [&] { gate.wait(); });
+    auto normal = asyncWithPriority(executor, IStreamsExecutor::TaskPriority::NORMAL, [&] {
+        std::lock_guard<std::mutex> lock(mutex);
+        order.push_back(0);
+    });
+    auto high = asyncWithPriority(executor, IStreamsExecutor::TaskPriority::HIGH, [&] {
+        std::lock_guard<std::mutex> lock(mutex);
+        order.push_back(1);
+    });
+    gate.open();
+    blocking.get();
+    normal.get();
+    high.get();
+    // the statistics are updated after the task is done, the stream takes the next task after that
+    async(executor, [] {}).get();
+    ASSERT_EQ(std::vector<int>({1, 0}), order);
+    EXPECT_EQ(1u, executor->GetLatencyStatistics(IStreamsExecutor::TaskPriority::NORMAL).tasks);
+    EXPECT_EQ(1u, executor->GetLatencyStatistics(IStreamsExecutor::TaskPriority::HIGH).tasks);
+}
+
+TEST(CPUStreamsExecutorPriorityTests, highPriorityStreamRunsTaskWhileNormalStreamIsBusy) {
+    IStreamsExecutor::Config config{"TestCPUStreamsExecutor", 1};
+    config._highPriorityStreams = 1;
+    auto executor = std::make_shared<CPUStreamsExecutor>(config);
+    Gate normalStarted, gate;
+    auto normal = asyncWithPriority(executor, IStreamsExecutor::TaskPriority::NORMAL, [&] {
+        normalStarted.open();
+        gate.wait();
+    });
+    normalStarted.wait();
+    int streamId = -1;
+    auto high = asyncWithPriority(executor, IStreamsExecutor::TaskPriority::HIGH, [&] { streamId = executor->GetStreamId(); });
+    ASSERT_EQ(std::future_status::ready, high.wait_for(std::chrono::seconds(10)));
+    EXPECT_EQ(1, streamId);
+    gate.open();
+    normal.get();
+}
+
+#ifdef __linux__
+static std::vector<int> getCurrentThreadCpus() {
+    cpu_set_t mask;
+    CPU_ZERO(&mask);
+    sched_getaffinity(0, sizeof(mask), &mask);
+    std::vector<int> cpus;
+    for (int cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+        if (CPU_ISSET(cpu, &mask))
+            cpus.push_back(cpu);
+    }
+    return cpus;
+}
+
+TEST(CPUStreamsExecutorPriorityTests, highPriorityStreamIsPinnedToCoresOfFirstNormalStream) {
+    IStreamsExecutor::Config config{"TestCPUStreamsExecutor", 2, 1, IStreamsExecutor::ThreadBindingType::CORES};
+    config._highPriorityStreams = 1;
+    auto executor = std::make_shared<CPUStreamsExecutor>(config);
+    Gate gate;
+    std::mutex mutex;
+    std::condition_variable normalStarted;
+    std::map<int, std::vector<int>> cpus;
+    auto runNormal = [&] {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            cpus[executor->GetStreamId()] = getCurrentThreadCpus();
+        }
+        normalStarted.notify_all();
+        gate.wait();
+    };
+    // the normal streams are busy, so the high priority task is run by the reserved stream
+    auto normal0 = asyncWithPriority(executor, IStreamsExecutor::TaskPriority::NORMAL, runNormal);
+    auto normal1 = asyncWithPriority(executor, IStreamsExecutor::TaskPriority::NORMAL, runNormal);
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        normalStarted.wait(lock, [&] { return cpus.size() == 2; });
+    }
+    auto high = asyncWithPriority(executor, IStreamsExecutor::TaskPriority::HIGH, [&] {
+        std::lock_guard<std::mutex> lock(mutex);
+        cpus[executor->GetStreamId()] = getCurrentThreadCpus();
+    });
+    ASSERT_EQ(std::future_status::ready, high.wait_for(std::chrono::seconds(10)));
+    gate.open();
+    normal0.get();
+    normal1.get();
+    ASSERT_EQ(1u, cpus.count(0));
+    ASSERT_EQ(1u, cpus.count(2));
+    EXPECT_EQ(1u, cpus[2].size());
+    EXPECT_EQ(cpus[0], cpus[2]);
+}
+#endif
+
+TEST(CPUStreamsExecutorPriorityTests, normalTaskIsPausedAtYieldPointUntilHighPriorityTasksAreDone) {
+    IStreamsExecutor::Config config{"TestCPUStreamsExecutor", 1};
+    config._highPriorityStreams = 1;
+    auto executor = std::make_shared<CPUStreamsExecutor>(config);
+    Gate normalStarted, highQueued, highGate;
+    std::atomic<bool> highDone{false};
+    bool highDoneAtResume = false;
+    auto normal = asyncWithPriority(executor, IStreamsExecutor::TaskPriority::NORMAL, [&] {
+        normalStarted.open();
+        highQueued.wait();
+        executor->YieldToHighPriority();
+        highDoneAtResume = highDone;
+    });
+    normalStarted.wait();
+    auto high = asyncWithPriority(executor, IStreamsExecutor::TaskPriority::HIGH, [&] {
+        highGate.wait();
+        highDone = true;
+    });
+    highQueued.open();
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    EXPECT_EQ(std::future_status::timeout, normal.wait_for(std::chrono::milliseconds(0)));
+    highGate.open();
+    high.get();
+    normal.get();
+    EXPECT_TRUE(highDoneAtResume);
+}
+
+TEST(CPUStreamsExecutorPriorityTests, normalTaskIsNotPausedWithoutHighPriorityStreams) {
+    auto executor = std::make_shared<CPUStreamsExecutor>(IStreamsExecutor::Config{"TestCPUStreamsExecutor", 1});
+    Gate highQueued;
+    auto normal = asyncWithPriority(executor, IStreamsExecutor::TaskPriority::NORMAL, [&] {
+        highQueued.wait();
+        executor->YieldToHighPriority();
+    });
+    auto high = asyncWithPriority(executor, IStreamsExecutor::TaskPriority::HIGH, [] {});
+    highQueued.open();
+    normal.get();
+    high.get();
+}
+
 class ASyncTaskExecutorTests : public TaskExecutorTests {};
 
 // TODO: Issue-11695
@@ -686,6 +686,33 @@ TEST(TransformationTests, ConvertPrecision_Variables) {
     ASSERT_FALSE(has_type<ngraph::element::Type_t::f16>(f));
 }
 
+TEST(TransformationTests, ConvertPrecision_KeepConstPrecision) {
+    std::shared_ptr<ngraph::Function> f(nullptr);
+    {
+        auto input = std::make_shared<opset4::Parameter>(element::f16, Shape{2, 8});
+        auto weights = opset4::Constant::create(element::f16, Shape{4, 8}, {1});
+        weights->get_rt_info()["KEEP_CONST_PRECISION"] = std::make_shared<VariantWrapper<std::string>>("");
+        auto matmul = std::make_shared<opset4::MatMul>(input, weights, false, true);
+
+        f = std::make_shared<Function>(NodeVector{matmul}, ParameterVector{input});
+
+        pass::Manager manager;
+        manager.register_pass<ngraph::pass::ConvertPrecision>(precisions_array {{ ngraph::element::f16, ngraph::element::f32 }});
+        manager.run_passes(f);
+    }
+
+    auto matmul = std::dynamic_pointer_cast<opset4::MatMul>(f->get_results()[0]->get_input_node_shared_ptr(0));
+    ASSERT_NE(matmul, nullptr);
+    ASSERT_EQ(matmul->get_input_element_type(0), element::f32);
+    auto convert = std::dynamic_pointer_cast<opset4::Convert>(matmul->get_input_node_shared_ptr(1));
+    ASSERT_NE(convert, nullptr);
+    ASSERT_EQ(convert->get_output_element_type(0), element::f32);
+    ASSERT_TRUE(convert->get_rt_info().count("DISABLED_CONSTANT_FOLDING"));
+    auto weights = std::dynamic_pointer_cast<opset4::Constant>(convert->get_input_node_shared_ptr(0));
+    ASSERT_NE(weights, nullptr);
+    ASSERT_EQ(weights->get_output_element_type(0), element::f16);
+}
+
 template <typename From, typename To>
 void constant_convert_test(element::Type type_from, element::Type type_to, const std::vector<From>& value, const std::vector<To>& expected) {
     std::shared_ptr<ngraph::Function> f(nullptr);
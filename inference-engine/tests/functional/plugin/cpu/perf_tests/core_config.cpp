@@ -0,0 +1,13 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "functional_test_utils/core_config.hpp"
+
+void CoreConfiguration(LayerTestsUtils::LayerTestsCommon* test) {
+    // Within the test scope we don't need any implicit bf16 optimisations, so let's run the network as is.
+    auto& configuration = test->GetConfiguration();
+    if (!configuration.count(InferenceEngine::PluginConfigParams::KEY_ENFORCE_BF16)) {
+        configuration.insert({InferenceEngine::PluginConfigParams::KEY_ENFORCE_BF16, InferenceEngine::PluginConfigParams::NO});
+    }
+}
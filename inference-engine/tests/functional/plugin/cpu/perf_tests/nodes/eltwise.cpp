@@ -0,0 +1,78 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "perf_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+using namespace CPUPerfTestUtils;
+
+namespace CPUPerfTestsDefinitions {
+
+using EltwisePerfTestParams = std::tuple<
+        ngraph::helpers::EltwiseTypes,
+        PerfCommonParams>;
+
+class EltwisePerfTest : public testing::WithParamInterface<EltwisePerfTestParams>, public CPUPerfTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<EltwisePerfTestParams> obj) {
+        ngraph::helpers::EltwiseTypes eltwiseType;
+        PerfCommonParams commonParams;
+        std::tie(eltwiseType, commonParams) = obj.param;
+
+        std::ostringstream result;
+        result << "Type=" << eltwiseType << "_" << CPUPerfTestsCommon::getTestCaseName(commonParams);
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        ngraph::helpers::EltwiseTypes eltwiseType;
+        PerfCommonParams commonParams;
+        std::tie(eltwiseType, commonParams) = this->GetParam();
+        const auto ngPrc = SetUpCommon(commonParams);
+
+        auto params = ngraph::builder::makeParams(ngPrc, {inputShape, inputShape});
+        auto eltwise = ngraph::builder::makeEltwise(params[0], params[1], eltwiseType);
+        eltwise->get_rt_info() = getCPUInfo();
+
+        auto lastNode = graphKind == GraphKind::Subgraph ? makeTail(ngPrc, eltwise) : eltwise;
+        function = std::make_shared<ngraph::Function>(ngraph::ResultVector{std::make_shared<ngraph::opset1::Result>(lastNode)},
+                                                      params, "EltwisePerf");
+    }
+};
+
+TEST_P(EltwisePerfTest, Benchmark) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    RunBenchmark("Eltwise");
+}
+
+namespace {
+
+const std::vector<ngraph::helpers::EltwiseTypes> eltwiseTypes = {
+        ngraph::helpers::EltwiseTypes::ADD,
+        ngraph::helpers::EltwiseTypes::MULTIPLY,
+        ngraph::helpers::EltwiseTypes::SQUARED_DIFF
+};
+
+std::vector<CPUSpecificParams> cpuParams_4D = {
+        CPUSpecificParams({nchw, nchw}, {nchw}, {}, {}),
+        CPUSpecificParams({nhwc, nhwc}, {nhwc}, {}, {}),
+        CPUSpecificParams({nChw16c, nChw16c}, {nChw16c}, {}, {})
+};
+
+const auto params_4D = ::testing::Combine(
+        ::testing::ValuesIn(eltwiseTypes),
+        ::testing::Combine(
+                ::testing::ValuesIn(perfGraphKinds),
+                ::testing::ValuesIn(perfShapes4D),
+                ::testing::ValuesIn(filterCPUSpecificParams(cpuParams_4D)),
+                ::testing::ValuesIn(perfPrecisions)));
+
+INSTANTIATE_TEST_SUITE_P(perf_Eltwise_4D, EltwisePerfTest, params_4D, EltwisePerfTest::getTestCaseName);
+
+} // namespace
+} // namespace CPUPerfTestsDefinitions
@@ -0,0 +1,75 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "perf_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+using namespace CPUPerfTestUtils;
+
+namespace CPUPerfTestsDefinitions {
+
+using FakeQuantizePerfTestParams = std::tuple<
+        bool,   // per-channel ranges
+        PerfCommonParams>;
+
+class FakeQuantizePerfTest : public testing::WithParamInterface<FakeQuantizePerfTestParams>, public CPUPerfTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<FakeQuantizePerfTestParams> obj) {
+        bool perChannel;
+        PerfCommonParams commonParams;
+        std::tie(perChannel, commonParams) = obj.param;
+
+        std::ostringstream result;
+        result << "Ranges=" << (perChannel ? "PerChannel" : "PerTensor") << "_"
+               << CPUPerfTestsCommon::getTestCaseName(commonParams);
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        bool perChannel;
+        PerfCommonParams commonParams;
+        std::tie(perChannel, commonParams) = this->GetParam();
+        const auto ngPrc = SetUpCommon(commonParams);
+
+        const std::vector<size_t> rangesShape = perChannel ? std::vector<size_t>{1, inputShape[1], 1, 1} : std::vector<size_t>{1};
+        auto params = ngraph::builder::makeParams(ngPrc, {inputShape});
+        auto fq = ngraph::builder::makeFakeQuantize(params[0], ngPrc, 256, rangesShape,
+                                                    {-10.f}, {10.f}, {-10.f}, {10.f});
+        fq->get_rt_info() = getCPUInfo();
+
+        auto lastNode = graphKind == GraphKind::Subgraph ? makeTail(ngPrc, fq) : fq;
+        function = std::make_shared<ngraph::Function>(ngraph::ResultVector{std::make_shared<ngraph::opset1::Result>(lastNode)},
+                                                      params, "FakeQuantizePerf");
+    }
+};
+
+TEST_P(FakeQuantizePerfTest, Benchmark) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    RunBenchmark("FakeQuantize");
+}
+
+namespace {
+
+std::vector<CPUSpecificParams> cpuParams_4D = {
+        CPUSpecificParams({nchw}, {nchw}, {}, {}),
+        CPUSpecificParams({nhwc}, {nhwc}, {}, {}),
+        CPUSpecificParams({nChw16c}, {nChw16c}, {}, {})
+};
+
+const auto params_4D = ::testing::Combine(
+        ::testing::Values(false, true),
+        ::testing::Combine(
+                ::testing::ValuesIn(perfGraphKinds),
+                ::testing::ValuesIn(perfShapes4D),
+                ::testing::ValuesIn(filterCPUSpecificParams(cpuParams_4D)),
+                ::testing::Values(Precision::FP32)));
+
+INSTANTIATE_TEST_SUITE_P(perf_FakeQuantize_4D, FakeQuantizePerfTest, params_4D, FakeQuantizePerfTest::getTestCaseName);
+
+} // namespace
+} // namespace CPUPerfTestsDefinitions
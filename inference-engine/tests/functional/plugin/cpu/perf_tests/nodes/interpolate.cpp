@@ -0,0 +1,92 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "perf_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+using namespace CPUPerfTestUtils;
+
+namespace CPUPerfTestsDefinitions {
+
+using InterpolatePerfTestParams = std::tuple<
+        ngraph::op::v4::Interpolate::InterpolateMode,
+        PerfCommonParams>;
+
+class InterpolatePerfTest : public testing::WithParamInterface<InterpolatePerfTestParams>, public CPUPerfTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<InterpolatePerfTestParams> obj) {
+        ngraph::op::v4::Interpolate::InterpolateMode mode;
+        PerfCommonParams commonParams;
+        std::tie(mode, commonParams) = obj.param;
+
+        std::ostringstream result;
+        result << "Mode=" << mode << "_" << CPUPerfTestsCommon::getTestCaseName(commonParams);
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        using Interpolate = ngraph::op::v4::Interpolate;
+
+        Interpolate::InterpolateMode mode;
+        PerfCommonParams commonParams;
+        std::tie(mode, commonParams) = this->GetParam();
+        const auto ngPrc = SetUpCommon(commonParams);
+
+        // x2 upscaling of the spatial dimensions
+        const std::vector<int64_t> axes = {2, 3};
+        const std::vector<float> scales = {2.f, 2.f};
+        const std::vector<size_t> targetShape = {inputShape[2] * 2, inputShape[3] * 2};
+
+        auto params = ngraph::builder::makeParams(ngPrc, {inputShape});
+        auto targetShapeInput = std::make_shared<ngraph::opset3::Constant>(ngraph::element::i64, ngraph::Shape{targetShape.size()}, targetShape);
+        auto scalesInput = std::make_shared<ngraph::opset3::Constant>(ngraph::element::f32, ngraph::Shape{scales.size()}, scales);
+        auto axesInput = std::make_shared<ngraph::opset3::Constant>(ngraph::element::i64, ngraph::Shape{axes.size()}, axes);
+
+        Interpolate::InterpolateAttrs attrs{mode, Interpolate::ShapeCalcMode::scales, {0, 0, 0, 0}, {0, 0, 0, 0},
+                                            Interpolate::CoordinateTransformMode::half_pixel, Interpolate::NearestMode::round_prefer_floor,
+                                            false, -0.75};
+        auto interpolate = std::make_shared<Interpolate>(params[0], targetShapeInput, scalesInput, axesInput, attrs);
+        interpolate->get_rt_info() = getCPUInfo();
+
+        auto lastNode = graphKind == GraphKind::Subgraph ? makeTail(ngPrc, interpolate) : interpolate;
+        function = std::make_shared<ngraph::Function>(ngraph::ResultVector{std::make_shared<ngraph::opset1::Result>(lastNode)},
+                                                      params, "InterpolatePerf");
+    }
+};
+
+TEST_P(InterpolatePerfTest, Benchmark) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    RunBenchmark("Interpolate");
+}
+
+namespace {
+
+const std::vector<ngraph::op::v4::Interpolate::InterpolateMode> modes = {
+        ngraph::op::v4::Interpolate::InterpolateMode::nearest,
+        ngraph::op::v4::Interpolate::InterpolateMode::linear_onnx,
+        ngraph::op::v4::Interpolate::InterpolateMode::cubic
+};
+
+std::vector<CPUSpecificParams> cpuParams_4D = {
+        CPUSpecificParams({nchw, x, x, x}, {nchw}, {}, {}),
+        CPUSpecificParams({nhwc, x, x, x}, {nhwc}, {}, {}),
+        CPUSpecificParams({nChw16c, x, x, x}, {nChw16c}, {}, {})
+};
+
+const auto params_4D = ::testing::Combine(
+        ::testing::ValuesIn(modes),
+        ::testing::Combine(
+                ::testing::ValuesIn(perfGraphKinds),
+                ::testing::ValuesIn(perfShapes4D),
+                ::testing::ValuesIn(filterCPUSpecificParams(cpuParams_4D)),
+                ::testing::ValuesIn(perfPrecisions)));
+
+INSTANTIATE_TEST_SUITE_P(perf_Interpolate_4D, InterpolatePerfTest, params_4D, InterpolatePerfTest::getTestCaseName);
+
+} // namespace
+} // namespace CPUPerfTestsDefinitions
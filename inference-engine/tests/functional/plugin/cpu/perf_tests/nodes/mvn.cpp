@@ -0,0 +1,73 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "perf_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+using namespace CPUPerfTestUtils;
+
+namespace CPUPerfTestsDefinitions {
+
+using MvnPerfTestParams = std::tuple<
+        bool,   // across channels
+        PerfCommonParams>;
+
+class MvnPerfTest : public testing::WithParamInterface<MvnPerfTestParams>, public CPUPerfTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<MvnPerfTestParams> obj) {
+        bool acrossChannels;
+        PerfCommonParams commonParams;
+        std::tie(acrossChannels, commonParams) = obj.param;
+
+        std::ostringstream result;
+        result << "AcrossChannels=" << (acrossChannels ? "TRUE" : "FALSE") << "_"
+               << CPUPerfTestsCommon::getTestCaseName(commonParams);
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        bool acrossChannels;
+        PerfCommonParams commonParams;
+        std::tie(acrossChannels, commonParams) = this->GetParam();
+        const auto ngPrc = SetUpCommon(commonParams);
+
+        auto params = ngraph::builder::makeParams(ngPrc, {inputShape});
+        auto mvn = ngraph::builder::makeMVN(params[0], acrossChannels, true, 1e-9);
+        mvn->get_rt_info() = getCPUInfo();
+
+        auto lastNode = graphKind == GraphKind::Subgraph ? makeTail(ngPrc, mvn) : mvn;
+        function = std::make_shared<ngraph::Function>(ngraph::ResultVector{std::make_shared<ngraph::opset1::Result>(lastNode)},
+                                                      params, "MvnPerf");
+    }
+};
+
+TEST_P(MvnPerfTest, Benchmark) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    RunBenchmark("MVN");
+}
+
+namespace {
+
+std::vector<CPUSpecificParams> cpuParams_4D = {
+        CPUSpecificParams({nchw}, {nchw}, {}, {}),
+        CPUSpecificParams({nhwc}, {nhwc}, {}, {}),
+        CPUSpecificParams({nChw16c}, {nChw16c}, {}, {})
+};
+
+const auto params_4D = ::testing::Combine(
+        ::testing::Values(false, true),
+        ::testing::Combine(
+                ::testing::ValuesIn(perfGraphKinds),
+                ::testing::ValuesIn(perfShapes4D),
+                ::testing::ValuesIn(filterCPUSpecificParams(cpuParams_4D)),
+                ::testing::ValuesIn(perfPrecisions)));
+
+INSTANTIATE_TEST_SUITE_P(perf_MVN_4D, MvnPerfTest, params_4D, MvnPerfTest::getTestCaseName);
+
+} // namespace
+} // namespace CPUPerfTestsDefinitions
@@ -0,0 +1,89 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "perf_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+using namespace CPUPerfTestUtils;
+
+namespace CPUPerfTestsDefinitions {
+
+using ReducePerfTestParams = std::tuple<
+        ngraph::helpers::ReductionType,
+        std::vector<int64_t>,   // axes
+        PerfCommonParams>;
+
+class ReducePerfTest : public testing::WithParamInterface<ReducePerfTestParams>, public CPUPerfTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<ReducePerfTestParams> obj) {
+        ngraph::helpers::ReductionType reductionType;
+        std::vector<int64_t> axes;
+        PerfCommonParams commonParams;
+        std::tie(reductionType, axes, commonParams) = obj.param;
+
+        std::ostringstream result;
+        result << "Type=" << reductionType << "_axes=" << CommonTestUtils::vec2str(axes) << "_"
+               << CPUPerfTestsCommon::getTestCaseName(commonParams);
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        ngraph::helpers::ReductionType reductionType;
+        std::vector<int64_t> axes;
+        PerfCommonParams commonParams;
+        std::tie(reductionType, axes, commonParams) = this->GetParam();
+        const auto ngPrc = SetUpCommon(commonParams);
+
+        auto params = ngraph::builder::makeParams(ngPrc, {inputShape});
+        auto axesInput = std::make_shared<ngraph::opset3::Constant>(ngraph::element::i64, ngraph::Shape{axes.size()}, axes);
+        auto reduce = ngraph::builder::makeReduce(params[0], axesInput, true, reductionType);
+        reduce->get_rt_info() = getCPUInfo();
+
+        auto lastNode = graphKind == GraphKind::Subgraph ? makeTail(ngPrc, reduce) : reduce;
+        function = std::make_shared<ngraph::Function>(ngraph::ResultVector{std::make_shared<ngraph::opset1::Result>(lastNode)},
+                                                      params, "ReducePerf");
+    }
+};
+
+TEST_P(ReducePerfTest, Benchmark) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    RunBenchmark("Reduce");
+}
+
+namespace {
+
+const std::vector<ngraph::helpers::ReductionType> reductionTypes = {
+        ngraph::helpers::ReductionType::Mean,
+        ngraph::helpers::ReductionType::Max,
+        ngraph::helpers::ReductionType::Sum
+};
+
+const std::vector<std::vector<int64_t>> axes = {
+        {1},
+        {2, 3}
+};
+
+std::vector<CPUSpecificParams> cpuParams_4D = {
+        CPUSpecificParams({nchw}, {nchw}, {}, {}),
+        CPUSpecificParams({nhwc}, {nhwc}, {}, {}),
+        CPUSpecificParams({nChw16c}, {nChw16c}, {}, {})
+};
+
+const auto params_4D = ::testing::Combine(
+        ::testing::ValuesIn(reductionTypes),
+        ::testing::ValuesIn(axes),
+        ::testing::Combine(
+                ::testing::ValuesIn(perfGraphKinds),
+                ::testing::ValuesIn(perfShapes4D),
+                ::testing::ValuesIn(filterCPUSpecificParams(cpuParams_4D)),
+                ::testing::ValuesIn(perfPrecisions)));
+
+INSTANTIATE_TEST_SUITE_P(perf_Reduce_4D, ReducePerfTest, params_4D, ReducePerfTest::getTestCaseName);
+
+} // namespace
+} // namespace CPUPerfTestsDefinitions
@@ -0,0 +1,339 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "perf_test_utils.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <numeric>
+
+#ifdef __linux__
+#include <dirent.h>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include <cpu/cpu_config.hpp>
+
+#include <ngraph/opsets/opset1.hpp>
+#include "ngraph_functions/builders.hpp"
+
+namespace CPUPerfTestUtils {
+
+namespace {
+
+size_t getEnvValue(const char* name, size_t defaultValue) {
+    const char* value = std::getenv(name);
+    return value ? std::strtoul(value, nullptr, 10) : defaultValue;
+}
+
+class PerfReportEnvironment : public ::testing::Environment {
+public:
+    void TearDown() override {
+        PerfReport::getInstance().save();
+    }
+};
+
+const auto perfReportEnvironment = ::testing::AddGlobalTestEnvironment(new PerfReportEnvironment);
+
+std::string escape(const std::string& str) {
+    std::string result;
+    for (auto c : str) {
+        if (c == '"' || c == '\\')
+            result.push_back('\\');
+        result.push_back(c);
+    }
+    return result;
+}
+
+void writeCounter(std::ostream& out, const char* name, double value) {
+    out << ", \"" << name << "\": ";
+    if (value < 0)
+        out << "null";
+    else
+        out << value;
+}
+
+/**
+ * @brief Counts a hardware event for all the threads of the process existing at the start.
+ *        The inference threads are created by the network loading, so they are counted.
+ */
+class HardwareCounter {
+public:
+    explicit HardwareCounter(uint64_t config) {
+#ifdef __linux__
+        DIR* tasks = opendir("/proc/self/task");
+        if (tasks == nullptr)
+            return;
+        while (auto entry = readdir(tasks)) {
+            if (entry->d_name[0] == '.')
+                continue;
+            perf_event_attr attr = {};
+            attr.size = sizeof(attr);
+            attr.type = PERF_TYPE_HW_CACHE;
+            attr.config = config;
+            attr.disabled = 1;
+            attr.exclude_kernel = 1;
+            attr.exclude_hv = 1;
+            const auto tid = static_cast<pid_t>(std::strtol(entry->d_name, nullptr, 10));
+            const auto fd = static_cast<int>(syscall(SYS_perf_event_open, &attr, tid, -1, -1, 0));
+            if (fd < 0) {
+                // the event isn't supported by the CPU or the access is restricted by perf_event_paranoid
+                for (auto opened : fds)
+                    close(opened);
+                fds.clear();
+                break;
+            }
+            fds.push_back(fd);
+        }
+        closedir(tasks);
+#endif
+    }
+
+    ~HardwareCounter() {
+#ifdef __linux__
+        for (auto fd : fds)
+            close(fd);
+#endif
+    }
+
+    void start() {
+#ifdef __linux__
+        for (auto fd : fds) {
+            ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+            ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+        }
+#endif
+    }
+
+    void stop() {
+#ifdef __linux__
+        for (auto fd : fds)
+            ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+#endif
+    }
+
+    /**
+     * @brief Returns the number of events, negative if the counter is not available
+     */
+    double value() const {
+        if (fds.empty())
+            return -1.0;
+        uint64_t total = 0;
+#ifdef __linux__
+        for (auto fd : fds) {
+            uint64_t count = 0;
+            if (read(fd, &count, sizeof(count)) == sizeof(count))
+                total += count;
+        }
+#endif
+        return static_cast<double>(total);
+    }
+
+private:
+    std::vector<int> fds;
+};
+
+#ifdef __linux__
+constexpr uint64_t hwCacheEvent(uint64_t cache, uint64_t op, uint64_t result) {
+    return cache | (op << 8) | (result << 16);
+}
+
+const uint64_t dtlbLoadMissesEvent = hwCacheEvent(PERF_COUNT_HW_CACHE_DTLB, PERF_COUNT_HW_CACHE_OP_READ, PERF_COUNT_HW_CACHE_RESULT_MISS);
+// "node-load-misses": the loads missed the local NUMA node memory
+const uint64_t remoteAccessesEvent = hwCacheEvent(PERF_COUNT_HW_CACHE_NODE, PERF_COUNT_HW_CACHE_OP_READ, PERF_COUNT_HW_CACHE_RESULT_MISS);
+#else
+const uint64_t dtlbLoadMissesEvent = 0;
+const uint64_t remoteAccessesEvent = 0;
+#endif
+
+}  // namespace
+
+std::ostream& operator<<(std::ostream& os, GraphKind kind) {
+    switch (kind) {
+        case GraphKind::SingleOp: return os << "SingleOp";
+        case GraphKind::Subgraph: return os << "Subgraph";
+        default: IE_THROW() << "Unknown graph kind";
+    }
+}
+
+PerfReport& PerfReport::getInstance() {
+    static PerfReport report;
+    return report;
+}
+
+void PerfReport::add(const BenchmarkResult& result) {
+    std::lock_guard<std::mutex> lock(mutex);
+    results.push_back(result);
+}
+
+void PerfReport::save() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (results.empty())
+        return;
+
+    const char* fileName = std::getenv("CPU_PERF_REPORT");
+    std::ofstream out(fileName ? fileName : "cpu_perf_report.json");
+    out << "{\n  \"benchmarks\": [";
+    for (size_t i = 0; i < results.size(); i++) {
+        const auto& r = results[i];
+        out << (i ? ",\n" : "\n")
+            << "    {\"name\": \"" << escape(r.name) << "\""
+            << ", \"node_type\": \"" << r.nodeType << "\""
+            << ", \"impl_type\": \"" << r.implType << "\""
+            << ", \"output_layouts\": \"" << r.outputLayouts << "\""
+            << ", \"runtime_precision\": \"" << r.runtimePrecision << "\""
+            << ", \"iterations\": " << r.iterations
+            << std::fixed << std::setprecision(3)
+            << ", \"mean_us\": " << r.meanUs
+            << ", \"median_us\": " << r.medianUs
+            << ", \"min_us\": " << r.minUs
+            << ", \"throughput_fps\": " << r.throughput
+            << ", \"bandwidth_gbs\": " << r.bandwidthGBs;
+        writeCounter(out, "dtlb_misses_per_inf", r.dtlbMisses);
+        writeCounter(out, "remote_accesses_per_inf", r.remoteAccesses);
+        out << "}";
+        out.unsetf(std::ios_base::floatfield);
+    }
+    out << "\n  ]\n}\n";
+}
+
+std::string CPUPerfTestsCommon::getTestCaseName(const PerfCommonParams& params) {
+    GraphKind kind;
+    InferenceEngine::SizeVector shape;
+    CPUTestUtils::CPUSpecificParams cpuParams;
+    InferenceEngine::Precision precision;
+    std::tie(kind, shape, cpuParams, precision) = params;
+
+    std::ostringstream result;
+    result << kind << "_IS=" << CommonTestUtils::vec2str(shape);
+    result << "_Prc=" << precision.name();
+    result << CPUTestsBase::getTestCaseName(cpuParams);
+    return result.str();
+}
+
+ngraph::element::Type CPUPerfTestsCommon::SetUpCommon(const PerfCommonParams& params) {
+    CPUTestUtils::CPUSpecificParams cpuParams;
+    std::tie(graphKind, inputShape, cpuParams, execPrecision) = params;
+    std::tie(inFmts, outFmts, priority, selectedType) = cpuParams;
+
+    targetDevice = CommonTestUtils::DEVICE_CPU;
+    if (execPrecision == InferenceEngine::Precision::BF16) {
+        // BF16 execution is requested through the plugin config, the function itself stays in FP32
+        configuration.insert({InferenceEngine::PluginConfigParams::KEY_ENFORCE_BF16, InferenceEngine::PluginConfigParams::YES});
+    }
+    if (const char* arena = std::getenv("CPU_PERF_MEMORY_ARENA")) {
+        // e.g. CPU_ARENA_NUMA_THP, to compare the memory placement policies
+        configuration.insert({InferenceEngine::CPUConfigParams::KEY_CPU_MEMORY_ARENA, arena});
+    }
+    inPrc = outPrc = InferenceEngine::Precision::FP32;
+    return ngraph::element::f32;
+}
+
+std::shared_ptr<ngraph::Node> CPUPerfTestsCommon::makeTail(const ngraph::element::Type& ngPrc,
+                                                           const std::shared_ptr<ngraph::Node>& node) const {
+    auto scale = ngraph::builder::makeConstant<float>(ngPrc, {1}, {0.5f});
+    auto multiply = std::make_shared<ngraph::opset1::Multiply>(node, scale);
+    return std::make_shared<ngraph::opset1::Relu>(multiply);
+}
+
+void CPUPerfTestsCommon::RunBenchmark(const std::string& nodeType) {
+    using clock = std::chrono::steady_clock;
+
+    const auto warmupIterations = getEnvValue("CPU_PERF_WARMUP_ITERATIONS", 10);
+    const auto minIterations = std::max<size_t>(getEnvValue("CPU_PERF_MIN_ITERATIONS", 20), 1);
+    const auto minTime = std::chrono::milliseconds(getEnvValue("CPU_PERF_MIN_TIME_MS", 500));
+
+    LoadNetwork();
+    GenerateInputs();
+    // The first inference creates the request, sets the inputs and is accounted as a warm-up one
+    Infer();
+    for (size_t i = 1; i < warmupIterations; i++)
+        inferRequest.Infer();
+
+    HardwareCounter dtlbMisses(dtlbLoadMissesEvent);
+    HardwareCounter remoteAccesses(remoteAccessesEvent);
+    dtlbMisses.start();
+    remoteAccesses.start();
+
+    std::vector<double> timesUs;
+    const auto start = clock::now();
+    do {
+        const auto begin = clock::now();
+        inferRequest.Infer();
+        timesUs.push_back(std::chrono::duration<double, std::micro>(clock::now() - begin).count());
+    } while (timesUs.size() < minIterations || clock::now() - start < minTime);
+
+    dtlbMisses.stop();
+    remoteAccesses.stop();
+
+    size_t bytes = 0;
+    for (const auto& input : inputs)
+        bytes += input->byteSize();
+    for (const auto& output : executableNetwork.GetOutputsInfo())
+        bytes += inferRequest.GetBlob(output.first)->byteSize();
+
+    BenchmarkResult result;
+    const auto testInfo = ::testing::UnitTest::GetInstance()->current_test_info();
+    result.name = std::string(testInfo->test_case_name()) + "." + testInfo->name();
+    result.nodeType = nodeType;
+    result.iterations = timesUs.size();
+    result.meanUs = std::accumulate(timesUs.begin(), timesUs.end(), 0.0) / timesUs.size();
+    std::sort(timesUs.begin(), timesUs.end());
+    result.medianUs = timesUs[timesUs.size() / 2];
+    result.minUs = timesUs.front();
+    result.throughput = 1e6 / result.medianUs;
+    result.bandwidthGBs = static_cast<double>(bytes) / (result.medianUs * 1e3);
+    const auto dtlbMissesCount = dtlbMisses.value();
+    if (dtlbMissesCount >= 0)
+        result.dtlbMisses = dtlbMissesCount / result.iterations;
+    const auto remoteAccessesCount = remoteAccesses.value();
+    if (remoteAccessesCount >= 0)
+        result.remoteAccesses = remoteAccessesCount / result.iterations;
+
+    auto execGraph = executableNetwork.GetExecGraphInfo().getFunction();
+    ASSERT_NE(nullptr, execGraph);
+    for (const auto& node : execGraph->get_ops()) {
+        const auto& rtInfo = node->get_rt_info();
+        auto getExecValue = [&rtInfo](const std::string& paramName) -> std::string {
+            auto it = rtInfo.find(paramName);
+            if (it == rtInfo.end())
+                return {};
+            auto value = std::dynamic_pointer_cast<ngraph::VariantImpl<std::string>>(it->second);
+            return value ? value->get() : std::string{};
+        };
+        if (getExecValue(ExecGraphInfoSerialization::LAYER_TYPE) == nodeType) {
+            result.implType = getExecValue(ExecGraphInfoSerialization::IMPL_TYPE);
+            result.outputLayouts = getExecValue(ExecGraphInfoSerialization::OUTPUT_LAYOUTS);
+            result.runtimePrecision = getExecValue(ExecGraphInfoSerialization::RUNTIME_PRECISION);
+            break;
+        }
+    }
+
+    RecordProperty("impl_type", result.implType);
+    RecordProperty("median_us", std::to_string(result.medianUs));
+    RecordProperty("throughput_fps", std::to_string(result.throughput));
+    RecordProperty("bandwidth_gbs", std::to_string(result.bandwidthGBs));
+    RecordProperty("dtlb_misses_per_inf", std::to_string(result.dtlbMisses));
+    RecordProperty("remote_accesses_per_inf", std::to_string(result.remoteAccesses));
+
+    std::cout << std::left << std::setw(24) << result.implType
+              << " iterations: " << std::setw(8) << result.iterations
+              << std::fixed << std::setprecision(2)
+              << " median: " << result.medianUs << " us"
+              << " min: " << result.minUs << " us"
+              << " " << result.throughput << " inf/s"
+              << " " << result.bandwidthGBs << " GB/s" << std::endl;
+    std::cout.unsetf(std::ios_base::floatfield | std::ios_base::adjustfield);
+
+    PerfReport::getInstance().add(result);
+}
+
+}  // namespace CPUPerfTestUtils
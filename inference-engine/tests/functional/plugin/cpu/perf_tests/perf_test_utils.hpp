@@ -0,0 +1,114 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "test_utils/cpu_test_utils.hpp"
+
+namespace CPUPerfTestUtils {
+
+/**
+ * @brief Defines the shape of the benchmarked function
+ */
+enum class GraphKind {
+    SingleOp,   // the node under test only
+    Subgraph    // the node under test with a small eltwise tail, to measure the fused variant
+};
+
+std::ostream& operator<<(std::ostream& os, GraphKind kind);
+
+/**
+ * @brief Parameters shared by all per-node benchmarks
+ */
+using PerfCommonParams = std::tuple<
+        GraphKind,
+        InferenceEngine::SizeVector,        // input shape
+        CPUTestUtils::CPUSpecificParams,    // input/output layouts
+        InferenceEngine::Precision          // execution precision (FP32 or BF16)
+>;
+
+struct BenchmarkResult {
+    std::string name;
+    std::string nodeType;
+    std::string implType;
+    std::string outputLayouts;
+    std::string runtimePrecision;
+    size_t iterations = 0;
+    double meanUs = 0.0;
+    double medianUs = 0.0;
+    double minUs = 0.0;
+    double throughput = 0.0;      // inferences per second
+    double bandwidthGBs = 0.0;    // input + output bytes moved per second
+    // Hardware events per inference of all the process threads, negative if the counters aren't available
+    double dtlbMisses = -1.0;      // data TLB load misses
+    double remoteAccesses = -1.0;  // loads served from the memory of the remote NUMA node
+};
+
+/**
+ * @brief Collects benchmark results and stores them as JSON to the file given by CPU_PERF_REPORT
+ *        environment variable (cpu_perf_report.json by default) when the test program finishes.
+ */
+class PerfReport {
+public:
+    static PerfReport& getInstance();
+
+    void add(const BenchmarkResult& result);
+    void save() const;
+
+private:
+    PerfReport() = default;
+
+    mutable std::mutex mutex;
+    std::vector<BenchmarkResult> results;
+};
+
+class CPUPerfTestsCommon : virtual public LayerTestsUtils::LayerTestsCommon, public CPUTestUtils::CPUTestsBase {
+public:
+    static std::string getTestCaseName(const PerfCommonParams& params);
+
+protected:
+    /**
+     * @brief Unpacks common parameters, sets the layouts and returns the nGraph precision of the function
+     */
+    ngraph::element::Type SetUpCommon(const PerfCommonParams& params);
+
+    /**
+     * @brief Loads the network, runs warm-up and timed iterations, reports the results.
+     * @param nodeType Execution graph type of the benchmarked node, used to report the selected implementation
+     */
+    void RunBenchmark(const std::string& nodeType);
+
+    /**
+     * @brief Appends the eltwise tail used by GraphKind::Subgraph: Multiply by constant followed by Relu
+     */
+    std::shared_ptr<ngraph::Node> makeTail(const ngraph::element::Type& ngPrc, const std::shared_ptr<ngraph::Node>& node) const;
+
+    GraphKind graphKind = GraphKind::SingleOp;
+    InferenceEngine::SizeVector inputShape;
+    InferenceEngine::Precision execPrecision;
+};
+
+/**
+ * @brief The default benchmark grid shared by the node benchmarks
+ */
+const std::vector<GraphKind> perfGraphKinds = {GraphKind::SingleOp, GraphKind::Subgraph};
+
+const std::vector<InferenceEngine::SizeVector> perfShapes4D = {
+        {1, 64, 56, 56},
+        {1, 256, 28, 28},
+        {1, 1024, 7, 7},
+        {8, 32, 112, 112}
+};
+
+const std::vector<InferenceEngine::Precision> perfPrecisions = {
+        InferenceEngine::Precision::FP32,
+        InferenceEngine::Precision::BF16
+};
+
+}  // namespace CPUPerfTestUtils
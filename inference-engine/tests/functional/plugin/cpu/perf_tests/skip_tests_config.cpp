@@ -0,0 +1,20 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <vector>
+#include <string>
+
+#include <ie_system_conf.h>
+#include "functional_test_utils/skip_tests_config.hpp"
+
+std::vector<std::string> disabledTestPatterns() {
+    std::vector<std::string> retVector;
+
+    if (!InferenceEngine::with_cpu_x86_bfloat16()) {
+        // on platforms which do not support bfloat16, the BF16 kernels are emulated and the numbers are meaningless
+        retVector.emplace_back(R"(.*_Prc=BF16.*)");
+    }
+
+    return retVector;
+}
@@ -0,0 +1,143 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstring>
+#include <memory>
+#include <string>
+#include <utility>
+
+#ifndef _WIN32
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#include <cpu/cpu_context_api.hpp>
+#include <common_test_utils/test_common.hpp>
+
+#include <exec_graph_info.hpp>
+#include <ngraph/variant.hpp>
+#include "ngraph_functions/builders.hpp"
+#include "functional_test_utils/blob_utils.hpp"
+
+using namespace ::testing;
+using namespace InferenceEngine;
+
+class CPURemoteBlob_Test : public CommonTestUtils::TestsCommon {
+protected:
+    std::shared_ptr<ngraph::Function> fn_ptr;
+
+    // The input feeds the convolution only, so the graph can use the user blob in place of the input memory
+    void SetUp() override {
+        const auto ngPrc = ngraph::element::f32;
+        auto params = ngraph::builder::makeParams(ngPrc, {{1, 3, 24, 24}});
+        auto conv = ngraph::builder::makeConvolution(params[0], ngPrc, {3, 3}, {1, 1}, {0, 0}, {0, 0}, {1, 1},
+                                                     ngraph::op::PadType::EXPLICIT, 8);
+        auto relu = std::make_shared<ngraph::opset1::Relu>(conv);
+        fn_ptr = std::make_shared<ngraph::Function>(ngraph::ResultVector{std::make_shared<ngraph::opset1::Result>(relu)},
+                                                    params, "ConvRelu");
+    }
+
+    static void copyTo(const Blob::Ptr& src, const Blob::Ptr& dst) {
+        ASSERT_EQ(src->byteSize(), dst->byteSize());
+        std::memcpy(as<MemoryBlob>(dst)->wmap().as<void*>(), as<MemoryBlob>(src)->rmap().as<const void*>(), src->byteSize());
+    }
+
+    static Blob::Ptr inferRegular(ExecutableNetwork& execNet, const std::string& inputName, const Blob::Ptr& input) {
+        auto request = execNet.CreateInferRequest();
+        request.SetBlob(inputName, input);
+        request.Infer();
+        return request.GetBlob(execNet.GetOutputsInfo().begin()->first);
+    }
+
+    // Returns the numbers of inferences which used the input blob in place and which copied it
+    static std::pair<size_t, size_t> getInputCopyCounts(ExecutableNetwork& execNet, const std::string& inputName) {
+        auto execGraph = execNet.GetExecGraphInfo().getFunction();
+        for (const auto& node : execGraph->get_ops()) {
+            if (!ngraph::op::is_parameter(node) || node->get_friendly_name() != inputName)
+                continue;
+            const auto& rtInfo = node->get_rt_info();
+            auto getCount = [&rtInfo](const std::string& name) -> size_t {
+                auto it = rtInfo.find(name);
+                IE_ASSERT(it != rtInfo.end()) << "No " << name;
+                auto value = std::dynamic_pointer_cast<ngraph::VariantImpl<std::string>>(it->second);
+                IE_ASSERT(value != nullptr);
+                return std::stoul(value->get());
+            };
+            return {getCount("zeroCopyCount"), getCount("copyCount")};
+        }
+        IE_THROW() << "No input " << inputName << " in the execution graph";
+    }
+};
+
+TEST_F(CPURemoteBlob_Test, smoke_canInputMemfdBlob) {
+#if defined(_WIN32) || defined(__APPLE__) || defined(ANDROID)
+    GTEST_SKIP();
+#endif
+    CNNNetwork net(fn_ptr);
+    const auto inputName = net.getInputsInfo().begin()->first;
+    const auto& inputDesc = net.getInputsInfo().begin()->second->getTensorDesc();
+
+    auto ie = InferenceEngine::Core();
+    auto execNet = ie.LoadNetwork(net, CommonTestUtils::DEVICE_CPU);
+    auto fakeImageData = FuncTestUtils::createAndFillBlob(inputDesc);
+    auto outputRegular = inferRegular(execNet, inputName, fakeImageData);
+
+    auto context = execNet.GetContext();
+    ASSERT_NE(nullptr, std::dynamic_pointer_cast<cpu::SharedMemoryContext>(context));
+    auto sharedBlob = cpu::make_shared_blob(inputDesc, context);
+    auto casted = std::dynamic_pointer_cast<cpu::SharedMemoryBlob>(sharedBlob);
+    ASSERT_NE(nullptr, casted);
+    ASSERT_GE(casted->getFd(), 0);
+
+    // the producer maps the same memory by the descriptor, e.g. received from the other process
+    auto producerBlob = cpu::make_shared_blob(inputDesc, context, casted->getFd());
+    copyTo(fakeImageData, producerBlob);
+
+    const auto countsBefore = getInputCopyCounts(execNet, inputName);
+    auto request = execNet.CreateInferRequest();
+    request.SetBlob(inputName, sharedBlob);
+    ASSERT_EQ(sharedBlob, request.GetBlob(inputName));
+    request.Infer();
+    auto outputShared = request.GetBlob(execNet.GetOutputsInfo().begin()->first);
+
+    // the shared memory is used as the graph input memory without a copy
+    const auto countsAfter = getInputCopyCounts(execNet, inputName);
+    EXPECT_EQ(countsBefore.first + 1, countsAfter.first);
+    EXPECT_EQ(countsBefore.second, countsAfter.second);
+
+    ASSERT_EQ(outputRegular->size(), outputShared->size());
+    FuncTestUtils::compareBlobs(outputRegular, outputShared, FuncTestUtils::GetComparisonThreshold(Precision::FP32));
+}
+
+#ifndef _WIN32
+TEST_F(CPURemoteBlob_Test, smoke_canInferOnSharedMemoryContext) {
+#if defined(__APPLE__) || defined(ANDROID)
+    GTEST_SKIP();
+#endif
+    CNNNetwork net(fn_ptr);
+    const auto inputName = net.getInputsInfo().begin()->first;
+    const auto& inputDesc = net.getInputsInfo().begin()->second->getTensorDesc();
+
+    auto ie = InferenceEngine::Core();
+    auto context = cpu::make_shared_context(ie);
+    auto execNetRegular = ie.LoadNetwork(net, CommonTestUtils::DEVICE_CPU);
+    auto execNetShared = ie.LoadNetwork(net, context);
+
+    auto fakeImageData = FuncTestUtils::createAndFillBlob(inputDesc);
+    auto outputRegular = inferRegular(execNetRegular, inputName, fakeImageData);
+
+    const std::string shmName = "/ie_cpu_remote_blob_test_" + std::to_string(getpid());
+    const size_t offset = 100;  // not a multiple of the page size
+    auto sharedBlob = cpu::make_shared_blob(inputDesc, context, shmName, offset);
+    shm_unlink(shmName.c_str());
+    copyTo(fakeImageData, sharedBlob);
+
+    auto outputShared = inferRegular(execNetShared, inputName, sharedBlob);
+    // the shared memory is used as the graph input memory without a copy
+    const auto counts = getInputCopyCounts(execNetShared, inputName);
+    EXPECT_EQ(1u, counts.first);
+    EXPECT_EQ(0u, counts.second);
+    FuncTestUtils::compareBlobs(outputRegular, outputShared, FuncTestUtils::GetComparisonThreshold(Precision::FP32));
+}
+#endif  // _WIN32
@@ -0,0 +1,78 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <blob_factory.hpp>
+#include <ngraph/opsets/opset6.hpp>
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "common_test_utils/data_utils.hpp"
+
+using namespace InferenceEngine;
+
+namespace CPUSubgraphTestsDefinitions {
+
+/* Checks that the network of the operations processing the batch items independently is compiled for the dynamic
+   batch and the first items of the batch are inferred as by the whole batch inference.
+
+       Parameter[4,3,8,8]
+               |
+        MVN(axes={2,3})
+               |
+      Transpose(0,2,3,1)
+               |
+              Abs
+               |
+             Result
+*/
+class DynamicBatchPerSampleOpsCPUTest : virtual public LayerTestsUtils::LayerTestsCommon {
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        auto params = ngraph::builder::makeParams(ngraph::element::f32, {shape});
+        auto axes = ngraph::opset6::Constant::create(ngraph::element::i64, {2}, {2, 3});
+        auto mvn = std::make_shared<ngraph::opset6::MVN>(params[0], axes, true, 1e-9f, ngraph::op::MVNEpsMode::INSIDE_SQRT);
+        auto order = ngraph::opset6::Constant::create(ngraph::element::i64, {4}, {0, 2, 3, 1});
+        auto transpose = std::make_shared<ngraph::opset6::Transpose>(mvn, order);
+        auto abs = std::make_shared<ngraph::opset6::Abs>(transpose);
+        function = std::make_shared<ngraph::Function>(ngraph::ResultVector{std::make_shared<ngraph::opset6::Result>(abs)},
+                                                      params, "DynamicBatchPerSampleOps");
+    }
+
+    Blob::Ptr InferWithBatch(ExecutableNetwork& network, const Blob::Ptr& input, int batch) {
+        auto request = network.CreateInferRequest();
+        request.SetBlob(network.GetInputsInfo().begin()->first, input);
+        if (batch > 0)
+            request.SetBatch(batch);
+        request.Infer();
+        return request.GetBlob(network.GetOutputsInfo().begin()->first);
+    }
+
+    const SizeVector shape = {4, 3, 8, 8};
+};
+
+TEST_F(DynamicBatchPerSampleOpsCPUTest, smoke_FirstItemsOfBatchAreInferred) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    auto staticNetwork = core->LoadNetwork(CNNNetwork{function}, targetDevice);
+    auto dynamicNetwork = core->LoadNetwork(CNNNetwork{function}, targetDevice,
+                                            {{PluginConfigParams::KEY_DYN_BATCH_ENABLED, PluginConfigParams::YES}});
+
+    auto input = make_blob_with_precision(TensorDesc(Precision::FP32, shape, Layout::NCHW));
+    input->allocate();
+    CommonTestUtils::fill_data_random<Precision::FP32>(input, 10, -5, 1, 1);
+
+    const int batch = 2;
+    const auto expected = InferWithBatch(staticNetwork, input, 0);
+    const auto actual = InferWithBatch(dynamicNetwork, input, batch);
+
+    auto expectedData = expected->cbuffer().as<const float*>();
+    auto actualData = actual->cbuffer().as<const float*>();
+    const size_t batchSize = actual->size() / shape[0] * batch;
+    for (size_t i = 0; i < batchSize; i++) {
+        ASSERT_NEAR(expectedData[i], actualData[i], 1e-5f) << "at index " << i;
+    }
+}
+
+}  // namespace CPUSubgraphTestsDefinitions
@@ -0,0 +1,136 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cpu/cpu_config.hpp>
+#include <exec_graph_info.hpp>
+#include <ie_system_conf.h>
+#include "test_utils/fusing_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+
+using namespace ngraph;
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+using FCCompressedWeightsTestParams = std::tuple<SizeVector,            // input shape
+                                                 size_t,                // output channels
+                                                 fusingSpecificParams>;
+
+/* Checks that FullyConnected made of FP16 MatMul keeps the FP16 weights with CPU_COMPRESSED_WEIGHTS enabled, so they
+   take less memory than the FP32 ones. The numbers of the input and output channels aren't multiples of the vector
+   length to check the tails.
+*/
+class FCCompressedWeightsTest : public testing::WithParamInterface<FCCompressedWeightsTestParams>, public CpuTestWithFusing,
+                                virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<FCCompressedWeightsTestParams> obj) {
+        SizeVector inputShape;
+        size_t outputChannels;
+        fusingSpecificParams fusingParams;
+        std::tie(inputShape, outputChannels, fusingParams) = obj.param;
+
+        std::ostringstream result;
+        result << "IS=" << CommonTestUtils::vec2str(inputShape) << "_";
+        result << "OC=" << outputChannels;
+        result << CpuTestWithFusing::getTestCaseName(fusingParams);
+
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        configuration = {{CPUConfigParams::KEY_CPU_COMPRESSED_WEIGHTS, PluginConfigParams::YES}};
+        inPrc = outPrc = Precision::FP32;
+
+        SizeVector inputShape;
+        fusingSpecificParams fusingParams;
+        std::tie(inputShape, outputChannels, fusingParams) = this->GetParam();
+        std::tie(postOpMgrPtr, fusedOps) = fusingParams;
+        inputChannels = inputShape.back();
+
+        auto inputParams = builder::makeParams(element::f16, {inputShape});
+        auto paramOuts = helpers::convert2OutputVector(helpers::castOps2Nodes<op::Parameter>(inputParams));
+        auto matrixB = builder::makeConstant<float>(element::f16, {outputChannels, inputChannels}, {}, true);
+        auto matMul = builder::makeMatMul(paramOuts[0], matrixB, false, true);
+
+        function = makeNgraphFunction(element::f16, inputParams, matMul, "FCCompressedWeights");
+    }
+
+    std::map<std::string, std::string> getFullyConnectedRtInfo() {
+        auto execGraph = executableNetwork.GetExecGraphInfo().getFunction();
+        for (const auto& node : execGraph->get_ops()) {
+            std::map<std::string, std::string> values;
+            for (const auto& rtInfo : node->get_rt_info()) {
+                auto value = std::dynamic_pointer_cast<ngraph::VariantImpl<std::string>>(rtInfo.second);
+                if (value != nullptr)
+                    values[rtInfo.first] = value->get();
+            }
+            if (values[ExecGraphInfoSerialization::LAYER_TYPE] == "FullyConnected")
+                return values;
+        }
+        return {};
+    }
+
+    size_t inputChannels = 0;
+    size_t outputChannels = 0;
+};
+
+TEST_P(FCCompressedWeightsTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    CheckFusingResults(executableNetwork, "FullyConnected");
+    if (!with_cpu_x86_avx2())
+        return;
+
+    auto rtInfo = getFullyConnectedRtInfo();
+    ASSERT_EQ(std::string::npos, rtInfo[ExecGraphInfoSerialization::IMPL_TYPE].find("sparse"));
+    ASSERT_NE(rtInfo.end(), rtInfo.find("weightsBytes"));
+    ASSERT_LT(std::stoul(rtInfo["weightsBytes"]), outputChannels * inputChannels * sizeof(float));
+}
+
+namespace {
+
+const auto fusingBiasFC = fusingSpecificParams{std::make_shared<postNodesMgr>(std::vector<postNodeBuilder>{
+            {[](std::shared_ptr<Node> inpNode, const element::Type& ngPrc, ParameterVector& params) {
+                auto bias = builder::makeConstant(ngPrc, Shape({inpNode->get_input_shape(1).front()}), std::vector<float>{}, true);
+                return std::make_shared<opset1::Add>(inpNode, bias);
+            }, "fusingBiasFC"}}), {"Add"}};
+
+const std::vector<size_t> outputChannels = {
+    40, 128
+};
+
+const std::vector<SizeVector> inputShapes2D = {
+    {1, 96},
+    {37, 100}
+};
+
+std::vector<fusingSpecificParams> fusingParamsSet2D {
+        emptyFusingSpec,
+        fusingBiasFC,
+        fusingRelu
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_Check_2D, FCCompressedWeightsTest,
+                         ::testing::Combine(::testing::ValuesIn(inputShapes2D),
+                                            ::testing::ValuesIn(outputChannels),
+                                            ::testing::ValuesIn(fusingParamsSet2D)),
+                         FCCompressedWeightsTest::getTestCaseName);
+
+const std::vector<SizeVector> inputShapes3D = {
+    {2, 5, 64}
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_Check_3D, FCCompressedWeightsTest,
+                         ::testing::Combine(::testing::ValuesIn(inputShapes3D),
+                                            ::testing::ValuesIn(outputChannels),
+                                            ::testing::Values(emptyFusingSpec)),
+                         FCCompressedWeightsTest::getTestCaseName);
+
+} // namespace
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,170 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cpu/cpu_config.hpp>
+#include <exec_graph_info.hpp>
+#include <ie_system_conf.h>
+#include "test_utils/fusing_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+
+using namespace ngraph;
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+using FCLowBitWeightsTestParams = std::tuple<SizeVector,            // input shape
+                                             size_t,                // output channels
+                                             size_t,                // groups
+                                             element::Type,         // weights precision
+                                             fusingSpecificParams>;
+
+/* Checks that FullyConnected with 4-bit weights decompressed per group keeps the weights packed with
+   CPU_COMPRESSED_WEIGHTS enabled, so they take less memory than the INT8 ones.
+
+     Constant [OC, groups, group size] (u4 or i4)
+           |
+        Convert
+           |
+       Subtract (u4 only)
+           |
+       Multiply
+           |
+        Reshape [OC, IC]
+           |
+        MatMul (transpose_b)
+*/
+class FCLowBitWeightsTest : public testing::WithParamInterface<FCLowBitWeightsTestParams>, public CpuTestWithFusing,
+                            virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<FCLowBitWeightsTestParams> obj) {
+        SizeVector inputShape;
+        size_t outputChannels, groups;
+        element::Type weightsPrc;
+        fusingSpecificParams fusingParams;
+        std::tie(inputShape, outputChannels, groups, weightsPrc, fusingParams) = obj.param;
+
+        std::ostringstream result;
+        result << "IS=" << CommonTestUtils::vec2str(inputShape) << "_";
+        result << "OC=" << outputChannels << "_";
+        result << "G=" << groups << "_";
+        result << "WPRC=" << weightsPrc;
+        result << CpuTestWithFusing::getTestCaseName(fusingParams);
+
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        configuration = {{CPUConfigParams::KEY_CPU_COMPRESSED_WEIGHTS, PluginConfigParams::YES}};
+        inPrc = outPrc = Precision::FP32;
+
+        SizeVector inputShape;
+        size_t groups;
+        element::Type weightsPrc;
+        fusingSpecificParams fusingParams;
+        std::tie(inputShape, outputChannels, groups, weightsPrc, fusingParams) = this->GetParam();
+        std::tie(postOpMgrPtr, fusedOps) = fusingParams;
+        inputChannels = inputShape.back();
+
+        auto inputParams = builder::makeParams(element::f32, {inputShape});
+        auto paramOuts = helpers::convert2OutputVector(helpers::castOps2Nodes<op::Parameter>(inputParams));
+
+        const Shape weightsShape{outputChannels, groups, inputChannels / groups};
+        std::vector<uint8_t> weightsData(shape_size(weightsShape) / 2);
+        for (size_t i = 0; i < weightsData.size(); i++)
+            weightsData[i] = static_cast<uint8_t>((i * 37 + 11) % 256);
+        auto weights = std::make_shared<opset1::Constant>(weightsPrc, weightsShape, weightsData.data());
+        std::shared_ptr<Node> decompression = std::make_shared<opset1::Convert>(weights, element::f32);
+        if (weightsPrc == element::u4) {
+            std::vector<float> zeroPoints(outputChannels * groups);
+            for (size_t i = 0; i < zeroPoints.size(); i++)
+                zeroPoints[i] = static_cast<float>(i % 16);
+            auto zeroPointsConst = builder::makeConstant(element::f32, {outputChannels, groups, 1}, zeroPoints);
+            decompression = std::make_shared<opset1::Subtract>(decompression, zeroPointsConst);
+        }
+        auto scales = builder::makeConstant<float>(element::f32, {outputChannels, groups, 1}, {}, true);
+        decompression = std::make_shared<opset1::Multiply>(decompression, scales);
+        auto shape = builder::makeConstant<int64_t>(element::i64, {2}, {static_cast<int64_t>(outputChannels), static_cast<int64_t>(inputChannels)});
+        auto reshape = std::make_shared<opset1::Reshape>(decompression, shape, false);
+        auto matMul = builder::makeMatMul(paramOuts[0], reshape, false, true);
+
+        function = makeNgraphFunction(element::f32, inputParams, matMul, "FCLowBitWeights");
+    }
+
+    std::map<std::string, std::string> getFullyConnectedRtInfo() {
+        auto execGraph = executableNetwork.GetExecGraphInfo().getFunction();
+        for (const auto& node : execGraph->get_ops()) {
+            std::map<std::string, std::string> values;
+            for (const auto& rtInfo : node->get_rt_info()) {
+                auto value = std::dynamic_pointer_cast<ngraph::VariantImpl<std::string>>(rtInfo.second);
+                if (value != nullptr)
+                    values[rtInfo.first] = value->get();
+            }
+            if (values[ExecGraphInfoSerialization::LAYER_TYPE] == "FullyConnected")
+                return values;
+        }
+        return {};
+    }
+
+    size_t inputChannels = 0;
+    size_t outputChannels = 0;
+};
+
+TEST_P(FCLowBitWeightsTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    CheckFusingResults(executableNetwork, "FullyConnected");
+    if (!with_cpu_x86_avx2())
+        return;
+
+    auto rtInfo = getFullyConnectedRtInfo();
+    ASSERT_NE(std::string::npos, rtInfo[ExecGraphInfoSerialization::IMPL_TYPE].find("jit"));
+    ASSERT_NE(rtInfo.end(), rtInfo.find("weightsBytes"));
+    ASSERT_LT(std::stoul(rtInfo["weightsBytes"]), outputChannels * inputChannels);
+}
+
+namespace {
+
+const auto fusingBiasFC = fusingSpecificParams{std::make_shared<postNodesMgr>(std::vector<postNodeBuilder>{
+            {[](std::shared_ptr<Node> inpNode, const element::Type& ngPrc, ParameterVector& params) {
+                auto bias = builder::makeConstant(ngPrc, Shape({inpNode->get_input_shape(1).front()}), std::vector<float>{}, true);
+                return std::make_shared<opset1::Add>(inpNode, bias);
+            }, "fusingBiasFC"}}), {"Add"}};
+
+const std::vector<element::Type> weightsPrecisions = {
+    element::u4, element::i4
+};
+
+const std::vector<size_t> outputChannels = {
+    40, 128
+};
+
+std::vector<fusingSpecificParams> fusingParamsSet2D {
+        emptyFusingSpec,
+        fusingBiasFC,
+        fusingRelu
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_Check_2D, FCLowBitWeightsTest,
+                         ::testing::Combine(::testing::Values(SizeVector{1, 128}, SizeVector{37, 128}),
+                                            ::testing::ValuesIn(outputChannels),
+                                            ::testing::Values(1, 4),
+                                            ::testing::ValuesIn(weightsPrecisions),
+                                            ::testing::ValuesIn(fusingParamsSet2D)),
+                         FCLowBitWeightsTest::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_Check_3D, FCLowBitWeightsTest,
+                         ::testing::Combine(::testing::Values(SizeVector{2, 5, 256}),
+                                            ::testing::ValuesIn(outputChannels),
+                                            ::testing::Values(2),
+                                            ::testing::ValuesIn(weightsPrecisions),
+                                            ::testing::Values(emptyFusingSpec)),
+                         FCLowBitWeightsTest::getTestCaseName);
+
+} // namespace
+
+} // namespace SubgraphTestsDefinitions
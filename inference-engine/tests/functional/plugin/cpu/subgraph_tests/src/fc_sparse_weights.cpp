@@ -0,0 +1,148 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cpu/cpu_config.hpp>
+#include <exec_graph_info.hpp>
+#include <ie_system_conf.h>
+#include "test_utils/fusing_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+
+using namespace ngraph;
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+using FCSparseWeightsTestParams = std::tuple<SizeVector,            // input shape
+                                             size_t,                // output channels
+                                             fusingSpecificParams>;
+
+/* Checks that FullyConnected with weights consisting mostly of the zero blocks of 16 output channels is executed
+   by the sparse weights kernel. The number of output channels isn't a multiple of the block to check the tail.
+*/
+class FCSparseWeightsTest : public testing::WithParamInterface<FCSparseWeightsTestParams>, public CpuTestWithFusing,
+                            virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<FCSparseWeightsTestParams> obj) {
+        SizeVector inputShape;
+        size_t outputChannels;
+        fusingSpecificParams fusingParams;
+        std::tie(inputShape, outputChannels, fusingParams) = obj.param;
+
+        std::ostringstream result;
+        result << "IS=" << CommonTestUtils::vec2str(inputShape) << "_";
+        result << "OC=" << outputChannels;
+        result << CpuTestWithFusing::getTestCaseName(fusingParams);
+
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        configuration = {{CPUConfigParams::KEY_CPU_SPARSE_WEIGHTS_THRESHOLD, "0.5"}};
+
+        SizeVector inputShape;
+        size_t outputChannels;
+        fusingSpecificParams fusingParams;
+        std::tie(inputShape, outputChannels, fusingParams) = this->GetParam();
+        std::tie(postOpMgrPtr, fusedOps) = fusingParams;
+
+        const size_t inputChannels = inputShape.back();
+        const size_t blockSize = 16;
+        // every fifth block is non-zero
+        std::vector<float> weights(outputChannels * inputChannels, 0.f);
+        for (size_t oc = 0; oc < outputChannels; oc++) {
+            for (size_t ic = 0; ic < inputChannels; ic++) {
+                if ((oc / blockSize * 7 + ic * 13) % 5 == 0)
+                    weights[oc * inputChannels + ic] = static_cast<float>(static_cast<int>((oc * 31 + ic * 17) % 9) - 4) / 8.f;
+            }
+        }
+
+        auto inputParams = builder::makeParams(element::f32, {inputShape});
+        auto paramOuts = helpers::convert2OutputVector(helpers::castOps2Nodes<op::Parameter>(inputParams));
+        auto matrixB = builder::makeConstant<float>(element::f32, {outputChannels, inputChannels}, weights);
+        auto matMul = builder::makeMatMul(paramOuts[0], matrixB, false, true);
+
+        function = makeNgraphFunction(element::f32, inputParams, matMul, "FCSparseWeights");
+    }
+
+    std::string getFullyConnectedImplType() {
+        auto execGraph = executableNetwork.GetExecGraphInfo().getFunction();
+        for (const auto& node : execGraph->get_ops()) {
+            const auto& rtInfo = node->get_rt_info();
+            auto getExecValue = [&rtInfo](const std::string& paramName) -> std::string {
+                auto it = rtInfo.find(paramName);
+                IE_ASSERT(it != rtInfo.end());
+                auto value = std::dynamic_pointer_cast<ngraph::VariantImpl<std::string>>(it->second);
+                IE_ASSERT(value != nullptr);
+                return value->get();
+            };
+            if (getExecValue(ExecGraphInfoSerialization::LAYER_TYPE) == "FullyConnected")
+                return getExecValue(ExecGraphInfoSerialization::IMPL_TYPE);
+        }
+        return {};
+    }
+};
+
+TEST_P(FCSparseWeightsTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    CheckFusingResults(executableNetwork, "FullyConnected");
+    const auto implType = getFullyConnectedImplType();
+    if (with_cpu_x86_avx2())
+        ASSERT_NE(std::string::npos, implType.find("sparse")) << implType;
+    else
+        ASSERT_EQ(std::string::npos, implType.find("sparse")) << implType;
+}
+
+namespace {
+
+const auto fusingBiasFC = fusingSpecificParams{std::make_shared<postNodesMgr>(std::vector<postNodeBuilder>{
+            {[](std::shared_ptr<Node> inpNode, const element::Type& ngPrc, ParameterVector& params) {
+                auto bias = builder::makeConstant(ngPrc, Shape({inpNode->get_input_shape(1).front()}), std::vector<float>{}, true);
+                return std::make_shared<opset1::Add>(inpNode, bias);
+            }, "fusingBiasFC"}}), {"Add"}};
+
+const std::vector<size_t> outputChannels = {
+    40, 128
+};
+
+const std::vector<SizeVector> inputShapes2D = {
+    {1, 96},
+    {37, 256}
+};
+
+std::vector<fusingSpecificParams> fusingParamsSet2D {
+        emptyFusingSpec,
+        fusingBiasFC,
+        fusingRelu,
+        fusingMultiplyPerChannel
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_Check_2D, FCSparseWeightsTest,
+                         ::testing::Combine(::testing::ValuesIn(inputShapes2D),
+                                            ::testing::ValuesIn(outputChannels),
+                                            ::testing::ValuesIn(fusingParamsSet2D)),
+                         FCSparseWeightsTest::getTestCaseName);
+
+const std::vector<SizeVector> inputShapes3D = {
+    {2, 5, 64}
+};
+
+std::vector<fusingSpecificParams> fusingParamsSet3D {
+        emptyFusingSpec,
+        fusingBiasFC
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_Check_3D, FCSparseWeightsTest,
+                         ::testing::Combine(::testing::ValuesIn(inputShapes3D),
+                                            ::testing::ValuesIn(outputChannels),
+                                            ::testing::ValuesIn(fusingParamsSet3D)),
+                         FCSparseWeightsTest::getTestCaseName);
+
+} // namespace
+
+} // namespace SubgraphTestsDefinitions
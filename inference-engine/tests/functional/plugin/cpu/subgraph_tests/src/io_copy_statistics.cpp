@@ -0,0 +1,85 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+
+using namespace InferenceEngine;
+
+namespace CPUSubgraphTestsDefinitions {
+
+/* Checks that the execution graph reports for each input and output how many inferences
+   used the user blob in place and how many copied it.
+
+       Parameter[FP32]   Parameter[FP32]
+               \          /
+                   Add
+                    |
+                  Result
+*/
+class IOCopyStatisticsCPUTest : virtual public LayerTestsUtils::LayerTestsCommon {
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        auto params = ngraph::builder::makeParams(ngraph::element::f32, {{1, 32, 64, 64}, {1, 32, 64, 64}});
+        auto add = std::make_shared<ngraph::opset1::Add>(params[0], params[1]);
+        function = std::make_shared<ngraph::Function>(ngraph::ResultVector{std::make_shared<ngraph::opset1::Result>(add)},
+                                                      params, "IOCopyStatistics");
+    }
+
+    // Checks that each input and output of the execution graph counts the given number of inferences
+    static void CheckCounters(ExecutableNetwork& network, size_t inferences) {
+        auto execGraph = network.GetExecGraphInfo().getFunction();
+        ASSERT_NE(nullptr, execGraph);
+        size_t ioNodes = 0;
+        for (const auto& node : execGraph->get_ops()) {
+            if (!ngraph::op::is_parameter(node) && !ngraph::op::is_output(node))
+                continue;
+            const auto& rtInfo = node->get_rt_info();
+            auto getCount = [&rtInfo](const std::string& name) -> size_t {
+                auto it = rtInfo.find(name);
+                IE_ASSERT(it != rtInfo.end()) << "No " << name;
+                auto value = std::dynamic_pointer_cast<ngraph::VariantImpl<std::string>>(it->second);
+                IE_ASSERT(value != nullptr);
+                return std::stoul(value->get());
+            };
+            EXPECT_EQ(inferences, getCount("zeroCopyCount") + getCount("copyCount")) << node->get_friendly_name();
+            ioNodes++;
+        }
+        ASSERT_EQ(3, ioNodes);
+    }
+};
+
+TEST_F(IOCopyStatisticsCPUTest, smoke_CountersMatchInferences) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    constexpr size_t inferIterations = 3;
+    Run();
+    for (size_t i = 1; i < inferIterations; i++)
+        inferRequest.Infer();
+
+    CheckCounters(executableNetwork, inferIterations);
+}
+
+TEST_F(IOCopyStatisticsCPUTest, smoke_CountersOfAllStreamsAreSummed) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    constexpr size_t streams = 2;
+    constexpr size_t inferIterations = 3;
+    auto network = core->LoadNetwork(CNNNetwork{function}, targetDevice,
+                                     {{PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, std::to_string(streams)}});
+    std::vector<InferRequest> requests;
+    for (size_t i = 0; i < streams; i++)
+        requests.push_back(network.CreateInferRequest());
+    for (size_t i = 0; i < inferIterations; i++) {
+        for (auto& request : requests)
+            request.StartAsync();
+        for (auto& request : requests)
+            request.Wait(InferRequest::WaitMode::RESULT_READY);
+    }
+
+    CheckCounters(network, streams * inferIterations);
+}
+
+}  // namespace CPUSubgraphTestsDefinitions
@@ -0,0 +1,92 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cpu/cpu_config.hpp>
+#include <exec_graph_info.hpp>
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+
+using namespace InferenceEngine;
+
+namespace CPUSubgraphTestsDefinitions {
+
+/* Checks that the global layout assignment doesn't increase the amount of reordered data and keeps the results.
+   The reported reorders are the ones of the compiled graph, the optimized reorders are listed but don't copy the data.
+   The eltwise feeds a convolution which prefers the blocked layout and two planar consumers.
+
+            Parameter[1,32,28,28]
+                    |
+               Convolution
+                    |
+            Multiply by Constant
+            /       |        \
+     Convolution  Softmax  Transpose
+           |        |          |
+        Result    Result     Result
+*/
+class LayoutAssignmentCPUTest : virtual public LayerTestsUtils::LayerTestsCommon {
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        const auto ngPrc = ngraph::element::f32;
+        auto params = ngraph::builder::makeParams(ngPrc, {{1, 32, 28, 28}});
+        auto conv = ngraph::builder::makeConvolution(params[0], ngPrc, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                                     ngraph::op::PadType::EXPLICIT, 32);
+        auto scale = ngraph::builder::makeConstant<float>(ngPrc, {1, 32, 1, 1}, {}, true);
+        auto multiply = std::make_shared<ngraph::opset1::Multiply>(conv, scale);
+        auto conv2 = ngraph::builder::makeConvolution(multiply, ngPrc, {1, 1}, {1, 1}, {0, 0}, {0, 0}, {1, 1},
+                                                      ngraph::op::PadType::EXPLICIT, 16);
+        auto softmax = std::make_shared<ngraph::opset1::Softmax>(multiply, 3);
+        auto order = ngraph::builder::makeConstant<int64_t>(ngraph::element::i64, {4}, {0, 2, 3, 1});
+        auto transpose = std::make_shared<ngraph::opset1::Transpose>(multiply, order);
+
+        ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(conv2),
+                                     std::make_shared<ngraph::opset1::Result>(softmax),
+                                     std::make_shared<ngraph::opset1::Result>(transpose)};
+        function = std::make_shared<ngraph::Function>(results, params, "LayoutAssignment");
+    }
+
+    uint64_t GetMetric(const std::string& name) {
+        return executableNetwork.GetMetric(name).as<uint64_t>();
+    }
+
+    uint64_t GetReorderLayersCount() {
+        auto execGraph = executableNetwork.GetExecGraphInfo().getFunction();
+        uint64_t count = 0;
+        for (const auto& node : execGraph->get_ops()) {
+            const auto& rtInfo = node->get_rt_info();
+            auto it = rtInfo.find(ExecGraphInfoSerialization::LAYER_TYPE);
+            IE_ASSERT(it != rtInfo.end());
+            auto value = std::dynamic_pointer_cast<ngraph::VariantImpl<std::string>>(it->second);
+            IE_ASSERT(value != nullptr);
+            if (value->get() == "Reorder")
+                count++;
+        }
+        return count;
+    }
+};
+
+TEST_F(LayoutAssignmentCPUTest, smoke_GlobalDoesNotIncreaseReorders) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    configuration = {{CPUConfigParams::KEY_CPU_LAYOUT_ASSIGNMENT, CPUConfigParams::CPU_LAYOUT_GREEDY}};
+    LoadNetwork();
+    const auto greedyCount = GetMetric(CPU_METRIC_KEY(REORDER_COUNT));
+    const auto greedyBytes = GetMetric(CPU_METRIC_KEY(REORDER_BYTES));
+    EXPECT_GT(greedyCount, 0);
+    EXPECT_GT(greedyBytes, 0);
+    EXPECT_LE(greedyCount, GetReorderLayersCount());
+    EXPECT_EQ(greedyCount, GetMetric(CPU_METRIC_KEY(GREEDY_REORDER_COUNT)));
+    EXPECT_EQ(greedyBytes, GetMetric(CPU_METRIC_KEY(GREEDY_REORDER_BYTES)));
+
+    configuration = {{CPUConfigParams::KEY_CPU_LAYOUT_ASSIGNMENT, CPUConfigParams::CPU_LAYOUT_GLOBAL}};
+    Run();
+    EXPECT_EQ(greedyCount, GetMetric(CPU_METRIC_KEY(GREEDY_REORDER_COUNT)));
+    EXPECT_EQ(greedyBytes, GetMetric(CPU_METRIC_KEY(GREEDY_REORDER_BYTES)));
+    EXPECT_LE(GetMetric(CPU_METRIC_KEY(REORDER_COUNT)), GetReorderLayersCount());
+    EXPECT_LE(GetMetric(CPU_METRIC_KEY(REORDER_BYTES)), greedyBytes);
+}
+
+}  // namespace CPUSubgraphTestsDefinitions
@@ -0,0 +1,109 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cpu/cpu_config.hpp>
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "common_test_utils/data_utils.hpp"
+
+using namespace InferenceEngine;
+
+namespace CPUSubgraphTestsDefinitions {
+
+/* Checks that the asynchronous requests started together are inferred as one batch and each of them gets its own
+   outputs.
+
+       Parameter[1,16,8,8]   Constant[1,16,1,1]
+                   \           /
+                       Add
+                        |
+                       Relu
+                        |
+                      Result
+*/
+class RequestBatchingCPUTest : virtual public LayerTestsUtils::LayerTestsCommon {
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        for (size_t c = 0; c < channels; c++)
+            bias.push_back(0.1f * c - 0.5f);
+
+        auto params = ngraph::builder::makeParams(ngraph::element::f32, {shape});
+        auto biasNode = ngraph::builder::makeConstant(ngraph::element::f32, {1, channels, 1, 1}, bias);
+        auto add = std::make_shared<ngraph::opset1::Add>(params[0], biasNode);
+        auto relu = std::make_shared<ngraph::opset1::Relu>(add);
+        function = std::make_shared<ngraph::Function>(ngraph::ResultVector{std::make_shared<ngraph::opset1::Result>(relu)},
+                                                      params, "RequestBatching");
+    }
+
+    // Starts the requests at once and validates the outputs of each of them
+    void InferAndValidate(size_t numRequests) {
+        const auto inputName = executableNetwork.GetInputsInfo().begin()->first;
+        const auto outputName = executableNetwork.GetOutputsInfo().begin()->first;
+
+        std::vector<InferRequest> requests;
+        for (size_t i = 0; i < numRequests; i++) {
+            requests.push_back(executableNetwork.CreateInferRequest());
+            auto input = requests.back().GetBlob(inputName);
+            CommonTestUtils::fill_data_random<Precision::FP32>(input, 10, -5, 1, static_cast<int>(i + 1));
+        }
+        for (auto& request : requests)
+            request.StartAsync();
+        for (auto& request : requests)
+            request.Wait(InferRequest::RESULT_READY);
+
+        for (auto& request : requests) {
+            auto input = request.GetBlob(inputName);
+            auto output = request.GetBlob(outputName);
+            ASSERT_EQ(shape, output->getTensorDesc().getDims());
+            auto inputData = input->cbuffer().as<const float*>();
+            auto outputData = output->cbuffer().as<const float*>();
+            const size_t spatial = shape[2] * shape[3];
+            for (size_t i = 0; i < output->size(); i++) {
+                const auto expected = std::max(inputData[i] + bias[(i / spatial) % channels], 0.f);
+                ASSERT_FLOAT_EQ(expected, outputData[i]) << "at index " << i;
+            }
+        }
+    }
+
+    const size_t channels = 16;
+    const SizeVector shape = {1, channels, 8, 8};
+    std::vector<float> bias;
+};
+
+TEST_F(RequestBatchingCPUTest, smoke_FullBatch) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    configuration = {{CPUConfigParams::KEY_CPU_BATCHING_MAX_BATCH, "4"},
+                     {CPUConfigParams::KEY_CPU_BATCHING_TIMEOUT, "1000000"}};
+    LoadNetwork();
+
+    InferAndValidate(4);
+    EXPECT_FLOAT_EQ(4.f, executableNetwork.GetMetric(CPU_METRIC_KEY(BATCHING_AVERAGE_BATCH_SIZE)).as<float>());
+}
+
+TEST_F(RequestBatchingCPUTest, smoke_PaddedBatchAfterTimeout) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    configuration = {{CPUConfigParams::KEY_CPU_BATCHING_MAX_BATCH, "8"},
+                     {CPUConfigParams::KEY_CPU_BATCHING_TIMEOUT, "100000"}};
+    LoadNetwork();
+
+    InferAndValidate(3);
+    EXPECT_FLOAT_EQ(3.f, executableNetwork.GetMetric(CPU_METRIC_KEY(BATCHING_AVERAGE_BATCH_SIZE)).as<float>());
+    EXPECT_GT(executableNetwork.GetMetric(CPU_METRIC_KEY(BATCHING_MAX_QUEUE_TIME)).as<float>(), 0.f);
+}
+
+TEST_F(RequestBatchingCPUTest, smoke_SyncRequestIsInferredAlone) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    configuration = {{CPUConfigParams::KEY_CPU_BATCHING_MAX_BATCH, "4"}};
+    LoadNetwork();
+    inferRequest = executableNetwork.CreateInferRequest();
+    inferRequest.Infer();
+    EXPECT_FLOAT_EQ(0.f, executableNetwork.GetMetric(CPU_METRIC_KEY(BATCHING_AVERAGE_BATCH_SIZE)).as<float>());
+}
+
+}  // namespace CPUSubgraphTestsDefinitions
@@ -0,0 +1,81 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <chrono>
+#include <thread>
+
+#include <cpu/cpu_config.hpp>
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+
+using namespace InferenceEngine;
+
+namespace CPUSubgraphTestsDefinitions {
+
+/* Checks that the networks with the request priority share the streams executor, so the latencies of the requests
+   of both priorities are reported by each of them.
+
+       Parameter[1,16,8,8]
+               |
+              Relu
+               |
+             Result
+*/
+class RequestPriorityCPUTest : virtual public LayerTestsUtils::LayerTestsCommon {
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        auto params = ngraph::builder::makeParams(ngraph::element::f32, {{1, 16, 8, 8}});
+        auto relu = std::make_shared<ngraph::opset1::Relu>(params[0]);
+        function = std::make_shared<ngraph::Function>(ngraph::ResultVector{std::make_shared<ngraph::opset1::Result>(relu)},
+                                                      params, "RequestPriority");
+    }
+
+    ExecutableNetwork LoadWithPriority(const std::string& priority) {
+        std::map<std::string, std::string> config = {{PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, "1"},
+                                                     {CPUConfigParams::KEY_CPU_HIGH_PRIORITY_STREAMS, "1"},
+                                                     {CPUConfigParams::KEY_CPU_REQUEST_PRIORITY, priority}};
+        return core->LoadNetwork(CNNNetwork{function}, targetDevice, config);
+    }
+
+    static void InferAsync(ExecutableNetwork& network, size_t numRequests) {
+        std::vector<InferRequest> requests;
+        for (size_t i = 0; i < numRequests; i++)
+            requests.push_back(network.CreateInferRequest());
+        for (auto& request : requests)
+            request.StartAsync();
+        for (auto& request : requests)
+            ASSERT_EQ(StatusCode::OK, request.Wait(InferRequest::RESULT_READY));
+    }
+
+    // The latency is accounted by the stream after the request is completed
+    static float WaitForLatency(ExecutableNetwork& network, const std::string& metric) {
+        float latency = 0.f;
+        for (int i = 0; i < 1000 && latency == 0.f; i++) {
+            latency = network.GetMetric(metric).as<float>();
+            if (latency == 0.f)
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        return latency;
+    }
+};
+
+TEST_F(RequestPriorityCPUTest, smoke_LatenciesOfBothPrioritiesAreReported) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    auto normalNetwork = LoadWithPriority(CPUConfigParams::CPU_PRIORITY_NORMAL);
+    auto highNetwork = LoadWithPriority(CPUConfigParams::CPU_PRIORITY_HIGH);
+    EXPECT_EQ(CPUConfigParams::CPU_PRIORITY_HIGH, highNetwork.GetConfig(CPUConfigParams::KEY_CPU_REQUEST_PRIORITY).as<std::string>());
+
+    InferAsync(normalNetwork, 4);
+    InferAsync(highNetwork, 2);
+
+    for (auto network : {&normalNetwork, &highNetwork}) {
+        EXPECT_GT(WaitForLatency(*network, CPU_METRIC_KEY(NORMAL_PRIORITY_MAX_LATENCY)), 0.f);
+        EXPECT_GT(WaitForLatency(*network, CPU_METRIC_KEY(HIGH_PRIORITY_MAX_LATENCY)), 0.f);
+    }
+}
+
+}  // namespace CPUSubgraphTestsDefinitions
@@ -0,0 +1,171 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cpu/cpu_config.hpp>
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "common_test_utils/data_utils.hpp"
+#include <blob_factory.hpp>
+
+using namespace InferenceEngine;
+
+namespace CPUSubgraphTestsDefinitions {
+
+/* Checks that the graphs compiled for the input shapes other than the network ones are reused.
+
+       Parameter[1,16,H,W]   Constant[1,16,1,1]
+                   \           /
+                       Add
+                        |
+                       Relu
+                        |
+                      Result
+*/
+class ShapeCacheCPUTest : virtual public LayerTestsUtils::LayerTestsCommon {
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        for (size_t c = 0; c < channels; c++)
+            bias.push_back(0.1f * c - 0.5f);
+
+        auto params = ngraph::builder::makeParams(ngraph::element::f32, {{1, channels, 8, 8}});
+        auto biasNode = ngraph::builder::makeConstant(ngraph::element::f32, {1, channels, 1, 1}, bias);
+        auto add = std::make_shared<ngraph::opset1::Add>(params[0], biasNode);
+        auto relu = std::make_shared<ngraph::opset1::Relu>(add);
+        function = std::make_shared<ngraph::Function>(ngraph::ResultVector{std::make_shared<ngraph::opset1::Result>(relu)},
+                                                      params, "ShapeCache");
+    }
+
+    void InferAndValidate(const SizeVector& shape) {
+        const auto inputName = executableNetwork.GetInputsInfo().begin()->first;
+        const auto outputName = executableNetwork.GetOutputsInfo().begin()->first;
+
+        auto input = make_blob_with_precision(TensorDesc(Precision::FP32, shape, Layout::NCHW));
+        input->allocate();
+        CommonTestUtils::fill_data_random<Precision::FP32>(input, 10, -5);
+        inferRequest.SetBlob(inputName, input);
+        inferRequest.Infer();
+
+        auto output = inferRequest.GetBlob(outputName);
+        ASSERT_EQ(shape, output->getTensorDesc().getDims());
+        auto inputData = input->cbuffer().as<const float*>();
+        auto outputData = output->cbuffer().as<const float*>();
+        const size_t spatial = shape[2] * shape[3];
+        for (size_t i = 0; i < output->size(); i++) {
+            const auto expected = std::max(inputData[i] + bias[(i / spatial) % channels], 0.f);
+            ASSERT_FLOAT_EQ(expected, outputData[i]) << "at index " << i;
+        }
+    }
+
+    void CheckCacheMetrics(uint64_t hits, uint64_t misses) {
+        EXPECT_EQ(hits, executableNetwork.GetMetric(CPU_METRIC_KEY(SHAPE_CACHE_HITS)).as<uint64_t>());
+        EXPECT_EQ(misses, executableNetwork.GetMetric(CPU_METRIC_KEY(SHAPE_CACHE_MISSES)).as<uint64_t>());
+    }
+
+    const size_t channels = 16;
+    std::vector<float> bias;
+};
+
+TEST_F(ShapeCacheCPUTest, smoke_ReuseAndEvictGraphs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    configuration = {{CPUConfigParams::KEY_CPU_SHAPE_CACHE_SIZE, "2"}};
+    LoadNetwork();
+    inferRequest = executableNetwork.CreateInferRequest();
+
+    InferAndValidate({1, channels, 8, 8});      // network shapes, hit
+    InferAndValidate({1, channels, 12, 12});    // miss
+    InferAndValidate({1, channels, 12, 12});    // hit
+    InferAndValidate({1, channels, 4, 4});      // miss
+    InferAndValidate({1, channels, 6, 6});      // miss, evicts 12x12
+    InferAndValidate({1, channels, 12, 12});    // miss
+    InferAndValidate({1, channels, 8, 8});      // hit
+    CheckCacheMetrics(3, 4);
+}
+
+TEST_F(ShapeCacheCPUTest, smoke_PrecompiledBuckets) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    configuration = {{CPUConfigParams::KEY_CPU_SHAPE_BUCKETS, "1x16x12x12;1x16x4x4"}};
+    LoadNetwork();
+    inferRequest = executableNetwork.CreateInferRequest();
+
+    InferAndValidate({1, channels, 4, 4});
+    InferAndValidate({1, channels, 12, 12});
+    CheckCacheMetrics(2, 0);
+}
+
+TEST_F(ShapeCacheCPUTest, smoke_OtherShapesRequireCache) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    LoadNetwork();
+    inferRequest = executableNetwork.CreateInferRequest();
+
+    auto input = make_blob_with_precision(TensorDesc(Precision::FP32, {1, channels, 4, 4}, Layout::NCHW));
+    input->allocate();
+    ASSERT_THROW(inferRequest.SetBlob(executableNetwork.GetInputsInfo().begin()->first, input), Exception);
+}
+
+/* Checks that the constants depending on the input shapes aren't shared between the graphs of different shapes,
+   while they have the same names and dims.
+
+       Parameter[1,4,H,W]
+           |         \
+           |       ShapeOf
+           |          |
+           |     Gather(W axis)
+           |          |
+           |     Convert(f32)
+           |         /
+              Add
+               |
+             Result
+*/
+class ShapeDependentConstantsCPUTest : virtual public LayerTestsUtils::LayerTestsCommon {
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        auto params = ngraph::builder::makeParams(ngraph::element::f32, {{1, 4, 8, 8}});
+        auto shapeOf = std::make_shared<ngraph::opset1::ShapeOf>(params[0]);
+        auto width = std::make_shared<ngraph::opset1::Gather>(shapeOf,
+                                                               ngraph::opset1::Constant::create(ngraph::element::i64, {1}, {3}),
+                                                               ngraph::opset1::Constant::create(ngraph::element::i64, {}, {0}));
+        auto convert = std::make_shared<ngraph::opset1::Convert>(width, ngraph::element::f32);
+        auto add = std::make_shared<ngraph::opset1::Add>(params[0], convert);
+        function = std::make_shared<ngraph::Function>(ngraph::ResultVector{std::make_shared<ngraph::opset1::Result>(add)},
+                                                      params, "ShapeDependentConstants");
+    }
+
+    void InferAndValidate(const SizeVector& shape) {
+        auto input = make_blob_with_precision(TensorDesc(Precision::FP32, shape, Layout::NCHW));
+        input->allocate();
+        CommonTestUtils::fill_data_random<Precision::FP32>(input, 10, -5);
+        inferRequest.SetBlob(executableNetwork.GetInputsInfo().begin()->first, input);
+        inferRequest.Infer();
+
+        auto output = inferRequest.GetBlob(executableNetwork.GetOutputsInfo().begin()->first);
+        auto inputData = input->cbuffer().as<const float*>();
+        auto outputData = output->cbuffer().as<const float*>();
+        for (size_t i = 0; i < output->size(); i++) {
+            ASSERT_FLOAT_EQ(inputData[i] + shape[3], outputData[i]) << "at index " << i;
+        }
+    }
+};
+
+TEST_F(ShapeDependentConstantsCPUTest, smoke_ConstantsAreNotShared) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    configuration = {{CPUConfigParams::KEY_CPU_SHAPE_CACHE_SIZE, "2"}};
+    LoadNetwork();
+    inferRequest = executableNetwork.CreateInferRequest();
+
+    InferAndValidate({1, 4, 8, 8});
+    InferAndValidate({1, 4, 8, 12});
+    InferAndValidate({1, 4, 8, 6});
+    InferAndValidate({1, 4, 8, 8});
+}
+
+}  // namespace CPUSubgraphTestsDefinitions
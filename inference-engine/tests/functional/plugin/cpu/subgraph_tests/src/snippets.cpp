@@ -0,0 +1,97 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cpu/cpu_config.hpp>
+#include <exec_graph_info.hpp>
+#include <ie_system_conf.h>
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+
+using namespace InferenceEngine;
+
+namespace CPUSubgraphTestsDefinitions {
+
+/* Checks that an elementwise chain is executed by the generated snippet kernel. The operations feeding the results are
+   not tokenized, so the snippet consists of Add, Multiply and Subtract and has two outputs: Add and Subtract.
+   B is broadcasted along the innermost dim, C along the dim before it, the innermost dim leaves a scalar tail.
+
+       A   B
+        \ /
+        Add    C
+         | \  /
+         | Multiply
+         |    |
+         | Subtract 2
+         |  /     \
+       Multiply   Relu
+          |         |
+        Result    Result
+*/
+class SnippetsCPUTest : public testing::WithParamInterface<SizeVector>,
+                        virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<SizeVector> obj) {
+        std::ostringstream result;
+        result << "IS=" << CommonTestUtils::vec2str(obj.param);
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        configuration = {{CPUConfigParams::KEY_CPU_SNIPPETS, PluginConfigParams::YES}};
+
+        const auto ngPrc = ngraph::element::f32;
+        const auto shapeA = GetParam();
+        auto shapeB = shapeA;
+        shapeB.back() = 1;
+        auto shapeC = shapeA;
+        shapeC[shapeC.size() - 2] = 1;
+
+        auto params = ngraph::builder::makeParams(ngPrc, {shapeA, shapeB, shapeC});
+        auto add = std::make_shared<ngraph::opset1::Add>(params[0], params[1]);
+        auto mul = std::make_shared<ngraph::opset1::Multiply>(add, params[2]);
+        auto two = ngraph::builder::makeConstant<float>(ngPrc, {1}, {2.f});
+        auto sub = std::make_shared<ngraph::opset1::Subtract>(mul, two);
+        auto mul2 = std::make_shared<ngraph::opset1::Multiply>(add, sub);
+        auto relu = std::make_shared<ngraph::opset1::Relu>(sub);
+
+        ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(mul2),
+                                     std::make_shared<ngraph::opset1::Result>(relu)};
+        function = std::make_shared<ngraph::Function>(results, params, "Snippets");
+    }
+
+    size_t CountSnippets() {
+        auto execGraph = executableNetwork.GetExecGraphInfo().getFunction();
+        size_t count = 0;
+        for (const auto& node : execGraph->get_ops()) {
+            const auto& rtInfo = node->get_rt_info();
+            auto it = rtInfo.find(ExecGraphInfoSerialization::LAYER_TYPE);
+            IE_ASSERT(it != rtInfo.end());
+            auto value = std::dynamic_pointer_cast<ngraph::VariantImpl<std::string>>(it->second);
+            IE_ASSERT(value != nullptr);
+            if (value->get() == "Subgraph")
+                count++;
+        }
+        return count;
+    }
+};
+
+TEST_P(SnippetsCPUTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    if (with_cpu_x86_avx2())
+        ASSERT_EQ(1, CountSnippets());
+    else
+        ASSERT_EQ(0, CountSnippets());
+}
+
+INSTANTIATE_TEST_CASE_P(smoke_Snippets, SnippetsCPUTest,
+                        ::testing::Values(SizeVector{1, 3, 17, 33},
+                                          SizeVector{2, 5, 4, 7, 19},
+                                          SizeVector{1, 1, 3, 1000}),
+                        SnippetsCPUTest::getTestCaseName);
+
+}  // namespace CPUSubgraphTestsDefinitions
@@ -0,0 +1,83 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstring>
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+
+using namespace InferenceEngine;
+
+namespace CPUSubgraphTestsDefinitions {
+
+/* Checks that the graphs of the streams made from the single compiled template give the same results.
+   Relu and FakeQuantize are fused into Convolution, so the copies of the fused nodes are checked as well.
+
+       Parameter
+           |
+      Convolution
+           |
+          Relu
+           |
+      FakeQuantize
+           |
+       Transpose
+           |
+         Result
+*/
+class StreamsGraphTemplateCPUTest : public testing::WithParamInterface<std::string>,
+                                    virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<std::string> obj) {
+        return "streams=" + obj.param;
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        configuration = {{PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, GetParam()}};
+
+        const auto ngPrc = ngraph::element::f32;
+        auto params = ngraph::builder::makeParams(ngPrc, {{1, 8, 10, 10}});
+        auto conv = ngraph::builder::makeConvolution(params[0], ngPrc, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                                     ngraph::op::PadType::EXPLICIT, 16, true);
+        auto relu = std::make_shared<ngraph::opset1::Relu>(conv);
+        auto fq = ngraph::builder::makeFakeQuantize(relu, ngPrc, 256, {1, 16, 1, 1});
+        auto order = ngraph::builder::makeConstant<int64_t>(ngraph::element::i64, {4}, {0, 2, 3, 1});
+        auto transpose = std::make_shared<ngraph::opset1::Transpose>(fq, order);
+
+        function = std::make_shared<ngraph::Function>(ngraph::ResultVector{std::make_shared<ngraph::opset1::Result>(transpose)},
+                                                      params, "StreamsGraphTemplate");
+    }
+};
+
+TEST_P(StreamsGraphTemplateCPUTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+
+    const auto inputName = executableNetwork.GetInputsInfo().begin()->first;
+    const auto outputName = executableNetwork.GetOutputsInfo().begin()->first;
+    const auto expected = inferRequest.GetBlob(outputName);
+
+    // the requests are executed by different streams
+    std::vector<InferRequest> requests;
+    for (size_t i = 0; i < 8; i++) {
+        requests.push_back(executableNetwork.CreateInferRequest());
+        requests.back().SetBlob(inputName, inputs[0]);
+    }
+    for (auto& request : requests)
+        request.StartAsync();
+    for (auto& request : requests) {
+        ASSERT_EQ(StatusCode::OK, request.Wait(InferRequest::WaitMode::RESULT_READY));
+        const auto actual = request.GetBlob(outputName);
+        ASSERT_EQ(expected->byteSize(), actual->byteSize());
+        ASSERT_EQ(0, std::memcmp(expected->cbuffer().as<const void*>(), actual->cbuffer().as<const void*>(), expected->byteSize()));
+    }
+}
+
+INSTANTIATE_TEST_CASE_P(smoke_StreamsGraphTemplate, StreamsGraphTemplateCPUTest,
+                        ::testing::Values("1", "4"),
+                        StreamsGraphTemplateCPUTest::getTestCaseName);
+
+}  // namespace CPUSubgraphTestsDefinitions
@@ -5,6 +5,7 @@
 #include "hetero/synthetic.hpp"
 #include <ngraph/op/util/op_types.hpp>
 #include <ngraph/variant.hpp>
+#include <hetero/hetero_plugin_config.hpp>
 #include "ngraph_functions/builders.hpp"
 #include "ngraph_functions/subgraph_builders.hpp"
 #include <random>
@@ -149,4 +150,39 @@ TEST_P(HeteroSyntheticTest, someLayersToMajorPluginOthersToFallback) {
     }
 }
 
+TEST_P(HeteroSyntheticTest, pipelinedSubgraphsMatchReference) {
+    auto affinities = SetUpAffinity();
+    SCOPED_TRACE(affinities);
+    configuration[HETERO_CONFIG_KEY(PIPELINE)] = CONFIG_VALUE(YES);
+    configuration[CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS)] = CONFIG_VALUE(NO);
+    Run();
+    if (FuncTestUtils::SkipTestsConfig::currentTestIsDisabled()) {
+        return;
+    }
+    ASSERT_TRUE(executableNetwork.GetConfig(HETERO_CONFIG_KEY(PIPELINE)).as<bool>());
+
+    // several requests in flight share the stage pools and the intermediate buffers
+    const auto expectedOutputs = GetOutputs();
+    std::vector<InferenceEngine::InferRequest> requests;
+    for (int i = 0; i < 4; ++i) {
+        requests.push_back(executableNetwork.CreateInferRequest());
+        const auto& functionParams = function->get_parameters();
+        for (std::size_t p = 0; p < functionParams.size(); ++p) {
+            requests.back().SetBlob(functionParams[p]->get_friendly_name(), inputs[p]);
+        }
+    }
+    for (int iteration = 0; iteration < 3; ++iteration) {
+        for (auto&& request : requests) {
+            request.StartAsync();
+        }
+        for (auto&& request : requests) {
+            request.Wait(InferenceEngine::InferRequest::WaitMode::RESULT_READY);
+            auto outputInfo = executableNetwork.GetOutputsInfo().begin();
+            for (std::size_t i = 0; i < expectedOutputs.size(); ++i, ++outputInfo) {
+                Compare(expectedOutputs[i], request.GetBlob(outputInfo->first));
+            }
+        }
+    }
+}
+
 }  //  namespace HeteroTests
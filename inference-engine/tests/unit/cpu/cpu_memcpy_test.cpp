@@ -0,0 +1,45 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <tuple>
+#include <vector>
+
+#include "nodes/common/cpu_memcpy.h"
+
+using ParallelMemcpyParams = std::tuple<
+        size_t,     // bytes to copy
+        size_t,     // source offset
+        size_t      // destination offset
+>;
+
+class ParallelMemcpyTest : public ::testing::TestWithParam<ParallelMemcpyParams> {};
+
+TEST_P(ParallelMemcpyTest, CopiesAllBytes) {
+    size_t count, srcOffset, dstOffset;
+    std::tie(count, srcOffset, dstOffset) = GetParam();
+
+    std::vector<uint8_t> src(count + srcOffset);
+    std::iota(src.begin(), src.end(), 0);
+    // Guard bytes check that nothing is written out of the destination range
+    std::vector<uint8_t> dst(count + dstOffset + 1, 0xAB);
+
+    cpu_parallel_memcpy(dst.data() + dstOffset, src.data() + srcOffset, count);
+
+    ASSERT_TRUE(std::all_of(dst.begin(), dst.begin() + dstOffset, [](uint8_t value) { return value == 0xAB; }));
+    ASSERT_TRUE(std::equal(src.begin() + srcOffset, src.end(), dst.begin() + dstOffset));
+    ASSERT_EQ(0xAB, dst.back());
+}
+
+// Small copies are done in the calling thread, the large ones are split between threads
+// and the ones above LLC size use non-temporal stores
+INSTANTIATE_TEST_SUITE_P(smoke_CPU, ParallelMemcpyTest,
+                         ::testing::Combine(
+                                 ::testing::Values(0, 1, 17, 4096, 256 * 1024 + 3, 4 * 1024 * 1024 + 7, 96 * 1024 * 1024 + 1),
+                                 ::testing::Values(0, 5),
+                                 ::testing::Values(0, 3)));
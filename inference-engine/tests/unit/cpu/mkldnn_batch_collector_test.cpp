@@ -0,0 +1,180 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <future>
+#include <memory>
+#include <vector>
+
+#include <blob_factory.hpp>
+#include <threading/ie_cpu_streams_executor.hpp>
+
+#include "mkldnn_batch_collector.h"
+
+using namespace InferenceEngine;
+using namespace MKLDNNPlugin;
+
+namespace {
+
+const SizeVector dims = {1, 4};
+
+InputsDataMap makeInputs() {
+    auto input = std::make_shared<InputInfo>();
+    input->setInputData(std::make_shared<Data>("input", TensorDesc(Precision::FP32, dims, Layout::NC)));
+    return {{"input", input}};
+}
+
+OutputsDataMap makeOutputs() {
+    return {{"output", std::make_shared<Data>("output", TensorDesc(Precision::FP32, dims, Layout::NC))}};
+}
+
+// Doubles the input, the same is done by the batched inference
+class TestRequest : public IInferRequestInternal {
+public:
+    explicit TestRequest(float value) : IInferRequestInternal(makeInputs(), makeOutputs()) {
+        _inputs["input"] = make_shared_blob<float>(TensorDesc(Precision::FP32, dims, Layout::NC));
+        _inputs["input"]->allocate();
+        _outputs["output"] = make_shared_blob<float>(TensorDesc(Precision::FP32, dims, Layout::NC));
+        _outputs["output"]->allocate();
+        auto data = _inputs["input"]->buffer().as<float*>();
+        for (size_t i = 0; i < _inputs["input"]->size(); i++)
+            data[i] = value + i;
+    }
+
+    void InferImpl() override {
+        inferredAlone = true;
+        doubleValues(_inputs["input"], _outputs["output"]);
+    }
+
+    static void doubleValues(const Blob::Ptr& input, const Blob::Ptr& output) {
+        auto src = input->cbuffer().as<const float*>();
+        auto dst = output->buffer().as<float*>();
+        for (size_t i = 0; i < input->size(); i++)
+            dst[i] = 2 * src[i];
+    }
+
+    void checkOutput(float value) {
+        auto data = _outputs["output"]->cbuffer().as<const float*>();
+        for (size_t i = 0; i < _outputs["output"]->size(); i++)
+            EXPECT_EQ(2 * (value + i), data[i]);
+    }
+
+    bool inferredAlone = false;
+};
+
+class MKLDNNBatchCollectorTest : public ::testing::Test {
+protected:
+    MKLDNNBatchCollector::Ptr makeCollector(size_t maxBatch, std::chrono::microseconds timeout) {
+        auto infer = [this] (const BlobMap& inputs, const BlobMap& outputs) {
+            batches.push_back(inputs.at("input")->getTensorDesc().getDims()[0]);
+            auto data = inputs.at("input")->cbuffer().as<const float*>();
+            lastRows.emplace_back(data + inputs.at("input")->size() - dims[1], data + inputs.at("input")->size());
+            TestRequest::doubleValues(inputs.at("input"), outputs.at("output"));
+        };
+        auto executor = std::make_shared<CPUStreamsExecutor>(IStreamsExecutor::Config{"MKLDNNBatchCollectorTest", 1});
+        return std::make_shared<MKLDNNBatchCollector>(infer, executor, makeInputs(), makeOutputs(),
+                                                      MKLDNNBatchCollector::MakeBatchSizes(maxBatch), timeout);
+    }
+
+    // Starts all the requests at once and waits for them
+    void infer(const MKLDNNBatchCollector::Ptr& collector, const std::vector<std::shared_ptr<TestRequest>>& requests) {
+        std::vector<MKLDNNBatchCollector::StageExecutor::Ptr> stages;
+        std::vector<std::promise<void>> promises(requests.size());
+        for (size_t i = 0; i < requests.size(); i++) {
+            stages.push_back(collector->MakeStageExecutor(requests[i].get()));
+        }
+        for (size_t i = 0; i < requests.size(); i++) {
+            auto stage = stages[i].get();
+            auto promise = &promises[i];
+            stage->run([stage, promise] {
+                stage->CheckResult();
+                promise->set_value();
+            });
+        }
+        for (auto& promise : promises)
+            promise.get_future().get();
+    }
+
+    std::vector<size_t> batches;
+    std::vector<std::vector<float>> lastRows;
+};
+
+}  // namespace
+
+TEST(MKLDNNBatchCollectorSizesTest, PowersOfTwoUpToMaxBatch) {
+    EXPECT_EQ(std::vector<size_t>({2, 4, 8}), MKLDNNBatchCollector::MakeBatchSizes(8));
+    EXPECT_EQ(std::vector<size_t>({2, 4, 6}), MKLDNNBatchCollector::MakeBatchSizes(6));
+    EXPECT_TRUE(MKLDNNBatchCollector::MakeBatchSizes(1).empty());
+    EXPECT_TRUE(MKLDNNBatchCollector::MakeBatchSizes(0).empty());
+}
+
+TEST(MKLDNNBatchCollectorSizesTest, FirstDimensionIsMultiplied) {
+    auto shapes = MKLDNNBatchCollector::GetBatchedShapes(makeInputs(), 8);
+    EXPECT_EQ(SizeVector({8, 4}), shapes.at("input"));
+}
+
+TEST_F(MKLDNNBatchCollectorTest, FullBatchIsInferredAtOnce) {
+    auto collector = makeCollector(4, std::chrono::seconds(10));
+    std::vector<std::shared_ptr<TestRequest>> requests;
+    for (int i = 0; i < 4; i++)
+        requests.push_back(std::make_shared<TestRequest>(10.f * i));
+
+    infer(collector, requests);
+
+    EXPECT_EQ(std::vector<size_t>({4}), batches);
+    for (int i = 0; i < 4; i++) {
+        EXPECT_FALSE(requests[i]->inferredAlone);
+        requests[i]->checkOutput(10.f * i);
+    }
+    const auto statistics = collector->GetStatistics();
+    EXPECT_EQ(4u, statistics.requests);
+    EXPECT_EQ(1u, statistics.batches);
+}
+
+TEST_F(MKLDNNBatchCollectorTest, PartialBatchIsPaddedAfterTimeout) {
+    auto collector = makeCollector(4, std::chrono::milliseconds(200));
+    std::vector<std::shared_ptr<TestRequest>> requests;
+    for (int i = 0; i < 3; i++)
+        requests.push_back(std::make_shared<TestRequest>(10.f * i));
+
+    infer(collector, requests);
+
+    EXPECT_EQ(std::vector<size_t>({4}), batches);
+    for (int i = 0; i < 3; i++) {
+        EXPECT_FALSE(requests[i]->inferredAlone);
+        requests[i]->checkOutput(10.f * i);
+    }
+    EXPECT_EQ(3u, collector->GetStatistics().requests);
+}
+
+TEST_F(MKLDNNBatchCollectorTest, PaddingOfReusedBuffersIsZeroed) {
+    auto collector = makeCollector(4, std::chrono::milliseconds(200));
+    std::vector<std::shared_ptr<TestRequest>> requests;
+    for (int i = 0; i < 4; i++)
+        requests.push_back(std::make_shared<TestRequest>(10.f * i + 1.f));
+    infer(collector, requests);
+    requests.pop_back();
+    infer(collector, requests);
+
+    EXPECT_EQ(std::vector<size_t>({4, 4}), batches);
+    ASSERT_EQ(2u, lastRows.size());
+    EXPECT_EQ(std::vector<float>(dims[1], 0.f), lastRows[1]);
+    for (int i = 0; i < 3; i++)
+        requests[i]->checkOutput(10.f * i + 1.f);
+}
+
+TEST_F(MKLDNNBatchCollectorTest, SingleRequestIsInferredAlone) {
+    auto collector = makeCollector(4, std::chrono::milliseconds(1));
+    std::vector<std::shared_ptr<TestRequest>> requests = {std::make_shared<TestRequest>(5.f)};
+
+    infer(collector, requests);
+
+    EXPECT_TRUE(batches.empty());
+    EXPECT_TRUE(requests[0]->inferredAlone);
+    requests[0]->checkOutput(5.f);
+    const auto statistics = collector->GetStatistics();
+    EXPECT_EQ(1u, statistics.requests);
+    EXPECT_EQ(1u, statistics.batches);
+}
@@ -0,0 +1,83 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <ie_common.h>
+#include <ie_system_conf.h>
+#include <ngraph/opsets/opset1.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+#include "mkldnn_memory_arena.h"
+#include "mkldnn_exec_network.h"
+
+using namespace MKLDNNPlugin;
+
+namespace {
+
+bool isZeroed(const void* ptr, size_t size) {
+    auto bytes = static_cast<const uint8_t*>(ptr);
+    return std::all_of(bytes, bytes + size, [] (uint8_t byte) { return byte == 0; });
+}
+
+}  // namespace
+
+TEST(MemoryArenaTest, CannotBeCreatedForDefaultAllocation) {
+    ASSERT_THROW(MKLDNNMemoryArena(0, Config::MemoryArena::Default), InferenceEngine::Exception);
+}
+
+TEST(MemoryArenaTest, SmallBlocksAreAlignedZeroedAndDisjoint) {
+    for (auto mode : {Config::MemoryArena::Numa, Config::MemoryArena::NumaTransparentHugePages, Config::MemoryArena::NumaExplicitHugePages}) {
+        MKLDNNMemoryArena arena(-1, mode);
+        auto first = arena.allocate(100);
+        auto second = arena.allocate(1);
+        ASSERT_NE(nullptr, first);
+        ASSERT_NE(nullptr, second);
+        ASSERT_EQ(0, reinterpret_cast<uintptr_t>(first.get()) % 64);
+        ASSERT_EQ(0, reinterpret_cast<uintptr_t>(second.get()) % 64);
+        ASSERT_TRUE(isZeroed(first.get(), 100));
+        ASSERT_TRUE(isZeroed(second.get(), 1));
+
+        std::memset(first.get(), 0xFF, 100);
+        ASSERT_TRUE(isZeroed(second.get(), 1));
+    }
+}
+
+TEST(MemoryArenaTest, BlocksOutliveArena) {
+    std::shared_ptr<void> small, large;
+    {
+        MKLDNNMemoryArena arena(-1, Config::MemoryArena::Numa);
+        small = arena.allocate(64);
+        large = arena.allocate(64 * 1024 * 1024);
+    }
+    std::memset(small.get(), 1, 64);
+    std::memset(large.get(), 1, 64 * 1024 * 1024);
+    ASSERT_EQ(1, static_cast<uint8_t*>(large.get())[64 * 1024 * 1024 - 1]);
+}
+
+TEST(MemoryArenaTest, UsedBySingleStreamNetwork) {
+    // the only graph doesn't use the weights cache, while the memory is still reserved from the arena
+    auto param = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{1, 16, 32, 32});
+    auto relu = std::make_shared<ngraph::opset1::Relu>(param);
+    auto abs = std::make_shared<ngraph::opset1::Abs>(relu);
+    auto function = std::make_shared<ngraph::Function>(ngraph::ResultVector{std::make_shared<ngraph::opset1::Result>(abs)},
+                                                       ngraph::ParameterVector{param});
+
+    Config cfg;
+    cfg.streamExecutorConfig._streams = 1;
+    cfg.memoryArena = Config::MemoryArena::Numa;
+    NumaNodesWeights weights;
+    auto reservedSize = [&weights] {
+        size_t size = 0;
+        for (auto numaNodeId : InferenceEngine::getAvailableNUMANodes())
+            size += weights.getArena(numaNodeId, Config::MemoryArena::Numa)->getReservedSize();
+        return size;
+    };
+    ASSERT_EQ(0u, reservedSize());
+
+    MKLDNNExecNetwork network(InferenceEngine::CNNNetwork(function), cfg, std::make_shared<MKLDNNExtensionManager>(), weights);
+    ASSERT_LT(0u, reservedSize());
+}
@@ -0,0 +1,69 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "mkldnn_streams_tuner.h"
+
+using namespace MKLDNNPlugin;
+
+namespace {
+
+std::vector<int> getStreams(const std::vector<StreamsLayout>& layouts) {
+    std::vector<int> streams;
+    for (const auto& layout : layouts)
+        streams.push_back(layout.streams);
+    return streams;
+}
+
+StreamsLayout makeLayout(double throughput, double latency) {
+    StreamsLayout layout;
+    layout.throughput = throughput;
+    layout.latency = latency;
+    return layout;
+}
+
+}  // namespace
+
+TEST(StreamsTunerTest, CandidatesArePowersOfTwoUpToCores) {
+    const auto layouts = MakeStreamsLayoutCandidates(12, 12, 1);
+    ASSERT_EQ((std::vector<int>{1, 2, 4, 8, 12}), getStreams(layouts));
+    for (const auto& layout : layouts)
+        ASSERT_EQ(0, layout.threads);
+}
+
+TEST(StreamsTunerTest, CandidatesIncludeNumaNodes) {
+    const auto layouts = MakeStreamsLayoutCandidates(24, 24, 3);
+    ASSERT_EQ((std::vector<int>{1, 2, 3, 4, 8, 16, 24}), getStreams(layouts));
+}
+
+TEST(StreamsTunerTest, CandidatesWithHyperThreadingTryBothThreadsNumbers) {
+    const auto layouts = MakeStreamsLayoutCandidates(4, 8, 1);
+    ASSERT_EQ(6u, layouts.size());
+    // one stream uses the cores by default, so all the hardware threads are tried
+    ASSERT_EQ(1, layouts[0].streams);
+    ASSERT_EQ(0, layouts[0].threads);
+    ASSERT_EQ(1, layouts[1].streams);
+    ASSERT_EQ(8, layouts[1].threads);
+    // several streams use all the hardware threads by default, so the cores only are tried
+    ASSERT_EQ(4, layouts[5].streams);
+    ASSERT_EQ(4, layouts[5].threads);
+}
+
+TEST(StreamsTunerTest, HigherThroughputIsBetterWithoutLimit) {
+    ASSERT_TRUE(IsBetterStreamsLayout(makeLayout(200, 40), makeLayout(100, 10), 0.f));
+    ASSERT_FALSE(IsBetterStreamsLayout(makeLayout(100, 10), makeLayout(200, 40), 0.f));
+}
+
+TEST(StreamsTunerTest, LayoutFittingLatencyLimitIsBetter) {
+    ASSERT_TRUE(IsBetterStreamsLayout(makeLayout(100, 10), makeLayout(200, 40), 20.f));
+    ASSERT_TRUE(IsBetterStreamsLayout(makeLayout(150, 15), makeLayout(100, 10), 20.f));
+}
+
+TEST(StreamsTunerTest, LowerLatencyIsBetterIfNoLayoutFitsLimit) {
+    ASSERT_TRUE(IsBetterStreamsLayout(makeLayout(100, 30), makeLayout(200, 40), 20.f));
+    ASSERT_FALSE(IsBetterStreamsLayout(makeLayout(200, 40), makeLayout(100, 30), 20.f));
+}
@@ -0,0 +1,131 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <tuple>
+#include <vector>
+
+#include "nodes/common/nms_kernel.hpp"
+
+using namespace InferenceEngine::Extensions::Cpu;
+
+namespace {
+
+float referenceIoU(const float* boxI, const float* boxJ, float offset) {
+    if (boxJ[0] > boxI[2] || boxJ[2] < boxI[0] || boxJ[1] > boxI[3] || boxJ[3] < boxI[1])
+        return 0.f;
+    const float width = (std::min)(boxI[2], boxJ[2]) - (std::max)(boxI[0], boxJ[0]) + offset;
+    const float height = (std::min)(boxI[3], boxJ[3]) - (std::max)(boxI[1], boxJ[1]) + offset;
+    if (width <= 0.f || height <= 0.f)
+        return 0.f;
+    const float areaI = (boxI[2] - boxI[0] + offset) * (boxI[3] - boxI[1] + offset);
+    const float areaJ = (boxJ[2] - boxJ[0] + offset) * (boxJ[3] - boxJ[1] + offset);
+    return width * height / (areaI + areaJ - width * height);
+}
+
+// Greedy suppression checking every candidate against all the selected boxes
+std::vector<int> referenceNms(const std::vector<float>& scores, const std::vector<float>& boxes, const nms_conf& conf) {
+    std::vector<int> order;
+    for (int i = 0; i < static_cast<int>(scores.size()); i++) {
+        if (scores[i] > conf.score_threshold)
+            order.push_back(i);
+    }
+    std::stable_sort(order.begin(), order.end(), [&](int l, int r) { return scores[l] > scores[r]; });
+    if (conf.pre_nms_topn >= 0 && static_cast<int>(order.size()) > conf.pre_nms_topn)
+        order.resize(conf.pre_nms_topn);
+
+    std::vector<int> selected;
+    for (int candidate : order) {
+        if (conf.post_nms_topn >= 0 && static_cast<int>(selected.size()) == conf.post_nms_topn)
+            break;
+        bool keep = true;
+        for (int kept : selected) {
+            const float iou = referenceIoU(&boxes[4 * kept], &boxes[4 * candidate], conf.coordinates_offset);
+            if (conf.suppress_equal_iou ? iou >= conf.iou_threshold : iou > conf.iou_threshold) {
+                keep = false;
+                break;
+            }
+        }
+        if (keep)
+            selected.push_back(candidate);
+    }
+    return selected;
+}
+
+}  // namespace
+
+using NmsKernelParams = std::tuple<
+        int,    // number of boxes
+        float,  // IoU threshold
+        bool,   // suppress boxes with IoU equal to the threshold
+        float,  // coordinates offset
+        int     // maximum number of the selected boxes
+>;
+
+class NmsKernelTest : public ::testing::TestWithParam<NmsKernelParams> {};
+
+TEST_P(NmsKernelTest, MatchesGreedySuppression) {
+    int numBoxes, maxOut;
+    float iouThreshold, offset;
+    bool suppressEqual;
+    std::tie(numBoxes, iouThreshold, suppressEqual, offset, maxOut) = GetParam();
+
+    std::mt19937 gen(numBoxes);
+    std::uniform_real_distribution<float> position(0.f, 100.f), size(0.f, 20.f), score(0.f, 1.f);
+    std::vector<float> boxes(4 * numBoxes), scores(numBoxes);
+    for (int i = 0; i < numBoxes; i++) {
+        // integer coordinates and rounded scores produce equal IoU values and scores
+        const float y = std::round(position(gen)), x = std::round(position(gen));
+        boxes[4 * i + 0] = y;
+        boxes[4 * i + 1] = x;
+        boxes[4 * i + 2] = y + std::round(size(gen));
+        boxes[4 * i + 3] = x + std::round(size(gen));
+        scores[i] = std::round(score(gen) * 20.f) / 20.f;
+    }
+
+    nms_conf conf;
+    conf.score_threshold = 0.1f;
+    conf.pre_nms_topn = -1;
+    conf.post_nms_topn = maxOut;
+    conf.iou_threshold = iouThreshold;
+    conf.suppress_equal_iou = suppressEqual;
+    conf.coordinates_offset = offset;
+    conf.parallel = true;
+
+    std::vector<int> selected(numBoxes);
+    selected.resize(XARCH::nms_exec(scores.data(), boxes.data(), numBoxes, conf, selected.data()));
+    ASSERT_EQ(referenceNms(scores, boxes, conf), selected);
+}
+
+INSTANTIATE_TEST_CASE_P(NmsKernel, NmsKernelTest,
+                        ::testing::Combine(::testing::Values(1, 15, 300, 5000),
+                                           ::testing::Values(0.f, 0.5f, 1.f),
+                                           ::testing::Bool(),
+                                           ::testing::Values(0.f, 1.f),
+                                           ::testing::Values(-1, 10)));
+
+TEST(NmsKernelTest, PreNmsTopNLimitsCandidates) {
+    // the second box overlaps the first one only, so it is selected if the first one is out of the top
+    const std::vector<float> boxes = {0.f, 0.f, 10.f, 10.f,
+                                      1.f, 1.f, 11.f, 11.f,
+                                      50.f, 50.f, 60.f, 60.f};
+    const std::vector<float> scores = {0.9f, 0.8f, 0.95f};
+
+    nms_conf conf;
+    conf.score_threshold = 0.f;
+    conf.pre_nms_topn = 2;
+    conf.post_nms_topn = -1;
+    conf.iou_threshold = 0.5f;
+    conf.suppress_equal_iou = false;
+    conf.coordinates_offset = 0.f;
+    conf.parallel = false;
+
+    std::vector<int> selected(3);
+    selected.resize(XARCH::nms_exec(scores.data(), boxes.data(), 3, conf, selected.data()));
+    ASSERT_EQ(std::vector<int>({2, 0}), selected);
+}
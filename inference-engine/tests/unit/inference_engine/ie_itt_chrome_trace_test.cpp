@@ -0,0 +1,107 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+
+#include <openvino/itt.hpp>
+
+#include "common_test_utils/test_common.hpp"
+
+#ifdef ENABLE_PROFILING_CHROME_TRACE
+
+OV_ITT_DOMAIN(ChromeTraceTest);
+
+namespace {
+std::string readFile(const std::string& fileName) {
+    std::ifstream in(fileName);
+    std::stringstream content;
+    content << in.rdbuf();
+    return content.str();
+}
+}  // namespace
+
+class ChromeTraceTests : public CommonTestUtils::TestsCommon {
+protected:
+    const std::string fileName = "chrome_trace_test.json";
+
+    void TearDown() override {
+        openvino::itt::traceStop();
+        std::remove(fileName.c_str());
+    }
+};
+
+TEST_F(ChromeTraceTests, DumpContainsNestedTasksAndThreadNames) {
+    openvino::itt::traceStart("");
+    std::thread worker([] {
+        openvino::itt::threadName("chrome_trace_worker");
+        openvino::itt::ScopedTask<ChromeTraceTest> outer(openvino::itt::handle("OuterTask"));
+        openvino::itt::ScopedTask<ChromeTraceTest> inner(openvino::itt::handle("Inner\"Task"));
+    });
+    worker.join();
+
+    ASSERT_TRUE(openvino::itt::traceDump(fileName));
+    const auto trace = readFile(fileName);
+    EXPECT_NE(std::string::npos, trace.find("\"traceEvents\""));
+    EXPECT_NE(std::string::npos, trace.find("\"name\":\"OuterTask\",\"cat\":\"ChromeTraceTest\",\"ph\":\"X\""));
+    EXPECT_NE(std::string::npos, trace.find("\"name\":\"Inner\\\"Task\""));
+    EXPECT_NE(std::string::npos, trace.find("\"args\":{\"name\":\"chrome_trace_worker\"}"));
+}
+
+TEST_F(ChromeTraceTests, ThreadNamedBeforeStartIsDumped) {
+    std::thread worker([] {
+        openvino::itt::threadName("chrome_trace_named_before_start");
+        openvino::itt::traceStart("");
+        openvino::itt::ScopedTask<ChromeTraceTest> task(openvino::itt::handle("TaskAfterStart"));
+    });
+    worker.join();
+
+    ASSERT_TRUE(openvino::itt::traceDump(fileName));
+    const auto trace = readFile(fileName);
+    EXPECT_NE(std::string::npos, trace.find("TaskAfterStart"));
+    EXPECT_NE(std::string::npos, trace.find("\"args\":{\"name\":\"chrome_trace_named_before_start\"}"));
+}
+
+TEST_F(ChromeTraceTests, CanDumpWhileEventsAreRecorded) {
+    openvino::itt::traceStart("");
+    std::atomic<bool> stop {false};
+    std::thread worker([&stop] {
+        while (!stop) {
+            openvino::itt::ScopedTask<ChromeTraceTest> task(openvino::itt::handle("ConcurrentTask"));
+        }
+    });
+    for (int i = 0; i < 10; i++)
+        EXPECT_TRUE(openvino::itt::traceDump(fileName));
+    stop = true;
+    worker.join();
+
+    ASSERT_TRUE(openvino::itt::traceDump(fileName));
+    const auto trace = readFile(fileName);
+    EXPECT_NE(std::string::npos, trace.find("\"name\":\"ConcurrentTask\",\"cat\":\"ChromeTraceTest\""));
+    EXPECT_EQ('\n', trace.back());
+}
+
+TEST_F(ChromeTraceTests, NoEventsRecordedWhenStopped) {
+    openvino::itt::traceStop();
+    {
+        openvino::itt::ScopedTask<ChromeTraceTest> task(openvino::itt::handle("TaskWhileStopped"));
+    }
+
+    ASSERT_TRUE(openvino::itt::traceDump(fileName));
+    EXPECT_EQ(std::string::npos, readFile(fileName).find("TaskWhileStopped"));
+}
+
+#else
+
+TEST(ChromeTraceTests, DumpIsNotAvailableWithoutCollector) {
+    EXPECT_FALSE(openvino::itt::traceDump("chrome_trace_test.json"));
+}
+
+#endif  // ENABLE_PROFILING_CHROME_TRACE
@@ -0,0 +1,79 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "common_test_utils/test_common.hpp"
+
+#include "ie_mmap_object.hpp"
+
+using namespace InferenceEngine;
+
+class MmapObjectTests : public CommonTestUtils::TestsCommon {
+protected:
+    void SetUp() override {
+        CommonTestUtils::TestsCommon::SetUp();
+        fileName = "mmap_object_test_" + std::to_string(reinterpret_cast<size_t>(this)) + ".bin";
+    }
+
+    void TearDown() override {
+        std::remove(fileName.c_str());
+        CommonTestUtils::TestsCommon::TearDown();
+    }
+
+    void writeFile(const std::vector<char>& content) {
+        std::ofstream stream(fileName, std::ios::binary);
+        stream.write(content.data(), content.size());
+    }
+
+    std::vector<char> readFile() {
+        std::ifstream stream(fileName, std::ios::binary);
+        return std::vector<char>(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+    }
+
+    std::string fileName;
+};
+
+TEST_F(MmapObjectTests, canMapFile) {
+    const std::vector<char> content = {1, 2, 3, 4, 5, 6, 7};
+    writeFile(content);
+
+    auto memory = loadMmapObject(fileName);
+    ASSERT_NE(nullptr, memory);
+    ASSERT_EQ(content.size(), memory->size());
+    EXPECT_EQ(content, std::vector<char>(memory->data(), memory->data() + memory->size()));
+}
+
+TEST_F(MmapObjectTests, mappedBlobKeepsMappingAlive) {
+    const std::vector<char> content = {10, 20, 30};
+    writeFile(content);
+
+    auto blob = makeMappedBlob(loadMmapObject(fileName));
+    ASSERT_EQ(content.size(), blob->byteSize());
+    auto data = blob->cbuffer().as<const char*>();
+    ASSERT_NE(nullptr, data);
+    EXPECT_EQ(content, std::vector<char>(data, data + content.size()));
+}
+
+TEST_F(MmapObjectTests, writesToMappingDontChangeFile) {
+    const std::vector<char> content = {1, 2, 3};
+    writeFile(content);
+
+    auto memory = loadMmapObject(fileName);
+    ASSERT_NE(nullptr, memory);
+    memory->data()[0] = 42;
+    EXPECT_EQ(42, memory->data()[0]);
+    memory.reset();
+    EXPECT_EQ(content, readFile());
+}
+
+TEST_F(MmapObjectTests, cannotMapEmptyOrMissingFile) {
+    EXPECT_EQ(nullptr, loadMmapObject(fileName));
+    writeFile({});
+    EXPECT_EQ(nullptr, loadMmapObject(fileName));
+}
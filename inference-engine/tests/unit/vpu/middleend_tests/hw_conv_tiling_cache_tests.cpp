@@ -0,0 +1,75 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include <vpu/middleend/hw/conv_tiling/hw_convolution_tiler.hpp>
+
+namespace {
+
+using namespace vpu;
+using namespace vpu::HWTilingNS;
+
+const int tilingCMXLimit = 1024 * 1024;
+
+DimValues makeDims(int w, int h, int c) {
+    DimValues dims;
+    dims.set(Dim::W, w);
+    dims.set(Dim::H, h);
+    dims.set(Dim::C, c);
+    dims.set(Dim::N, 1);
+    return dims;
+}
+
+// 3x3 convolution with the same padding
+ConvolutionOptions makeConvolution(const std::string& name, int size, int inputChannels, int outputChannels) {
+    const auto outputDims = makeDims(size, size, outputChannels);
+    return ConvolutionOptions{name, makeDims(size, size, inputChannels), outputDims, outputDims,
+                              3, 3, 1, 1, 1, 1, 1, false};
+}
+
+void expectEqual(const std::vector<TilingOption>& expected, const std::vector<TilingOption>& actual) {
+    ASSERT_EQ(expected.size(), actual.size());
+    for (size_t i = 0; i < expected.size(); ++i) {
+        EXPECT_EQ(expected[i].numWidthTiles, actual[i].numWidthTiles);
+        EXPECT_EQ(expected[i].numHeightTiles, actual[i].numHeightTiles);
+        EXPECT_EQ(expected[i].numChannelTiles, actual[i].numChannelTiles);
+        EXPECT_EQ(expected[i].totalNumTiles, actual[i].totalNumTiles);
+        EXPECT_DOUBLE_EQ(expected[i].cost, actual[i].cost);
+    }
+}
+
+TEST(HWConvolutionTilingCacheTests, IdenticalConvolutionsAreSearchedOnce) {
+    const std::vector<ConvolutionOptions> convolutions = {
+        makeConvolution("conv1", 56, 64, 64),
+        makeConvolution("conv2", 56, 64, 64),
+        makeConvolution("conv3", 28, 128, 128),
+        makeConvolution("conv4", 56, 64, 64),
+    };
+
+    HWConvolutionTilingCache cache(Direction::INPUT_TO_OUTPUT, 1, tilingCMXLimit);
+    ASSERT_NO_THROW(cache.prepare(convolutions));
+    EXPECT_EQ(2u, cache.size());
+
+    for (const auto& convolution : convolutions) {
+        const HWConvolutionTilingSearcher searcher(convolution, Direction::INPUT_TO_OUTPUT, 1, tilingCMXLimit);
+        expectEqual(searcher.tilingOptions(), cache.tilingOptions(convolution));
+    }
+    EXPECT_EQ(convolutions.size(), cache.hits());
+    EXPECT_EQ(2u, cache.size());
+}
+
+TEST(HWConvolutionTilingCacheTests, MissingConvolutionIsSearchedOnRequest) {
+    HWConvolutionTilingCache cache(Direction::INPUT_TO_OUTPUT, 1, tilingCMXLimit);
+
+    const auto convolution = makeConvolution("conv", 28, 128, 128);
+    const HWConvolutionTilingSearcher searcher(convolution, Direction::INPUT_TO_OUTPUT, 1, tilingCMXLimit);
+    expectEqual(searcher.tilingOptions(), cache.tilingOptions(convolution));
+    EXPECT_EQ(0u, cache.hits());
+    EXPECT_EQ(1u, cache.size());
+}
+
+}  // namespace
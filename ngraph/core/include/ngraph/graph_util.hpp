@@ -393,6 +393,20 @@ namespace ngraph
     NGRAPH_API
     std::shared_ptr<ngraph::Function> clone_function(const ngraph::Function& func);
 
+    // input function is cloned and returned without validation of the cloned nodes
+    // output types and shapes of the cloned nodes are copied from the input function, so it must
+    // be validated already
+    // NodeMap input may contain default node mapping i.e. pre-cloned nodes with the same output
+    // types and shapes
+    // NodeMap output (by reference) fully maps input and cloned function ops
+    NGRAPH_API
+    std::shared_ptr<ngraph::Function> clone_function_trusted(const ngraph::Function& func,
+                                                             NodeMap& node_map);
+
+    // input function is cloned and returned without validation of the cloned nodes
+    NGRAPH_API
+    std::shared_ptr<ngraph::Function> clone_function_trusted(const ngraph::Function& func);
+
     NGRAPH_API
     std::pair<std::shared_ptr<op::Result>, std::shared_ptr<op::v0::Parameter>>
         insert_result_parameter_split(const std::shared_ptr<Node>& src_node,
@@ -33,6 +33,7 @@
 #include "ngraph/op/util/variable.hpp"
 #include "ngraph/op/util/variable_value.hpp"
 #include "ngraph/output_vector.hpp"
+#include "ngraph/stable_vector.hpp"
 #include "ngraph/strides.hpp"
 #include "ngraph/type.hpp"
 
@@ -144,6 +145,11 @@ namespace ngraph
         /// Throws if the node is invalid.
         virtual void validate_and_infer_types();
 
+        /// \brief Returns false if validate_and_infer_types() modifies state shared with other
+        /// nodes (e.g. tensors of its inputs or variables), so the node can't be validated
+        /// concurrently with other nodes.
+        virtual bool has_thread_safe_validation() const { return true; }
+
         // Called in constructors during transition
         void constructor_validate_and_infer_types();
 
@@ -388,6 +394,17 @@ namespace ngraph
             const OutputVector& inputs,
             const std::vector<std::shared_ptr<Node>>& control_dependencies) const;
 
+        /// \brief Copies a node which is known to be valid without running
+        ///        validate_and_infer_types() on the copy.
+        ///
+        /// Output element types, shapes, names and bounds as well as input relevance are taken
+        /// from this node, so the new inputs must have the same types and shapes as the current
+        /// ones. Nodes which cannot be constructed from just the new inputs (e.g. ones creating
+        /// default inputs) are validated as usual.
+        std::shared_ptr<Node> copy_with_new_inputs_trusted(
+            const OutputVector& inputs,
+            const std::vector<std::shared_ptr<Node>>& control_dependencies) const;
+
         /// True if this and node have one output with same element type and shape
         bool has_same_type(std::shared_ptr<const Node> node) const;
 
@@ -493,17 +510,24 @@ namespace ngraph
         descriptor::Input& get_input_descriptor(size_t position);
         descriptor::Output& get_output_descriptor(size_t position);
 
+        struct Provenance
+        {
+            std::unordered_set<std::string> tags;
+            std::set<std::shared_ptr<Node>> group;
+        };
+        Provenance& get_provenance();
+
         std::vector<Node*> m_control_dependents;
         std::vector<std::shared_ptr<Node>> m_control_dependencies;
-        std::string m_node_type;
         size_t m_instance_id{m_next_instance_id.fetch_add(1)};
         std::string m_friendly_name;
         std::string m_unique_name;
         static std::atomic<size_t> m_next_instance_id;
-        std::unordered_set<std::string> m_provenance_tags;
-        std::set<std::shared_ptr<Node>> m_provenance_group;
-        std::deque<descriptor::Input> m_inputs;
-        std::deque<descriptor::Output> m_outputs;
+        // allocated on the first provenance tag or group member, most of the nodes have none
+        std::unique_ptr<Provenance> m_provenance;
+        // descriptors are referenced by pointers from the connected nodes, so they must not move
+        StableVector<descriptor::Input> m_inputs;
+        StableVector<descriptor::Output> m_outputs;
         std::shared_ptr<ngraph::op::util::OpAnnotations> m_op_annotations;
         std::map<std::string, std::shared_ptr<Variant>> m_rt_info;
     };
@@ -22,6 +22,9 @@ namespace ngraph
                 : Sink(arguments)
             {
             }
+
+            /// \brief The variable shared with ReadValue is updated by validation
+            bool has_thread_safe_validation() const override { return false; }
         };
 
         namespace v3
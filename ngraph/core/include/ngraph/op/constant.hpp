@@ -328,14 +328,13 @@ namespace ngraph
                         get_data_ptr());
                 }
 
-                bool get_all_data_elements_bitwise_identical() const
-                {
-                    return m_all_elements_bitwise_identical;
-                }
+                bool get_all_data_elements_bitwise_identical() const;
                 std::string convert_value_to_string(size_t index) const;
 
                 /**
-                 * \brief Allows to avoid buffer allocation on the visit_attributes call
+                 * \brief Allows to avoid buffer allocation on the visit_attributes call. The data
+                 * set by the visitor is expected to be shared with an external buffer, which isn't
+                 * read until the data is accessed.
                  */
                 void alloc_buffer_on_visit_attributes(bool val)
                 {
@@ -687,7 +686,9 @@ namespace ngraph
                 element::Type m_element_type;
                 Shape m_shape{};
                 std::shared_ptr<runtime::AlignedBuffer> m_data;
-                bool m_all_elements_bitwise_identical;
+                mutable bool m_all_elements_bitwise_identical;
+                // false if m_all_elements_bitwise_identical is computed on the first request
+                mutable bool m_all_elements_bitwise_identical_checked = true;
                 bool m_alloc_buffer_on_visit_attributes = true;
             };
         } // namespace v0
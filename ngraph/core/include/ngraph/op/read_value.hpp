@@ -24,6 +24,9 @@ namespace ngraph
                 : Op(arguments)
             {
             }
+
+            /// \brief The variable shared with Assign is updated by validation
+            bool has_thread_safe_validation() const override { return false; }
         };
 
         namespace v3
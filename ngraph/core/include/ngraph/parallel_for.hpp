@@ -0,0 +1,36 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+#include "ngraph/ngraph_visibility.hpp"
+
+namespace ngraph
+{
+    /// \brief Calls body(i) for every i in [0, size), the calls may run concurrently
+    using ParallelFor =
+        std::function<void(size_t size, const std::function<void(size_t)>& body)>;
+
+    /// \brief Sets the executor nGraph uses to run independent work concurrently: validation of
+    ///        independent nodes, constant folding of independent subgraphs and the reference
+    ///        kernels working on large tensors. nGraph doesn't depend on a threading library, so
+    ///        the executor is provided by the application, e.g. Inference Engine registers a
+    ///        TBB based one. Everything runs in the calling thread while no executor is set.
+    NGRAPH_API
+    void set_parallel_for(const ParallelFor& parallel_for);
+    NGRAPH_API
+    ParallelFor get_parallel_for();
+
+    /// \brief Splits [0, work_amount) into blocks of at least min_block_size items and calls
+    ///        body(begin, end) for every block through the executor set by set_parallel_for().
+    ///        Calls body(0, work_amount) in the calling thread if no executor is set or the work
+    ///        doesn't fill two blocks.
+    NGRAPH_API
+    void parallel_for_blocks(size_t work_amount,
+                             size_t min_block_size,
+                             const std::function<void(size_t begin, size_t end)>& body);
+} // namespace ngraph
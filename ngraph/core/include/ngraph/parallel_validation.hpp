@@ -0,0 +1,19 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "ngraph/ngraph_visibility.hpp"
+#include "ngraph/parallel_for.hpp"
+
+namespace ngraph
+{
+    /// \brief Enables validation of independent nodes in parallel when an executor is set by
+    ///        set_parallel_for(). Disabled by default unless NGRAPH_PARALLEL_VALIDATION
+    ///        environment variable is set.
+    NGRAPH_API
+    void set_parallel_validation_enabled(bool enabled);
+    NGRAPH_API
+    bool get_parallel_validation_enabled();
+} // namespace ngraph
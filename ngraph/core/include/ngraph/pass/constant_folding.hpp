@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include "ngraph/parallel_for.hpp"
 #include "ngraph/pass/pass.hpp"
 
 namespace ngraph
@@ -22,11 +23,27 @@ namespace ngraph
             bool run_on_function(std::shared_ptr<ngraph::Function> f) override;
 
         private:
+            /// \brief Folds the nodes with Constant inputs of every dependency level
+            /// concurrently and applies the replacements in the topological order.
+            bool fold_in_parallel(const std::vector<std::shared_ptr<Node>>& ordered_ops,
+                                  const ParallelFor& parallel_for,
+                                  bool rewritten);
+            bool fold_node(const std::shared_ptr<Node>& node, bool revalidate);
+            bool replace_outputs(const std::shared_ptr<Node>& node,
+                                 const OutputVector& replacements);
             void copy_runtime_info_to_target_inputs(const std::shared_ptr<Node>& node,
                                                     const Output<Node>& replacement);
             /// \brief Folds pre-calculated output tensor values to constants in case lower and
             /// upper estimations are equal. Traverses graph backwards starting from the results.
             bool pre_calculated_values_folding(const std::shared_ptr<ngraph::Function>& f);
         };
+
+        /// \brief Enables folding of independent nodes in parallel when an executor is set by
+        ///        set_parallel_for(). Disabled by default unless
+        ///        NGRAPH_PARALLEL_CONSTANT_FOLDING environment variable is set.
+        NGRAPH_API
+        void set_parallel_constant_folding_enabled(bool enabled);
+        NGRAPH_API
+        bool get_parallel_constant_folding_enabled();
     } // namespace pass
 } // namespace ngraph
@@ -0,0 +1,247 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+namespace ngraph
+{
+    /// \brief Sequence container which never moves its elements, so pointers and references to
+    ///        them stay valid while elements are appended.
+    ///
+    /// Elements are stored in a list of chunks. The first chunk holds the reserved number of
+    /// elements (at least one), each next chunk is twice as large as the previous one. Unlike
+    /// std::deque nothing is allocated for an empty container and a container with a few
+    /// elements takes a single small allocation.
+    template <typename T>
+    class StableVector
+    {
+        struct Chunk
+        {
+            Chunk* next;
+            size_t capacity;
+            size_t size;
+
+            static constexpr size_t header_size =
+                (sizeof(Chunk*) + 2 * sizeof(size_t) + alignof(T) - 1) / alignof(T) * alignof(T);
+
+            T* elements()
+            {
+                return reinterpret_cast<T*>(reinterpret_cast<char*>(this) + header_size);
+            }
+        };
+
+    public:
+        template <typename Value>
+        class Iterator
+        {
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = T;
+            using difference_type = std::ptrdiff_t;
+            using pointer = Value*;
+            using reference = Value&;
+
+            Iterator() = default;
+            Iterator(Chunk* chunk, size_t index)
+                : m_chunk(chunk)
+                , m_index(index)
+            {
+            }
+
+            reference operator*() const { return m_chunk->elements()[m_index]; }
+            pointer operator->() const { return &m_chunk->elements()[m_index]; }
+            Iterator& operator++()
+            {
+                if (++m_index == m_chunk->size)
+                {
+                    m_chunk = m_chunk->next;
+                    m_index = 0;
+                }
+                return *this;
+            }
+            Iterator operator++(int)
+            {
+                Iterator result = *this;
+                ++*this;
+                return result;
+            }
+            bool operator==(const Iterator& other) const
+            {
+                return m_chunk == other.m_chunk && m_index == other.m_index;
+            }
+            bool operator!=(const Iterator& other) const { return !(*this == other); }
+
+        private:
+            Chunk* m_chunk{nullptr};
+            size_t m_index{0};
+        };
+
+        using value_type = T;
+        using size_type = size_t;
+        using iterator = Iterator<T>;
+        using const_iterator = Iterator<const T>;
+
+        StableVector() = default;
+        StableVector(const StableVector& other) { *this = other; }
+        StableVector(StableVector&& other) noexcept { *this = std::move(other); }
+        ~StableVector() { clear(); }
+
+        StableVector& operator=(const StableVector& other)
+        {
+            if (this != &other)
+            {
+                clear();
+                reserve(other.size());
+                for (const T& value : other)
+                {
+                    emplace_back(value);
+                }
+            }
+            return *this;
+        }
+
+        StableVector& operator=(StableVector&& other) noexcept
+        {
+            if (this != &other)
+            {
+                clear();
+                std::swap(m_first, other.m_first);
+                std::swap(m_last, other.m_last);
+                std::swap(m_size, other.m_size);
+                std::swap(m_reserved, other.m_reserved);
+            }
+            return *this;
+        }
+
+        size_t size() const { return m_size; }
+        bool empty() const { return m_size == 0; }
+
+        /// \brief Makes the next allocated chunk large enough for n elements in total
+        void reserve(size_t n)
+        {
+            if (n > m_reserved)
+            {
+                m_reserved = n;
+            }
+        }
+
+        template <typename... Args>
+        T& emplace_back(Args&&... args)
+        {
+            if (m_last != nullptr && m_last->size < m_last->capacity)
+            {
+                T* element =
+                    new (m_last->elements() + m_last->size) T(std::forward<Args>(args)...);
+                m_last->size++;
+                m_size++;
+                return *element;
+            }
+
+            size_t capacity = m_last == nullptr ? 1 : 2 * m_last->capacity;
+            if (m_reserved > m_size + capacity)
+            {
+                capacity = m_reserved - m_size;
+            }
+            void* memory = ::operator new(Chunk::header_size + capacity * sizeof(T));
+            Chunk* chunk = new (memory) Chunk{nullptr, capacity, 0};
+            // the chunk is linked only after the element is constructed, so the container has no
+            // empty chunks if the constructor throws
+            T* element;
+            try
+            {
+                element = new (chunk->elements()) T(std::forward<Args>(args)...);
+            }
+            catch (...)
+            {
+                ::operator delete(memory);
+                throw;
+            }
+            chunk->size = 1;
+            if (m_last == nullptr)
+            {
+                m_first = chunk;
+            }
+            else
+            {
+                m_last->next = chunk;
+            }
+            m_last = chunk;
+            m_size++;
+            return *element;
+        }
+
+        T& operator[](size_t i) { return find(i); }
+        const T& operator[](size_t i) const { return find(i); }
+
+        T& at(size_t i)
+        {
+            check_range(i);
+            return find(i);
+        }
+        const T& at(size_t i) const
+        {
+            check_range(i);
+            return find(i);
+        }
+
+        T& back() { return m_last->elements()[m_last->size - 1]; }
+        const T& back() const { return m_last->elements()[m_last->size - 1]; }
+
+        iterator begin() { return iterator(m_first, 0); }
+        iterator end() { return iterator(nullptr, 0); }
+        const_iterator begin() const { return const_iterator(m_first, 0); }
+        const_iterator end() const { return const_iterator(nullptr, 0); }
+
+        void clear()
+        {
+            Chunk* chunk = m_first;
+            while (chunk != nullptr)
+            {
+                for (size_t i = 0; i < chunk->size; i++)
+                {
+                    chunk->elements()[i].~T();
+                }
+                Chunk* next = chunk->next;
+                chunk->~Chunk();
+                ::operator delete(chunk);
+                chunk = next;
+            }
+            m_first = nullptr;
+            m_last = nullptr;
+            m_size = 0;
+            m_reserved = 0;
+        }
+
+    private:
+        T& find(size_t i) const
+        {
+            Chunk* chunk = m_first;
+            while (i >= chunk->size)
+            {
+                i -= chunk->size;
+                chunk = chunk->next;
+            }
+            return chunk->elements()[i];
+        }
+
+        void check_range(size_t i) const
+        {
+            if (i >= m_size)
+            {
+                throw std::out_of_range("StableVector index is out of range");
+            }
+        }
+
+        Chunk* m_first{nullptr};
+        Chunk* m_last{nullptr};
+        size_t m_size{0};
+        size_t m_reserved{0};
+    };
+} // namespace ngraph
@@ -9,6 +9,7 @@
 #include <utility>
 #include "ngraph/coordinate_transform.hpp"
 #include "ngraph/op/util/attr_types.hpp"
+#include "ngraph/runtime/reference/utils/parallel.hpp"
 #include "ngraph/shape_util.hpp"
 
 namespace ngraph
@@ -77,6 +78,108 @@ namespace ngraph
                     }
                 }
 
+                // Merges the adjacent output dimensions broadcasted the same way and computes the
+                // output by the blocks of elements, the blocks are processed concurrently.
+                template <typename T, typename U, typename Functor>
+                void numpy_autobroadcast_binop_blocks(const T* arg0,
+                                                      const T* arg1,
+                                                      U* out,
+                                                      const Shape& shape0,
+                                                      const Shape& shape1,
+                                                      const size_t padding0,
+                                                      const size_t padding1,
+                                                      const Shape& output_shape,
+                                                      Functor elementwise_functor)
+                {
+                    // the innermost dimension goes first, broadcasted dimensions have zero strides
+                    std::vector<size_t> dims;
+                    std::vector<size_t> strides0;
+                    std::vector<size_t> strides1;
+                    size_t stride0 = 1;
+                    size_t stride1 = 1;
+                    for (size_t i = output_shape.size(); i-- > 0;)
+                    {
+                        if (output_shape[i] == 1)
+                            continue;
+                        const size_t dim0 = value_with_padding_or(shape0, padding0, i, 1);
+                        const size_t dim1 = value_with_padding_or(shape1, padding1, i, 1);
+                        const size_t s0 = dim0 == 1 ? 0 : stride0;
+                        const size_t s1 = dim1 == 1 ? 0 : stride1;
+                        if (!dims.empty() && (s0 == 0) == (strides0.back() == 0) &&
+                            (s1 == 0) == (strides1.back() == 0))
+                        {
+                            dims.back() *= output_shape[i];
+                        }
+                        else
+                        {
+                            dims.push_back(output_shape[i]);
+                            strides0.push_back(s0);
+                            strides1.push_back(s1);
+                        }
+                        stride0 *= dim0;
+                        stride1 *= dim1;
+                    }
+
+                    const size_t inner = dims[0];
+                    const size_t inner0 = strides0[0];
+                    const size_t inner1 = strides1[0];
+                    parallel_for_elements(shape_size(output_shape), [&](size_t begin, size_t end) {
+                        std::vector<size_t> index(dims.size());
+                        size_t offset0 = 0;
+                        size_t offset1 = 0;
+                        for (size_t i = 0, pos = begin; i < dims.size(); ++i)
+                        {
+                            index[i] = pos % dims[i];
+                            pos /= dims[i];
+                            offset0 += index[i] * strides0[i];
+                            offset1 += index[i] * strides1[i];
+                        }
+                        for (size_t pos = begin; pos < end;)
+                        {
+                            const size_t count = std::min(inner - index[0], end - pos);
+                            const T* a = arg0 + offset0;
+                            const T* b = arg1 + offset1;
+                            U* o = out + pos;
+                            if (inner0 && inner1)
+                            {
+                                for (size_t i = 0; i < count; ++i)
+                                    o[i] = elementwise_functor(a[i], b[i]);
+                            }
+                            else if (inner0)
+                            {
+                                for (size_t i = 0; i < count; ++i)
+                                    o[i] = elementwise_functor(a[i], *b);
+                            }
+                            else if (inner1)
+                            {
+                                for (size_t i = 0; i < count; ++i)
+                                    o[i] = elementwise_functor(*a, b[i]);
+                            }
+                            else
+                            {
+                                for (size_t i = 0; i < count; ++i)
+                                    o[i] = elementwise_functor(*a, *b);
+                            }
+                            pos += count;
+
+                            // move to the beginning of the next row
+                            offset0 -= index[0] * inner0;
+                            offset1 -= index[0] * inner1;
+                            index[0] = 0;
+                            for (size_t i = 1; i < dims.size(); ++i)
+                            {
+                                offset0 += strides0[i];
+                                offset1 += strides1[i];
+                                if (++index[i] < dims[i])
+                                    break;
+                                offset0 -= index[i] * strides0[i];
+                                offset1 -= index[i] * strides1[i];
+                                index[i] = 0;
+                            }
+                        }
+                    });
+                }
+
                 inline size_t calculate_fixed_axis(size_t axis, const size_t* strides)
                 {
                     while (axis > 0 && strides[axis - 1] == 1)
@@ -114,10 +217,12 @@ namespace ngraph
                 switch (broadcast_spec.m_type)
                 {
                 case op::AutoBroadcastType::NONE:
-                    for (size_t i = 0; i < shape_size(arg0_shape); i++)
-                    {
-                        out[i] = elementwise_functor(arg0[i], arg1[i]);
-                    }
+                    parallel_for_elements(shape_size(arg0_shape), [&](size_t begin, size_t end) {
+                        for (size_t i = begin; i < end; i++)
+                        {
+                            out[i] = elementwise_functor(arg0[i], arg1[i]);
+                        }
+                    });
                     break;
                 case op::AutoBroadcastType::NUMPY:
                     // We'll be using CoordinateTransform to handle the broadcasting. The general
@@ -191,7 +296,19 @@ namespace ngraph
                         }
 #else
 
-                        if (axis == 0)
+                        if (shape_size(output_shape) >= 2 * parallel_block_size)
+                        {
+                            numpy_autobroadcast_binop_blocks(arg0,
+                                                             arg1,
+                                                             out,
+                                                             arg0_shape,
+                                                             arg1_shape,
+                                                             padding0,
+                                                             padding1,
+                                                             output_shape,
+                                                             elementwise_functor);
+                        }
+                        else if (axis == 0)
                         {
                             for (size_t i = 0, end = strides0[0]; i < end; ++i)
                                 out[i] = elementwise_functor(arg0[i], arg1[i]);
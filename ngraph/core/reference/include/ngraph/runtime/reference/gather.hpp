@@ -4,8 +4,10 @@
 
 #pragma once
 
+#include <algorithm>
 #include <numeric>
 
+#include "ngraph/runtime/reference/utils/parallel.hpp"
 #include "ngraph/shape.hpp"
 #include "utils/span.hpp"
 
@@ -37,30 +39,60 @@ namespace ngraph
                 int64_t batch_indices_mul = shape_size(span(indices_shape).subspan(batch_dims));
 
                 int64_t axis_size = data_shape[axis];
-                int64_t data_offset, out_offset, idx;
 
-                for (int64_t batch = 0; batch < batch_size; batch++)
-                    for (int64_t outer_idx = 0; outer_idx < outer_size; outer_idx++)
+                // every index of every batch and outer position copies its own slice of the
+                // output, so the slices are copied concurrently
+                auto copy_slices = [&](size_t begin, size_t end) {
+                    int64_t i = begin % indices_size;
+                    int64_t outer_idx = (begin / indices_size) % outer_size;
+                    int64_t batch = begin / indices_size / outer_size;
+                    for (size_t n = begin; n < end; n++)
                     {
-                        data_offset = batch_data_mul * batch + inner_size * axis_size * outer_idx;
-                        out_offset = batch_out_mul * batch + indices_size * inner_size * outer_idx;
-                        for (int64_t i = 0; i < indices_size; i++)
-                        {
-                            idx = indices[i + batch_indices_mul * batch];
-                            // clang-format off
-                            // todo: check if bound check is needed
-                            // if (idx >= axis_size || (idx < 0 && -idx >= axis_size))
-                            //    throw std::domain_error{"indices values of Gather exceed size along axis"};
-                            // clang-format on
-                            if (idx < 0)
-                                idx += axis_size;
+                        int64_t data_offset =
+                            batch_data_mul * batch + inner_size * axis_size * outer_idx;
+                        int64_t out_offset =
+                            batch_out_mul * batch + indices_size * inner_size * outer_idx;
+                        int64_t idx = indices[i + batch_indices_mul * batch];
+                        // clang-format off
+                        // todo: check if bound check is needed
+                        // if (idx >= axis_size || (idx < 0 && -idx >= axis_size))
+                        //    throw std::domain_error{"indices values of Gather exceed size along axis"};
+                        // clang-format on
+                        if (idx < 0)
+                            idx += axis_size;
+
+                        const auto src_begin = std::next(data, data_offset + inner_size * idx);
+                        const auto src_end = std::next(src_begin, inner_size);
+                        const auto out_ptr = std::next(out, out_offset + inner_size * i);
+                        std::copy(src_begin, src_end, out_ptr);
 
-                            const auto src_begin = std::next(data, data_offset + inner_size * idx);
-                            const auto src_end = std::next(src_begin, inner_size);
-                            const auto out_ptr = std::next(out, out_offset + inner_size * i);
-                            std::copy(src_begin, src_end, out_ptr);
+                        if (++i == indices_size)
+                        {
+                            i = 0;
+                            if (++outer_idx == outer_size)
+                            {
+                                outer_idx = 0;
+                                batch++;
+                            }
                         }
                     }
+                };
+
+                const size_t slices = batch_size * outer_size * indices_size;
+                if (slices == 0)
+                {
+                    return;
+                }
+                if (slices * static_cast<size_t>(inner_size) < 2 * parallel_block_size)
+                {
+                    copy_slices(0, slices);
+                }
+                else
+                {
+                    const size_t min_slices = std::max<size_t>(
+                        parallel_block_size / static_cast<size_t>(inner_size), 1);
+                    parallel_for_blocks(slices, min_slices, copy_slices);
+                }
             }
 
         } // namespace reference
@@ -0,0 +1,40 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <utility>
+
+#include "ngraph/parallel_for.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace reference
+        {
+            /// \brief Minimal number of elements processed by a separate task, smaller tensors
+            ///        are processed faster than the tasks are scheduled
+            constexpr size_t parallel_block_size = 32768;
+
+            /// \brief Calls body(begin, end) for the blocks of [0, count) elements. The blocks
+            ///        are processed concurrently by the executor set with
+            ///        ngraph::set_parallel_for(), so body has to write disjoint outputs.
+            template <typename Body>
+            void parallel_for_elements(size_t count, Body&& body)
+            {
+                if (count < 2 * parallel_block_size)
+                {
+                    if (count > 0)
+                    {
+                        body(size_t{0}, count);
+                    }
+                    return;
+                }
+                parallel_for_blocks(count, parallel_block_size, std::forward<Body>(body));
+            }
+        } // namespace reference
+    }     // namespace runtime
+} // namespace ngraph
@@ -8,6 +8,7 @@
 #include "ngraph/check.hpp"
 #include "ngraph/runtime/opt_kernel/reshape.hpp"
 #include "ngraph/runtime/reference/reshape.hpp"
+#include "ngraph/runtime/reference/utils/parallel.hpp"
 
 using namespace ngraph;
 
@@ -234,6 +235,99 @@ namespace
             }
         }
     }
+    template <size_t elem_size>
+    void copy_strided(const char* in, char* out, size_t count, size_t in_stride)
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            memcpy(out, in, elem_size);
+            in += in_stride * elem_size;
+            out += elem_size;
+        }
+    }
+
+    void copy_strided(const char* in, char* out, size_t count, size_t in_stride, size_t elem_size)
+    {
+        if (in_stride == 1)
+        {
+            memcpy(out, in, count * elem_size);
+            return;
+        }
+        switch (elem_size)
+        {
+        case 1: copy_strided<1>(in, out, count, in_stride); break;
+        case 2: copy_strided<2>(in, out, count, in_stride); break;
+        case 4: copy_strided<4>(in, out, count, in_stride); break;
+        case 8: copy_strided<8>(in, out, count, in_stride); break;
+        default:
+            for (size_t i = 0; i < count; ++i)
+            {
+                memcpy(out, in, elem_size);
+                in += in_stride * elem_size;
+                out += elem_size;
+            }
+        }
+    }
+
+    // Splits the output into rows of the innermost dimension, every row is gathered from the input
+    // with a constant stride, so the blocks of rows are copied concurrently.
+    void reshape_in_parallel(const char* in,
+                             char* out,
+                             const Shape& in_shape,
+                             const AxisVector& in_axis_order,
+                             size_t elem_size)
+    {
+        const size_t rank = in_shape.size();
+        Shape out_shape(rank);
+        std::vector<size_t> in_strides(rank);
+        size_t in_stride = 1;
+        for (size_t i = rank; i-- > 0;)
+        {
+            in_strides[i] = in_stride;
+            in_stride *= in_shape[i];
+        }
+        // strides of the input along the output dimensions
+        std::vector<size_t> strides(rank);
+        for (size_t i = 0; i < rank; i++)
+        {
+            out_shape[i] = in_shape[in_axis_order[i]];
+            strides[i] = in_strides[in_axis_order[i]];
+        }
+
+        const size_t row_size = out_shape.back();
+        const size_t rows = shape_size(out_shape) / row_size;
+        const size_t min_rows =
+            std::max<size_t>(runtime::reference::parallel_block_size / row_size, 1);
+        parallel_for_blocks(rows, min_rows, [&](size_t begin, size_t end) {
+            std::vector<size_t> index(rank - 1);
+            size_t offset = 0;
+            for (size_t i = rank - 1, row = begin; i-- > 0;)
+            {
+                index[i] = row % out_shape[i];
+                row /= out_shape[i];
+                offset += index[i] * strides[i];
+            }
+            for (size_t row = begin; row < end; ++row)
+            {
+                copy_strided(in + offset * elem_size,
+                             out + row * row_size * elem_size,
+                             row_size,
+                             strides.back(),
+                             elem_size);
+                for (size_t i = rank - 1; i-- > 0;)
+                {
+                    offset += strides[i];
+                    if (++index[i] < out_shape[i])
+                    {
+                        break;
+                    }
+                    offset -= index[i] * strides[i];
+                    index[i] = 0;
+                }
+            }
+        });
+    }
+
     bool no_axis_reordering(const AxisVector& axis_order)
     {
         auto tmp = axis_order;
@@ -255,6 +349,12 @@ void runtime::opt_kernel::reshape(const char* in,
         return;
     }
 
+    if (shape_size(in_shape) >= 2 * runtime::reference::parallel_block_size)
+    {
+        reshape_in_parallel(in, out, in_shape, in_axis_order, elem_size);
+        return;
+    }
+
     switch (in_shape.size())
     {
     case 0: reshape_in0(in, out, in_shape, in_axis_order, out_shape, elem_size); break;
@@ -2,9 +2,11 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
 #include <cstring>
 
 #include "ngraph/runtime/reference/concat.hpp"
+#include "ngraph/runtime/reference/utils/parallel.hpp"
 
 namespace ngraph
 {
@@ -40,21 +42,46 @@ namespace ngraph
                 }
 
                 const auto& shape_sizes = calculate_shape_sizes(in_shapes);
+                const size_t out_size = shape_size(out_shape);
+                if (steps == 0 || out_size == 0)
+                {
+                    return;
+                }
 
-                size_t out_offset = 0;
-                for (size_t step = 0; step < steps; ++step)
+                // offsets of the inputs in the output block of a step
+                std::vector<size_t> step_offsets(args.size() + 1, 0);
+                for (size_t in_index = 0; in_index < args.size(); ++in_index)
                 {
-                    for (size_t in_index = 0; in_index < args.size(); ++in_index)
+                    step_offsets[in_index + 1] =
+                        step_offsets[in_index] + shape_sizes[in_index] / steps;
+                }
+
+                // every input of every step is copied to its own part of the output, so the copies
+                // are independent
+                const size_t copies = steps * args.size();
+                auto copy = [&](size_t begin, size_t end) {
+                    for (size_t i = begin; i < end; ++i)
                     {
+                        const size_t step = i / args.size();
+                        const size_t in_index = i % args.size();
                         const size_t size = shape_sizes[in_index] / steps;
                         const size_t in_offset = step * size;
+                        const size_t out_offset =
+                            step * step_offsets.back() + step_offsets[in_index];
 
                         std::memcpy(&out[out_offset * elem_size],
                                     &args[in_index][in_offset * elem_size],
                                     size * elem_size);
-
-                        out_offset += size;
                     }
+                };
+                if (out_size < 2 * parallel_block_size)
+                {
+                    copy(0, copies);
+                }
+                else
+                {
+                    parallel_for_blocks(
+                        copies, std::max<size_t>(parallel_block_size * copies / out_size, 1), copy);
                 }
             }
         } // namespace reference
@@ -3,8 +3,10 @@
 //
 
 #include <algorithm>
+#include <exception>
 #include <list>
 #include <memory>
+#include <unordered_map>
 #include <ngraph/ops.hpp>
 
 #include "itt.hpp"
@@ -15,6 +17,7 @@
 #include "ngraph/op/util/variable_context.hpp"
 #include "ngraph/op/util/variable_extension.hpp"
 #include "ngraph/opsets/opset7.hpp"
+#include "ngraph/parallel_validation.hpp"
 #include "ngraph/validation_util.hpp"
 
 using namespace std;
@@ -225,6 +228,106 @@ void Function::prerequirements(bool detect_variables, bool detect_parameters)
         check_all_variables_registered(ordered_ops, m_variables);
 }
 
+namespace
+{
+    // smaller functions are validated faster than the levels are scheduled
+    const size_t min_parallel_validation_size = 64;
+
+    // Validates the nodes level by level, the nodes of a level depend only on the nodes of the
+    // previous levels, so they are validated concurrently.
+    void validate_nodes_in_parallel(const std::vector<shared_ptr<Node>>& ordered_ops,
+                                    const ParallelFor& parallel_for)
+    {
+        OV_ITT_SCOPED_TASK(ngraph::itt::domains::nGraph, "validate_nodes_in_parallel");
+
+        std::unordered_map<const Node*, size_t> node_levels;
+        node_levels.reserve(ordered_ops.size());
+        std::vector<std::vector<Node*>> levels;
+        auto get_level = [&node_levels](const Node* node) {
+            auto it = node_levels.find(node);
+            return it == node_levels.end() ? 0 : it->second + 1;
+        };
+        for (const auto& node : ordered_ops)
+        {
+            size_t level = 0;
+            for (const auto& input : node->inputs())
+            {
+                level = std::max(level, get_level(input.get_source_output().get_node()));
+            }
+            for (const auto& dependency : node->get_control_dependencies())
+            {
+                level = std::max(level, get_level(dependency.get()));
+            }
+            node_levels[node.get()] = level;
+            if (levels.size() <= level)
+            {
+                levels.resize(level + 1);
+            }
+            levels[level].push_back(node.get());
+        }
+
+        bool failed = false;
+        for (const auto& level : levels)
+        {
+            std::vector<Node*> concurrent_nodes;
+            std::vector<Node*> serial_nodes;
+            for (const auto node : level)
+            {
+                (node->has_thread_safe_validation() ? concurrent_nodes : serial_nodes)
+                    .push_back(node);
+            }
+            std::vector<std::exception_ptr> errors(concurrent_nodes.size());
+            auto validate = [&](size_t i) {
+                try
+                {
+                    concurrent_nodes[i]->revalidate_and_infer_types();
+                }
+                catch (...)
+                {
+                    errors[i] = std::current_exception();
+                }
+            };
+            if (concurrent_nodes.size() > 1)
+            {
+                parallel_for(concurrent_nodes.size(), validate);
+            }
+            else if (concurrent_nodes.size() == 1)
+            {
+                validate(0);
+            }
+            failed = std::any_of(errors.begin(), errors.end(), [](const std::exception_ptr& e) {
+                return e != nullptr;
+            });
+            if (failed)
+            {
+                break;
+            }
+            try
+            {
+                for (const auto node : serial_nodes)
+                {
+                    node->revalidate_and_infer_types();
+                }
+            }
+            catch (...)
+            {
+                failed = true;
+                break;
+            }
+        }
+
+        // Nodes are validated in a different order than the sequential validation does, so
+        // the error is reproduced sequentially to report the same failure as it would.
+        if (failed)
+        {
+            for (const auto& node : ordered_ops)
+            {
+                node->revalidate_and_infer_types();
+            }
+        }
+    }
+}
+
 void Function::validate_nodes_and_infer_types() const
 {
     OV_ITT_SCOPED_TASK(ngraph::itt::domains::nGraph, "Function::validate_nodes_and_infer_types");
@@ -237,9 +340,22 @@ void Function::validate_nodes_and_infer_types() const
     std::map<Variable*, Counter> pair_checker;
     std::stringstream unregistered_parameters;
     std::stringstream unregistered_variables;
-    for (auto& node : get_ordered_ops())
+    const auto ordered_ops = get_ordered_ops();
+    const auto parallel_for = get_parallel_for();
+    if (get_parallel_validation_enabled() && parallel_for &&
+        ordered_ops.size() >= min_parallel_validation_size)
+    {
+        validate_nodes_in_parallel(ordered_ops, parallel_for);
+    }
+    else
+    {
+        for (auto& node : ordered_ops)
+        {
+            node->revalidate_and_infer_types();
+        }
+    }
+    for (auto& node : ordered_ops)
     {
-        node->revalidate_and_infer_types();
         if (op::is_parameter(node) &&
             std::find(m_parameters.begin(), m_parameters.end(), node) == m_parameters.end())
             unregistered_parameters << node << std::endl;
@@ -273,54 +273,98 @@ bool ngraph::is_post_dominated(Node* X, Node* Y)
     return true;
 }
 
-std::vector<std::shared_ptr<ngraph::Node>>
-    ngraph::clone_nodes(const std::vector<std::shared_ptr<ngraph::Node>>& nodes, NodeMap& node_map)
+namespace
 {
-    // for each node in topological order
-    auto sorted_nodes = topological_sort(nodes);
-    for (auto node : sorted_nodes)
+    // clones nodes given in topological order
+    void clone_sorted_nodes(const std::vector<std::shared_ptr<Node>>& sorted_nodes,
+                            NodeMap& node_map,
+                            bool trusted)
     {
-        if (node_map.count(node.get()) == 0)
+        for (const auto& node : sorted_nodes)
         {
-            // get (already) cloned arguments and clone the node
-            OutputVector cloned_args;
-            for (auto input : node->inputs())
-            {
-                Output<Node> output = input.get_source_output();
-                cloned_args.push_back(output.for_node(node_map.at(output.get_node())));
-            }
-            std::vector<std::shared_ptr<Node>> cloned_dependencies;
-            for (auto& dependency : node->get_control_dependencies())
+            if (node_map.count(node.get()) == 0)
             {
-                shared_ptr<Node>& dependent = node_map.at(dependency.get());
-                if (find(cloned_dependencies.begin(), cloned_dependencies.end(), dependent) ==
-                    cloned_dependencies.end())
+                // get (already) cloned arguments and clone the node
+                OutputVector cloned_args;
+                cloned_args.reserve(node->get_input_size());
+                for (auto input : node->inputs())
                 {
-                    cloned_dependencies.push_back(dependent);
+                    Output<Node> output = input.get_source_output();
+                    cloned_args.push_back(output.for_node(node_map.at(output.get_node())));
                 }
-            }
-            auto cloned_node = node->copy_with_new_inputs(cloned_args, cloned_dependencies);
-            // There is a friendly name for this node so copy it
-            cloned_node->set_friendly_name(node->get_friendly_name());
-            auto rt_info = node->get_rt_info();
-            cloned_node->get_rt_info() = rt_info;
+                std::vector<std::shared_ptr<Node>> cloned_dependencies;
+                for (auto& dependency : node->get_control_dependencies())
+                {
+                    shared_ptr<Node>& dependent = node_map.at(dependency.get());
+                    if (find(cloned_dependencies.begin(), cloned_dependencies.end(), dependent) ==
+                        cloned_dependencies.end())
+                    {
+                        cloned_dependencies.push_back(dependent);
+                    }
+                }
+                auto cloned_node =
+                    trusted ? node->copy_with_new_inputs_trusted(cloned_args, cloned_dependencies)
+                            : node->copy_with_new_inputs(cloned_args, cloned_dependencies);
+                // There is a friendly name for this node so copy it
+                cloned_node->set_friendly_name(node->get_friendly_name());
+                cloned_node->get_rt_info() = node->get_rt_info();
 
-            for (auto output : node->outputs())
-            {
-                const auto& output_rt_info = output.get_rt_info();
-                auto new_output = output.for_node(cloned_node);
-                new_output.get_rt_info() = output_rt_info;
+                for (auto output : node->outputs())
+                {
+                    const auto& output_rt_info = output.get_rt_info();
+                    auto new_output = output.for_node(cloned_node);
+                    new_output.get_rt_info() = output_rt_info;
+                }
+
+                for (const auto& tag : node->get_provenance_tags())
+                {
+                    cloned_node->add_provenance_tag(tag);
+                }
+                cloned_node->set_op_annotations(node->get_op_annotations());
+
+                node_map[node.get()] = cloned_node;
             }
+        }
+    }
 
-            for (auto tag : node->get_provenance_tags())
+    std::shared_ptr<Function> clone_function_from_map(const Function& func, NodeMap& node_map)
+    {
+        // get cloned function results and sinks and parameters
+        ResultVector cloned_results;
+        for (shared_ptr<Node> node : func.get_results())
+        {
+            auto result = as_type_ptr<op::Result>(node_map.at(node.get()));
+            if (!result)
             {
-                cloned_node->add_provenance_tag(tag);
+                throw ngraph_error("Results should be of type op::Result");
             }
-            cloned_node->set_op_annotations(node->get_op_annotations());
+            cloned_results.push_back(result);
+        }
+        SinkVector cloned_sinks;
+        for (auto node : func.get_sinks())
+        {
+            cloned_sinks.push_back(static_pointer_cast<op::Sink>(node_map.at(node.get())));
+        }
 
-            node_map[node.get()] = cloned_node;
+        std::vector<std::shared_ptr<op::Parameter>> cloned_params;
+        for (auto param : func.get_parameters())
+        {
+            cloned_params.push_back(as_type_ptr<op::Parameter>(node_map.at(param.get())));
         }
+
+        // create and return cloned function
+        auto result = std::make_shared<ngraph::Function>(cloned_results, cloned_params);
+        result->set_friendly_name(func.get_friendly_name());
+        result->add_sinks(cloned_sinks);
+        return result;
     }
+}
+
+std::vector<std::shared_ptr<ngraph::Node>>
+    ngraph::clone_nodes(const std::vector<std::shared_ptr<ngraph::Node>>& nodes, NodeMap& node_map)
+{
+    // for each node in topological order
+    clone_sorted_nodes(topological_sort(nodes), node_map, false);
 
     // create and return vector of cloned nodes
     // order matches input vector (not necessarily topological)
@@ -406,35 +450,23 @@ std::shared_ptr<ngraph::Function> ngraph::clone_function(const ngraph::Function&
 {
     // clone function operations
     clone_nodes(func.get_ops(), node_map);
+    return clone_function_from_map(func, node_map);
+}
 
-    // get cloned function results and sinks and parameters
-    ResultVector cloned_results;
-    for (shared_ptr<Node> node : func.get_results())
-    {
-        auto result = as_type_ptr<op::Result>(node_map.at(node.get()));
-        if (!result)
-        {
-            throw ngraph_error("Results should be of type op::Result");
-        }
-        cloned_results.push_back(result);
-    }
-    SinkVector cloned_sinks;
-    for (auto node : func.get_sinks())
-    {
-        cloned_sinks.push_back(static_pointer_cast<op::Sink>(node_map.at(node.get())));
-    }
-
-    std::vector<std::shared_ptr<op::Parameter>> cloned_params;
-    for (auto param : func.get_parameters())
-    {
-        cloned_params.push_back(as_type_ptr<op::Parameter>(node_map.at(param.get())));
-    }
+std::shared_ptr<ngraph::Function> ngraph::clone_function_trusted(const ngraph::Function& func)
+{
+    NodeMap nm;
+    return clone_function_trusted(func, nm);
+}
 
-    // create and return cloned function
-    auto result = std::make_shared<ngraph::Function>(cloned_results, cloned_params);
-    result->set_friendly_name(func.get_friendly_name());
-    result->add_sinks(cloned_sinks);
-    return result;
+std::shared_ptr<ngraph::Function> ngraph::clone_function_trusted(const ngraph::Function& func,
+                                                                 NodeMap& node_map)
+{
+    // ordered ops are already sorted, so the graph is traversed once instead of twice
+    const auto ordered_ops = func.get_ordered_ops();
+    node_map.reserve(node_map.size() + ordered_ops.size());
+    clone_sorted_nodes(ordered_ops, node_map, true);
+    return clone_function_from_map(func, node_map);
 }
 
 bool ngraph::is_equal_to_const_value(std::string const_value, const Output<Node>& reduce_constant)
@@ -22,15 +22,35 @@ using namespace ngraph;
 
 atomic<size_t> Node::m_next_instance_id(0);
 
+namespace
+{
+    // Inputs of the node constructed by copy_with_new_inputs_trusted(). Only the node connected
+    // to exactly these inputs skips validation, so helper nodes created by clone_with_new_inputs()
+    // and nested copies are still validated.
+    thread_local const OutputVector* trusted_copy_inputs = nullptr;
+
+    class TrustedCopyScope
+    {
+    public:
+        explicit TrustedCopyScope(const OutputVector& inputs)
+            : m_saved(trusted_copy_inputs)
+        {
+            trusted_copy_inputs = &inputs;
+        }
+        ~TrustedCopyScope() { trusted_copy_inputs = m_saved; }
+
+    private:
+        const OutputVector* m_saved;
+    };
+}
+
 Node::Node(const Node& node)
     : m_control_dependents(node.m_control_dependents)
     , m_control_dependencies(node.m_control_dependencies)
-    // skip m_node_type -- will be generated automatically
     , m_instance_id(m_next_instance_id.fetch_add(1))
     , m_friendly_name(node.m_friendly_name)
     // skip m_unique_name -- will be generated automatically
-    , m_provenance_tags(node.m_provenance_tags)
-    , m_provenance_group(node.m_provenance_group)
+    , m_provenance(node.m_provenance ? new Provenance(*node.m_provenance) : nullptr)
     , m_inputs(node.m_inputs) // will be modified in the body
     // skip m_outputs -- should be initialized outside
     , m_op_annotations(node.m_op_annotations)
@@ -50,8 +70,7 @@ Node& Node::operator=(const Node& node)
     this->m_control_dependencies = node.m_control_dependencies;
     this->m_instance_id = m_next_instance_id.fetch_add(1);
     this->m_friendly_name = node.m_friendly_name;
-    this->m_provenance_tags = node.m_provenance_tags;
-    this->m_provenance_group = node.m_provenance_group;
+    this->m_provenance.reset(node.m_provenance ? new Provenance(*node.m_provenance) : nullptr);
     this->m_inputs = node.m_inputs;
     this->m_op_annotations = node.m_op_annotations;
     this->m_rt_info = node.m_rt_info;
@@ -139,6 +158,47 @@ std::shared_ptr<Node>
     return clone;
 }
 
+std::shared_ptr<Node> Node::copy_with_new_inputs_trusted(
+    const OutputVector& inputs,
+    const std::vector<std::shared_ptr<Node>>& control_dependencies) const
+{
+    shared_ptr<Node> clone;
+    {
+        TrustedCopyScope scope(inputs);
+        clone = clone_with_new_inputs(inputs);
+    }
+    if (clone->get_output_size() < get_output_size())
+    {
+        clone->set_output_size(get_output_size());
+    }
+    for (size_t i = 0; i < get_output_size(); i++)
+    {
+        const auto& tensor = get_output_tensor(i);
+        auto& cloned_tensor = clone->get_output_tensor(i);
+        cloned_tensor.set_tensor_type(tensor.get_element_type(), tensor.get_partial_shape());
+        cloned_tensor.set_names(tensor.get_names());
+        if (tensor.get_lower_value())
+        {
+            cloned_tensor.set_lower_value(tensor.get_lower_value());
+        }
+        if (tensor.get_upper_value())
+        {
+            cloned_tensor.set_upper_value(tensor.get_upper_value());
+        }
+    }
+    for (size_t i = 0; i < get_input_size() && i < clone->get_input_size(); i++)
+    {
+        const auto& input = m_inputs[i];
+        clone->set_input_is_relevant_to_shape(i, input.get_is_relevant_to_shape());
+        clone->set_input_is_relevant_to_value(i, input.get_is_relevant_to_value());
+    }
+    for (auto& cdep : control_dependencies)
+    {
+        clone->add_control_dependency(cdep);
+    }
+    return clone;
+}
+
 void Node::safe_delete(NodeVector& nodes, bool recurse)
 {
     for (auto& input : m_inputs)
@@ -183,6 +243,7 @@ void Node::set_arguments(const NodeVector& arguments)
 void Node::set_arguments(const OutputVector& arguments)
 {
     // Add this node as a user of each argument.
+    m_inputs.reserve(m_inputs.size() + arguments.size());
     size_t i = 0;
     for (auto& output : arguments)
     {
@@ -222,12 +283,25 @@ void Node::set_argument(size_t position, const Output<Node>& argument)
 
 void Node::constructor_validate_and_infer_types()
 {
+    if (trusted_copy_inputs != nullptr && m_inputs.size() == trusted_copy_inputs->size())
+    {
+        bool is_trusted_copy = true;
+        for (size_t i = 0; i < m_inputs.size() && is_trusted_copy; i++)
+        {
+            is_trusted_copy = input_value(i) == (*trusted_copy_inputs)[i];
+        }
+        if (is_trusted_copy)
+        {
+            return;
+        }
+    }
     validate_and_infer_types();
 }
 
 void Node::set_output_size(size_t n)
 {
     NGRAPH_CHECK(n >= m_outputs.size(), "shrinking ", m_outputs.size(), " to ", n);
+    m_outputs.reserve(n);
     for (size_t i = m_outputs.size(); i < n; ++i)
     {
         // create the descriptors
@@ -294,14 +368,26 @@ void Node::set_friendly_name(const string& name)
     m_friendly_name = name;
 }
 
+Node::Provenance& Node::get_provenance()
+{
+    if (!m_provenance)
+    {
+        m_provenance.reset(new Provenance());
+    }
+    return *m_provenance;
+}
+
 void Node::add_provenance_group_member(const shared_ptr<Node>& node)
 {
-    m_provenance_group.insert(node);
+    get_provenance().group.insert(node);
 }
 
 void Node::remove_provenance_group_member(const shared_ptr<Node>& node)
 {
-    m_provenance_group.erase(node);
+    if (m_provenance)
+    {
+        m_provenance->group.erase(node);
+    }
 }
 
 void Node::replace_provenance_group_member(const shared_ptr<Node>& current_node,
@@ -320,7 +406,8 @@ void Node::replace_provenance_group_member(const shared_ptr<Node>& current_node,
 
 const set<shared_ptr<Node>>& Node::get_provenance_group_members() const
 {
-    return m_provenance_group;
+    static const set<shared_ptr<Node>> empty_group;
+    return m_provenance ? m_provenance->group : empty_group;
 }
 
 shared_ptr<Node> Node::add_provenance_group_members_above(const OutputVector& base)
@@ -352,7 +439,7 @@ shared_ptr<Node> Node::add_provenance_group_members_above(const OutputVector& ba
         add_provenance_group_member(node->shared_from_this());
         for (auto value : node->input_values())
         {
-            if (m_provenance_group.count(value.get_node_shared_ptr()) == 0)
+            if (m_provenance->group.count(value.get_node_shared_ptr()) == 0)
             {
                 todo.push_back(value.get_node());
             }
@@ -390,13 +477,15 @@ void Node::add_provenance_tags_above(const OutputVector& base,
 
 const std::unordered_set<std::string>& Node::get_provenance_tags() const
 {
-    return m_provenance_tags;
+    static const std::unordered_set<std::string> empty_tags;
+    return m_provenance ? m_provenance->tags : empty_tags;
 }
 
 void Node::add_provenance_tag(const std::string& tag)
 {
-    m_provenance_tags.insert(tag);
-    for (auto node : m_provenance_group)
+    auto& provenance = get_provenance();
+    provenance.tags.insert(tag);
+    for (auto node : provenance.group)
     {
         node->add_provenance_tag(tag);
     }
@@ -404,7 +493,10 @@ void Node::add_provenance_tag(const std::string& tag)
 
 void Node::remove_provenance_tag(const std::string& tag)
 {
-    m_provenance_tags.erase(tag);
+    if (m_provenance)
+    {
+        m_provenance->tags.erase(tag);
+    }
 }
 
 void Node::merge_provenance_tags_from(const std::shared_ptr<const Node>& source)
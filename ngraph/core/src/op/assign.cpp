@@ -74,7 +74,13 @@ shared_ptr<Node> op::v3::Assign::clone_with_new_inputs(const OutputVector& new_a
 {
     NGRAPH_OP_SCOPE(v3_Assign_clone_with_new_inputs);
     check_new_args_count(this, new_args);
-    return make_shared<op::v3::Assign>(new_args.at(0), m_variable_id);
+    auto assign = make_shared<op::v3::Assign>(new_args.at(0), m_variable_id);
+    // the variable is looked up by validate_and_infer_types(), which a trusted copy doesn't run
+    if (!assign->get_variable())
+    {
+        assign->validate_and_infer_types();
+    }
+    return assign;
 }
 
 bool op::v3::Assign::visit_attributes(AttributeVisitor& visitor)
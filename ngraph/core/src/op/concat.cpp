@@ -107,7 +107,10 @@ shared_ptr<Node> op::Concat::clone_with_new_inputs(const OutputVector& new_args)
 {
     NGRAPH_OP_SCOPE(v0_Concat_clone_with_new_inputs);
     // TODO(amprocte): Should we check the new_args count here?
-    return make_shared<Concat>(new_args, m_axis);
+    auto concat = make_shared<Concat>(new_args, m_axis);
+    // normalized by validate_and_infer_types(), which a trusted copy doesn't run
+    concat->set_concatenation_axis(get_concatenation_axis());
+    return concat;
 }
 
 namespace
@@ -145,6 +145,7 @@ op::Constant::Constant(const Constant& other)
     m_shape = other.m_shape;
     m_data = other.m_data;
     m_all_elements_bitwise_identical = other.m_all_elements_bitwise_identical;
+    m_all_elements_bitwise_identical_checked = other.m_all_elements_bitwise_identical_checked;
     constructor_validate_and_infer_types();
 }
 
@@ -405,6 +406,16 @@ static bool test_bitwise_identical(const T* data, const size_t size)
     return data_is_constant;
 }
 
+bool op::Constant::get_all_data_elements_bitwise_identical() const
+{
+    if (!m_all_elements_bitwise_identical_checked)
+    {
+        m_all_elements_bitwise_identical = are_all_data_elements_bitwise_identical();
+        m_all_elements_bitwise_identical_checked = true;
+    }
+    return m_all_elements_bitwise_identical;
+}
+
 bool op::Constant::are_all_data_elements_bitwise_identical() const
 {
     bool rc = false;
@@ -471,7 +482,15 @@ bool op::v0::Constant::visit_attributes(AttributeVisitor& visitor)
         allocate_buffer();
     }
     visitor.on_attribute("value", m_data);
-    m_all_elements_bitwise_identical = are_all_data_elements_bitwise_identical();
+    if (m_alloc_buffer_on_visit_attributes)
+    {
+        m_all_elements_bitwise_identical = are_all_data_elements_bitwise_identical();
+    }
+    else
+    {
+        // Don't touch the shared data until it is really needed
+        m_all_elements_bitwise_identical_checked = false;
+    }
     return true;
 }
 
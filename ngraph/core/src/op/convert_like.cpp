@@ -8,6 +8,7 @@
 #include "ngraph/op/constant.hpp"
 #include "ngraph/op/convert.hpp"
 #include "ngraph/op/convert_like.hpp"
+#include "ngraph/op/parameter.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -46,7 +47,11 @@ bool op::v1::ConvertLike::constant_fold(OutputVector& output_values,
     if (auto data_const =
             std::dynamic_pointer_cast<op::Constant>(input_values[0].get_node_shared_ptr()))
     {
-        auto convert = make_shared<Convert>(input_values[0], input_values[1].get_element_type());
+        // the temporary Convert reads a placeholder instead of the Constant, so folding doesn't
+        // add consumers to the Constant which may be shared with the nodes folded concurrently
+        auto placeholder = make_shared<op::Parameter>(data_const->get_element_type(),
+                                                      data_const->get_output_partial_shape(0));
+        auto convert = make_shared<Convert>(placeholder, input_values[1].get_element_type());
         convert->constant_fold(output_values, OutputVector{data_const});
         return true;
     }
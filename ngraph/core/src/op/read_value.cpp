@@ -39,7 +39,13 @@ shared_ptr<Node> op::v3::ReadValue::clone_with_new_inputs(const OutputVector& ne
 {
     NGRAPH_OP_SCOPE(v3_ReadValue_clone_with_new_inputs);
     check_new_args_count(this, new_args);
-    return make_shared<ReadValue>(new_args.at(0), m_variable_id);
+    auto read_value = make_shared<ReadValue>(new_args.at(0), m_variable_id);
+    // the variable is created by validate_and_infer_types(), which a trusted copy doesn't run
+    if (!read_value->get_variable())
+    {
+        read_value->validate_and_infer_types();
+    }
+    return read_value;
 }
 
 bool op::v3::ReadValue::visit_attributes(AttributeVisitor& visitor)
@@ -86,5 +86,10 @@ shared_ptr<Node> op::ReverseSequence::clone_with_new_inputs(const OutputVector&
 {
     NGRAPH_OP_SCOPE(v0_ReverseSequence_clone_with_new_inputs);
     check_new_args_count(this, new_args);
-    return make_shared<ReverseSequence>(new_args.at(0), new_args.at(1), m_batch_axis, m_seq_axis);
+    auto reverse_sequence =
+        make_shared<ReverseSequence>(new_args.at(0), new_args.at(1), m_batch_axis, m_seq_axis);
+    // normalized by validate_and_infer_types(), which a trusted copy doesn't run
+    reverse_sequence->m_normalized_batch_axis = m_normalized_batch_axis;
+    reverse_sequence->m_normalized_seq_axis = m_normalized_seq_axis;
+    return reverse_sequence;
 }
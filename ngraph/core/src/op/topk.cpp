@@ -423,6 +423,8 @@ shared_ptr<Node> op::v1::TopK::clone_with_new_inputs(const OutputVector& new_arg
     check_new_args_count(this, new_args);
     auto new_v1_topk = make_shared<v1::TopK>(
         new_args.at(0), new_args.at(1), m_axis, m_mode, m_sort, m_index_element_type);
+    // normalized by validate_and_infer_types(), which a trusted copy doesn't run
+    new_v1_topk->m_normalized_axis = m_normalized_axis;
 
     return std::move(new_v1_topk);
 }
@@ -610,6 +612,8 @@ shared_ptr<Node> op::v3::TopK::clone_with_new_inputs(const OutputVector& new_arg
     check_new_args_count(this, new_args);
     auto new_v3_topk = make_shared<v3::TopK>(
         new_args.at(0), new_args.at(1), m_axis, m_mode, m_sort, m_index_element_type);
+    // normalized by validate_and_infer_types(), which a trusted copy doesn't run
+    new_v3_topk->m_normalized_axis = m_normalized_axis;
 
     return std::move(new_v3_topk);
 }
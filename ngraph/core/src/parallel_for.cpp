@@ -0,0 +1,60 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <mutex>
+#include <thread>
+
+#include "ngraph/parallel_for.hpp"
+
+namespace ngraph
+{
+    static std::mutex s_parallel_for_mutex;
+    static ParallelFor s_parallel_for;
+
+    void set_parallel_for(const ParallelFor& parallel_for)
+    {
+        std::lock_guard<std::mutex> lock(s_parallel_for_mutex);
+        s_parallel_for = parallel_for;
+    }
+
+    ParallelFor get_parallel_for()
+    {
+        std::lock_guard<std::mutex> lock(s_parallel_for_mutex);
+        return s_parallel_for;
+    }
+
+    void parallel_for_blocks(size_t work_amount,
+                             size_t min_block_size,
+                             const std::function<void(size_t begin, size_t end)>& body)
+    {
+        min_block_size = std::max<size_t>(min_block_size, 1);
+        ParallelFor parallel_for;
+        if (work_amount >= 2 * min_block_size)
+        {
+            parallel_for = get_parallel_for();
+        }
+        if (!parallel_for)
+        {
+            if (work_amount > 0)
+            {
+                body(0, work_amount);
+            }
+            return;
+        }
+
+        // a few blocks per thread balance the load without scheduling tiny tasks
+        static const size_t max_blocks =
+            4 * std::max<size_t>(std::thread::hardware_concurrency(), 1);
+        const size_t num_blocks = std::min(work_amount / min_block_size, max_blocks);
+        const size_t block_size = work_amount / num_blocks;
+        const size_t remainder = work_amount % num_blocks;
+        parallel_for(num_blocks, [&](size_t block) {
+            // the first blocks take one more item each to cover the remainder
+            const size_t begin = block * block_size + std::min(block, remainder);
+            const size_t end = begin + block_size + (block < remainder ? 1 : 0);
+            body(begin, end);
+        });
+    }
+} // namespace ngraph
@@ -0,0 +1,17 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <atomic>
+
+#include "ngraph/env_util.hpp"
+#include "ngraph/parallel_validation.hpp"
+
+namespace ngraph
+{
+    static std::atomic<bool> s_parallel_validation_enabled{
+        getenv_bool("NGRAPH_PARALLEL_VALIDATION")};
+
+    void set_parallel_validation_enabled(bool enabled) { s_parallel_validation_enabled = enabled; }
+    bool get_parallel_validation_enabled() { return s_parallel_validation_enabled; }
+} // namespace ngraph
@@ -3,7 +3,10 @@
 //
 
 #include "ngraph/pass/constant_folding.hpp"
+#include <atomic>
 #include <ngraph/op/constant.hpp>
+#include <unordered_map>
+#include "ngraph/env_util.hpp"
 #include "ngraph/op/util/sub_graph_base.hpp"
 #include "ngraph/rt_info.hpp"
 
@@ -12,57 +15,170 @@ using namespace ngraph;
 
 NGRAPH_RTTI_DEFINITION(ngraph::pass::ConstantFolding, "ConstantFolding", 0);
 
-bool ngraph::pass::ConstantFolding::run_on_function(std::shared_ptr<ngraph::Function> f)
+namespace
 {
-    bool rewritten = pre_calculated_values_folding(f);
+    // folding of smaller functions is faster than scheduling of their levels
+    const size_t min_parallel_folding_size = 64;
+
+    std::atomic<bool> s_parallel_constant_folding_enabled{
+        getenv_bool("NGRAPH_PARALLEL_CONSTANT_FOLDING")};
 
-    for (const auto& node : f->get_ordered_ops())
+    // Folding of a node with Constant inputs only reads the inputs and creates new nodes, so such
+    // nodes are folded concurrently. Nodes with subgraphs fold their bodies in place.
+    bool is_concurrently_foldable(const std::shared_ptr<Node>& node)
     {
-        if (rewritten)
+        if (node->get_input_size() == 0 || !node->has_thread_safe_validation() ||
+            is_type<op::util::SubGraphOp>(node))
         {
-            node->validate_and_infer_types();
+            return false;
+        }
+        for (const auto& input : node->inputs())
+        {
+            if (!is_type<op::Constant>(input.get_source_output().get_node()))
+            {
+                return false;
+            }
         }
+        return true;
+    }
 
-        OutputVector replacements(node->get_output_size());
-        if (node->constant_fold(replacements, node->input_values()))
+    // Groups the nodes into levels, the nodes of a level depend only on the nodes of the previous
+    // levels. The nodes of every level keep their topological order.
+    std::vector<std::vector<std::shared_ptr<Node>>>
+        get_levels(const std::vector<std::shared_ptr<Node>>& ordered_ops)
+    {
+        std::unordered_map<const Node*, size_t> node_levels;
+        node_levels.reserve(ordered_ops.size());
+        std::vector<std::vector<std::shared_ptr<Node>>> levels;
+        auto get_level = [&node_levels](const Node* node) {
+            auto it = node_levels.find(node);
+            return it == node_levels.end() ? 0 : it->second + 1;
+        };
+        for (const auto& node : ordered_ops)
         {
-            NGRAPH_CHECK(replacements.size() == node->get_output_size(),
-                         "constant_fold_default returned incorrect number of replacements for ",
-                         node);
+            size_t level = 0;
+            for (const auto& input : node->inputs())
+            {
+                level = std::max(level, get_level(input.get_source_output().get_node()));
+            }
+            for (const auto& dependency : node->get_control_dependencies())
+            {
+                level = std::max(level, get_level(dependency.get()));
+            }
+            node_levels[node.get()] = level;
+            if (levels.size() <= level)
+            {
+                levels.resize(level + 1);
+            }
+            levels[level].push_back(node);
+        }
+        return levels;
+    }
+} // namespace
+
+void ngraph::pass::set_parallel_constant_folding_enabled(bool enabled)
+{
+    s_parallel_constant_folding_enabled = enabled;
+}
+
+bool ngraph::pass::get_parallel_constant_folding_enabled()
+{
+    return s_parallel_constant_folding_enabled;
+}
 
-            for (size_t i = 0; i < replacements.size(); ++i)
+bool ngraph::pass::ConstantFolding::run_on_function(std::shared_ptr<ngraph::Function> f)
+{
+    bool rewritten = pre_calculated_values_folding(f);
+
+    const auto ordered_ops = f->get_ordered_ops();
+    const auto parallel_for = get_parallel_for();
+    if (get_parallel_constant_folding_enabled() && parallel_for &&
+        ordered_ops.size() >= min_parallel_folding_size)
+    {
+        return fold_in_parallel(ordered_ops, parallel_for, rewritten);
+    }
+
+    for (const auto& node : ordered_ops)
+    {
+        rewritten |= fold_node(node, rewritten);
+    }
+
+    return rewritten;
+}
+
+bool ngraph::pass::ConstantFolding::fold_in_parallel(
+    const std::vector<std::shared_ptr<Node>>& ordered_ops,
+    const ParallelFor& parallel_for,
+    bool rewritten)
+{
+    struct FoldingResult
+    {
+        OutputVector replacements;
+        bool folded = false;
+        std::exception_ptr error;
+    };
+
+    for (const auto& level : get_levels(ordered_ops))
+    {
+        std::vector<size_t> concurrent_nodes;
+        for (size_t i = 0; i < level.size(); ++i)
+        {
+            if (is_concurrently_foldable(level[i]))
             {
-                auto node_output = node->output(i);
-                auto replacement = replacements.at(i);
-                if (replacement.get_node_shared_ptr() && (node_output != replacement))
-                {
-                    if (replacements.size() == 1)
-                    {
-                        replacement.get_node_shared_ptr()->set_friendly_name(
-                            node->get_friendly_name());
-                    }
-                    else
-                    {
-                        replacement.get_node_shared_ptr()->set_friendly_name(
-                            node->get_friendly_name() + "." + std::to_string(i));
-                    }
-                    node_output.replace(replacement);
-                    // Propagate runtime info attributes to replacement consumer nodes
-                    copy_runtime_info_to_target_inputs(node, replacement);
+                concurrent_nodes.push_back(i);
+            }
+        }
 
-                    rewritten = true;
+        // inputs of the level are changed only if something was folded at the previous levels
+        const bool revalidate = rewritten;
+        std::vector<FoldingResult> results(level.size());
+        auto fold = [&](size_t i) {
+            const auto& node = level[concurrent_nodes[i]];
+            auto& result = results[concurrent_nodes[i]];
+            try
+            {
+                if (revalidate)
+                {
+                    node->validate_and_infer_types();
                 }
+                result.replacements.resize(node->get_output_size());
+                result.folded = node->constant_fold(result.replacements, node->input_values());
             }
+            catch (...)
+            {
+                result.error = std::current_exception();
+            }
+        };
+        if (concurrent_nodes.size() > 1)
+        {
+            parallel_for(concurrent_nodes.size(), fold);
         }
-        else
+        else if (concurrent_nodes.size() == 1)
+        {
+            fold(0);
+        }
+
+        // the graph is changed in the topological order, so the result is the same as the
+        // sequential folding gives
+        auto next_concurrent = concurrent_nodes.begin();
+        for (size_t i = 0; i < level.size(); ++i)
         {
-            // recursively constant fold operators containing subgraphs (ie: TensorIterator, Loop)
-            if (auto sub_graph_node = std::dynamic_pointer_cast<op::util::SubGraphOp>(node))
+            if (next_concurrent != concurrent_nodes.end() && *next_concurrent == i)
             {
-                if (const auto& sub_graph = sub_graph_node->get_function())
+                ++next_concurrent;
+                const auto& result = results[i];
+                if (result.error)
                 {
-                    rewritten |= run_on_function(sub_graph);
+                    std::rethrow_exception(result.error);
                 }
+                if (result.folded)
+                {
+                    rewritten |= replace_outputs(level[i], result.replacements);
+                }
+            }
+            else
+            {
+                rewritten |= fold_node(level[i], rewritten);
             }
         }
     }
@@ -70,6 +186,63 @@ bool ngraph::pass::ConstantFolding::run_on_function(std::shared_ptr<ngraph::Func
     return rewritten;
 }
 
+bool ngraph::pass::ConstantFolding::fold_node(const std::shared_ptr<Node>& node, bool revalidate)
+{
+    if (revalidate)
+    {
+        node->validate_and_infer_types();
+    }
+
+    OutputVector replacements(node->get_output_size());
+    if (node->constant_fold(replacements, node->input_values()))
+    {
+        return replace_outputs(node, replacements);
+    }
+
+    // recursively constant fold operators containing subgraphs (ie: TensorIterator, Loop)
+    if (auto sub_graph_node = std::dynamic_pointer_cast<op::util::SubGraphOp>(node))
+    {
+        if (const auto& sub_graph = sub_graph_node->get_function())
+        {
+            return run_on_function(sub_graph);
+        }
+    }
+    return false;
+}
+
+bool ngraph::pass::ConstantFolding::replace_outputs(const std::shared_ptr<Node>& node,
+                                                    const OutputVector& replacements)
+{
+    NGRAPH_CHECK(replacements.size() == node->get_output_size(),
+                 "constant_fold_default returned incorrect number of replacements for ",
+                 node);
+
+    bool rewritten = false;
+    for (size_t i = 0; i < replacements.size(); ++i)
+    {
+        auto node_output = node->output(i);
+        auto replacement = replacements.at(i);
+        if (replacement.get_node_shared_ptr() && (node_output != replacement))
+        {
+            if (replacements.size() == 1)
+            {
+                replacement.get_node_shared_ptr()->set_friendly_name(node->get_friendly_name());
+            }
+            else
+            {
+                replacement.get_node_shared_ptr()->set_friendly_name(
+                    node->get_friendly_name() + "." + std::to_string(i));
+            }
+            node_output.replace(replacement);
+            // Propagate runtime info attributes to replacement consumer nodes
+            copy_runtime_info_to_target_inputs(node, replacement);
+
+            rewritten = true;
+        }
+    }
+    return rewritten;
+}
+
 void ngraph::pass::ConstantFolding::copy_runtime_info_to_target_inputs(
     const std::shared_ptr<Node>& node, const Output<Node>& replacement)
 {
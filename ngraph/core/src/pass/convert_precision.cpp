@@ -22,6 +22,9 @@ using namespace ngraph;
 bool fuse_type_to_constant(const std::shared_ptr<ngraph::Node>& node,
                            ngraph::element::Type to,
                            const std::vector<ngraph::Input<ngraph::Node>>& consumers);
+bool keep_constant_precision(const std::shared_ptr<ngraph::Node>& node,
+                             ngraph::element::Type to,
+                             const std::vector<ngraph::Input<ngraph::Node>>& consumers);
 bool fuse_type_to_shapeof(const std::shared_ptr<ngraph::Node>& node,
                           ngraph::element::Type to,
                           size_t idx);
@@ -175,6 +178,10 @@ namespace
                     auto it = const_to_internal_output.find(node.get());
                     if (it != const_to_internal_output.end())
                     {
+                        if (node->get_rt_info().count("KEEP_CONST_PRECISION"))
+                        {
+                            return keep_constant_precision(node, to, it->second);
+                        }
                         return fuse_type_to_constant(node, to, it->second);
                     }
 
@@ -850,6 +857,23 @@ namespace
 
 } // namespace
 
+bool keep_constant_precision(const std::shared_ptr<ngraph::Node>& node,
+                             element::Type to,
+                             const std::vector<Input<Node>>& consumers)
+{
+    // The consumers get the data in the new precision through Convert which must not be folded back
+    // into the Constant, so the Constant stays in the original precision in the function
+    auto convert = std::make_shared<opset4::Convert>(node, to);
+    convert->set_friendly_name(node->get_friendly_name() + "/Convert");
+    convert->get_rt_info()["DISABLED_CONSTANT_FOLDING"] =
+        std::make_shared<VariantWrapper<std::string>>("");
+    for (auto& input : consumers)
+    {
+        input.replace_source_output(convert);
+    }
+    return true;
+}
+
 bool fuse_type_to_constant(const std::shared_ptr<ngraph::Node>& node,
                            element::Type to,
                            const std::vector<Input<Node>>& consumers)
@@ -3,6 +3,7 @@
 //
 
 #include <algorithm>
+#include <mutex>
 #include <ngraph/ops.hpp>
 #include <ngraph/rt_info.hpp>
 #include <numeric>
@@ -1369,6 +1370,11 @@ void propagate_rt_info(Node* node, const Output<Node>& final_port)
 
 HostTensorPtr evaluate_bound(const Output<Node>& output, bool is_upper)
 {
+    // bounds are cached in the tensors of the evaluated subgraph, which may be shared by nodes
+    // validated in parallel; evaluation of some bounds is recursive
+    static std::recursive_mutex bound_evaluation_mutex;
+    std::lock_guard<std::recursive_mutex> lock(bound_evaluation_mutex);
+
     // bound is already set in the tensor
     if (is_upper && output.get_tensor().get_upper_value() != nullptr)
         return output.get_tensor().get_upper_value();
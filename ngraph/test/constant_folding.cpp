@@ -2,6 +2,9 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <atomic>
+#include <thread>
+
 #include "gtest/gtest.h"
 
 #include "ngraph/ngraph.hpp"
@@ -3457,3 +3460,93 @@ TEST(constant_folding, constant_loop)
     range_test_check(result_node_0->cast_vector<float>(), expected_0);
     range_test_check(result_node_1->cast_vector<float>(), expected_1);
 }
+
+namespace
+{
+    void thread_parallel_for(size_t size, const std::function<void(size_t)>& body)
+    {
+        std::atomic<size_t> next{0};
+        std::vector<std::thread> threads;
+        for (size_t t = 0; t < 4; t++)
+        {
+            threads.emplace_back([&]() {
+                for (size_t i = next++; i < size; i = next++)
+                {
+                    body(i);
+                }
+            });
+        }
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+    }
+
+    // dequantized and transposed weights of independent layers, large enough to split kernels
+    shared_ptr<Function> make_weights_function(size_t num_layers)
+    {
+        const Shape weights_shape{128, 64, 3, 3};
+        vector<uint8_t> weights_values(shape_size(weights_shape));
+        for (size_t i = 0; i < weights_values.size(); i++)
+        {
+            weights_values[i] = static_cast<uint8_t>(i * 7 + i / 13);
+        }
+        auto shift = opset5::Constant::create(element::f32, Shape{}, {128});
+        auto order = opset5::Constant::create(element::i64, Shape{4}, {1, 0, 2, 3});
+        auto like = opset5::Constant::create(element::f16, Shape{}, {0});
+
+        ResultVector results;
+        for (size_t i = 0; i < num_layers; i++)
+        {
+            auto weights =
+                make_shared<opset5::Constant>(element::u8, weights_shape, weights_values);
+            auto convert = make_shared<opset5::Convert>(weights, element::f32);
+            auto subtract = make_shared<opset5::Subtract>(convert, shift);
+            vector<float> scale_values(weights_shape[0], 0.5f + i);
+            auto scale =
+                make_shared<opset5::Constant>(element::f32, Shape{128, 1, 1, 1}, scale_values);
+            auto multiply = make_shared<opset5::Multiply>(subtract, scale);
+            auto transpose = make_shared<opset5::Transpose>(multiply, order);
+            auto concat = make_shared<opset5::Concat>(OutputVector{transpose, transpose}, 1);
+            auto indices = opset5::Constant::create(element::i64, Shape{3}, {2, 0, 2});
+            auto axis = opset5::Constant::create(element::i64, Shape{}, {3});
+            auto gather = make_shared<opset5::Gather>(concat, indices, axis);
+            auto convert_like = make_shared<opset5::ConvertLike>(gather, like);
+            convert_like->set_friendly_name("layer_" + to_string(i));
+            results.push_back(make_shared<opset5::Result>(convert_like));
+        }
+        return make_shared<Function>(results, ParameterVector{});
+    }
+} // namespace
+
+TEST(constant_folding, parallel_folding_matches_sequential)
+{
+    auto expected = make_weights_function(8);
+    pass::Manager sequential_manager;
+    sequential_manager.register_pass<pass::ConstantFolding>();
+    sequential_manager.run_passes(expected);
+
+    auto f = make_weights_function(8);
+    set_parallel_for(thread_parallel_for);
+    pass::set_parallel_constant_folding_enabled(true);
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ConstantFolding>();
+    pass_manager.run_passes(f);
+    pass::set_parallel_constant_folding_enabled(false);
+    set_parallel_for(nullptr);
+
+    ASSERT_EQ(count_ops_of_type<op::Constant>(f), 8);
+    for (size_t i = 0; i < 8; i++)
+    {
+        auto expected_constant = as_type_ptr<op::Constant>(
+            expected->get_results().at(i)->input_value(0).get_node_shared_ptr());
+        auto constant =
+            as_type_ptr<op::Constant>(f->get_results().at(i)->input_value(0).get_node_shared_ptr());
+        ASSERT_TRUE(expected_constant);
+        ASSERT_TRUE(constant);
+        EXPECT_EQ(expected_constant->get_friendly_name(), constant->get_friendly_name());
+        EXPECT_EQ(Shape({64, 256, 3, 3}), constant->get_output_shape(0));
+        EXPECT_EQ(element::f16, constant->get_output_element_type(0));
+        EXPECT_EQ(expected_constant->cast_vector<float>(), constant->cast_vector<float>());
+    }
+}
@@ -0,0 +1,123 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "ngraph/ngraph.hpp"
+#include "ngraph/opsets/opset6.hpp"
+#include "ngraph/parallel_validation.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace
+{
+    void thread_parallel_for(size_t size, const std::function<void(size_t)>& body)
+    {
+        std::atomic<size_t> next{0};
+        std::vector<std::thread> threads;
+        for (size_t t = 0; t < 4; t++)
+        {
+            threads.emplace_back([&]() {
+                for (size_t i = next++; i < size; i = next++)
+                {
+                    body(i);
+                }
+            });
+        }
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+    }
+
+    class ParallelValidation : public ::testing::Test
+    {
+    protected:
+        void SetUp() override
+        {
+            set_parallel_for(thread_parallel_for);
+            set_parallel_validation_enabled(true);
+        }
+        void TearDown() override
+        {
+            set_parallel_validation_enabled(false);
+            set_parallel_for(nullptr);
+        }
+    };
+
+    // independent branches reshaped to the given pattern
+    shared_ptr<Function> make_wide_function(const shared_ptr<opset6::Parameter>& param,
+                                            const Output<Node>& pattern,
+                                            size_t num_branches)
+    {
+        OutputVector branches;
+        for (size_t i = 0; i < num_branches; i++)
+        {
+            auto relu = make_shared<opset6::Relu>(param);
+            auto add = make_shared<opset6::Add>(
+                relu, opset6::Constant::create(element::f32, Shape{1}, {static_cast<float>(i)}));
+            branches.push_back(make_shared<opset6::Reshape>(add, pattern, false));
+        }
+        auto concat = make_shared<opset6::Concat>(branches, 1);
+        return make_shared<Function>(OutputVector{concat}, ParameterVector{param});
+    }
+}
+
+TEST_F(ParallelValidation, infers_same_shapes)
+{
+    auto param = make_shared<opset6::Parameter>(element::f32, PartialShape{1, 8});
+    // the pattern is read through ShapeOf, so validation of every branch evaluates bounds of
+    // the shared subgraph
+    auto f = make_wide_function(param, make_shared<opset6::ShapeOf>(param), 100);
+
+    param->set_partial_shape(PartialShape{2, Dimension::dynamic()});
+    f->validate_nodes_and_infer_types();
+    EXPECT_TRUE(
+        f->get_output_partial_shape(0).same_scheme(PartialShape{2, Dimension::dynamic()}));
+
+    param->set_partial_shape(PartialShape{3, 4});
+    f->validate_nodes_and_infer_types();
+    EXPECT_EQ(Shape({3, 400}), f->get_output_shape(0));
+}
+
+TEST_F(ParallelValidation, reports_first_error)
+{
+    auto param = make_shared<opset6::Parameter>(element::f32, PartialShape{1, 8});
+    auto f = make_wide_function(
+        param, opset6::Constant::create(element::i64, Shape{2}, {1, 8}), 100);
+    // every Reshape fails, the error names the one validated first by the sequential mode
+    param->set_partial_shape(PartialShape{1, 8, 3});
+
+    std::string parallel_error;
+    try
+    {
+        f->validate_nodes_and_infer_types();
+    }
+    catch (const ngraph_error& e)
+    {
+        parallel_error = e.what();
+    }
+
+    set_parallel_validation_enabled(false);
+    param->set_partial_shape(PartialShape{1, 8, 3});
+    std::string sequential_error;
+    try
+    {
+        f->validate_nodes_and_infer_types();
+    }
+    catch (const ngraph_error& e)
+    {
+        sequential_error = e.what();
+    }
+
+    EXPECT_FALSE(sequential_error.empty());
+    EXPECT_EQ(sequential_error, parallel_error);
+}
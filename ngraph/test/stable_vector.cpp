@@ -0,0 +1,180 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
+
+#include "gtest/gtest.h"
+
+#include "ngraph/log.hpp"
+#include "ngraph/ngraph.hpp"
+#include "ngraph/opsets/opset6.hpp"
+#include "ngraph/stable_vector.hpp"
+#include "ngraph/util.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+TEST(stable_vector, elements_are_not_moved)
+{
+    StableVector<string> values;
+    EXPECT_TRUE(values.empty());
+    EXPECT_TRUE(values.begin() == values.end());
+
+    vector<const string*> addresses;
+    for (size_t i = 0; i < 100; i++)
+    {
+        addresses.push_back(&values.emplace_back(to_string(i)));
+    }
+    ASSERT_EQ(100, values.size());
+    for (size_t i = 0; i < values.size(); i++)
+    {
+        EXPECT_EQ(addresses[i], &values[i]);
+        EXPECT_EQ(to_string(i), values.at(i));
+    }
+    EXPECT_EQ("99", values.back());
+
+    size_t i = 0;
+    for (const auto& value : values)
+    {
+        EXPECT_EQ(addresses[i++], &value);
+    }
+    EXPECT_EQ(100, i);
+    EXPECT_THROW(values.at(100), std::out_of_range);
+}
+
+TEST(stable_vector, copy_and_move)
+{
+    StableVector<shared_ptr<int>> values;
+    values.reserve(3);
+    for (int i = 0; i < 5; i++)
+    {
+        values.emplace_back(make_shared<int>(i));
+    }
+
+    auto copy = values;
+    ASSERT_EQ(values.size(), copy.size());
+    for (size_t i = 0; i < values.size(); i++)
+    {
+        EXPECT_EQ(values[i], copy[i]);
+    }
+    EXPECT_EQ(2, values[0].use_count());
+
+    auto moved = std::move(copy);
+    EXPECT_TRUE(copy.empty());
+    ASSERT_EQ(5, moved.size());
+    EXPECT_EQ(2, values[4].use_count());
+
+    moved.clear();
+    EXPECT_TRUE(moved.empty());
+    EXPECT_EQ(1, values[0].use_count());
+}
+
+TEST(stable_vector, throwing_constructor)
+{
+    struct Throwing
+    {
+        Throwing(bool do_throw)
+        {
+            if (do_throw)
+            {
+                throw std::runtime_error("constructor failed");
+            }
+        }
+    };
+
+    StableVector<Throwing> values;
+    EXPECT_THROW(values.emplace_back(true), std::runtime_error);
+    EXPECT_TRUE(values.empty());
+    EXPECT_TRUE(values.begin() == values.end());
+    values.emplace_back(false);
+    EXPECT_THROW(values.emplace_back(true), std::runtime_error);
+    ASSERT_EQ(1, values.size());
+    size_t count = 0;
+    for (auto it = values.begin(); it != values.end(); ++it)
+    {
+        count++;
+    }
+    EXPECT_EQ(1, count);
+}
+
+namespace
+{
+    size_t get_allocated_bytes()
+    {
+#if defined(__GLIBC__)
+#if __GLIBC_PREREQ(2, 33)
+        return mallinfo2().uordblks;
+#else
+        return static_cast<unsigned int>(mallinfo().uordblks);
+#endif
+#else
+        return 0;
+#endif
+    }
+
+    // chains of Add with a Constant followed by Relu, 3 nodes per block
+    shared_ptr<Function> make_chain(size_t num_blocks)
+    {
+        auto param = make_shared<opset6::Parameter>(element::f32, Shape{1, 16});
+        Output<Node> last = param;
+        for (size_t i = 0; i < num_blocks; i++)
+        {
+            auto add = make_shared<opset6::Add>(
+                last, opset6::Constant::create(element::f32, Shape{1}, {1.f}));
+            last = make_shared<opset6::Relu>(add);
+        }
+        return make_shared<Function>(OutputVector{last}, ParameterVector{param});
+    }
+}
+
+TEST(benchmark, node_memory)
+{
+    const size_t num_blocks = 33000;
+    const size_t allocated_before = get_allocated_bytes();
+    stopwatch build_timer;
+    build_timer.start();
+    auto f = make_chain(num_blocks);
+    build_timer.stop();
+    const size_t allocated_after = get_allocated_bytes();
+
+    const size_t num_nodes = 3 * num_blocks + 2;
+    NGRAPH_INFO << "function with " << num_nodes << " nodes built in "
+                << build_timer.get_milliseconds() << "ms";
+    NGRAPH_INFO << "sizeof(Node) " << sizeof(Node) << " bytes";
+    if (allocated_after > allocated_before)
+    {
+        NGRAPH_INFO << "heap per node " << (allocated_after - allocated_before) / num_nodes
+                    << " bytes";
+    }
+
+    stopwatch sort_timer;
+    sort_timer.start();
+    auto ops = f->get_ordered_ops();
+    sort_timer.stop();
+    ASSERT_EQ(num_nodes, ops.size());
+
+    stopwatch traversal_timer;
+    size_t num_inputs = 0;
+    traversal_timer.start();
+    for (const auto& op : ops)
+    {
+        for (size_t i = 0; i < op->get_input_size(); i++)
+        {
+            num_inputs += op->get_input_node_ptr(i)->get_output_size();
+        }
+    }
+    traversal_timer.stop();
+    // Add and Relu of each block and the Result
+    EXPECT_EQ(3 * num_blocks + 1, num_inputs);
+
+    NGRAPH_INFO << "get_ordered_ops  " << sort_timer.get_milliseconds() << "ms";
+    NGRAPH_INFO << "input traversal  " << traversal_timer.get_microseconds() << "us";
+}
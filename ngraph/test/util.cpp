@@ -12,8 +12,10 @@
 #include "ngraph/file_util.hpp"
 #include "ngraph/function.hpp"
 #include "ngraph/graph_util.hpp"
+#include "ngraph/log.hpp"
 #include "ngraph/ngraph.hpp"
 #include "ngraph/op/util/op_annotations.hpp"
+#include "ngraph/opsets/opset3.hpp"
 #include "ngraph/opsets/opset6.hpp"
 #include "ngraph/pass/manager.hpp"
 #include "ngraph/pass/visualize_tree.hpp"
@@ -318,6 +320,180 @@ TEST(graph_util, clone_rt_info)
     }
 }
 
+TEST_F(CloneTest, clone_function_trusted_full)
+{
+    auto cloned_func = clone_function_trusted(*func, node_map);
+    ASSERT_TRUE(CompareNodeVector(func->get_ops(), cloned_func->get_ops(), node_map));
+}
+
+TEST(graph_util, clone_function_trusted)
+{
+    auto data =
+        make_shared<opset6::Parameter>(element::f32, PartialShape{2, Dimension::dynamic(), 6});
+    auto lengths = make_shared<opset6::Parameter>(element::i32, Shape{2});
+    auto split = make_shared<opset6::Split>(
+        data, opset6::Constant::create(element::i64, Shape{}, {-1}), 3);
+    auto concat = make_shared<opset6::Concat>(OutputVector{split->output(2), split->output(0)}, -1);
+    auto reverse = make_shared<opset6::ReverseSequence>(concat, lengths, -3, -2);
+    auto shape_of = make_shared<opset6::ShapeOf>(reverse);
+    auto reshape = make_shared<opset6::Reshape>(
+        reverse,
+        make_shared<opset6::Concat>(
+            OutputVector{opset6::Constant::create(element::i64, Shape{1}, {-1}),
+                         make_shared<opset6::Gather>(
+                             shape_of,
+                             opset6::Constant::create(element::i64, Shape{1}, {2}),
+                             opset6::Constant::create(element::i64, Shape{}, {0}))},
+            0),
+        false);
+    split->get_output_tensor(1).set_names({"split:1"});
+    auto f = make_shared<Function>(OutputVector{reshape, split->output(1)},
+                                   ParameterVector{data, lengths});
+
+    NodeMap node_map;
+    auto cloned_f = clone_function_trusted(*f, node_map);
+    const auto ops = f->get_ordered_ops();
+    const auto cloned_ops = cloned_f->get_ordered_ops();
+    ASSERT_EQ(ops.size(), cloned_ops.size());
+    for (size_t i = 0; i < ops.size(); i++)
+    {
+        const auto& op = ops[i];
+        const auto& cloned_op = cloned_ops[i];
+        ASSERT_EQ(node_map.at(op.get()), cloned_op);
+        ASSERT_EQ(op->get_type_info(), cloned_op->get_type_info());
+        ASSERT_EQ(op->get_output_size(), cloned_op->get_output_size());
+        for (size_t j = 0; j < op->get_output_size(); j++)
+        {
+            EXPECT_EQ(op->get_output_element_type(j), cloned_op->get_output_element_type(j));
+            EXPECT_TRUE(op->get_output_partial_shape(j).same_scheme(
+                cloned_op->get_output_partial_shape(j)));
+            EXPECT_EQ(op->get_output_tensor(j).get_names(),
+                      cloned_op->get_output_tensor(j).get_names());
+        }
+        for (size_t j = 0; j < op->get_input_size(); j++)
+        {
+            EXPECT_EQ(op->input(j).get_is_relevant_to_shapes(),
+                      cloned_op->input(j).get_is_relevant_to_shapes());
+        }
+    }
+
+    auto cloned_concat = as_type_ptr<opset6::Concat>(node_map.at(concat.get()));
+    ASSERT_TRUE(cloned_concat);
+    EXPECT_EQ(2, cloned_concat->get_concatenation_axis());
+    auto cloned_reverse = as_type_ptr<opset6::ReverseSequence>(node_map.at(reverse.get()));
+    ASSERT_TRUE(cloned_reverse);
+    EXPECT_EQ(0, cloned_reverse->get_batch_axis());
+    EXPECT_EQ(1, cloned_reverse->get_sequence_axis());
+
+    // the trusted clone is still a valid function
+    EXPECT_NO_THROW(cloned_f->validate_nodes_and_infer_types());
+    EXPECT_TRUE(cloned_f->get_output_partial_shape(0).same_scheme(f->get_output_partial_shape(0)));
+}
+
+TEST(graph_util, clone_function_trusted_variables)
+{
+    auto init = make_shared<opset3::Parameter>(element::f32, Shape{1, 4});
+    auto read_value = make_shared<opset3::ReadValue>(init, "variable");
+    auto add = make_shared<opset3::Add>(read_value, init);
+    auto assign = make_shared<opset3::Assign>(add, "variable");
+    auto f = make_shared<Function>(
+        ResultVector{make_shared<opset3::Result>(add)}, SinkVector{assign}, ParameterVector{init});
+
+    NodeMap node_map;
+    auto cloned_f = clone_function_trusted(*f, node_map);
+    auto cloned_read_value = as_type_ptr<opset3::ReadValue>(node_map.at(read_value.get()));
+    auto cloned_assign = as_type_ptr<opset3::Assign>(node_map.at(assign.get()));
+    ASSERT_TRUE(cloned_read_value && cloned_assign);
+    ASSERT_TRUE(cloned_read_value->get_variable());
+    EXPECT_EQ(cloned_read_value->get_variable(), cloned_assign->get_variable());
+    EXPECT_NE(read_value->get_variable(), cloned_read_value->get_variable());
+    EXPECT_EQ(1, cloned_f->get_sinks().size());
+}
+
+TEST(graph_util, clone_function_trusted_topk)
+{
+    auto data = make_shared<opset3::Parameter>(element::f32, Shape{2, 8, 4});
+    auto k = opset3::Constant::create(element::i64, Shape{}, {3});
+    auto topk_v1 = make_shared<op::v1::TopK>(data, k, -2, "max", "value");
+    auto topk_v3 = make_shared<opset3::TopK>(data, k, -1, "min", "index");
+    auto f = make_shared<Function>(OutputVector{topk_v1->output(0), topk_v3->output(1)},
+                                   ParameterVector{data});
+
+    NodeMap node_map;
+    auto cloned_f = clone_function_trusted(*f, node_map);
+    auto cloned_topk_v1 = as_type_ptr<op::v1::TopK>(node_map.at(topk_v1.get()));
+    auto cloned_topk_v3 = as_type_ptr<opset3::TopK>(node_map.at(topk_v3.get()));
+    ASSERT_TRUE(cloned_topk_v1 && cloned_topk_v3);
+    EXPECT_EQ(1, cloned_topk_v1->get_axis());
+    EXPECT_EQ(2, cloned_topk_v3->get_axis());
+}
+
+namespace
+{
+    // residual blocks of about 14 nodes each
+    shared_ptr<Function> make_large_function(size_t num_blocks)
+    {
+        const size_t channels = 8;
+        auto param = make_shared<opset6::Parameter>(element::f32, Shape{1, channels, 8, 8});
+        Output<Node> block_input = param;
+        for (size_t i = 0; i < num_blocks; i++)
+        {
+            auto conv = make_shared<opset6::Convolution>(
+                block_input,
+                opset6::Constant::create(element::f32, Shape{channels, channels, 3, 3}, {0.1f}),
+                Strides{1, 1},
+                CoordinateDiff{1, 1},
+                CoordinateDiff{1, 1},
+                Strides{1, 1});
+            auto bias = make_shared<opset6::Add>(
+                conv, opset6::Constant::create(element::f32, Shape{1, channels, 1, 1}, {0.f}));
+            auto relu = make_shared<opset6::Relu>(bias);
+            auto flatten = make_shared<opset6::Reshape>(
+                relu, opset6::Constant::create(element::i64, Shape{3}, vector<size_t>{1, channels, 64}), false);
+            auto transpose = make_shared<opset6::Transpose>(
+                flatten, opset6::Constant::create(element::i64, Shape{3}, {0, 2, 1}));
+            auto transpose_back = make_shared<opset6::Transpose>(
+                transpose, opset6::Constant::create(element::i64, Shape{3}, {0, 2, 1}));
+            auto unflatten = make_shared<opset6::Reshape>(
+                transpose_back,
+                opset6::Constant::create(element::i64, Shape{4}, vector<size_t>{1, channels, 8, 8}),
+                false);
+            block_input = make_shared<opset6::Add>(unflatten, block_input);
+        }
+        auto result = make_shared<opset6::Result>(block_input);
+        return make_shared<Function>(ResultVector{result}, ParameterVector{param});
+    }
+}
+
+TEST(benchmark, clone_function)
+{
+    auto f = make_large_function(1500);
+    NGRAPH_INFO << "function with " << f->get_ops().size() << " nodes";
+
+    // warm up the allocator before taking the measurements
+    clone_function(*f);
+
+    const size_t iterations = 5;
+    stopwatch validated_timer;
+    for (size_t i = 0; i < iterations; i++)
+    {
+        validated_timer.start();
+        auto cloned_f = clone_function(*f);
+        validated_timer.stop();
+    }
+    stopwatch trusted_timer;
+    for (size_t i = 0; i < iterations; i++)
+    {
+        trusted_timer.start();
+        auto cloned_f = clone_function_trusted(*f);
+        trusted_timer.stop();
+    }
+    NGRAPH_INFO << "clone_function         "
+                << validated_timer.get_total_milliseconds() / iterations << "ms";
+    NGRAPH_INFO << "clone_function_trusted "
+                << trusted_timer.get_total_milliseconds() / iterations << "ms";
+}
+
 TEST(util, round_up)
 {
     EXPECT_EQ(0, round_up(0, 4));
@@ -41,11 +41,52 @@ namespace openvino
             void taskBegin(domain_t d, handle_t t);
             void taskEnd(domain_t d);
             void threadName(const char* name);
+            void traceStart(const char* fileName);
+            void traceStop();
+            bool traceDump(const char* fileName);
         }
 /**
  * @endcond
  */
 
+        /**
+         * @fn void traceStart(const std::string &fileName)
+         * @ingroup ie_dev_profiling
+         * @brief Enables the built-in Chrome trace collector.
+         * @details Annotated tasks are recorded into per-thread ring buffers and written
+         *          to @p fileName in Chrome trace JSON format on process exit.
+         *          The collector can also be enabled using OPENVINO_CHROME_TRACE environment variable.
+         *          Does nothing if OpenVINO is built without ENABLE_PROFILING_CHROME_TRACE option.
+         * @param fileName [in] The trace file name. If empty, the trace is collected but written only by traceDump().
+         */
+        inline void traceStart(const std::string &fileName)
+        {
+            internal::traceStart(fileName.c_str());
+        }
+
+        /**
+         * @fn void traceStop()
+         * @ingroup ie_dev_profiling
+         * @brief Stops recording of new events. Already collected events are kept.
+         */
+        inline void traceStop()
+        {
+            internal::traceStop();
+        }
+
+        /**
+         * @fn bool traceDump(const std::string &fileName)
+         * @ingroup ie_dev_profiling
+         * @brief Writes the events collected so far to @p fileName in Chrome trace JSON format.
+         * @details Events of tasks which are still running are not included.
+         * @param fileName [in] The trace file name
+         * @return false if the collector is not available or the file can not be written
+         */
+        inline bool traceDump(const std::string &fileName)
+        {
+            return internal::traceDump(fileName.c_str());
+        }
+
         /**
          * @fn void threadName(const char* name)
          * @ingroup ie_dev_profiling
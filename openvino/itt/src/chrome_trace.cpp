@@ -0,0 +1,271 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#ifdef ENABLE_PROFILING_CHROME_TRACE
+
+#include "chrome_trace.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+
+#ifdef _WIN32
+#include <process.h>
+#define OV_GETPID _getpid
+#else
+#include <unistd.h>
+#define OV_GETPID getpid
+#endif
+
+namespace openvino {
+namespace itt {
+namespace chrome {
+
+namespace {
+
+constexpr size_t defaultCapacity = 1 << 14;
+
+size_t roundUpToPowerOfTwo(size_t value) {
+    size_t result = 1;
+    while (result < value)
+        result <<= 1;
+    return result;
+}
+
+void writeEscaped(std::ostream& out, const char* str) {
+    for (; *str; ++str) {
+        const char c = *str;
+        switch (c) {
+        case '"':  out << "\\\""; break;
+        case '\\': out << "\\\\"; break;
+        case '\n': out << "\\n"; break;
+        case '\t': out << "\\t"; break;
+        default:
+            if (static_cast<unsigned char>(c) < 0x20) {
+                char buf[8];
+                std::snprintf(buf, sizeof(buf), "\\u%04x", c);
+                out << buf;
+            } else {
+                out << c;
+            }
+        }
+    }
+}
+
+void writeMicroseconds(std::ostream& out, uint64_t ns) {
+    out << ns / 1000 << '.' << std::setw(3) << std::setfill('0') << ns % 1000;
+}
+
+}  // namespace
+
+ThreadBuffer::ThreadBuffer(uint32_t tid, size_t capacity)
+    : _tid(tid)
+    , _mask(capacity - 1)
+    , _slots(new Slot[capacity]) {
+}
+
+void ThreadBuffer::push(const Event& event) noexcept {
+    const auto head = _head.load(std::memory_order_relaxed);
+    auto& slot = _slots[head & _mask];
+    slot.sequence.store(0, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    slot.domain.store(event.domain, std::memory_order_relaxed);
+    slot.name.store(event.name, std::memory_order_relaxed);
+    slot.begin.store(event.begin, std::memory_order_relaxed);
+    slot.duration.store(event.duration, std::memory_order_relaxed);
+    slot.sequence.store(head + 1, std::memory_order_release);
+    _head.store(head + 1, std::memory_order_release);
+}
+
+std::vector<Event> ThreadBuffer::snapshot() const {
+    const auto head = _head.load(std::memory_order_acquire);
+    const auto capacity = static_cast<uint64_t>(_mask + 1);
+    const auto count = head < capacity ? head : capacity;
+    std::vector<Event> events;
+    events.reserve(static_cast<size_t>(count));
+    for (auto i = head - count; i != head; ++i) {
+        const auto& slot = _slots[i & _mask];
+        const auto sequence = slot.sequence.load(std::memory_order_acquire);
+        const Event event {slot.domain.load(std::memory_order_relaxed),
+                           slot.name.load(std::memory_order_relaxed),
+                           slot.begin.load(std::memory_order_relaxed),
+                           slot.duration.load(std::memory_order_relaxed)};
+        std::atomic_thread_fence(std::memory_order_acquire);
+        // The slot is skipped if the owner has overwritten it while it was copied
+        if (sequence == i + 1 && slot.sequence.load(std::memory_order_relaxed) == sequence)
+            events.push_back(event);
+    }
+    return events;
+}
+
+Collector& Collector::instance() {
+    // Never destroyed, since worker threads may still run annotated code during static deinitialization
+    static Collector* collector = new Collector();
+    return *collector;
+}
+
+void Collector::dumpAtExit() {
+    auto& collector = instance();
+    collector.stop();
+    std::string fileName;
+    {
+        std::lock_guard<std::mutex> lock(collector._mutex);
+        fileName = collector._fileName;
+    }
+    if (!fileName.empty())
+        collector.dump(fileName);
+}
+
+Collector::Collector()
+    : _origin(std::chrono::steady_clock::now())
+    , _capacity(defaultCapacity) {
+    if (const char* capacity = std::getenv("OPENVINO_CHROME_TRACE_EVENTS")) {
+        const auto value = std::strtoul(capacity, nullptr, 10);
+        if (value > 1)
+            _capacity = roundUpToPowerOfTwo(value);
+    }
+    if (const char* fileName = std::getenv("OPENVINO_CHROME_TRACE")) {
+        start(fileName);
+    }
+    std::atexit(&Collector::dumpAtExit);
+}
+
+void Collector::start(const std::string& fileName) {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (!fileName.empty())
+            _fileName = fileName;
+    }
+    _active.store(true, std::memory_order_relaxed);
+    _enabled.store(true, std::memory_order_release);
+}
+
+void Collector::stop() {
+    _enabled.store(false, std::memory_order_release);
+}
+
+uint64_t Collector::now() const noexcept {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - _origin).count());
+}
+
+Collector::ThreadState& Collector::threadState() {
+    thread_local ThreadState state;
+    return state;
+}
+
+ThreadBuffer& Collector::threadBuffer(ThreadState& state) {
+    static std::atomic<uint32_t> nextTid {1};
+    if (!state.buffer) {
+        auto buffer = std::make_shared<ThreadBuffer>(nextTid++, _capacity);
+        std::lock_guard<std::mutex> lock(_mutex);
+        buffer->name = state.name;
+        _buffers.push_back(buffer);
+        state.buffer = std::move(buffer);
+    }
+    return *state.buffer;
+}
+
+void Collector::taskBegin(const char* domain, const char* name) noexcept {
+    if (!_active.load(std::memory_order_relaxed))
+        return;
+    auto& state = threadState();
+    ++state.depth;
+    if (_enabled.load(std::memory_order_relaxed)) {
+        // The traced code must not fail because of the trace, so the task isn't recorded if there is no memory
+        try {
+            state.openTasks.push_back({state.depth, domain, name, now()});
+        } catch (...) {
+        }
+    }
+}
+
+void Collector::taskEnd() noexcept {
+    if (!_active.load(std::memory_order_relaxed))
+        return;
+    auto& state = threadState();
+    // Tasks begun before the collector has been started have no records
+    if (!state.openTasks.empty() && state.openTasks.back().depth == state.depth) {
+        const auto& task = state.openTasks.back();
+        if (_enabled.load(std::memory_order_relaxed)) {
+            try {
+                threadBuffer(state).push({task.domain, task.name, task.begin, now() - task.begin});
+            } catch (...) {
+            }
+        }
+        state.openTasks.pop_back();
+    }
+    --state.depth;
+}
+
+void Collector::threadName(const char* name) {
+    auto& state = threadState();
+    state.name = name;
+    if (state.buffer) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        state.buffer->name = name;
+    }
+}
+
+bool Collector::dump(const std::string& fileName) {
+    std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        buffers = _buffers;
+    }
+
+    std::ofstream out(fileName);
+    if (!out.is_open())
+        return false;
+
+    const auto pid = OV_GETPID();
+    bool first = true;
+    auto separator = [&] {
+        out << (first ? "\n" : ",\n");
+        first = false;
+    };
+
+    out << "{\"traceEvents\":[";
+    for (auto&& buffer : buffers) {
+        std::string name;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            name = buffer->name;
+        }
+        if (!name.empty()) {
+            separator();
+            out << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":" << pid
+                << ",\"tid\":" << buffer->tid() << ",\"args\":{\"name\":\"";
+            writeEscaped(out, name.c_str());
+            out << "\"}}";
+        }
+
+        auto events = buffer->snapshot();
+        std::sort(events.begin(), events.end(), [](const Event& lhs, const Event& rhs) {
+            return lhs.begin < rhs.begin;
+        });
+        for (auto&& event : events) {
+            separator();
+            out << "{\"name\":\"";
+            writeEscaped(out, event.name);
+            out << "\",\"cat\":\"";
+            writeEscaped(out, event.domain);
+            out << "\",\"ph\":\"X\",\"pid\":" << pid << ",\"tid\":" << buffer->tid() << ",\"ts\":";
+            writeMicroseconds(out, event.begin);
+            out << ",\"dur\":";
+            writeMicroseconds(out, event.duration);
+            out << "}";
+        }
+    }
+    out << "\n],\"displayTimeUnit\":\"ms\"}\n";
+    return out.good();
+}
+
+}  // namespace chrome
+}  // namespace itt
+}  // namespace openvino
+
+#endif  // ENABLE_PROFILING_CHROME_TRACE
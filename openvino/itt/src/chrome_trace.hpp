@@ -0,0 +1,120 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief Built-in collector which stores ITT annotations in Chrome trace format
+ * @file chrome_trace.hpp
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace openvino {
+namespace itt {
+namespace chrome {
+
+/**
+ * @brief Completed task record. Names point to interned strings owned by itt handles.
+ */
+struct Event {
+    const char* domain;
+    const char* name;
+    uint64_t    begin;      // ns since collector start
+    uint64_t    duration;   // ns
+};
+
+/**
+ * @brief Single producer ring buffer which belongs to one thread.
+ * @details Only the owner thread writes events, readers copy the last written events
+ *          without blocking the owner. Each slot is guarded by a sequence number,
+ *          so the reader skips the slots overwritten while they are copied.
+ */
+class ThreadBuffer {
+public:
+    ThreadBuffer(uint32_t tid, size_t capacity);
+
+    void push(const Event& event) noexcept;
+    std::vector<Event> snapshot() const;
+
+    uint32_t tid() const noexcept { return _tid; }
+
+    // Guarded by Collector mutex
+    std::string name;
+
+private:
+    struct Slot {
+        std::atomic<uint64_t>    sequence {0};  // Number of the stored event + 1, 0 while the slot is written
+        std::atomic<const char*> domain {nullptr};
+        std::atomic<const char*> name {nullptr};
+        std::atomic<uint64_t>    begin {0};
+        std::atomic<uint64_t>    duration {0};
+    };
+
+    const uint32_t _tid;
+    const size_t _mask;
+    std::unique_ptr<Slot[]> _slots;
+    std::atomic<uint64_t> _head {0};
+};
+
+/**
+ * @brief Process wide events collector
+ */
+class Collector {
+public:
+    static Collector& instance();
+
+    void start(const std::string& fileName);
+    void stop();
+    bool dump(const std::string& fileName);
+
+    void taskBegin(const char* domain, const char* name) noexcept;
+    void taskEnd() noexcept;
+    void threadName(const char* name);
+
+private:
+    /**
+     * @brief Per thread state, accessed by the owner thread only
+     */
+    struct ThreadState {
+        struct OpenTask {
+            int         depth;
+            const char* domain;
+            const char* name;
+            uint64_t    begin;
+        };
+
+        std::vector<OpenTask> openTasks;
+        int depth = 0;
+        std::string name;                      // Given to the buffer once it is allocated
+        std::shared_ptr<ThreadBuffer> buffer;  // Allocated on the first recorded event
+    };
+
+    Collector();
+
+    static void dumpAtExit();
+
+    static ThreadState& threadState();
+    ThreadBuffer& threadBuffer(ThreadState& state);
+    uint64_t now() const noexcept;
+
+    std::atomic<bool> _active {false};   // Set once the collector was started, tasks nesting is tracked since then
+    std::atomic<bool> _enabled {false};  // Events are recorded
+    const std::chrono::steady_clock::time_point _origin;
+    size_t _capacity;
+
+    std::mutex _mutex;
+    std::string _fileName;
+    std::vector<std::shared_ptr<ThreadBuffer>> _buffers;
+};
+
+}  // namespace chrome
+}  // namespace itt
+}  // namespace openvino
@@ -9,6 +9,13 @@
 #include <ittnotify.h>
 #endif
 
+#ifdef ENABLE_PROFILING_CHROME_TRACE
+#include "chrome_trace.hpp"
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#endif
+
 namespace openvino {
 namespace itt {
 namespace internal {
@@ -23,6 +30,115 @@ static size_t callStackDepth() {
 
 static thread_local uint32_t call_stack_depth = 0;
 
+#endif  // ENABLE_PROFILING_ITT
+
+#ifdef ENABLE_PROFILING_CHROME_TRACE
+
+/**
+ * @brief Domains and handles keep the interned annotation name for the built-in collector
+ *        and the ITT object if ITT is enabled as well.
+ */
+struct Annotation {
+    std::string name;
+    void* itt;
+};
+
+class AnnotationRegistry {
+public:
+    Annotation* get(char const* name, void* (*createITT)(char const*)) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto& annotation = _annotations[name];
+        if (!annotation) {
+            annotation.reset(new Annotation{name, createITT(name)});
+        }
+        return annotation.get();
+    }
+
+private:
+    std::mutex _mutex;
+    std::unordered_map<std::string, std::unique_ptr<Annotation>> _annotations;
+};
+
+static AnnotationRegistry& domains() {
+    static auto registry = new AnnotationRegistry();
+    return *registry;
+}
+
+static AnnotationRegistry& handles() {
+    static auto registry = new AnnotationRegistry();
+    return *registry;
+}
+
+#ifdef ENABLE_PROFILING_ITT
+static void* createITTDomain(char const* name) {
+    return __itt_domain_create(name);
+}
+
+static void* createITTHandle(char const* name) {
+    return __itt_string_handle_create(name);
+}
+#else
+static void* createITTDomain(char const*) {
+    return nullptr;
+}
+
+static void* createITTHandle(char const*) {
+    return nullptr;
+}
+#endif
+
+domain_t domain(char const* name) {
+    return reinterpret_cast<domain_t>(domains().get(name, createITTDomain));
+}
+
+handle_t handle(char const* name) {
+    return reinterpret_cast<handle_t>(handles().get(name, createITTHandle));
+}
+
+void taskBegin(domain_t d, handle_t t) {
+    auto domainAnnotation = reinterpret_cast<Annotation*>(d);
+    auto taskAnnotation = reinterpret_cast<Annotation*>(t);
+#ifdef ENABLE_PROFILING_ITT
+    if (!callStackDepth() || call_stack_depth++ < callStackDepth())
+        __itt_task_begin(reinterpret_cast<__itt_domain*>(domainAnnotation->itt),
+                        __itt_null,
+                        __itt_null,
+                        reinterpret_cast<__itt_string_handle*>(taskAnnotation->itt));
+#endif
+    chrome::Collector::instance().taskBegin(domainAnnotation->name.c_str(), taskAnnotation->name.c_str());
+}
+
+void taskEnd(domain_t d) {
+#ifdef ENABLE_PROFILING_ITT
+    if (!callStackDepth() || --call_stack_depth < callStackDepth())
+        __itt_task_end(reinterpret_cast<__itt_domain*>(reinterpret_cast<Annotation*>(d)->itt));
+#else
+    (void)d;
+#endif
+    chrome::Collector::instance().taskEnd();
+}
+
+void threadName(const char* name) {
+#ifdef ENABLE_PROFILING_ITT
+    __itt_thread_set_name(name);
+#endif
+    chrome::Collector::instance().threadName(name);
+}
+
+void traceStart(const char* fileName) {
+    chrome::Collector::instance().start(fileName);
+}
+
+void traceStop() {
+    chrome::Collector::instance().stop();
+}
+
+bool traceDump(const char* fileName) {
+    return chrome::Collector::instance().dump(fileName);
+}
+
+#elif defined(ENABLE_PROFILING_ITT)
+
 domain_t domain(char const* name) {
     return reinterpret_cast<domain_t>(__itt_domain_create(name));
 }
@@ -48,6 +164,12 @@ void threadName(const char* name) {
     __itt_thread_set_name(name);
 }
 
+void traceStart(const char *) { }
+
+void traceStop() { }
+
+bool traceDump(const char *) { return false; }
+
 #else
 
 domain_t domain(char const *) { return nullptr; }
@@ -60,7 +182,13 @@ void taskEnd(domain_t) { }
 
 void threadName(const char *) { }
 
-#endif  // ENABLE_PROFILING_ITT
+void traceStart(const char *) { }
+
+void traceStop() { }
+
+bool traceDump(const char *) { return false; }
+
+#endif  // ENABLE_PROFILING_CHROME_TRACE
 
 }  // namespace internal
 }  // namespace itt